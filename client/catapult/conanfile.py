@@ -14,6 +14,7 @@ class CatapultConan(ConanFile):
 		self.requires("cppzmq/4.10.0@nemtech/stable", run=True)
 		self.requires("mongo-cxx-driver/3.9.0@nemtech/stable", run=True)
 		self.requires("rocksdb/8.9.1@nemtech/stable", run=True)
+		self.requires("zstd/1.5.5", run=True)
 
 	def build_requirements(self):
 		# pylint: disable=not-callable
@@ -71,6 +72,7 @@ class CatapultConan(ConanFile):
 		self.options["mongo-cxx-driver*"].shared = True
 		self.options["rocksdb*"].shared = "Windows" != self.settings.os  # pylint: disable=no-member
 		self.options["zeromq*"].shared = True
+		self.options["zstd*"].shared = True
 
 		# test dependencies
 		self.options["benchmark*"].shared = False
@@ -25,6 +25,7 @@
 #include "src/FileTransactionStatusStorage.h"
 #include "src/FileUtChangeStorage.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/extensions/ConfigurationUtils.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/FileQueue.h"
 
@@ -33,22 +34,25 @@ namespace catapult { namespace filespooling {
 	namespace {
 		class FileQueueFactory {
 		public:
-			explicit FileQueueFactory(const std::string& dataDirectory)
+			FileQueueFactory(const std::string& dataDirectory, io::FileQueueStorageMode storageMode)
 					: m_dataDirectory(config::CatapultDataDirectoryPreparer::Prepare(dataDirectory))
+					, m_storageMode(storageMode)
 			{}
 
 		public:
 			std::unique_ptr<io::FileQueueWriter> create(const std::string& queueName) const {
-				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str());
+				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str(), "index.dat", m_storageMode);
 			}
 
 		private:
 			config::CatapultDataDirectory m_dataDirectory;
+			io::FileQueueStorageMode m_storageMode;
 		};
 
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
 			// register subscribers
-			FileQueueFactory factory(bootstrapper.config().User.DataDirectory);
+			const auto& config = bootstrapper.config();
+			FileQueueFactory factory(config.User.DataDirectory, extensions::GetSpoolStorageMode(config.Node));
 			auto& subscriptionManager = bootstrapper.subscriptionManager();
 			subscriptionManager.addBlockChangeSubscriber(CreateFileBlockChangeStorage(factory.create("block_change")));
 			subscriptionManager.addUtChangeSubscriber(CreateFileUtChangeStorage(factory.create("unconfirmed_transactions_change")));
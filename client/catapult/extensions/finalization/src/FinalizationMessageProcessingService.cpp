@@ -22,10 +22,12 @@
 #include "FinalizationMessageProcessingService.h"
 #include "FinalizationBootstrapperService.h"
 #include "finalization/src/FinalizationConfiguration.h"
+#include "finalization/src/chain/MessageSignatureVerifier.h"
 #include "finalization/src/chain/MultiRoundMessageAggregator.h"
 #include "finalization/src/ionet/FinalizationMessagePacketUtils.h"
 #include "finalization/src/model/FinalizationRoundRange.h"
 #include "catapult/consumers/RecentHashCache.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/extensions/DispatcherUtils.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
@@ -48,6 +50,33 @@ namespace catapult { namespace finalization {
 			return model::FinalizationRoundRange(view.minFinalizationRound(), view.maxFinalizationRound());
 		}
 
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				crypto::SecureRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		void AddMessages(
+				chain::MultiRoundMessageAggregator& messageAggregator,
+				const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages,
+				const std::vector<bool>& signatureResults) {
+			// signatures have already been verified, so only a single lock is needed to add all valid messages
+			auto modifier = messageAggregator.modifier();
+			for (auto i = 0u; i < messages.size(); ++i) {
+				const auto& pMessage = messages[i];
+				if (!signatureResults[i]) {
+					CATAPULT_LOG(warning) << "finalization message " << model::CalculateMessageHash(*pMessage) << " has invalid signature";
+					continue;
+				}
+
+				auto addResult = modifier.add(pMessage, model::MessageSignatureVerificationMode::Disabled);
+				if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+					CATAPULT_LOG(warning)
+							<< "finalization message " << model::CalculateMessageHash(*pMessage) << " rejected due to " << addResult;
+				}
+			}
+		}
+
 		class FinalizationMessageProcessingServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit FinalizationMessageProcessingServiceRegistrar(const FinalizationConfiguration& config) : m_config(config)
@@ -72,10 +101,12 @@ namespace catapult { namespace finalization {
 						extensions::CreateHashCheckOptions(m_config.ShortLivedCacheMessageDuration, state.config().Node));
 
 				auto messagesSink = CreateNewMessagesSink(locator);
+				auto randomFiller = CreateRandomFiller();
 				auto& hooks = GetFinalizationServerHooks(locator);
-				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink](
+				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink, randomFiller](
 						auto&& messages) {
 					auto newMessages = ionet::FinalizationMessages();
+					auto pMessagesToAdd = std::make_shared<std::vector<std::shared_ptr<model::FinalizationMessage>>>();
 					auto extractedMessages = model::FinalizationMessageRange::ExtractEntitiesFromRange(std::move(messages.Range));
 					CATAPULT_LOG(trace) << "received " << extractedMessages.size() << " messages from peer " << messages.SourceIdentity;
 
@@ -94,16 +125,22 @@ namespace catapult { namespace finalization {
 						if (!pRecentHashCache->add(messageHash))
 							continue;
 
-						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
-							auto addResult = messageAggregator.modifier().add(pMessage);
-							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
-								CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
-						});
+						pMessagesToAdd->push_back(pMessage);
 						newMessages.push_back(pMessage);
 					}
 
-					if (!newMessages.empty())
-						messagesSink(newMessages);
+					if (newMessages.empty())
+						return;
+
+					// verify all signatures in parallel before acquiring the aggregator lock
+					auto messagesToVerify = newMessages;
+					chain::VerifyMessageSignatures(messageProcessingPool, randomFiller, std::move(messagesToVerify)).then([
+							&messageAggregator,
+							pMessagesToAdd](auto&& signatureResultsFuture) {
+						AddMessages(messageAggregator, *pMessagesToAdd, signatureResultsFuture.get());
+					});
+
+					messagesSink(newMessages);
 				});
 			}
 
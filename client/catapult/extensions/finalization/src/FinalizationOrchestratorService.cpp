@@ -29,6 +29,7 @@
 #include "finalization/src/io/ProofStorageCache.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "catapult/crypto_voting/BmPrivateKeyTreePrefetcher.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
@@ -72,6 +73,7 @@ namespace catapult { namespace finalization {
 					, m_blockStorage(state.storage())
 					, m_dataDirectory(state.config().User.DataDirectory)
 					, m_votingStatusFile(m_dataDirectory.file("voting_status.dat"))
+					, m_pVotingPrivateKeyTreePrefetcher(CreateVotingPrivateKeyTreePrefetcher(state.config().User))
 					, m_orchestrator(
 							config.EnableRevoteOnBoot ? LoadVotingStatusFromStorage(m_proofStorage) : m_votingStatusFile.load(),
 							[stepDuration = config.StepDuration, &messageAggregator = m_messageAggregator](auto point, auto time) {
@@ -95,11 +97,20 @@ namespace catapult { namespace finalization {
 										io::FilePrevoteChainStorage prevoteChainStorage(dataDirectory);
 										prevoteChainStorage.save(blockStorageView, prevoteChainDescriptor);
 									},
-									CreateVotingPrivateKeyTree(state.config().User)))
+									CreateVotingPrivateKeyTree(m_pVotingPrivateKeyTreePrefetcher)))
 					, m_finalizer(CreateFinalizer(m_messageAggregator, m_proofStorage))
 			{}
 
 		public:
+			size_t numReadyVotingKeys() const {
+				return m_pVotingPrivateKeyTreePrefetcher->numReadyKeys();
+			}
+
+		public:
+			void prefetchVotingKeys() {
+				m_pVotingPrivateKeyTreePrefetcher->prefetch();
+			}
+
 			void poll(Timestamp time) {
 				auto orchestratorRound = m_orchestrator.votingStatus().Round;
 
@@ -166,9 +177,17 @@ namespace catapult { namespace finalization {
 				return { { storageRound.Epoch, storageRound.Point + FinalizationPoint(1) } };
 			}
 
-			static crypto::AggregateBmPrivateKeyTree CreateVotingPrivateKeyTree(const config::UserConfiguration& userConfig) {
+			static std::shared_ptr<crypto::BmPrivateKeyTreePrefetcher> CreateVotingPrivateKeyTreePrefetcher(
+					const config::UserConfiguration& userConfig) {
 				auto factory = CreateBmPrivateKeyTreeFactory(config::CatapultDirectory(userConfig.VotingKeysDirectory));
-				return crypto::AggregateBmPrivateKeyTree(factory);
+				return std::make_shared<crypto::BmPrivateKeyTreePrefetcher>(factory);
+			}
+
+			static crypto::AggregateBmPrivateKeyTree CreateVotingPrivateKeyTree(
+					const std::shared_ptr<crypto::BmPrivateKeyTreePrefetcher>& pPrefetcher) {
+				return crypto::AggregateBmPrivateKeyTree([pPrefetcher]() {
+					return pPrefetcher->next();
+				});
 			}
 
 			static std::string GetVotingPrivateKeyTreeFilename(uint64_t treeSequenceId) {
@@ -180,17 +199,24 @@ namespace catapult { namespace finalization {
 			static supplier<std::unique_ptr<crypto::BmPrivateKeyTree>> CreateBmPrivateKeyTreeFactory(
 					const config::CatapultDirectory& directory) {
 				auto treeSequenceId = 1u;
+				std::shared_ptr<io::FileStream> pPreviousKeyTreeStream;
 				std::shared_ptr<io::FileStream> pKeyTreeStream;
-				return [treeSequenceId, pKeyTreeStream, directory]() mutable {
-					auto keyTreeFilename = directory.file(GetVotingPrivateKeyTreeFilename(treeSequenceId++));
+				return [treeSequenceId, pPreviousKeyTreeStream, pKeyTreeStream, directory]() mutable {
+					auto keyTreeFilename = directory.file(GetVotingPrivateKeyTreeFilename(treeSequenceId));
 					CATAPULT_LOG(debug) << "loading voting private key tree from " << keyTreeFilename;
 
+					// sequence id is only advanced after a successful load so that a tree file added later is still loaded
+					// (either by the prefetch task or by the voting path, which retries the load when no tree is available)
 					if (!std::filesystem::exists(keyTreeFilename)) {
-						CATAPULT_LOG(error) << "could not load voting private key tree from " << keyTreeFilename;
+						CATAPULT_LOG(warning) << "could not load voting private key tree from " << keyTreeFilename;
 						return std::unique_ptr<crypto::BmPrivateKeyTree>();
 					}
 
+					++treeSequenceId;
+
+					// trees are prefetched, so the stream backing the active tree needs to outlive the load of the next tree
 					auto keyTreeFile = io::RawFile(keyTreeFilename, io::OpenMode::Read_Append);
+					pPreviousKeyTreeStream = std::move(pKeyTreeStream);
 					pKeyTreeStream = std::make_shared<io::FileStream>(std::move(keyTreeFile));
 
 					auto tree = crypto::BmPrivateKeyTree::FromStream(*pKeyTreeStream);
@@ -207,6 +233,7 @@ namespace catapult { namespace finalization {
 
 			config::CatapultDirectory m_dataDirectory;
 			VotingStatusFile m_votingStatusFile;
+			std::shared_ptr<crypto::BmPrivateKeyTreePrefetcher> m_pVotingPrivateKeyTreePrefetcher;
 			chain::FinalizationOrchestrator m_orchestrator;
 			action m_finalizer;
 		};
@@ -225,6 +252,13 @@ namespace catapult { namespace finalization {
 			return task;
 		}
 
+		thread::Task CreateVotingKeyPrefetchTask(BootstrapperFacade& facade) {
+			return thread::CreateNamedTask("voting key prefetch task", [&facade]() {
+				facade.prefetchVotingKeys();
+				return thread::make_ready_future(thread::TaskResult::Continue);
+			});
+		}
+
 		class FinalizationOrchestratorServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit FinalizationOrchestratorServiceRegistrar(const FinalizationConfiguration& config) : m_config(config)
@@ -235,8 +269,10 @@ namespace catapult { namespace finalization {
 				return { "FinalizationOrchestrator", extensions::ServiceRegistrarPhase::Post_Extended_Range_Consumers };
 			}
 
-			void registerServiceCounters(extensions::ServiceLocator&) override {
-				// no counters
+			void registerServiceCounters(extensions::ServiceLocator& locator) override {
+				locator.registerServiceCounter<BootstrapperFacade>(Orchestrator_Service_Name, "VOTING KEYS", [](const auto& facade) {
+					return facade.numReadyVotingKeys();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -246,6 +282,7 @@ namespace catapult { namespace finalization {
 
 				// add task
 				state.tasks().push_back(CreateFinalizationTask(*pOrchestrator, state.timeSupplier()));
+				state.tasks().push_back(CreateVotingKeyPrefetchTask(*pOrchestrator));
 			}
 
 		private:
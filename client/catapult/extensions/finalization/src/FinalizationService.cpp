@@ -29,6 +29,7 @@
 #include "finalization/src/chain/FinalizationProofVerifier.h"
 #include "finalization/src/chain/MultiRoundMessageAggregator.h"
 #include "catapult/config/CatapultKeys.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/extensions/NetworkUtils.h"
 #include "catapult/extensions/PeersConnectionTasks.h"
 #include "catapult/extensions/ServiceLocator.h"
@@ -98,19 +99,27 @@ namespace catapult { namespace finalization {
 			return task;
 		}
 
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				crypto::SecureRandomGenerator().fill(pOut, count);
+			};
+		}
+
 		thread::Task CreatePullProofTask(
 				const FinalizationConfiguration& config,
 				extensions::ServiceLocator& locator,
 				const extensions::ServiceState& state,
-				net::PacketWriters& packetWriters) {
+				net::PacketWriters& packetWriters,
+				thread::IoThreadPool& proofVerificationPool) {
 			FinalizationContextFactory finalizationContextFactory(config, state);
 			auto finalizationProofSynchronizer = chain::CreateFinalizationProofSynchronizer(
 					state.config().Blockchain.VotingSetGrouping,
 					config.UnfinalizedBlocksDuration.blocks(state.config().Blockchain.BlockGenerationTargetTime),
 					state.storage(),
 					GetProofStorageCache(locator),
-					[finalizationContextFactory](const auto& proof) {
-						auto result = chain::VerifyFinalizationProof(proof, finalizationContextFactory.create(proof.Round.Epoch));
+					[finalizationContextFactory, &proofVerificationPool, randomFiller = CreateRandomFiller()](const auto& proof) {
+						auto finalizationContext = finalizationContextFactory.create(proof.Round.Epoch);
+						auto result = chain::VerifyFinalizationProof(proof, finalizationContext, proofVerificationPool, randomFiller);
 						if (chain::VerifyFinalizationProofResult::Success != result) {
 							CATAPULT_LOG(warning)
 									<< "proof for round " << proof.Round << " at height " << proof.Height
@@ -163,7 +172,8 @@ namespace catapult { namespace finalization {
 
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, *pWriters));
-				state.tasks().push_back(CreatePullProofTask(m_config, locator, state, *pWriters));
+				auto& proofVerificationPool = *state.pool().pushIsolatedPool("proofVerification");
+				state.tasks().push_back(CreatePullProofTask(m_config, locator, state, *pWriters, proofVerificationPool));
 
 				if (m_config.EnableVoting)
 					state.tasks().push_back(CreatePullMessagesTask(locator, state, *pWriters));
@@ -20,6 +20,7 @@
 **/
 
 #include "FinalizationProofVerifier.h"
+#include "MessageSignatureVerifier.h"
 #include "RoundContext.h"
 #include "RoundMessageAggregator.h"
 #include "finalization/src/model/FinalizationContext.h"
@@ -53,27 +54,47 @@ namespace catapult { namespace chain {
 			std::memcpy(reinterpret_cast<void*>(pMessage->HashesPtr()), messageGroup.HashesPtr(), hashesPayloadSize);
 			return pMessage;
 		}
+
+		std::vector<std::shared_ptr<model::FinalizationMessage>> CreateMessages(const model::FinalizationProof& proof) {
+			std::vector<std::shared_ptr<model::FinalizationMessage>> messages;
+			for (const auto& messageGroup : proof.MessageGroups()) {
+				for (auto i = 0u; i < messageGroup.SignaturesCount; ++i) {
+					auto pMessage = CreateTemplateMessage(proof.Round, messageGroup);
+					pMessage->Signature = messageGroup.SignaturesPtr()[i];
+					messages.push_back(std::move(pMessage));
+				}
+			}
+
+			return messages;
+		}
 	}
 
 	VerifyFinalizationProofResult VerifyFinalizationProof(
 			const model::FinalizationProof& proof,
-			const model::FinalizationContext& context) {
+			const model::FinalizationContext& context,
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller) {
 		if (model::FinalizationProofHeader::Current_Version != proof.Version)
 			return VerifyFinalizationProofResult::Failure_Invalid_Version;
 
 		if (proof.Round.Epoch != context.epoch())
 			return VerifyFinalizationProofResult::Failure_Invalid_Epoch;
 
+		// verify all signatures (across all message groups) in parallel before processing any messages
+		auto messages = CreateMessages(proof);
+		auto signatureResults = VerifyMessageSignatures(pool, randomFiller, { messages.cbegin(), messages.cend() }).get();
+
 		auto pMessageAggregator = CreateRoundMessageAggregator(context);
-		for (const auto& messageGroup : proof.MessageGroups()) {
-			auto pTemplateMessage = CreateTemplateMessage(proof.Round, messageGroup);
-			for (auto i = 0u; i < messageGroup.SignaturesCount; ++i) {
-				pTemplateMessage->Signature = messageGroup.SignaturesPtr()[i];
-				auto addResult = pMessageAggregator->add(pTemplateMessage);
-				if (addResult <= chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
-					CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " rejected due to " << addResult;
-					return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
-				}
+		for (auto i = 0u; i < messages.size(); ++i) {
+			if (!signatureResults[i]) {
+				CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " has invalid signature";
+				return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
+			}
+
+			auto addResult = pMessageAggregator->add(messages[i], model::MessageSignatureVerificationMode::Disabled);
+			if (addResult <= chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+				CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " rejected due to " << addResult;
+				return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
 			}
 		}
 
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "catapult/crypto/Signer.h"
 #include <iosfwd>
 
 namespace catapult {
@@ -27,6 +28,7 @@ namespace catapult {
 		class FinalizationContext;
 		struct FinalizationProof;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace chain {
@@ -68,7 +70,11 @@ namespace catapult { namespace chain {
 	// endregion
 
 	/// Verifies \a proof given \a context.
+	/// All message signatures are batch verified in parallel using \a pool and \a randomFiller.
+	/// \note \a pool must not be the pool calling this function because this function blocks until all signatures are verified.
 	VerifyFinalizationProofResult VerifyFinalizationProof(
 			const model::FinalizationProof& proof,
-			const model::FinalizationContext& context);
+			const model::FinalizationContext& context,
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller);
 }}
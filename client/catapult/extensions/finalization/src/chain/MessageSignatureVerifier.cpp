@@ -0,0 +1,66 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MessageSignatureVerifier.h"
+#include "finalization/src/model/FinalizationMessage.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		struct VerificationContext {
+		public:
+			explicit VerificationContext(std::vector<std::shared_ptr<const model::FinalizationMessage>>&& messages)
+					: Messages(std::move(messages))
+					, Results(Messages.size(), 0) {
+				RawMessages.reserve(Messages.size());
+				for (const auto& pMessage : Messages)
+					RawMessages.push_back(pMessage.get());
+			}
+
+		public:
+			std::vector<std::shared_ptr<const model::FinalizationMessage>> Messages;
+			std::vector<const model::FinalizationMessage*> RawMessages;
+
+			// note: use uint8_t instead of bool because partitions are written concurrently
+			std::vector<uint8_t> Results;
+		};
+	}
+
+	thread::future<std::vector<bool>> VerifyMessageSignatures(
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller,
+			std::vector<std::shared_ptr<const model::FinalizationMessage>>&& messages) {
+		auto pContext = std::make_shared<VerificationContext>(std::move(messages));
+		auto partitionCallback = [pContext, randomFiller](auto itBegin, auto itEnd, auto startIndex, auto) {
+			auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+			auto partitionResults = model::VerifyMessageSignatures(randomFiller, &*itBegin, count);
+			for (auto i = 0u; i < count; ++i)
+				pContext->Results[startIndex + i] = partitionResults[i] ? 1 : 0;
+		};
+
+		auto future = thread::ParallelForPartition(pool.ioContext(), pContext->RawMessages, pool.numWorkerThreads(), partitionCallback);
+		return future.then([pContext](auto&&) {
+			return std::vector<bool>(pContext->Results.cbegin(), pContext->Results.cend());
+		});
+	}
+}}
@@ -0,0 +1,42 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/crypto/Signer.h"
+#include "catapult/thread/Future.h"
+#include <memory>
+#include <vector>
+
+namespace catapult {
+	namespace model { struct FinalizationMessage; }
+	namespace thread { class IoThreadPool; }
+}
+
+namespace catapult { namespace chain {
+
+	/// Verifies the signatures of all \a messages by partitioning them across \a pool and batch verifying each partition.
+	/// \a randomFiller is used to generate random bytes.
+	/// Returns a future that is resolved with a vector of bools that indicates the signature verification result for each message.
+	thread::future<std::vector<bool>> VerifyMessageSignatures(
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller,
+			std::vector<std::shared_ptr<const model::FinalizationMessage>>&& messages);
+}}
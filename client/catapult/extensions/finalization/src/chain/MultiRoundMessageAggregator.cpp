@@ -161,6 +161,12 @@ namespace catapult { namespace chain {
 	}
 
 	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::add(const std::shared_ptr<model::FinalizationMessage>& pMessage) {
+		return add(pMessage, model::MessageSignatureVerificationMode::Enabled);
+	}
+
+	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::add(
+			const std::shared_ptr<model::FinalizationMessage>& pMessage,
+			model::MessageSignatureVerificationMode signatureVerificationMode) {
 		auto messageRound = pMessage->StepIdentifier.Round();
 		if (m_state.MinFinalizationRound > messageRound || m_state.MaxFinalizationRound < messageRound) {
 			CATAPULT_LOG(warning)
@@ -176,7 +182,7 @@ namespace catapult { namespace chain {
 			iter = m_state.RoundMessageAggregators.emplace(messageRound, std::move(pRoundAggregator)).first;
 		}
 
-		return iter->second->add(pMessage);
+		return iter->second->add(pMessage, signatureVerificationMode);
 	}
 
 	void MultiRoundMessageAggregatorModifier::prune(FinalizationEpoch epoch) {
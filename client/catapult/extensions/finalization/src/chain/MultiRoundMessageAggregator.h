@@ -112,6 +112,12 @@ namespace catapult { namespace chain {
 		/// \note Message is a shared_ptr because it is detached from an EntityRange and is kept alive with its associated step.
 		RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage);
 
+		/// Adds a finalization message (\a pMessage) to the aggregator using \a signatureVerificationMode.
+		/// \note Signature verification should only be disabled when the message signature has already been verified.
+		RoundMessageAggregatorAddResult add(
+				const std::shared_ptr<model::FinalizationMessage>& pMessage,
+				model::MessageSignatureVerificationMode signatureVerificationMode);
+
 		/// Prunes this aggregator by removing all rounds with an epoch less than \a epoch.
 		void prune(FinalizationEpoch epoch);
 
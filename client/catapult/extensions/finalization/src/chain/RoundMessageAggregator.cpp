@@ -74,6 +74,9 @@ namespace catapult { namespace chain {
 		// region DefaultRoundMessageAggregator
 
 		class DefaultRoundMessageAggregator : public RoundMessageAggregator {
+		public:
+			using RoundMessageAggregator::add;
+
 		public:
 			explicit DefaultRoundMessageAggregator(const model::FinalizationContext& finalizationContext)
 					: m_finalizationContext(finalizationContext)
@@ -122,7 +125,9 @@ namespace catapult { namespace chain {
 			}
 
 		public:
-			RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) override {
+			RoundMessageAggregatorAddResult add(
+					const std::shared_ptr<model::FinalizationMessage>& pMessage,
+					model::MessageSignatureVerificationMode signatureVerificationMode) override {
 				auto maxHashesPerPoint = m_finalizationContext.config().MaxHashesPerPoint;
 				CATAPULT_LOG(trace)
 						<< "received message at " << pMessage->StepIdentifier
@@ -159,7 +164,7 @@ namespace catapult { namespace chain {
 							: RoundMessageAggregatorAddResult::Failure_Conflicting;
 				}
 
-				auto processResultPair = model::ProcessMessage(*pMessage, m_finalizationContext);
+				auto processResultPair = model::ProcessMessage(*pMessage, m_finalizationContext, signatureVerificationMode);
 				if (model::ProcessMessageResult::Success != processResultPair.first) {
 					CATAPULT_LOG(warning) << "rejecting finalization message with result " << processResultPair.first;
 					return RoundMessageAggregatorAddResult::Failure_Processing;
@@ -190,6 +195,10 @@ namespace catapult { namespace chain {
 		// endregion
 	}
 
+	RoundMessageAggregatorAddResult RoundMessageAggregator::add(const std::shared_ptr<model::FinalizationMessage>& pMessage) {
+		return add(pMessage, model::MessageSignatureVerificationMode::Enabled);
+	}
+
 	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(const model::FinalizationContext& finalizationContext) {
 		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext);
 	}
@@ -30,6 +30,7 @@ namespace catapult {
 	namespace model {
 		class FinalizationContext;
 		struct FinalizationMessage;
+		enum class MessageSignatureVerificationMode;
 	}
 }
 
@@ -63,7 +64,13 @@ namespace catapult { namespace chain {
 	public:
 		/// Adds a finalization message (\a pMessage) to the aggregator.
 		/// \note Message is a shared_ptr because it is detached from an EntityRange and is kept alive with its associated step.
-		virtual RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) = 0;
+		RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage);
+
+		/// Adds a finalization message (\a pMessage) to the aggregator using \a signatureVerificationMode.
+		/// \note Signature verification should only be disabled when the message signature has already been verified.
+		virtual RoundMessageAggregatorAddResult add(
+				const std::shared_ptr<model::FinalizationMessage>& pMessage,
+				model::MessageSignatureVerificationMode signatureVerificationMode) = 0;
 	};
 
 	/// Creates a round message aggregator around \a finalizationContext.
@@ -93,6 +93,13 @@ namespace catapult { namespace model {
 	}
 
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context) {
+		return ProcessMessage(message, context, MessageSignatureVerificationMode::Enabled);
+	}
+
+	std::pair<ProcessMessageResult, size_t> ProcessMessage(
+			const FinalizationMessage& message,
+			const FinalizationContext& context,
+			MessageSignatureVerificationMode signatureVerificationMode) {
 		auto accountView = context.lookup(message.Signature.Root.ParentPublicKey);
 		if (Amount() == accountView.Weight)
 			return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
@@ -103,10 +110,26 @@ namespace catapult { namespace model {
 		if (FinalizationMessage::Current_Version != message.Version)
 			return std::make_pair(ProcessMessageResult::Failure_Version, 0);
 
-		auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
-		if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
-			return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
+		if (MessageSignatureVerificationMode::Enabled == signatureVerificationMode) {
+			auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
+			if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
+				return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
+		}
 
 		return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
 	}
+
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			const FinalizationMessage* const* pMessages,
+			size_t count) {
+		std::vector<crypto::BmTreeSignatureInput> signatureInputs;
+		signatureInputs.reserve(count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& message = *pMessages[i];
+			signatureInputs.push_back({ message.Signature, StepIdentifierToBmKeyIdentifier(message.StepIdentifier), ToBuffer(message) });
+		}
+
+		return crypto::VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size());
+	}
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "StepIdentifier.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/crypto_voting/BmTreeSignature.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/TrailingVariableDataLayout.h"
@@ -130,8 +131,35 @@ namespace catapult { namespace model {
 	/// Insertion operator for outputting \a value to \a out.
 	std::ostream& operator<<(std::ostream& out, ProcessMessageResult value);
 
+	/// Finalization message signature verification modes.
+	enum class MessageSignatureVerificationMode {
+		/// Message signature is verified during processing.
+		Enabled,
+
+		/// Message signature is not verified during processing because it has already been verified.
+		Disabled
+	};
+
 	/// Processes a finalization \a message using \a context.
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context);
 
+	/// Processes a finalization \a message using \a context and \a signatureVerificationMode.
+	std::pair<ProcessMessageResult, size_t> ProcessMessage(
+			const FinalizationMessage& message,
+			const FinalizationContext& context,
+			MessageSignatureVerificationMode signatureVerificationMode);
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	/// Verifies the signatures of all \a count messages pointed to by \a pMessages using batch verification.
+	/// \a randomFiller is used to generate random bytes.
+	/// Returns a vector of bools that indicates the signature verification result for each individual message.
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			const FinalizationMessage* const* pMessages,
+			size_t count);
+
 	// endregion
 }}
@@ -194,6 +194,39 @@ namespace catapult { namespace finalization {
 		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage2, pMessage4 }), context.broadcastedPayloads()[1]);
 	}
 
+	TEST(TEST_CLASS, MessagesWithInvalidSignaturesAreForwardedButNotAddedToAggregator) {
+		// Arrange:
+		TestContext context(FinalizationPoint(8));
+		context.boot();
+
+		const auto& hooks = GetFinalizationServerHooks(context.locator());
+		auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+		aggregator.modifier().setMaxFinalizationRound({ Finalization_Epoch, FinalizationPoint(12) });
+
+		// - prepare message(s) and corrupt the signatures of two of them
+		const auto& hash = test::GenerateRandomByteArray<Hash256>();
+		auto pMessage1 = context.createMessage(VoterType::Large1, CreateStepIdentifier(12), Height(9), hash);
+		auto pMessage2 = context.createMessage(VoterType::Large1, CreateStepIdentifier(11), Height(8), hash);
+		auto pMessage3 = context.createMessage(VoterType::Large1, CreateStepIdentifier(10), Height(7), hash);
+		pMessage1->Signature.Bottom.Signature[0] ^= 0xFF;
+		pMessage2->Signature.Root.Signature[0] ^= 0xFF;
+
+		// Act:
+		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage2, pMessage3 }));
+
+		// - wait for the aggregator and the broadcast
+		WAIT_FOR_ONE_EXPR(aggregator.view().size());
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
+
+		// Assert: check the aggregator (all messages are processed under a single aggregator lock)
+		EXPECT_EQ(1u, aggregator.view().size());
+		EXPECT_TRUE(!!aggregator.view().tryGetRoundContext({ Finalization_Epoch, FinalizationPoint(10) }));
+
+		// - check the packet(s)
+		ASSERT_EQ(1u, context.numBroadcastCalls());
+		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1, pMessage2, pMessage3 }), context.broadcastedPayloads()[0]);
+	}
+
 	TEST(TEST_CLASS, PreviouslySeenMessageIsNotForwarded) {
 		// Arrange:
 		TestContext context(FinalizationPoint(10));
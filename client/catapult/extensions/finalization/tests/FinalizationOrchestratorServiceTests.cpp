@@ -296,14 +296,17 @@ namespace catapult { namespace finalization {
 
 		// Assert:
 		EXPECT_EQ(1u + Num_Dependent_Services, context.locator().numServices());
-		EXPECT_EQ(0u, context.locator().counters().size());
+		EXPECT_EQ(1u, context.locator().counters().size());
 
 		// - service (get does not throw)
 		context.locator().service<void>("fin.orchestrator");
+
+		// - initial tree is loaded on demand, so no keys are prefetched
+		EXPECT_EQ(0u, context.counter("VOTING KEYS"));
 	}
 
 	TEST(TEST_CLASS, TasksAreRegistered) {
-		test::AssertRegisteredTasks(TestContext(), { "finalization task" });
+		test::AssertRegisteredTasks(TestContext(), { "finalization task", "voting key prefetch task" });
 	}
 
 	// endregion
@@ -353,7 +356,7 @@ namespace catapult { namespace finalization {
 		template<typename TCheckState>
 		void RunFinalizationTaskTest(TestContext& context, size_t numRepetitions, TCheckState checkState) {
 			// Act:
-			test::RunTaskTestPostBoot(context, 1, "finalization task", [&context, numRepetitions, checkState](const auto& task) {
+			test::RunTaskTestPostBoot(context, 2, "finalization task", [&context, numRepetitions, checkState](const auto& task) {
 				// - run task multiple times
 				std::vector<thread::TaskResult> taskResults;
 				for (auto i = 0u; i < numRepetitions; ++i)
@@ -773,4 +776,76 @@ namespace catapult { namespace finalization {
 	}
 
 	// endregion
+
+	// region task - voting key prefetch
+
+	namespace {
+		void AssertVotingKeyPrefetchTask(const TestContextOptions& options, size_t numRepetitions, uint64_t expectedNumReadyKeys) {
+			// Arrange:
+			TestContext context(options);
+			context.boot();
+
+			// Act:
+			test::RunTaskTestPostBoot(context, 2, "voting key prefetch task", [&context, numRepetitions, expectedNumReadyKeys](
+					const auto& task) {
+				for (auto i = 0u; i < numRepetitions; ++i) {
+					auto result = task.Callback().get();
+
+					// Assert:
+					EXPECT_EQ(thread::TaskResult::Continue, result) << "result at " << i;
+				}
+
+				EXPECT_EQ(expectedNumReadyKeys, context.counter("VOTING KEYS"));
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, CanRunVotingKeyPrefetchTaskWhenVotingKeysAreAvailable) {
+		// Assert: second tree (epochs 5-8) is prefetched
+		AssertVotingKeyPrefetchTask(TestContextOptions(), 1, 4);
+	}
+
+	TEST(TEST_CLASS, CanRunVotingKeyPrefetchTaskMultipleTimesWithoutPrefetchingAdditionalTrees) {
+		// Assert: second tree (epochs 5-8) is prefetched only once
+		AssertVotingKeyPrefetchTask(TestContextOptions(), 3, 4);
+	}
+
+	TEST(TEST_CLASS, CanRunVotingKeyPrefetchTaskWhenVotingKeysAreNotAvailable) {
+		// Arrange: don't create any voting_private_key_tree files
+		TestContextOptions options;
+		options.ShouldPrepareVotingPrivateKeyTrees = false;
+
+		// Act + Assert:
+		AssertVotingKeyPrefetchTask(options, 1, 0);
+	}
+
+	TEST(TEST_CLASS, FinalizationTaskUsesPrefetchedVotingKeys) {
+		// Arrange:
+		TestContext context;
+		context.createCompletedRound();
+
+		auto& blockStorage = context.testState().state().storage();
+		mocks::SeedStorageWithFixedSizeBlocks(blockStorage, 1200);
+		context.setHash(1, blockStorage.view().loadBlockElement(Height(245))->EntityHash);
+
+		context.initialize();
+		context.boot();
+
+		// - prefetch the second tree (epochs 5-8), which is needed to vote in the current epoch
+		test::RunTaskTestPostBoot(context, 2, "voting key prefetch task", [](const auto& task) {
+			task.Callback().get();
+		});
+
+		// Sanity:
+		EXPECT_EQ(4u, context.counter("VOTING KEYS"));
+
+		// Act:
+		RunFinalizationTaskTest(context, 1, [&context](const auto&, const auto&, const auto& messages) {
+			// Assert: messages were signed with the prefetched tree, which is no longer counted as prefetched
+			EXPECT_EQ(2u, messages.size());
+			EXPECT_EQ(0u, context.counter("VOTING KEYS"));
+		});
+	}
+
+	// endregion
 }}
@@ -22,6 +22,9 @@
 #include "finalization/src/chain/FinalizationProofVerifier.h"
 #include "finalization/src/model/FinalizationProofUtils.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace chain {
@@ -37,7 +40,7 @@ namespace catapult { namespace chain {
 
 		class TestContext {
 		public:
-			TestContext() {
+			TestContext() : m_pPool(test::CreateStartedIoThreadPool()) {
 				auto config = finalization::FinalizationConfiguration::Uninitialized();
 				config.Size = 1000;
 				config.Threshold = 700;
@@ -56,7 +59,11 @@ namespace catapult { namespace chain {
 
 		public:
 			auto verify(const model::FinalizationProof& proof) const {
-				return VerifyFinalizationProof(proof, *m_pFinalizationContext);
+				auto randomFiller = [](auto* pOut, auto count) {
+					// can use low entropy source for tests
+					utils::LowEntropyRandomGenerator().fill(pOut, count);
+				};
+				return VerifyFinalizationProof(proof, *m_pFinalizationContext, *m_pPool, randomFiller);
 			}
 
 		public:
@@ -70,6 +77,7 @@ namespace catapult { namespace chain {
 		private:
 			std::unique_ptr<model::FinalizationContext> m_pFinalizationContext;
 			std::vector<test::AccountKeyPairDescriptor> m_keyPairDescriptors;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
 		};
 
 		// endregion
@@ -246,6 +254,14 @@ namespace catapult { namespace chain {
 		});
 	}
 
+	TEST(TEST_CLASS, VerifyFailsWhenProofContainsMessageWithInvalidBottomSignature) {
+		// Arrange:
+		RunModifiedPrevoteMessagesTest([](auto& prevoteMessages) {
+			// - corrupt bottom signature of last message
+			prevoteMessages.back()->Signature.Bottom.Signature[0] ^= 0xFF;
+		});
+	}
+
 	// endregion
 
 	// region success
@@ -0,0 +1,113 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "finalization/src/chain/MessageSignatureVerifier.h"
+#include "finalization/src/model/FinalizationMessage.h"
+#include "finalization/tests/test/FinalizationMessageTestUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS MessageSignatureVerifierTests
+
+	namespace {
+		using Messages = std::vector<std::shared_ptr<model::FinalizationMessage>>;
+
+		Messages CreateSignedMessages(size_t count) {
+			Messages messages;
+			for (auto i = 0u; i < count; ++i) {
+				std::shared_ptr<model::FinalizationMessage> pMessage = test::CreateMessage(Height(100 + i), i % 3);
+				pMessage->StepIdentifier = { FinalizationEpoch(4), FinalizationPoint(3), model::FinalizationStage::Prevote };
+				test::SignMessage(*pMessage, test::GenerateVotingKeyPair());
+				messages.push_back(pMessage);
+			}
+
+			return messages;
+		}
+
+		std::vector<bool> VerifyAll(const Messages& messages, uint32_t numThreads) {
+			auto pPool = test::CreateStartedIoThreadPool(numThreads);
+			auto randomFiller = [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+
+			return VerifyMessageSignatures(*pPool, randomFiller, { messages.cbegin(), messages.cend() }).get();
+		}
+	}
+
+	TEST(TEST_CLASS, SucceedsWhenNoMessagesArePresent) {
+		// Act:
+		auto results = VerifyAll({}, 4);
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, SucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto messages = CreateSignedMessages(25);
+
+		// Act:
+		auto results = VerifyAll(messages, 4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(25, true), results);
+	}
+
+	TEST(TEST_CLASS, FailsOnlyMessagesWithInvalidSignatures) {
+		// Arrange: corrupt messages in different partitions
+		auto messages = CreateSignedMessages(25);
+		std::vector<size_t> invalidIndexes{ 0, 7, 8, 16, 24 };
+		for (auto index : invalidIndexes)
+			messages[index]->Height = messages[index]->Height + Height(1);
+
+		// Act:
+		auto results = VerifyAll(messages, 4);
+
+		// Assert:
+		std::vector<bool> expectedResults(25, true);
+		for (auto index : invalidIndexes)
+			expectedResults[index] = false;
+
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	TEST(TEST_CLASS, ResultsAreIndependentOfNumberOfPartitions) {
+		// Arrange:
+		auto messages = CreateSignedMessages(10);
+		messages[3]->Height = messages[3]->Height + Height(1);
+
+		std::vector<bool> expectedResults(10, true);
+		expectedResults[3] = false;
+
+		for (auto numThreads : { 1u, 2u, 3u, 16u }) {
+			// Act:
+			auto results = VerifyAll(messages, numThreads);
+
+			// Assert:
+			EXPECT_EQ(expectedResults, results) << "num threads " << numThreads;
+		}
+	}
+}}
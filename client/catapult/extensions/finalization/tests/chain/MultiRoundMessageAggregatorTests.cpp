@@ -276,6 +276,37 @@ namespace catapult { namespace chain {
 		AssertCanAddMessage(Default_Min_Round + FinalizationPoint(5), RoundMessageAggregatorAddResult::Failure_Invalid_Height);
 	}
 
+	namespace {
+		template<typename TAdd>
+		void AssertSignatureVerificationModeIsForwarded(model::MessageSignatureVerificationMode expectedMode, TAdd add) {
+			// Arrange:
+			TestContext context;
+			context.aggregator().modifier().setMaxFinalizationRound(Default_Max_Round);
+
+			// Act:
+			add(context.aggregator().modifier(), CreateMessage(Default_Min_Round, Height(222)));
+
+			// Assert:
+			ASSERT_EQ(1u, context.roundMessageAggregators().size());
+			EXPECT_EQ(1u, context.roundMessageAggregators()[0]->numAddCalls());
+			EXPECT_EQ(expectedMode, context.roundMessageAggregators()[0]->lastSignatureVerificationMode());
+		}
+	}
+
+	TEST(TEST_CLASS, AddEnablesSignatureVerificationByDefault) {
+		AssertSignatureVerificationModeIsForwarded(model::MessageSignatureVerificationMode::Enabled, [](auto&& modifier, auto&& pMessage) {
+			modifier.add(std::move(pMessage));
+		});
+	}
+
+	TEST(TEST_CLASS, AddForwardsSignatureVerificationMode) {
+		for (auto mode : { model::MessageSignatureVerificationMode::Enabled, model::MessageSignatureVerificationMode::Disabled }) {
+			AssertSignatureVerificationModeIsForwarded(mode, [mode](auto&& modifier, auto&& pMessage) {
+				modifier.add(std::move(pMessage), mode);
+			});
+		}
+	}
+
 	TEST(TEST_CLASS, CanAddMultipleMessagesWithSamePoint) {
 		// Arrange:
 		TestContext context;
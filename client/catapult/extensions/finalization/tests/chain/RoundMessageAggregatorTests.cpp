@@ -224,6 +224,25 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(0u, context.aggregator().size());
 	}
 
+	PREVOTE_PRECOMIT_TEST(CannotAddMessageWithInvalidSignatureWhenSignatureVerificationIsEnabled) {
+		// Arrange:
+		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
+		pMessage->StepIdentifier = { Finalization_Epoch, Finalization_Point, TTraits::Stage };
+
+		TestContext context(1000, 700);
+		context.signMessage(*pMessage, 0);
+
+		// - corrupt the signature
+		pMessage->HashesPtr()[0][0] ^= 0xFF;
+
+		// Act:
+		auto result = context.aggregator().add(std::move(pMessage), model::MessageSignatureVerificationMode::Enabled);
+
+		// Assert:
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Failure_Processing, result);
+		EXPECT_EQ(0u, context.aggregator().size());
+	}
+
 	PREVOTE_PRECOMIT_TEST(CannotAddMessageWithInvalidSignature) {
 		// Arrange:
 		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
@@ -327,6 +346,25 @@ namespace catapult { namespace chain {
 		AssertBasicAddSuccess<TTraits>(1, Last_Finalized_Height + Height(1));
 	}
 
+	PREVOTE_PRECOMIT_TEST(CanAddMessageWithInvalidSignatureWhenSignatureVerificationIsDisabled) {
+		// Arrange:
+		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
+		pMessage->StepIdentifier = { Finalization_Epoch, Finalization_Point, TTraits::Stage };
+
+		TestContext context(1000, 700);
+		context.signMessage(*pMessage, 0);
+
+		// - corrupt the signature
+		pMessage->HashesPtr()[0][0] ^= 0xFF;
+
+		// Act:
+		auto result = context.aggregator().add(std::move(pMessage), model::MessageSignatureVerificationMode::Disabled);
+
+		// Assert:
+		EXPECT_EQ(TTraits::Success_Result, result);
+		EXPECT_EQ(1u, context.aggregator().size());
+	}
+
 	PREVOTE_PRECOMIT_TEST(CanAddMessageWithSingleHashAtLastFinalizedHeight_StartingEpoch) {
 		AssertBasicAddSuccess<TTraits>(1, Last_Finalized_Height);
 	}
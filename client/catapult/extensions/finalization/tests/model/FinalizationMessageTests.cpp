@@ -21,6 +21,7 @@
 
 #include "finalization/src/model/FinalizationMessage.h"
 #include "catapult/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "catapult/utils/RandomGenerator.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -391,6 +392,48 @@ namespace catapult { namespace model {
 		});
 	}
 
+	TEST(TEST_CLASS, ProcessMessage_FailsWhenSignatureIsInvalidAndSignatureVerificationIsEnabled) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, auto& message) {
+			// - corrupt a hash
+			test::FillWithRandomData(message.HashesPtr()[1]);
+
+			// Act:
+			auto processResultPair = ProcessMessage(message, context, MessageSignatureVerificationMode::Enabled);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Signature, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_SucceedsWhenSignatureIsInvalidAndSignatureVerificationIsDisabled) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, auto& message) {
+			// - corrupt a hash
+			test::FillWithRandomData(message.HashesPtr()[1]);
+
+			// Act:
+			auto processResultPair = ProcessMessage(message, context, MessageSignatureVerificationMode::Disabled);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_FailsWhenAccountIsNotVotingEligibleAndSignatureVerificationIsDisabled) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Ineligible, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessMessage(message, context, MessageSignatureVerificationMode::Disabled);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Voter, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
 	TEST(TEST_CLASS, ProcessMessage_FailsWhenReservedDataIsNotCleared) {
 		// Arrange:
 		auto modifyMessage = [](auto& message) { message.FinalizationMessage_Reserved1 = 1; };
@@ -460,4 +503,68 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region VerifyMessageSignatures
+
+	namespace {
+		std::vector<std::unique_ptr<FinalizationMessage>> CreateSignedMessages(size_t count) {
+			std::vector<std::unique_ptr<FinalizationMessage>> messages;
+			for (auto i = 0u; i < count; ++i) {
+				auto pMessage = CreateMessage(i % 4);
+				pMessage->StepIdentifier = DefaultStepIdentifier();
+				test::SignMessage(*pMessage, test::GenerateVotingKeyPair());
+				messages.push_back(std::move(pMessage));
+			}
+
+			return messages;
+		}
+
+		std::vector<bool> VerifyAll(const std::vector<std::unique_ptr<FinalizationMessage>>& messages) {
+			std::vector<const FinalizationMessage*> rawMessages;
+			for (const auto& pMessage : messages)
+				rawMessages.push_back(pMessage.get());
+
+			auto randomFiller = [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+			return VerifyMessageSignatures(randomFiller, rawMessages.data(), rawMessages.size());
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenNoMessagesArePresent) {
+		// Act:
+		auto results = VerifyAll({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto messages = CreateSignedMessages(10);
+
+		// Act:
+		auto results = VerifyAll(messages);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(10, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_FailsOnlyMessagesWithInvalidSignatures) {
+		// Arrange:
+		auto messages = CreateSignedMessages(10);
+		messages[2]->Signature.Root.Signature[0] ^= 0xFF;
+		messages[5]->Signature.Bottom.Signature[0] ^= 0xFF;
+		messages[7]->Height = messages[7]->Height + Height(1);
+
+		// Act:
+		auto results = VerifyAll(messages);
+
+		// Assert:
+		std::vector<bool> expectedResults{ true, true, false, true, true, false, true, false, true, true };
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	// endregion
 }}
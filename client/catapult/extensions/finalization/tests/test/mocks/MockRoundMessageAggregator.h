@@ -33,6 +33,7 @@ namespace catapult { namespace mocks {
 		explicit MockRoundMessageAggregator(const model::FinalizationRound& round)
 				: m_round(round)
 				, m_numAddCalls(0)
+				, m_lastSignatureVerificationMode(model::MessageSignatureVerificationMode::Enabled)
 				, m_roundContext(1000, 700)
 				, m_addResult(static_cast<chain::RoundMessageAggregatorAddResult>(-1))
 		{}
@@ -53,6 +54,11 @@ namespace catapult { namespace mocks {
 			return m_numAddCalls;
 		}
 
+		/// Gets the signature verification mode passed to the last add call.
+		model::MessageSignatureVerificationMode lastSignatureVerificationMode() const {
+			return m_lastSignatureVerificationMode;
+		}
+
 	public:
 		/// Sets the result of shortHashes to \a shortHashes.
 		void setShortHashes(model::ShortHashRange&& shortHashes) {
@@ -98,8 +104,13 @@ namespace catapult { namespace mocks {
 		}
 
 	public:
-		chain::RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>&) override {
+		using chain::RoundMessageAggregator::add;
+
+		chain::RoundMessageAggregatorAddResult add(
+				const std::shared_ptr<model::FinalizationMessage>&,
+				model::MessageSignatureVerificationMode signatureVerificationMode) override {
 			++m_numAddCalls;
+			m_lastSignatureVerificationMode = signatureVerificationMode;
 			return m_addResult;
 		}
 
@@ -107,6 +118,7 @@ namespace catapult { namespace mocks {
 		model::FinalizationRound m_round;
 		Height m_height;
 		size_t m_numAddCalls;
+		model::MessageSignatureVerificationMode m_lastSignatureVerificationMode;
 		chain::RoundContext m_roundContext;
 
 		model::ShortHashRange m_shortHashes;
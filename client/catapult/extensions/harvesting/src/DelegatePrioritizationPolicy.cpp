@@ -66,6 +66,13 @@ namespace catapult { namespace harvesting {
 				if (primaryAccountPublicKey == delegatePublicKey)
 					return std::numeric_limits<uint64_t>::max();
 
+				// prefer snapshot when available because it can be read without waiting for an in progress commit
+				auto pSnapshot = cache.sub<cache::AccountStateCache>().snapshot();
+				if (pSnapshot) {
+					cache::ImportanceView view(*pSnapshot);
+					return view.getAccountImportanceOrDefault(delegatePublicKey, pSnapshot->height() + Height(1)).unwrap();
+				}
+
 				auto cacheView = cache.createView();
 				auto height = cacheView.height() + Height(1); // harvesting *next* block
 				auto readOnlyAccountStateCache = cache::ReadOnlyAccountStateCache(cacheView.sub<cache::AccountStateCache>());
@@ -71,6 +71,29 @@ namespace catapult { namespace harvesting {
 		void AddGenerationHashProof(model::Block& block, const crypto::VrfProof& vrfProof) {
 			block.GenerationHashProof = { vrfProof.Gamma, vrfProof.VerificationHash, vrfProof.Scalar };
 		}
+
+		std::unique_ptr<model::Block> GenerateBlock(
+				const NextBlockContext& context,
+				const model::BlockchainConfiguration& config,
+				const Address& beneficiary,
+				const BlockGenerator& blockGenerator,
+				const crypto::KeyPair& harvesterKeyPair,
+				const crypto::VrfProof& vrfProof) {
+			utils::StackLogger stackLogger("generating candidate block", utils::LogLevel::debug);
+			auto pBlockHeader = CreateUnsignedBlockHeader(
+					context,
+					model::CalculateBlockTypeFromHeight(context.Height, config.ImportanceGrouping),
+					config.Network.Identifier,
+					harvesterKeyPair.publicKey(),
+					beneficiary);
+
+			AddGenerationHashProof(*pBlockHeader, vrfProof);
+			auto pBlock = blockGenerator(*pBlockHeader, config.MaxTransactionsPerBlock);
+			if (pBlock)
+				SignBlockHeader(harvesterKeyPair, *pBlock);
+
+			return pBlock;
+		}
 	}
 
 	Harvester::Harvester(
@@ -79,11 +102,22 @@ namespace catapult { namespace harvesting {
 			const Address& beneficiary,
 			const UnlockedAccounts& unlockedAccounts,
 			const BlockGenerator& blockGenerator)
+			: Harvester(cache, config, beneficiary, unlockedAccounts, blockGenerator, BlockPreparer())
+	{}
+
+	Harvester::Harvester(
+			const cache::CatapultCache& cache,
+			const model::BlockchainConfiguration& config,
+			const Address& beneficiary,
+			const UnlockedAccounts& unlockedAccounts,
+			const BlockGenerator& blockGenerator,
+			const BlockPreparer& blockPreparer)
 			: m_cache(cache)
 			, m_config(config)
 			, m_beneficiary(beneficiary)
 			, m_unlockedAccounts(unlockedAccounts)
 			, m_blockGenerator(blockGenerator)
+			, m_blockPreparer(blockPreparer)
 	{}
 
 	std::unique_ptr<model::Block> Harvester::harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp) {
@@ -106,39 +140,35 @@ namespace catapult { namespace harvesting {
 			return view.getAccountImportanceOrDefault(key, height);
 		});
 
-		auto unlockedAccountsView = m_unlockedAccounts.view();
+		// unlocked accounts view is released before preparing the next block so that preparation does not block account changes
 		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
 		crypto::VrfProof vrfProof;
+		auto hasUnlockedAccounts = false;
+		{
+			auto unlockedAccountsView = m_unlockedAccounts.view();
+			unlockedAccountsView.forEach([&context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
+				hitContext.Signer = descriptor.signingKeyPair().publicKey();
+
+				vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
+				hitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
+				if (hitPredicate(hitContext)) {
+					pHarvesterKeyPair = &descriptor.signingKeyPair();
+					return false;
+				}
+
+				return true;
+			});
+
+			if (pHarvesterKeyPair)
+				return GenerateBlock(context, m_config, m_beneficiary, m_blockGenerator, *pHarvesterKeyPair, vrfProof);
+
+			hasUnlockedAccounts = 0 != unlockedAccountsView.size();
+		}
 
-		unlockedAccountsView.forEach([&context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
-			hitContext.Signer = descriptor.signingKeyPair().publicKey();
-
-			vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
-			hitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
-			if (hitPredicate(hitContext)) {
-				pHarvesterKeyPair = &descriptor.signingKeyPair();
-				return false;
-			}
-
-			return true;
-		});
-
-		if (!pHarvesterKeyPair)
-			return nullptr;
-
-		utils::StackLogger stackLogger("generating candidate block", utils::LogLevel::debug);
-		auto pBlockHeader = CreateUnsignedBlockHeader(
-				context,
-				model::CalculateBlockTypeFromHeight(context.Height, m_config.ImportanceGrouping),
-				m_config.Network.Identifier,
-				pHarvesterKeyPair->publicKey(),
-				m_beneficiary);
-
-		AddGenerationHashProof(*pBlockHeader, vrfProof);
-		auto pBlock = m_blockGenerator(*pBlockHeader, m_config.MaxTransactionsPerBlock);
-		if (pBlock)
-			SignBlockHeader(*pHarvesterKeyPair, *pBlock);
+		// prepare the next block while waiting for a hit so that less work is done when one is found
+		if (m_blockPreparer && hasUnlockedAccounts)
+			m_blockPreparer(context.Height, context.Timestamp, m_config.MaxTransactionsPerBlock);
 
-		return pBlock;
+		return nullptr;
 	}
 }}
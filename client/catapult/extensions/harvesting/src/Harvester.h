@@ -43,6 +43,17 @@ namespace catapult { namespace harvesting {
 				const UnlockedAccounts& unlockedAccounts,
 				const BlockGenerator& blockGenerator);
 
+		/// Creates a harvester around catapult \a cache, blockchain \a config, \a beneficiary,
+		/// unlocked accounts set (\a unlockedAccounts), \a blockGenerator used to customize block generation
+		/// and \a blockPreparer used to prepare the next block when no unlocked account has a hit.
+		Harvester(
+				const cache::CatapultCache& cache,
+				const model::BlockchainConfiguration& config,
+				const Address& beneficiary,
+				const UnlockedAccounts& unlockedAccounts,
+				const BlockGenerator& blockGenerator,
+				const BlockPreparer& blockPreparer);
+
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
 		/// Created block will have \a lastBlockElement as parent and \a timestamp as timestamp.
@@ -54,5 +65,6 @@ namespace catapult { namespace harvesting {
 		const Address m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
 		BlockGenerator m_blockGenerator;
+		BlockPreparer m_blockPreparer;
 	};
 }}
@@ -40,6 +40,46 @@ namespace catapult { namespace harvesting {
 			// generate the block
 			return facade.commit(blockHeader);
 		}
+
+		struct PreparedTransactionsInfo {
+			catapult::Height Height;
+			uint32_t MaxTransactionsPerBlock = 0;
+			std::unique_ptr<TransactionsInfo> pTransactionsInfo;
+		};
+
+		bool TryApplyAll(HarvestingUtFacade& facade, const TransactionsInfo& transactionsInfo) {
+			for (auto i = 0u; i < transactionsInfo.Transactions.size(); ++i) {
+				if (!facade.apply(model::TransactionInfo(transactionsInfo.Transactions[i], transactionsInfo.TransactionHashes[i])))
+					return false;
+			}
+
+			return true;
+		}
+
+		bool TryUsePreparedTransactionsInfo(
+				HarvestingUtFacade& facade,
+				PreparedTransactionsInfo& preparedTransactionsInfo,
+				uint32_t maxTransactionsPerBlock,
+				TransactionsInfo& transactionsInfo) {
+			// prepared transactions are consumed by the first block generation attempt
+			auto pPreparedTransactionsInfo = std::move(preparedTransactionsInfo.pTransactionsInfo);
+			if (!pPreparedTransactionsInfo
+					|| facade.height() != preparedTransactionsInfo.Height
+					|| maxTransactionsPerBlock != preparedTransactionsInfo.MaxTransactionsPerBlock)
+				return false;
+
+			// reapply all prepared transactions because block time and state might have changed since preparation
+			if (TryApplyAll(facade, *pPreparedTransactionsInfo)) {
+				transactionsInfo = std::move(*pPreparedTransactionsInfo);
+				return true;
+			}
+
+			CATAPULT_LOG(debug) << "discarding prepared transactions at height " << preparedTransactionsInfo.Height;
+			while (0 != facade.size())
+				facade.unapply();
+
+			return false;
+		}
 	}
 
 	BlockGenerator CreateHarvesterBlockGenerator(
@@ -47,23 +87,39 @@ namespace catapult { namespace harvesting {
 			const model::TransactionRegistry& transactionRegistry,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache) {
+		return CreateSpeculativeHarvesterBlockGenerator(strategy, transactionRegistry, utFacadeFactory, utCache).Generator;
+	}
+
+	SpeculativeBlockGenerator CreateSpeculativeHarvesterBlockGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const model::TransactionRegistry& transactionRegistry,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache) {
 		auto countRetriever = [&transactionRegistry](const auto& transaction) {
 			return 1 + transactionRegistry.findPlugin(transaction.Type)->embeddedCount(transaction);
 		};
 
 		auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(strategy, countRetriever, utCache);
-		return [utFacadeFactory, transactionsInfoSupplier](const auto& blockHeader, auto maxTransactionsPerBlock) {
+		auto pPreparedTransactionsInfo = std::make_shared<PreparedTransactionsInfo>();
+
+		SpeculativeBlockGenerator speculativeBlockGenerator;
+		speculativeBlockGenerator.Generator = [utFacadeFactory, transactionsInfoSupplier, pPreparedTransactionsInfo](
+				const auto& blockHeader,
+				auto maxTransactionsPerBlock) {
 			// 1. check height consistency
 			auto pUtFacade = utFacadeFactory.create(blockHeader.Timestamp);
 			if (blockHeader.Height != pUtFacade->height()) {
 				CATAPULT_LOG(debug)
 						<< "bypassing state hash calculation because cache height (" << pUtFacade->height() - Height(1)
 						<< ") is inconsistent with block height (" << blockHeader.Height << ")";
+				pPreparedTransactionsInfo->pTransactionsInfo.reset();
 				return std::unique_ptr<model::Block>();
 			}
 
-			// 2. select transactions
-			auto transactionsInfo = transactionsInfoSupplier(*pUtFacade, maxTransactionsPerBlock);
+			// 2. select transactions, preferring prepared transactions
+			TransactionsInfo transactionsInfo;
+			if (!TryUsePreparedTransactionsInfo(*pUtFacade, *pPreparedTransactionsInfo, maxTransactionsPerBlock, transactionsInfo))
+				transactionsInfo = transactionsInfoSupplier(*pUtFacade, maxTransactionsPerBlock);
 
 			// 3. build a block
 			auto pBlock = GenerateBlock(*pUtFacade, blockHeader, transactionsInfo);
@@ -74,5 +130,24 @@ namespace catapult { namespace harvesting {
 
 			return pBlock;
 		};
+
+		speculativeBlockGenerator.Preparer = [utFacadeFactory, transactionsInfoSupplier, pPreparedTransactionsInfo](
+				auto height,
+				auto timestamp,
+				auto maxTransactionsPerBlock) {
+			// facade is destroyed without committing, so none of its changes are visible outside of the preparation
+			auto pUtFacade = utFacadeFactory.create(timestamp);
+			if (height != pUtFacade->height()) {
+				pPreparedTransactionsInfo->pTransactionsInfo.reset();
+				return;
+			}
+
+			auto transactionsInfo = transactionsInfoSupplier(*pUtFacade, maxTransactionsPerBlock);
+			pPreparedTransactionsInfo->Height = height;
+			pPreparedTransactionsInfo->MaxTransactionsPerBlock = maxTransactionsPerBlock;
+			pPreparedTransactionsInfo->pTransactionsInfo = std::make_unique<TransactionsInfo>(std::move(transactionsInfo));
+		};
+
+		return speculativeBlockGenerator;
 	}
 }}
@@ -22,6 +22,7 @@
 #pragma once
 #include "catapult/model/Block.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
+#include "catapult/functions.h"
 
 namespace catapult {
 	namespace cache { class ReadWriteUtCache; }
@@ -33,6 +34,19 @@ namespace catapult { namespace harvesting {
 	/// Generates a block from a seed block header given a maximum number of transactions.
 	using BlockGenerator = std::function<std::unique_ptr<model::Block> (const model::BlockHeader&, uint32_t)>;
 
+	/// Speculatively selects transactions for a block at a height and time given a maximum number of transactions.
+	using BlockPreparer = consumer<Height, Timestamp, uint32_t>;
+
+	/// Block generator and preparer sharing speculatively selected transactions.
+	/// \note Generator and preparer are not thread safe and are expected to be called by the same task.
+	struct SpeculativeBlockGenerator {
+		/// Generates a block, preferring the most recently prepared transactions when they are still applicable.
+		BlockGenerator Generator;
+
+		/// Prepares transactions for the next block so that they don't need to be selected when the block is generated.
+		BlockPreparer Preparer;
+	};
+
 	/// Creates a default block generator around \a transactionRegistry, \a utFacadeFactory and \a utCache
 	/// for specified transaction \a strategy.
 	BlockGenerator CreateHarvesterBlockGenerator(
@@ -40,4 +54,13 @@ namespace catapult { namespace harvesting {
 			const model::TransactionRegistry& transactionRegistry,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache);
+
+	/// Creates a speculative block generator around \a transactionRegistry, \a utFacadeFactory and \a utCache
+	/// for specified transaction \a strategy.
+	/// \note Prepared transactions are revalidated when a block is generated, so they only affect transaction selection.
+	SpeculativeBlockGenerator CreateSpeculativeHarvesterBlockGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const model::TransactionRegistry& transactionRegistry,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache);
 }}
@@ -47,10 +47,11 @@ namespace catapult { namespace harvesting {
 		LOAD_HARVESTING_PROPERTY(MaxUnlockedAccounts);
 		LOAD_HARVESTING_PROPERTY(DelegatePrioritizationPolicy);
 		LOAD_HARVESTING_PROPERTY(BeneficiaryAddress);
+		LOAD_HARVESTING_PROPERTY(EnableSpeculativeBlockPreparation);
 
 #undef LOAD_HARVESTING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 6);
+		utils::VerifyBagSizeExact(bag, 7);
 		return config;
 	}
 
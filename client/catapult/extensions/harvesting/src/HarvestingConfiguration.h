@@ -52,6 +52,11 @@ namespace catapult { namespace harvesting {
 		/// Address of the account receiving part of the harvested fee.
 		Address BeneficiaryAddress;
 
+		/// \c true if transactions for the next block should be selected and validated between harvest attempts.
+		/// \note Selection runs on every harvest attempt without a hit and holds a cache delta for its duration,
+		///       so block commits are delayed until it completes.
+		bool EnableSpeculativeBlockPreparation;
+
 	private:
 		HarvestingConfiguration() = default;
 
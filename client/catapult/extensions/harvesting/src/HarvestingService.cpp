@@ -119,7 +119,7 @@ namespace catapult { namespace harvesting {
 		thread::Task CreateHarvestingTask(
 				extensions::ServiceState& state,
 				const UnlockedAccountsHolder& unlockedAccountsHolder,
-				const Address& beneficiaryAddress) {
+				const HarvestingConfiguration& config) {
 			auto strategy = state.config().Node.TransactionSelectionStrategy;
 			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
 			const auto& utCache = const_cast<const extensions::ServiceState&>(state).utCache();
@@ -133,10 +133,19 @@ namespace catapult { namespace harvesting {
 			});
 
 			auto pUnlockedAccounts = unlockedAccountsHolder.pUnlockedAccounts;
-			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, transactionRegistry, utFacadeFactory, utCache);
-			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
-					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(cache, blockchainConfig, beneficiaryAddress, *pUnlockedAccounts, blockGenerator));
+			auto speculativeBlockGenerator = CreateSpeculativeHarvesterBlockGenerator(
+					strategy,
+					transactionRegistry,
+					utFacadeFactory,
+					utCache);
+			auto pHarvester = std::make_unique<Harvester>(
+					cache,
+					blockchainConfig,
+					config.BeneficiaryAddress,
+					*pUnlockedAccounts,
+					speculativeBlockGenerator.Generator,
+					config.EnableSpeculativeBlockPreparation ? speculativeBlockGenerator.Preparer : BlockPreparer());
+			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(CreateHarvesterTaskOptions(state), std::move(pHarvester));
 
 			auto pUnlockedAccountsUpdater = unlockedAccountsHolder.pUnlockedAccountsUpdater;
 			return thread::CreateNamedTask("harvesting task", [pUnlockedAccountsUpdater, pHarvesterTask]() {
@@ -204,7 +213,7 @@ namespace catapult { namespace harvesting {
 				locator.registerRootedService("unlockedAccounts", unlockedAccountsHolder.pUnlockedAccounts);
 
 				// add tasks
-				state.tasks().push_back(CreateHarvestingTask(state, unlockedAccountsHolder, m_config.BeneficiaryAddress));
+				state.tasks().push_back(CreateHarvestingTask(state, unlockedAccountsHolder, m_config));
 
 				if (IsDiagnosticExtensionEnabled(state.config().Extensions))
 					RegisterDiagnosticUnlockedAccountsHandler(state, *unlockedAccountsHolder.pUnlockedAccounts);
@@ -29,16 +29,11 @@ namespace catapult { namespace harvesting {
 	namespace {
 		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-		enum class SortDirection { Ascending, Descending };
-
-		template<SortDirection Direction>
 		struct MaxFeeMultiplierComparer {
 			bool operator()(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) const {
 				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
 				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
-				return SortDirection::Ascending == Direction
-						? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier
-						: lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
+				return lhsMaxFeeMultiplier < rhsMaxFeeMultiplier;
 			}
 		};
 
@@ -77,33 +72,29 @@ namespace catapult { namespace harvesting {
 			uint32_t TransactionLimit;
 		};
 
-		auto GetFirstTransactionInfoPointers(const SupplyInput& input, const predicate<const model::TransactionInfo&>& filter) {
-			return cache::GetFirstTransactionInfoPointers(input.UtCacheView, input.TransactionLimit, input.EmbeddedCountRetriever, filter);
-		}
-
 		auto GetFirstTransactionInfoPointers(
 				const SupplyInput& input,
-				const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
+				cache::UtCacheIterationOrder order,
 				const predicate<const model::TransactionInfo&>& filter) {
 			return cache::GetFirstTransactionInfoPointers(
 					input.UtCacheView,
 					input.TransactionLimit,
 					input.EmbeddedCountRetriever,
-					sortComparer,
+					order,
 					filter);
 		}
 
 		TransactionsInfo SupplyOldest(const SupplyInput& input) {
 			// 1. get first transactions from the ut cache
-			auto candidates = GetFirstTransactionInfoPointers(input, [&utFacade = input.UtFacade](const auto& transactionInfo) {
+			auto order = cache::UtCacheIterationOrder::Arrival;
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
 
 			// 2. pick the smallest multiplier so that all transactions pass validation
 			auto minFeeMultiplier = BlockFeeMultiplier();
 			if (!candidates.empty()) {
-				auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), comparer);
+				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), MaxFeeMultiplierComparer());
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
 			}
 
@@ -111,9 +102,9 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMinimumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade](const auto& transactionInfo) {
+			// 1. get first transactions with lowest fee multipliers from the ut cache
+			auto order = cache::UtCacheIterationOrder::Max_Fee_Multiplier_Ascending;
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
 
@@ -126,10 +117,10 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMaximumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
+			// 1. get first transactions with highest fee multipliers from the ut cache
+			auto order = cache::UtCacheIterationOrder::Max_Fee_Multiplier_Descending;
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade, &maximizer](
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade, &maximizer](
 					const auto& transactionInfo) {
 				if (!utFacade.apply(transactionInfo))
 					return false;
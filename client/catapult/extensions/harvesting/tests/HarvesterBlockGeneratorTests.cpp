@@ -38,6 +38,49 @@ namespace catapult { namespace harvesting {
 	namespace {
 		constexpr auto Cache_Height = Height(7);
 
+		// region MockDeadlineValidator
+
+		// rejects transactions with deadlines preceding block time before forwarding all notifications to the mock validator
+		class MockDeadlineValidator : public validators::stateful::AggregateNotificationValidator {
+		public:
+			explicit MockDeadlineValidator(const std::shared_ptr<const validators::stateful::AggregateNotificationValidator>& pValidator)
+					: m_pValidator(pValidator)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pValidator->name();
+			}
+
+			std::vector<std::string> names() const override {
+				return m_pValidator->names();
+			}
+
+			validators::ValidationResult validate(
+					const model::Notification& notification,
+					const validators::ValidatorContext& context) const override {
+				if (test::MockNotification::Notification_Type == notification.Type) {
+					const auto& mockNotification = test::CastToDerivedNotification<test::MockNotification>(notification);
+					auto deadlineIter = m_deadlines.find(mockNotification.Hash);
+					if (m_deadlines.cend() != deadlineIter && deadlineIter->second < context.BlockTime)
+						return validators::ValidationResult::Failure;
+				}
+
+				return m_pValidator->validate(notification, context);
+			}
+
+		public:
+			void setDeadline(const Hash256& hash, Timestamp deadline) {
+				m_deadlines[hash] = deadline;
+			}
+
+		private:
+			std::shared_ptr<const validators::stateful::AggregateNotificationValidator> m_pValidator;
+			std::unordered_map<Hash256, Timestamp, utils::ArrayHasher<Hash256>> m_deadlines;
+		};
+
+		// endregion
+
 		// region test context
 
 		class TestContext {
@@ -46,9 +89,19 @@ namespace catapult { namespace harvesting {
 					: m_config(CreateBlockchainConfiguration())
 					, m_catapultCache(test::CreateEmptyCatapultCache(m_config, CreateCacheConfiguration(m_dbDirGuard.name())))
 					, m_transactionRegistry(mocks::CreateDefaultTransactionRegistry(mocks::PluginOptionFlags::Contains_Embeddings))
-					, m_utFacadeFactory(m_catapultCache, m_config, m_executionConfig.Config, [](auto) { return Hash256(); })
+					, m_pDeadlineValidator(std::make_shared<MockDeadlineValidator>(m_executionConfig.pValidator))
+					, m_utFacadeFactory(
+							m_catapultCache,
+							m_config,
+							CreateExecutionConfiguration(m_executionConfig.Config, m_pDeadlineValidator),
+							[](auto) { return Hash256(); })
 					, m_pUtCache(test::CreateSeededMemoryUtCache(0))
-					, m_generator(CreateHarvesterBlockGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache)) {
+					, m_generator(CreateHarvesterBlockGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache))
+					, m_speculativeGenerator(CreateSpeculativeHarvesterBlockGenerator(
+							strategy,
+							m_transactionRegistry,
+							m_utFacadeFactory,
+							*m_pUtCache)) {
 				// add 5 transaction infos to UT cache with multipliers alternating between 10 and 20
 				m_transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs({
 					{ 201, 200 }, { 202, 100 }, { 203, 200 }, { 204, 100 }, { 205, 200 }
@@ -99,11 +152,39 @@ namespace catapult { namespace harvesting {
 				return m_generator(blockHeader, maxTransactionsPerBlock);
 			}
 
+			auto generateSpeculative(Height blockHeight, uint32_t maxTransactionsPerBlock, Timestamp blockTime = Timestamp()) {
+				model::BlockHeader blockHeader;
+				blockHeader.Height = blockHeight;
+				blockHeader.Timestamp = blockTime;
+				return m_speculativeGenerator.Generator(blockHeader, maxTransactionsPerBlock);
+			}
+
+			void prepare(Height blockHeight, uint32_t maxTransactionsPerBlock, Timestamp blockTime = Timestamp()) {
+				m_speculativeGenerator.Preparer(blockHeight, blockTime, maxTransactionsPerBlock);
+			}
+
 		public:
 			void setValidationFailure() {
 				m_executionConfig.pValidator->setResult(validators::ValidationResult::Failure);
 			}
 
+			void setValidationFailure(size_t transactionIndex) {
+				const auto& transactionHash = m_transactionInfos[transactionIndex].EntityHash;
+				m_executionConfig.pValidator->setResult(validators::ValidationResult::Failure, transactionHash, 1);
+			}
+
+			void setDeadline(size_t transactionIndex, Timestamp deadline) {
+				m_pDeadlineValidator->setDeadline(m_transactionInfos[transactionIndex].EntityHash, deadline);
+			}
+
+			void clearUtCache() {
+				std::vector<Hash256> transactionHashes;
+				for (const auto& transactionInfo : m_transactionInfos)
+					transactionHashes.push_back(transactionInfo.EntityHash);
+
+				test::RemoveAll(*m_pUtCache, transactionHashes);
+			}
+
 		private:
 			static model::BlockchainConfiguration CreateBlockchainConfiguration() {
 				auto config = model::BlockchainConfiguration::Uninitialized();
@@ -118,15 +199,25 @@ namespace catapult { namespace harvesting {
 				return cache::CacheConfiguration(databaseDirectory, cache::PatriciaTreeStorageMode::Enabled);
 			}
 
+			static chain::ExecutionConfiguration CreateExecutionConfiguration(
+					const chain::ExecutionConfiguration& executionConfig,
+					const std::shared_ptr<const validators::stateful::AggregateNotificationValidator>& pValidator) {
+				auto config = executionConfig;
+				config.pValidator = pValidator;
+				return config;
+			}
+
 		private:
 			test::TempDirectoryGuard m_dbDirGuard;
 			model::BlockchainConfiguration m_config;
 			cache::CatapultCache m_catapultCache;
 			test::MockExecutionConfiguration m_executionConfig;
 			model::TransactionRegistry m_transactionRegistry;
+			std::shared_ptr<MockDeadlineValidator> m_pDeadlineValidator;
 			HarvestingUtFacadeFactory m_utFacadeFactory;
 			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
 			BlockGenerator m_generator;
+			SpeculativeBlockGenerator m_speculativeGenerator;
 
 			std::vector<model::TransactionInfo> m_transactionInfos;
 			Hash256 m_initialStateHash;
@@ -219,4 +310,146 @@ namespace catapult { namespace harvesting {
 	}
 
 	// endregion
+
+	// region speculative generation
+
+	namespace {
+		void AssertBlockTransactionSizes(const model::Block& block, const std::vector<uint32_t>& expectedSizes) {
+			std::vector<uint32_t> sizes;
+			for (const auto& transaction : block.Transactions())
+				sizes.push_back(transaction.Size);
+
+			EXPECT_EQ(expectedSizes, sizes);
+		}
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorCanGenerateBlockWithoutPreparation) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 16);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, { 201, 202, 203, 204 });
+		EXPECT_EQ(BlockFeeMultiplier(10), pBlock->FeeMultiplier);
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorUsesPreparedTransactions) {
+		// Arrange: prepare transactions and then remove them from the ut cache
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(1), 16);
+		context.clearUtCache();
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 16);
+
+		// Assert: prepared transactions were revalidated and added to the block
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, { 201, 202, 203, 204 });
+		EXPECT_NE(Hash256(), pBlock->TransactionsHash);
+		EXPECT_EQ(BlockFeeMultiplier(10), pBlock->FeeMultiplier);
+
+		std::vector<Amount> expectedSurpluses{ Amount(201 * 10), Amount(0), Amount(203 * 10), Amount(0), Amount(0) };
+		EXPECT_EQ(context.calculateExpectedStateHash(expectedSurpluses), pBlock->StateHash);
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorConsumesPreparedTransactions) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(1), 16);
+		context.clearUtCache();
+
+		// Act:
+		auto pBlock1 = context.generateSpeculative(Cache_Height + Height(1), 16);
+		auto pBlock2 = context.generateSpeculative(Cache_Height + Height(1), 16);
+
+		// Assert: second block was generated from the (empty) ut cache
+		ASSERT_TRUE(!!pBlock1);
+		AssertBlockTransactionSizes(*pBlock1, { 201, 202, 203, 204 });
+
+		ASSERT_TRUE(!!pBlock2);
+		AssertBlockTransactionSizes(*pBlock2, {});
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorIgnoresTransactionsPreparedForDifferentHeight) {
+		// Arrange: preparation is bypassed because cache height is inconsistent with block height
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(2), 16);
+		context.clearUtCache();
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 16);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, {});
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorIgnoresTransactionsPreparedForDifferentMaxTransactionsPerBlock) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(1), 16);
+		context.clearUtCache();
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 8);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, {});
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorSelectsTransactionsWhenPreparedTransactionFailsValidation) {
+		// Arrange: invalidate second transaction after preparation
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(1), 16);
+		context.setValidationFailure(1);
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 16);
+
+		// Assert: transactions were selected from the ut cache
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, { 201, 203, 204 });
+
+		std::vector<Amount> expectedSurpluses{ Amount(201 * 10), Amount(0), Amount(203 * 10), Amount(0), Amount(0) };
+		EXPECT_EQ(context.calculateExpectedStateHash(expectedSurpluses), pBlock->StateHash);
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorSelectsTransactionsWhenPreparedTransactionExpiresBeforeGeneration) {
+		// Arrange: second transaction is valid when transactions are prepared but expires before the block is generated
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.setDeadline(1, Timestamp(150));
+		context.prepare(Cache_Height + Height(1), 16, Timestamp(100));
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 16, Timestamp(200));
+
+		// Assert: all prepared transactions were unapplied and transactions were selected from the ut cache at block time
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, { 201, 203, 204 });
+		EXPECT_EQ(BlockFeeMultiplier(10), pBlock->FeeMultiplier);
+
+		std::vector<Amount> expectedSurpluses{ Amount(201 * 10), Amount(0), Amount(203 * 10), Amount(0), Amount(0) };
+		EXPECT_EQ(context.calculateExpectedStateHash(expectedSurpluses), pBlock->StateHash);
+	}
+
+	TEST(TEST_CLASS, SpeculativeGeneratorUsesPreparedTransactionsWhenNoneExpireBeforeGeneration) {
+		// Arrange: second transaction expires after the block is generated
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.setDeadline(1, Timestamp(250));
+		context.prepare(Cache_Height + Height(1), 16, Timestamp(100));
+		context.clearUtCache();
+
+		// Act:
+		auto pBlock = context.generateSpeculative(Cache_Height + Height(1), 16, Timestamp(200));
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockTransactionSizes(*pBlock, { 201, 202, 203, 204 });
+	}
+
+	// endregion
 }}
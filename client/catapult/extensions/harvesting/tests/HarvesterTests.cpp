@@ -145,6 +145,13 @@ namespace catapult { namespace harvesting {
 				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator);
 			}
 
+			std::unique_ptr<Harvester> CreateHarvester(
+					const model::BlockchainConfiguration& config,
+					const BlockGenerator& blockGenerator,
+					const BlockPreparer& blockPreparer) {
+				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator, blockPreparer);
+			}
+
 			HarvesterDescriptor BestHarvester() const {
 				crypto::VrfProof bestVrfProof;
 				uint64_t bestHit = std::numeric_limits<uint64_t>::max();
@@ -611,4 +618,117 @@ namespace catapult { namespace harvesting {
 	}
 
 	// endregion
+
+	// region block preparer
+
+	namespace {
+		struct BlockPreparerParams {
+			catapult::Height Height;
+			catapult::Timestamp Timestamp;
+			uint32_t MaxTransactionsPerBlock;
+		};
+
+		struct BlockPreparerTestContext {
+		public:
+			BlockPreparerTestContext() : NumGeneratorCalls(0) {
+				auto config = CreateConfiguration();
+				config.MaxTransactionsPerBlock = 123;
+				pHarvester = Context.CreateHarvester(
+						config,
+						[&numGeneratorCalls = NumGeneratorCalls](const auto&, auto) {
+							++numGeneratorCalls;
+							return test::GenerateEmptyRandomBlock();
+						},
+						[&preparerParams = PreparerParams](auto height, auto timestamp, auto maxTransactionsPerBlock) {
+							preparerParams.push_back({ height, timestamp, maxTransactionsPerBlock });
+						});
+			}
+
+		public:
+			HarvesterContext Context;
+			size_t NumGeneratorCalls;
+			std::vector<BlockPreparerParams> PreparerParams;
+			std::unique_ptr<Harvester> pHarvester;
+		};
+	}
+
+	TEST(TEST_CLASS, HarvestPreparesBlockWhenNoHarvesterHasHit) {
+		// Arrange:
+		BlockPreparerTestContext context;
+		auto bestHarvester = context.Context.BestHarvester();
+		auto timestamp = context.Context.CalculateBlockGenerationTime(bestHarvester);
+		auto tooEarly = Timestamp(timestamp.unwrap() - 1000);
+
+		// Act:
+		auto pBlock = context.pHarvester->harvest(context.Context.LastBlockElement, tooEarly);
+
+		// Assert: preparer was called with next block parameters
+		EXPECT_FALSE(!!pBlock);
+		EXPECT_EQ(0u, context.NumGeneratorCalls);
+
+		ASSERT_EQ(1u, context.PreparerParams.size());
+		EXPECT_EQ(context.Context.LastBlockElement.Block.Height + Height(1), context.PreparerParams[0].Height);
+		EXPECT_EQ(tooEarly, context.PreparerParams[0].Timestamp);
+		EXPECT_EQ(123u, context.PreparerParams[0].MaxTransactionsPerBlock);
+	}
+
+	TEST(TEST_CLASS, HarvestPreparesBlockAfterReleasingUnlockedAccounts) {
+		// Arrange: create a preparer that modifies unlocked accounts (this would deadlock if the harvester still held a view)
+		HarvesterContext context;
+		size_t numUnlockedAccounts = 0;
+		auto pHarvester = context.CreateHarvester(
+				CreateConfiguration(),
+				[](const auto&, auto) { return test::GenerateEmptyRandomBlock(); },
+				[&context, &numUnlockedAccounts](auto, auto, auto) {
+					{
+						auto modifier = context.pUnlockedAccounts->modifier();
+						modifier.remove(context.SigningKeyPairs[0].publicKey());
+					}
+
+					numUnlockedAccounts = context.pUnlockedAccounts->view().size();
+				});
+
+		auto bestHarvester = context.BestHarvester();
+		auto tooEarly = Timestamp(context.CalculateBlockGenerationTime(bestHarvester).unwrap() - 1000);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, tooEarly);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock);
+		EXPECT_EQ(context.SigningKeyPairs.size() - 1, numUnlockedAccounts);
+	}
+
+	TEST(TEST_CLASS, HarvestDoesNotPrepareBlockWhenHarvesterHasHit) {
+		// Arrange:
+		BlockPreparerTestContext context;
+
+		// Act:
+		auto pBlock = context.pHarvester->harvest(context.Context.LastBlockElement, Max_Time);
+
+		// Assert:
+		EXPECT_TRUE(!!pBlock);
+		EXPECT_EQ(1u, context.NumGeneratorCalls);
+		EXPECT_TRUE(context.PreparerParams.empty());
+	}
+
+	TEST(TEST_CLASS, HarvestDoesNotPrepareBlockWhenNoAccountIsUnlocked) {
+		// Arrange:
+		BlockPreparerTestContext context;
+		{
+			auto modifier = context.Context.pUnlockedAccounts->modifier();
+			for (const auto& keyPair : context.Context.SigningKeyPairs)
+				modifier.remove(keyPair.publicKey());
+		}
+
+		// Act:
+		auto pBlock = context.pHarvester->harvest(context.Context.LastBlockElement, Max_Time);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock);
+		EXPECT_EQ(0u, context.NumGeneratorCalls);
+		EXPECT_TRUE(context.PreparerParams.empty());
+	}
+
+	// endregion
 }}
@@ -46,7 +46,8 @@ namespace catapult { namespace harvesting {
 							{ "enableAutoHarvesting", "true" },
 							{ "maxUnlockedAccounts", "2" },
 							{ "delegatePrioritizationPolicy", "Importance" },
-							{ "beneficiaryAddress", Beneficiary_Address }
+							{ "beneficiaryAddress", Beneficiary_Address },
+							{ "enableSpeculativeBlockPreparation", "true" }
 						}
 					}
 				};
@@ -65,6 +66,7 @@ namespace catapult { namespace harvesting {
 				EXPECT_EQ(0u, config.MaxUnlockedAccounts);
 				EXPECT_EQ(DelegatePrioritizationPolicy::Age, config.DelegatePrioritizationPolicy);
 				EXPECT_EQ(Address(), config.BeneficiaryAddress);
+				EXPECT_FALSE(config.EnableSpeculativeBlockPreparation);
 			}
 
 			static void AssertCustom(const HarvestingConfiguration& config) {
@@ -76,6 +78,7 @@ namespace catapult { namespace harvesting {
 				EXPECT_EQ(2u, config.MaxUnlockedAccounts);
 				EXPECT_EQ(DelegatePrioritizationPolicy::Importance, config.DelegatePrioritizationPolicy);
 				EXPECT_EQ(model::StringToAddress(Beneficiary_Address), config.BeneficiaryAddress);
+				EXPECT_TRUE(config.EnableSpeculativeBlockPreparation);
 			}
 		};
 	}
@@ -120,6 +123,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(5u, config.MaxUnlockedAccounts);
 		EXPECT_EQ(DelegatePrioritizationPolicy::Importance, config.DelegatePrioritizationPolicy);
 		EXPECT_EQ(Address(), config.BeneficiaryAddress);
+		EXPECT_FALSE(config.EnableSpeculativeBlockPreparation);
 	}
 
 	// endregion
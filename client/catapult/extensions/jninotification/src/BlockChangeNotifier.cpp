@@ -72,6 +72,9 @@ namespace catapult { namespace jninotification {
 			void notifyDropBlocksAfter(Height height) override {
 			}
 
+			void flush() override {
+			}
+
 		private:
 			void writeBlockView(JNIEnv* env,
                                 jobject obj,
@@ -33,7 +33,6 @@
 #include "src/MongoTransactionStorage.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/RootedService.h"
-#include "catapult/io/BlockStorageChangeSubscriber.h"
 #include <mongocxx/instance.hpp>
 
 namespace catapult { namespace mongo {
@@ -120,19 +119,26 @@ namespace catapult { namespace mongo {
 
 			// add a pre load handler for initializing (nemesis) storage
 			// (pPluginManager is kept alive by pTransactionRegistry)
-			auto pMongoBlockStorage = CreateMongoBlockStorage(
+			auto pBlockChangeCounters = std::make_shared<MongoBlockChangeCounters>();
+			auto pMongoBlockChangeSubscriber = CreateMongoBlockChangeSubscriber(
 					*pMongoContext,
 					dbConfig.MaxDropBatchSize,
+					dbConfig.MaxBlockBatchSize,
 					*pTransactionRegistry,
-					pPluginManager->receiptRegistry());
+					pPluginManager->receiptRegistry(),
+					pBlockChangeCounters);
+
+			// expose per collection block change counters
+			bootstrapper.pluginManager().addDiagnosticCounterHook([pBlockChangeCounters](auto& counters, const auto&) {
+				AddMongoBlockChangeDiagnosticCounters(counters, pBlockChangeCounters);
+			});
 
 			// empty unconfirmed and partial transactions collections
 			EmptyCollection(*pMongoContext, Ut_Collection_Name);
 			EmptyCollection(*pMongoContext, Pt_Collection_Name);
 
 			// register subscriptions
-			bootstrapper.subscriptionManager().addBlockChangeSubscriber(
-					io::CreateBlockStorageChangeSubscriber(std::move(pMongoBlockStorage)));
+			bootstrapper.subscriptionManager().addBlockChangeSubscriber(std::move(pMongoBlockChangeSubscriber));
 			bootstrapper.subscriptionManager().addPtChangeSubscriber(CreateMongoPtStorage(*pMongoContext, *pTransactionRegistry));
 			bootstrapper.subscriptionManager().addUtChangeSubscriber(
 					CreateMongoTransactionStorage(*pMongoContext, *pTransactionRegistry, Ut_Collection_Name));
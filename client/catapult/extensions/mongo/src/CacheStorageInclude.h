@@ -42,6 +42,10 @@ namespace catapult { namespace mongo { class MongoStorageContext; } }
 #define DEFINE_MONGO_FLAT_CACHE_STORAGE(NAME, TRAITS_NAME) \
 	DEFINE_MONGO_CACHE_STORAGE(NAME, MongoFlatCacheStorage, TRAITS_NAME)
 
+/// Defines a mongo incremental flat cache storage with \a NAME using \a TRAITS_NAME.
+#define DEFINE_MONGO_INCREMENTAL_FLAT_CACHE_STORAGE(NAME, TRAITS_NAME) \
+	DEFINE_MONGO_CACHE_STORAGE(NAME, MongoIncrementalFlatCacheStorage, TRAITS_NAME)
+
 /// Defines a mongo historical cache storage with \a NAME using \a TRAITS_NAME.
 #define DEFINE_MONGO_HISTORICAL_CACHE_STORAGE(NAME, TRAITS_NAME) \
 	DEFINE_MONGO_CACHE_STORAGE(NAME, MongoHistoricalCacheStorage, TRAITS_NAME)
@@ -41,6 +41,7 @@ namespace catapult { namespace mongo {
 		LOAD_DB_PROPERTY(DatabaseName);
 		LOAD_DB_PROPERTY(MaxWriterThreads);
 		LOAD_DB_PROPERTY(MaxDropBatchSize);
+		LOAD_DB_PROPERTY(MaxBlockBatchSize);
 		LOAD_DB_PROPERTY(WriteTimeout);
 
 #undef LOAD_DB_PROPERTY
@@ -48,7 +49,7 @@ namespace catapult { namespace mongo {
 		auto pluginsPair = utils::ExtractSectionAsUnorderedSet(bag, "plugins");
 		config.Plugins = pluginsPair.first;
 
-		utils::VerifyBagSizeExact(bag, 5 + pluginsPair.second);
+		utils::VerifyBagSizeExact(bag, 6 + pluginsPair.second);
 		return config;
 	}
 
@@ -44,6 +44,9 @@ namespace catapult { namespace mongo {
 		/// Maximum number of heights to drop at once.
 		uint32_t MaxDropBatchSize;
 
+		/// Maximum number of blocks to save at once.
+		uint32_t MaxBlockBatchSize;
+
 		/// Write timeout.
 		utils::TimeSpan WriteTimeout;
 
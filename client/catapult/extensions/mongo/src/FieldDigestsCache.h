@@ -0,0 +1,94 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "MongoFieldDiffer.h"
+#include <list>
+#include <map>
+
+namespace catapult { namespace mongo {
+
+	/// Bounded cache of document field digests that evicts the digests of the least recently saved elements.
+	template<typename TKey>
+	class FieldDigestsCache {
+	private:
+		using KeyList = std::list<TKey>;
+
+		struct Entry {
+			FieldDigests Digests;
+			typename KeyList::iterator KeyIter;
+		};
+
+	public:
+		/// Creates a cache that holds the field digests of at most \a maxSize elements.
+		explicit FieldDigestsCache(size_t maxSize) : m_maxSize(maxSize)
+		{}
+
+	public:
+		/// Gets the number of elements with cached field digests.
+		size_t size() const {
+			return m_entries.size();
+		}
+
+		/// Gets the field digests of the element with \a key or \c nullptr when they are not cached.
+		const FieldDigests* tryGet(const TKey& key) const {
+			auto iter = m_entries.find(key);
+			return m_entries.cend() == iter ? nullptr : &iter->second.Digests;
+		}
+
+	public:
+		/// Sets the field digests of the element with \a key to \a digests and marks it as most recently saved.
+		void set(const TKey& key, FieldDigests&& digests) {
+			auto iter = m_entries.find(key);
+			if (m_entries.end() != iter) {
+				iter->second.Digests = std::move(digests);
+				m_keys.splice(m_keys.begin(), m_keys, iter->second.KeyIter);
+				return;
+			}
+
+			if (0 == m_maxSize)
+				return;
+
+			if (m_entries.size() == m_maxSize) {
+				m_entries.erase(m_keys.back());
+				m_keys.pop_back();
+			}
+
+			m_keys.push_front(key);
+			m_entries.emplace(key, Entry{ std::move(digests), m_keys.begin() });
+		}
+
+		/// Removes the field digests of the element with \a key.
+		void remove(const TKey& key) {
+			auto iter = m_entries.find(key);
+			if (m_entries.end() == iter)
+				return;
+
+			m_keys.erase(iter->second.KeyIter);
+			m_entries.erase(iter);
+		}
+
+	private:
+		size_t m_maxSize;
+		KeyList m_keys;
+		std::map<TKey, Entry> m_entries;
+	};
+}}
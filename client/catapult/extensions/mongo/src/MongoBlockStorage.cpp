@@ -29,6 +29,8 @@
 #include "mappers/ResolutionStatementMapper.h"
 #include "mappers/TransactionMapper.h"
 #include "mappers/TransactionStatementMapper.h"
+#include "catapult/utils/StackTimer.h"
+#include <array>
 
 using namespace bsoncxx::builder::stream;
 
@@ -52,102 +54,113 @@ namespace catapult { namespace mongo {
 			return mappers::ToModel(cursor, numHashes);
 		}
 
-		void SaveBlockHeader(
-				const mongocxx::database& database,
-				const model::BlockElement& blockElement,
-				uint32_t totalTransactionsCount) {
-			auto blocks = database["blocks"];
-			auto dbBlock = mappers::ToDbModel(blockElement, totalTransactionsCount);
-
-			// in idempotent mode, if blockElement is already in the database, this call will be bypassed
-			// so nonzero inserted_count check is proper
-			auto result = blocks.insert_one(dbBlock.view()).value().result();
-			if (0 == result.inserted_count())
-				CATAPULT_THROW_RUNTIME_ERROR("SaveBlockHeader failed: block header was not inserted");
-		}
+		using Documents = std::vector<bsoncxx::document::value>;
 
-		size_t SaveTransactions(
+		template<typename TStatements, typename TCreateDocument>
+		thread::future<Documents> MapStatements(
 				MongoBulkWriter& bulkWriter,
-				Height height,
-				const std::vector<model::TransactionElement>& transactions,
-				const MongoTransactionRegistry& registry,
-				const MongoErrorPolicy& errorPolicy) {
-			std::atomic<size_t> totalTransactionsCount(0);
-			auto createDocuments = [height, &registry, &totalTransactionsCount](const auto& transactionElement, auto index) {
-				auto metadata = MongoTransactionMetadata(transactionElement, height, index);
-				auto documents = mappers::ToDbDocuments(transactionElement.Transaction, metadata, registry);
-				totalTransactionsCount += documents.size();
+				const TStatements& statements,
+				TCreateDocument createDocument) {
+			return bulkWriter.mapDocuments(statements, [createDocument](const auto& pair, auto) {
+				Documents documents;
+				documents.push_back(createDocument(pair.second));
 				return documents;
-			};
-			auto results = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
-
-			auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
-			errorPolicy.checkInserted(totalTransactionsCount, aggregateResult, itemsDescription);
-			return totalTransactionsCount;
+			});
 		}
 
-		void SaveBlockStatement(
-				MongoBulkWriter& bulkWriter,
-				Height height,
-				const model::BlockStatement& blockStatement,
-				const MongoReceiptRegistry& registry,
-				const MongoErrorPolicy& errorPolicy) {
-			using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
-
-			std::vector<BulkWriteResultFuture> futures;
-			std::vector<size_t> numExpectedInserts;
-
-			// transaction statements
-			numExpectedInserts.emplace_back(blockStatement.TransactionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("transactionStatements", blockStatement.TransactionStatements, [height, &registry](
-					const auto& pair,
-					auto) {
-				return mappers::ToDbModel(height, pair.second, registry);
-			}));
-
-			// address resolution statements
-			numExpectedInserts.emplace_back(blockStatement.AddressResolutionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("addressResolutionStatements", blockStatement.AddressResolutionStatements, [height](
-					const auto& pair,
-					auto) {
-				return mappers::ToDbModel(height, pair.second);
-			}));
-
-			// mosaic resolution statements
-			numExpectedInserts.emplace_back(blockStatement.MosaicResolutionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("mosaicResolutionStatements", blockStatement.MosaicResolutionStatements, [height](
-					const auto& pair,
-					auto) {
-				return mappers::ToDbModel(height, pair.second);
-			}));
-
-			auto statementsFuture = thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](
-					auto&& resultsFuture) {
-				auto insertResultsContainer = resultsFuture.get();
-				auto i = 0u;
-				auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
-				for (auto& insertResults : insertResultsContainer) {
-					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults.get())));
-					errorPolicy.checkInserted(numExpectedInserts[i], aggregateResult, itemsDescription);
-					++i;
-				}
-			});
+		// region DocumentsBatch
 
-			statementsFuture.get();
-		}
+		/// Documents of pending blocks grouped by collection.
+		class DocumentsBatch {
+		public:
+			/// Collection names in save order.
+			/// \note Blocks are saved last so that a block is only present when all of its dependent documents are present.
+			static constexpr std::array<const char*, 5> Collection_Names {{
+				"transactions",
+				"transactionStatements",
+				"addressResolutionStatements",
+				"mosaicResolutionStatements",
+				"blocks"
+			}};
+
+			/// Diagnostic counter name prefixes in save order.
+			static constexpr std::array<const char*, Collection_Names.size()> Counter_Name_Prefixes {{
+				"DB TX",
+				"DB TXST",
+				"DB ADRS",
+				"DB MORS",
+				"DB BLK"
+			}};
+
+			/// Index of the blocks collection in Collection_Names.
+			static constexpr size_t Blocks_Index = 4;
+
+		public:
+			/// Creates an empty batch.
+			DocumentsBatch() : m_numBlocks(0)
+			{}
+
+		public:
+			/// Gets the number of blocks in the batch.
+			size_t numBlocks() const {
+				return m_numBlocks;
+			}
+
+			/// Gets the height of the last block in the batch.
+			Height lastHeight() const {
+				return m_lastHeight;
+			}
+
+			/// Gets the documents for the collection at \a index.
+			const Documents& documentsAt(size_t index) const {
+				return m_documents[index];
+			}
+
+		public:
+			/// Adds \a documents to the collection at \a index.
+			void add(size_t index, Documents&& documents) {
+				auto& collectionDocuments = m_documents[index];
+				std::move(documents.begin(), documents.end(), std::back_inserter(collectionDocuments));
+			}
+
+			/// Marks the block with \a height as complete.
+			void completeBlock(Height height) {
+				++m_numBlocks;
+				m_lastHeight = height;
+			}
+
+			/// Removes all documents from the batch.
+			void clear() {
+				for (auto& documents : m_documents)
+					documents.clear();
+
+				m_numBlocks = 0;
+				m_lastHeight = Height();
+			}
+
+		private:
+			std::array<Documents, Collection_Names.size()> m_documents;
+			size_t m_numBlocks;
+			Height m_lastHeight;
+		};
+
+		// endregion
 
 		class MongoBlockStorage final : public io::LightBlockStorage {
 		public:
 			MongoBlockStorage(
 					MongoStorageContext& context,
 					uint32_t maxDropBatchSize,
+					uint32_t maxBlockBatchSize,
 					const MongoTransactionRegistry& transactionRegistry,
-					const MongoReceiptRegistry& receiptRegistry)
+					const MongoReceiptRegistry& receiptRegistry,
+					const std::shared_ptr<MongoBlockChangeCounters>& pCounters)
 					: m_context(context)
 					, m_maxDropBatchSize(maxDropBatchSize)
+					, m_maxBlockBatchSize(std::max<uint32_t>(1, maxBlockBatchSize))
 					, m_transactionRegistry(transactionRegistry)
 					, m_receiptRegistry(receiptRegistry)
+					, m_pCounters(pCounters)
 					, m_database(m_context.createDatabaseConnection())
 					, m_errorPolicy(m_context.createCollectionErrorPolicy(""))
 			{}
@@ -179,22 +192,28 @@ namespace catapult { namespace mongo {
 			void saveBlock(const model::BlockElement& blockElement) override {
 				auto height = blockElement.Block.Height;
 
+				// in idempotent mode, pending blocks are flushed by dropBlocksAfter, so blocks are effectively saved one at a time
 				if (MongoErrorPolicy::Mode::Idempotent == m_errorPolicy.mode()) {
 					dropBlocksAfter(height - Height(1));
 					dropAllAfter(height - Height(1)); // forcibly drop orphaned documents
 				}
 
-				auto dbHeight = chainHeight();
-				if (height != dbHeight + Height(1)) {
+				auto storageHeight = 0 == m_batch.numBlocks() ? chainHeight() : m_batch.lastHeight();
+				if (height != storageHeight + Height(1)) {
 					std::ostringstream out;
-					out << "cannot save block with height " << height << " when storage height is " << dbHeight;
+					out << "cannot save block with height " << height << " when storage height is " << storageHeight;
 					CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
 				}
 
-				saveBlockInternal(blockElement);
+				addBlock(blockElement);
+
+				if (m_batch.numBlocks() >= m_maxBlockBatchSize)
+					flush();
 			}
 
 			void dropBlocksAfter(Height height) override {
+				flush();
+
 				auto dbHeight = chainHeight();
 				if (dbHeight <= height)
 					return;
@@ -205,24 +224,104 @@ namespace catapult { namespace mongo {
 
 			// endregion
 
+		public:
+			/// Saves all pending blocks.
+			void flush() {
+				if (0 == m_batch.numBlocks())
+					return;
+
+				utils::StackTimer stopwatch;
+				auto numBlocks = m_batch.numBlocks();
+				auto lastHeight = m_batch.lastHeight();
+
+				// save all dependent documents in parallel before saving block headers
+				auto& bulkWriter = m_context.bulkWriter();
+				std::vector<thread::future<std::vector<thread::future<BulkWriteResult>>>> futures;
+				for (auto i = 0u; i < DocumentsBatch::Blocks_Index; ++i)
+					futures.push_back(bulkWriter.bulkInsert(DocumentsBatch::Collection_Names[i], m_batch.documentsAt(i)));
+
+				for (auto i = 0u; i < DocumentsBatch::Blocks_Index; ++i)
+					checkInserted(i, futures[i].get());
+
+				checkInserted(
+						DocumentsBatch::Blocks_Index,
+						bulkWriter.bulkInsert("blocks", m_batch.documentsAt(DocumentsBatch::Blocks_Index)).get());
+
+				setHeight(lastHeight);
+
+				auto elapsedMillis = stopwatch.millis();
+				CATAPULT_LOG(debug)
+						<< "saved " << numBlocks << " blocks ending at height " << lastHeight
+						<< " (" << m_batch.documentsAt(0).size() << " transactions) in " << elapsedMillis << "ms";
+
+				for (auto i = 0u; i < DocumentsBatch::Collection_Names.size(); ++i) {
+					m_pCounters->NumSavedDocuments[i] += m_batch.documentsAt(i).size();
+					m_pCounters->NumPendingDocuments[i] = 0;
+				}
+
+				m_batch.clear();
+			}
+
 		private:
-			void saveBlockInternal(const model::BlockElement& blockElement) {
+			void addBlock(const model::BlockElement& blockElement) {
 				auto height = blockElement.Block.Height;
-				auto totalTransactionsCount = saveTransactions(height, blockElement.Transactions);
+				auto& bulkWriter = m_context.bulkWriter();
+
+				// map all documents in parallel
+				auto transactionsFuture = bulkWriter.mapDocuments(blockElement.Transactions, [height, &registry = m_transactionRegistry](
+						const auto& transactionElement,
+						auto index) {
+					auto metadata = MongoTransactionMetadata(transactionElement, height, index);
+					return mappers::ToDbDocuments(transactionElement.Transaction, metadata, registry);
+				});
+
+				std::vector<thread::future<Documents>> statementsFutures;
+				if (blockElement.OptionalStatement) {
+					const auto& blockStatement = *blockElement.OptionalStatement;
+					const auto& receiptRegistry = m_receiptRegistry;
+					auto createTransactionStatementDocument = [height, &receiptRegistry](const auto& statement) {
+						return mappers::ToDbModel(height, statement, receiptRegistry);
+					};
+					auto createResolutionStatementDocument = [height](const auto& statement) {
+						return mappers::ToDbModel(height, statement);
+					};
+
+					statementsFutures.push_back(MapStatements(
+							bulkWriter,
+							blockStatement.TransactionStatements,
+							createTransactionStatementDocument));
+					statementsFutures.push_back(MapStatements(
+							bulkWriter,
+							blockStatement.AddressResolutionStatements,
+							createResolutionStatementDocument));
+					statementsFutures.push_back(MapStatements(
+							bulkWriter,
+							blockStatement.MosaicResolutionStatements,
+							createResolutionStatementDocument));
+				}
 
-				if (blockElement.OptionalStatement)
-					saveBlockStatement(height, *blockElement.OptionalStatement);
+				auto transactionDocuments = transactionsFuture.get();
+				auto totalTransactionsCount = static_cast<uint32_t>(transactionDocuments.size());
 
-				SaveBlockHeader(m_database, blockElement, static_cast<uint32_t>(totalTransactionsCount));
-				setHeight(height);
-			}
+				m_batch.add(0, std::move(transactionDocuments));
+				for (auto i = 0u; i < statementsFutures.size(); ++i)
+					m_batch.add(1 + i, statementsFutures[i].get());
 
-			size_t saveTransactions(Height height, const std::vector<model::TransactionElement>& transactions) {
-				return SaveTransactions(m_context.bulkWriter(), height, transactions, m_transactionRegistry, m_errorPolicy);
+				Documents blockDocuments;
+				blockDocuments.push_back(mappers::ToDbModel(blockElement, totalTransactionsCount));
+				m_batch.add(DocumentsBatch::Blocks_Index, std::move(blockDocuments));
+				m_batch.completeBlock(height);
+
+				for (auto i = 0u; i < DocumentsBatch::Collection_Names.size(); ++i)
+					m_pCounters->NumPendingDocuments[i] = m_batch.documentsAt(i).size();
 			}
 
-			void saveBlockStatement(Height height, const model::BlockStatement& blockStatement) {
-				SaveBlockStatement(m_context.bulkWriter(), height, blockStatement, m_receiptRegistry, m_errorPolicy);
+			void checkInserted(size_t collectionIndex, std::vector<thread::future<BulkWriteResult>>&& results) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
+
+				std::ostringstream out;
+				out << DocumentsBatch::Collection_Names[collectionIndex] << " at heights ending at " << m_batch.lastHeight();
+				m_errorPolicy.checkInserted(m_batch.documentsAt(collectionIndex).size(), aggregateResult, out.str());
 			}
 
 			void setHeight(Height height) {
@@ -279,10 +378,35 @@ namespace catapult { namespace mongo {
 		private:
 			MongoStorageContext& m_context;
 			uint32_t m_maxDropBatchSize;
+			uint32_t m_maxBlockBatchSize;
 			const MongoTransactionRegistry& m_transactionRegistry;
 			const MongoReceiptRegistry& m_receiptRegistry;
+			std::shared_ptr<MongoBlockChangeCounters> m_pCounters;
 			MongoDatabase m_database;
 			MongoErrorPolicy m_errorPolicy;
+			DocumentsBatch m_batch;
+		};
+
+		class MongoBlockChangeSubscriber : public io::BlockChangeSubscriber {
+		public:
+			explicit MongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage) : m_pStorage(std::move(pStorage))
+			{}
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				m_pStorage->saveBlock(blockElement);
+			}
+
+			void notifyDropBlocksAfter(Height height) override {
+				m_pStorage->dropBlocksAfter(height);
+			}
+
+			void flush() override {
+				m_pStorage->flush();
+			}
+
+		private:
+			std::unique_ptr<MongoBlockStorage> m_pStorage;
 		};
 	}
 
@@ -291,6 +415,44 @@ namespace catapult { namespace mongo {
 			uint32_t maxDropBatchSize,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry) {
-		return std::make_unique<MongoBlockStorage>(context, maxDropBatchSize, transactionRegistry, receiptRegistry);
+		return std::make_unique<MongoBlockStorage>(
+				context,
+				maxDropBatchSize,
+				1,
+				transactionRegistry,
+				receiptRegistry,
+				std::make_shared<MongoBlockChangeCounters>());
+	}
+
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(
+			MongoStorageContext& context,
+			uint32_t maxDropBatchSize,
+			uint32_t maxBlockBatchSize,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry,
+			const std::shared_ptr<MongoBlockChangeCounters>& pCounters) {
+		auto pStorage = std::make_unique<MongoBlockStorage>(
+				context,
+				maxDropBatchSize,
+				maxBlockBatchSize,
+				transactionRegistry,
+				receiptRegistry,
+				pCounters);
+		return std::make_unique<MongoBlockChangeSubscriber>(std::move(pStorage));
+	}
+
+	void AddMongoBlockChangeDiagnosticCounters(
+			std::vector<utils::DiagnosticCounter>& counters,
+			const std::shared_ptr<const MongoBlockChangeCounters>& pCounters) {
+		static_assert(MongoBlockChangeCounters::Num_Collections == DocumentsBatch::Collection_Names.size());
+		for (auto i = 0u; i < MongoBlockChangeCounters::Num_Collections; ++i) {
+			std::string prefix = DocumentsBatch::Counter_Name_Prefixes[i];
+			counters.emplace_back(utils::DiagnosticCounterId(prefix + " PEND"), [pCounters, i]() {
+				return pCounters->NumPendingDocuments[i].load();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId(prefix + " SAVED"), [pCounters, i]() {
+				return pCounters->NumSavedDocuments[i].load();
+			});
+		}
 	}
 }}
@@ -21,7 +21,11 @@
 
 #pragma once
 #include "MongoStorageContext.h"
+#include "catapult/io/BlockChangeSubscriber.h"
 #include "catapult/io/BlockStorage.h"
+#include "catapult/utils/DiagnosticCounter.h"
+#include <array>
+#include <atomic>
 
 namespace catapult {
 	namespace mongo {
@@ -38,4 +42,32 @@ namespace catapult { namespace mongo {
 			uint32_t maxDropBatchSize,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry);
+
+	/// Per collection document counters of a mongodb block change subscriber.
+	struct MongoBlockChangeCounters {
+		/// Number of collections written by a block change subscriber.
+		static constexpr size_t Num_Collections = 5;
+
+		/// Number of documents buffered for each collection but not yet saved.
+		std::array<std::atomic<uint64_t>, Num_Collections> NumPendingDocuments{};
+
+		/// Number of documents saved to each collection.
+		std::array<std::atomic<uint64_t>, Num_Collections> NumSavedDocuments{};
+	};
+
+	/// Creates a mongodb block change subscriber around \a context, \a maxDropBatchSize, \a maxBlockBatchSize,
+	/// \a transactionRegistry and \a receiptRegistry that updates \a pCounters.
+	/// \note Saved blocks are buffered and written together when flushed or when \a maxBlockBatchSize blocks are pending.
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(
+			MongoStorageContext& context,
+			uint32_t maxDropBatchSize,
+			uint32_t maxBlockBatchSize,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry,
+			const std::shared_ptr<MongoBlockChangeCounters>& pCounters);
+
+	/// Adds diagnostic counters for all collections tracked by \a pCounters to \a counters.
+	void AddMongoBlockChangeDiagnosticCounters(
+			std::vector<utils::DiagnosticCounter>& counters,
+			const std::shared_ptr<const MongoBlockChangeCounters>& pCounters);
 }}
@@ -44,13 +44,15 @@ namespace catapult { namespace mongo {
 	/// \note The bulk writer supports inserting, upserting and deleting documents.
 	class MongoBulkWriter final : public std::enable_shared_from_this<MongoBulkWriter> {
 	private:
+		enum class BulkWriteOrder { Ordered, Unordered };
+
 		struct BulkWriteParams {
 		public:
-			BulkWriteParams(MongoBulkWriter& bulkWriter, const std::string& collectionName)
+			BulkWriteParams(MongoBulkWriter& bulkWriter, const std::string& collectionName, BulkWriteOrder order)
 					: pConnection(bulkWriter.m_connectionPool.acquire())
 					, Database(pConnection->database(bulkWriter.m_dbName))
 					, Collection(Database[collectionName])
-					, Bulk(Collection.create_bulk_write(GetBulkWriteOptions(bulkWriter)))
+					, Bulk(Collection.create_bulk_write(GetBulkWriteOptions(bulkWriter, order)))
 		{}
 
 		public:
@@ -60,15 +62,17 @@ namespace catapult { namespace mongo {
 			mongocxx::bulk_write Bulk;
 
 		private:
-			static mongocxx::options::bulk_write GetBulkWriteOptions(const MongoBulkWriter& bulkWriter) {
+			static mongocxx::options::bulk_write GetBulkWriteOptions(const MongoBulkWriter& bulkWriter, BulkWriteOrder order) {
 				mongocxx::options::bulk_write options;
 				options.write_concern(bulkWriter.writeOptions());
+				options.ordered(BulkWriteOrder::Ordered == order);
 				return options;
 			}
 		};
 
 		using AccountStates = std::unordered_set<std::shared_ptr<const state::AccountState>>;
 		using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
+		using Documents = std::vector<bsoncxx::document::value>;
 
 		template<typename TEntity>
 		using AppendOperation = consumer<mongocxx::bulk_write&, const TEntity&, uint32_t>;
@@ -77,7 +81,7 @@ namespace catapult { namespace mongo {
 		using CreateDocument = std::function<bsoncxx::document::value (const TEntity&, uint32_t)>;
 
 		template<typename TEntity>
-		using CreateDocuments = std::function<std::vector<bsoncxx::document::value> (const TEntity&, uint32_t)>;
+		using CreateDocuments = std::function<Documents (const TEntity&, uint32_t)>;
 
 		template<typename TEntity>
 		using CreateFilter = std::function<bsoncxx::document::value (const TEntity&)>;
@@ -150,6 +154,16 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Inserts (already mapped) \a documents into the collection named \a collectionName.
+		/// \note Insertions are unordered, so \a documents must not depend on each other.
+		BulkWriteResultFuture bulkInsert(const std::string& collectionName, const Documents& documents) {
+			auto appendOperation = [](auto& bulk, const auto& document, auto) {
+				bulk.append(mongocxx::model::insert_one(document.view()));
+			};
+
+			return bulkWrite<Documents>(collectionName, documents, appendOperation, BulkWriteOrder::Unordered);
+		}
+
 		/// Upserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
 		/// to documents (\a createDocument) matching the specified entity filter (\a createFilter).
 		template<typename TContainer>
@@ -169,6 +183,24 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Updates \a entities in the collection named \a collectionName using a one-to-one mapping of entities
+		/// to update documents (\a createUpdate) matching the specified entity filter (\a createFilter).
+		/// \note Entities that are not already present in the collection are not inserted.
+		template<typename TContainer>
+		BulkWriteResultFuture bulkUpdate(
+				const std::string& collectionName,
+				const TContainer& entities,
+				const CreateDocument<typename TContainer::value_type>& createUpdate,
+				const CreateFilter<typename TContainer::value_type>& createFilter) {
+			auto appendOperation = [createUpdate, createFilter](auto& bulk, const auto& entity, auto index) {
+				auto update = createUpdate(entity, index);
+				auto filter = createFilter(entity);
+				bulk.append(mongocxx::model::update_one(filter.view(), update.view()));
+			};
+
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+		}
+
 		/// Deletes \a entities from the collection named \a collectionName matching the specified entity filter (\a createFilter).
 		template<typename TContainer>
 		BulkWriteResultFuture bulkDelete(
@@ -183,6 +215,37 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Maps \a entities to documents using a one-to-many mapping of entities to documents (\a createDocuments).
+		/// \note Mapping is performed concurrently but the returned documents are ordered like \a entities.
+		template<typename TContainer>
+		thread::future<Documents> mapDocuments(
+				const TContainer& entities,
+				const CreateDocuments<typename TContainer::value_type>& createDocuments) {
+			if (entities.empty())
+				return thread::make_ready_future(Documents());
+
+			auto numPartitions = std::min<size_t>(entities.size(), m_pool.numWorkerThreads());
+			auto pPartitionDocuments = std::make_shared<std::vector<Documents>>(numPartitions);
+			auto workCallback = [createDocuments, pPartitionDocuments](auto itBegin, auto itEnd, auto startIndex, auto batchIndex) {
+				auto& partitionDocuments = (*pPartitionDocuments)[batchIndex];
+				auto index = static_cast<uint32_t>(startIndex);
+				for (auto iter = itBegin; itEnd != iter; ++iter, ++index) {
+					for (auto& entityDocument : createDocuments(*iter, index))
+						partitionDocuments.push_back(std::move(entityDocument));
+				}
+			};
+
+			auto& ioContext = m_pool.ioContext();
+			return thread::compose(ParallelForPartition(ioContext, entities, numPartitions, workCallback), [pPartitionDocuments](
+					const auto&) {
+				Documents documents;
+				for (auto& partitionDocuments : *pPartitionDocuments)
+					std::move(partitionDocuments.begin(), partitionDocuments.end(), std::back_inserter(documents));
+
+				return thread::make_ready_future(std::move(documents));
+			});
+		}
+
 	private:
 		thread::future<BulkWriteResult> handleBulkOperation(
 				const std::string& collectionName,
@@ -244,18 +307,19 @@ namespace catapult { namespace mongo {
 		BulkWriteResultFuture bulkWrite(
 				const std::string& collectionName,
 				const TContainer& entities,
-				const AppendOperation<typename TContainer::value_type>& appendOperation) {
+				const AppendOperation<typename TContainer::value_type>& appendOperation,
+				BulkWriteOrder order = BulkWriteOrder::Ordered) {
 			if (entities.empty())
 				return thread::make_ready_future(std::vector<thread::future<BulkWriteResult>>());
 
 			auto numThreads = m_pool.numWorkerThreads();
 			auto pContext = std::make_shared<BulkWriteContext>(std::min<size_t>(entities.size(), numThreads));
-			auto workCallback = [pThis = shared_from_this(), entitiesStart = entities.cbegin(), collectionName, appendOperation, pContext](
+			auto workCallback = [pThis = shared_from_this(), collectionName, appendOperation, order, pContext](
 					auto itBegin,
 					auto itEnd,
 					auto startIndex,
 					auto batchIndex) {
-				auto pBulkWriteParams = std::make_unique<BulkWriteParams>(*pThis, collectionName);
+				auto pBulkWriteParams = std::make_unique<BulkWriteParams>(*pThis, collectionName, order);
 
 				auto index = static_cast<uint32_t>(startIndex);
 				for (auto iter = itBegin; itEnd != iter; ++iter, ++index)
@@ -0,0 +1,161 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MongoFieldDiffer.h"
+#include "catapult/crypto/Hashes.h"
+#include <bsoncxx/builder/stream/document.hpp>
+#include <bsoncxx/types/bson_value/view.hpp>
+#include <algorithm>
+#include <cstring>
+
+using namespace bsoncxx::builder::stream;
+
+namespace catapult { namespace mongo {
+
+	namespace {
+		uint64_t CalculateDigest(const bsoncxx::document::view& fieldDocument) {
+			Hash256 hash;
+			crypto::Sha3_256({ fieldDocument.data(), fieldDocument.length() }, hash);
+
+			uint64_t digest;
+			std::memcpy(&digest, hash.data(), sizeof(uint64_t));
+			return digest;
+		}
+
+		uint64_t CalculateDigest(const std::string& path, const bsoncxx::types::bson_value::view& value) {
+			return CalculateDigest((document() << path << value << finalize).view());
+		}
+
+		uint64_t CalculateSubdocumentDigest(const std::string& path) {
+			// digest tracks presence of subdocument but not its fields
+			return CalculateDigest((document() << path << open_document << close_document << finalize).view());
+		}
+
+		template<typename TAction>
+		void ForEachField(const bsoncxx::document::view& fieldsDocument, TAction action) {
+			for (const auto& element : fieldsDocument) {
+				auto path = std::string(element.key());
+				if (bsoncxx::type::k_document != element.type()) {
+					auto digest = CalculateDigest(path, element.get_value());
+					action(std::move(path), element.get_value(), digest);
+					continue;
+				}
+
+				action(std::string(path), element.get_value(), CalculateSubdocumentDigest(path));
+
+				for (const auto& subElement : element.get_document().view()) {
+					auto subPath = path + "." + std::string(subElement.key());
+					auto digest = CalculateDigest(subPath, subElement.get_value());
+					action(std::move(subPath), subElement.get_value(), digest);
+				}
+			}
+		}
+
+		void SortByPath(FieldDigests& digests) {
+			std::sort(digests.begin(), digests.end(), [](const auto& lhs, const auto& rhs) {
+				return *lhs.pPath < *rhs.pPath;
+			});
+		}
+
+		const FieldDigest* FindByPath(const FieldDigests& digests, const std::string& path) {
+			auto iter = std::lower_bound(digests.cbegin(), digests.cend(), path, [](const auto& digest, const auto& value) {
+				return *digest.pPath < value;
+			});
+
+			return digests.cend() != iter && path == *iter->pPath ? &*iter : nullptr;
+		}
+
+		bool IsCoveredBy(const std::string& path, const std::vector<std::string>& parentPaths) {
+			return std::any_of(parentPaths.cbegin(), parentPaths.cend(), [&path](const auto& parentPath) {
+				return path.size() > parentPath.size()
+						&& '.' == path[parentPath.size()]
+						&& 0 == path.compare(0, parentPath.size(), parentPath);
+			});
+		}
+	}
+
+	FieldDigests MongoFieldDiffer::calculateDigests(const bsoncxx::document::view& fieldsDocument) {
+		FieldDigests digests;
+		ForEachField(fieldsDocument, [this, &digests](auto&& path, const auto&, auto digest) {
+			digests.push_back({ &internPath(std::move(path)), digest });
+		});
+
+		SortByPath(digests);
+		return digests;
+	}
+
+	FieldDiff MongoFieldDiffer::diff(const bsoncxx::document::view& fieldsDocument, const FieldDigests& previousDigests) {
+		FieldDiff result;
+
+		// 1. set all new and changed fields; a subdocument is visited before its fields,
+		//    so a subdocument that is set as a whole (e.g. after a type change) covers all of its fields
+		std::vector<std::pair<std::string, bsoncxx::types::bson_value::view>> setFields;
+		ForEachField(fieldsDocument, [this, &previousDigests, &result, &setFields](auto&& path, const auto& value, auto digest) {
+			const auto* pPreviousDigest = FindByPath(previousDigests, path);
+			if (!pPreviousDigest || digest != pPreviousDigest->Digest)
+				setFields.emplace_back(path, value);
+
+			result.Digests.push_back({ &internPath(std::move(path)), digest });
+		});
+
+		SortByPath(result.Digests);
+
+		std::vector<std::string> replacedPaths;
+		document setDocument;
+		for (const auto& setField : setFields) {
+			if (IsCoveredBy(setField.first, replacedPaths))
+				continue;
+
+			setDocument << setField.first << setField.second;
+			replacedPaths.push_back(setField.first);
+		}
+
+		// 2. unset all removed fields
+		document unsetDocument;
+		auto hasUnsetFields = false;
+		for (const auto& previousDigest : previousDigests) {
+			const auto& path = *previousDigest.pPath;
+			if (FindByPath(result.Digests, path) || IsCoveredBy(path, replacedPaths))
+				continue;
+
+			unsetDocument << path << "";
+			replacedPaths.push_back(path);
+			hasUnsetFields = true;
+		}
+
+		if (replacedPaths.empty())
+			return result;
+
+		document updateDocument;
+		if (!setFields.empty())
+			updateDocument << "$set" << bsoncxx::types::b_document{ setDocument.view() };
+
+		if (hasUnsetFields)
+			updateDocument << "$unset" << bsoncxx::types::b_document{ unsetDocument.view() };
+
+		result.Update = updateDocument << finalize;
+		return result;
+	}
+
+	const std::string& MongoFieldDiffer::internPath(std::string&& path) {
+		return *m_paths.insert(std::move(path)).first;
+	}
+}}
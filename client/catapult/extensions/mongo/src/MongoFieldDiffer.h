@@ -0,0 +1,69 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace catapult { namespace mongo {
+
+	/// Digest of a document field.
+	struct FieldDigest {
+		/// Field path.
+		const std::string* pPath;
+
+		/// Field digest.
+		uint64_t Digest;
+	};
+
+	/// Document field digests sorted by path.
+	using FieldDigests = std::vector<FieldDigest>;
+
+	/// Field-level difference between two documents.
+	struct FieldDiff {
+		/// Field digests of the new document.
+		FieldDigests Digests;
+
+		/// Update document composed of \c $set and \c $unset operations (unset when documents are equal).
+		std::optional<bsoncxx::document::value> Update;
+	};
+
+	/// Calculates field-level differences between documents.
+	/// \note Fields of top-level subdocuments are diffed individually, all other fields are diffed as a whole.
+	class MongoFieldDiffer {
+	public:
+		/// Calculates field digests of \a document.
+		FieldDigests calculateDigests(const bsoncxx::document::view& document);
+
+		/// Diffs \a document against the field digests (\a previousDigests) of a previously saved document.
+		FieldDiff diff(const bsoncxx::document::view& document, const FieldDigests& previousDigests);
+
+	private:
+		const std::string& internPath(std::string&& path);
+
+	private:
+		std::unordered_set<std::string> m_paths;
+	};
+}}
@@ -52,5 +52,5 @@ namespace catapult { namespace mongo { namespace storages {
 		};
 	}
 
-	DEFINE_MONGO_FLAT_CACHE_STORAGE(AccountState, AccountStateCacheTraits)
+	DEFINE_MONGO_INCREMENTAL_FLAT_CACHE_STORAGE(AccountState, AccountStateCacheTraits)
 }}}
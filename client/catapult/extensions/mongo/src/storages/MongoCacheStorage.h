@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "mongo/src/FieldDigestsCache.h"
 #include "mongo/src/MongoBulkWriter.h"
 #include "mongo/src/MongoStorageContext.h"
 #include "mongo/src/mappers/MapperUtils.h"
@@ -274,4 +275,132 @@ namespace catapult { namespace mongo { namespace storages {
 		MongoBulkWriter& m_bulkWriter;
 		model::NetworkIdentifier m_networkIdentifier;
 	};
+
+	/// Mongo cache storage that persists flat cache data using delete and field-level updates.
+	/// \note Elements saved for the first time (by this storage) are upserted as whole documents,
+	///       subsequent modifications only \c $set and \c $unset the changed fields.
+	///       Field digests are only tracked for the most recently saved elements, so modifications of
+	///       elements that have been evicted are upserted as whole documents again.
+	template<typename TCacheTraits>
+	class MongoIncrementalFlatCacheStorage : public ExternalCacheStorageT<typename TCacheTraits::CacheType> {
+	private:
+		using CacheChangesType = cache::SingleCacheChangesT<typename TCacheTraits::CacheDeltaType, typename TCacheTraits::ModelType>;
+		using KeyType = typename TCacheTraits::KeyType;
+		using ModelType = typename TCacheTraits::ModelType;
+		using ElementContainerType = std::unordered_set<const ModelType*>;
+		using ElementDocument = std::pair<const ModelType*, bsoncxx::document::value>;
+
+	public:
+		/// Default maximum number of elements with tracked field digests.
+		static constexpr size_t Default_Max_Tracked_Elements = 100'000;
+
+	public:
+		/// Creates a cache storage around \a storageContext and \a networkIdentifier that tracks
+		/// the field digests of at most \a maxTrackedElements elements.
+		MongoIncrementalFlatCacheStorage(
+				MongoStorageContext& storageContext,
+				model::NetworkIdentifier networkIdentifier,
+				size_t maxTrackedElements = Default_Max_Tracked_Elements)
+				: m_database(storageContext.createDatabaseConnection())
+				, m_errorPolicy(storageContext.createCollectionErrorPolicy(TCacheTraits::Collection_Name))
+				, m_bulkWriter(storageContext.bulkWriter())
+				, m_networkIdentifier(networkIdentifier)
+				, m_fieldDigests(maxTrackedElements)
+		{}
+
+	private:
+		void saveDelta(const CacheChangesType& changes) override {
+			auto addedElements = changes.addedElements();
+			auto modifiedElements = changes.modifiedElements();
+			auto removedElements = changes.removedElements();
+
+			// 1. remove elements common to both added and removed
+			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
+
+			// 2. remove all removed elements from db
+			removeAll(removedElements);
+
+			// 3. upsert untracked elements and update tracked elements
+			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
+			saveAll(modifiedElements);
+		}
+
+	private:
+		void removeAll(const ElementContainerType& elements) {
+			if (elements.empty())
+				return;
+
+			auto deleteResults = m_bulkWriter.bulkDelete(TCacheTraits::Collection_Name, elements, CreateFilter).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(deleteResults)));
+			m_errorPolicy.checkDeleted(elements.size(), aggregateResult, "removed elements");
+
+			for (const auto* pElement : elements)
+				m_fieldDigests.remove(TCacheTraits::GetId(*pElement));
+		}
+
+		void saveAll(const ElementContainerType& elements) {
+			if (elements.empty())
+				return;
+
+			std::vector<ElementDocument> upserts;
+			std::vector<ElementDocument> updates;
+			std::vector<std::pair<KeyType, FieldDigests>> fieldDigestsUpdates;
+			for (const auto* pElement : elements) {
+				auto key = TCacheTraits::GetId(*pElement);
+				auto elementDocument = TCacheTraits::MapToMongoDocument(*pElement, m_networkIdentifier);
+
+				const auto* pFieldDigests = m_fieldDigests.tryGet(key);
+				if (!pFieldDigests) {
+					fieldDigestsUpdates.emplace_back(key, m_differ.calculateDigests(elementDocument.view()));
+					upserts.emplace_back(pElement, std::move(elementDocument));
+					continue;
+				}
+
+				auto fieldDiff = m_differ.diff(elementDocument.view(), *pFieldDigests);
+				if (!fieldDiff.Update)
+					continue;
+
+				fieldDigestsUpdates.emplace_back(key, std::move(fieldDiff.Digests));
+				updates.emplace_back(pElement, std::move(*fieldDiff.Update));
+			}
+
+			auto getDocument = [](const auto& elementDocument, auto) {
+				return elementDocument.second;
+			};
+			auto createFilter = [](const auto& elementDocument) {
+				return CreateFilter(elementDocument.first);
+			};
+			auto upsertResultsFuture = m_bulkWriter.bulkUpsert(TCacheTraits::Collection_Name, upserts, getDocument, createFilter);
+			auto updateResultsFuture = m_bulkWriter.bulkUpdate(TCacheTraits::Collection_Name, updates, getDocument, createFilter);
+
+			auto upsertResult = BulkWriteResult::Aggregate(thread::get_all(upsertResultsFuture.get()));
+			m_errorPolicy.checkUpserted(upserts.size(), upsertResult, "added and untracked modified elements");
+
+			auto updateResult = BulkWriteResult::Aggregate(thread::get_all(updateResultsFuture.get()));
+			m_errorPolicy.checkUpserted(updates.size(), updateResult, "tracked modified elements");
+
+			// only track field digests after all documents have been saved
+			for (auto& pair : fieldDigestsUpdates)
+				m_fieldDigests.set(pair.first, std::move(pair.second));
+		}
+
+	private:
+		static bsoncxx::document::value CreateFilter(const ModelType* pModel) {
+			return CreateFilterByKey(TCacheTraits::GetId(*pModel));
+		}
+
+		static bsoncxx::document::value CreateFilterByKey(const KeyType& key) {
+			using namespace bsoncxx::builder::stream;
+
+			return document() << std::string(TCacheTraits::Id_Property_Name) << TCacheTraits::MapToMongoId(key) << finalize;
+		}
+
+	private:
+		MongoDatabase m_database;
+		MongoErrorPolicy m_errorPolicy;
+		MongoBulkWriter& m_bulkWriter;
+		model::NetworkIdentifier m_networkIdentifier;
+		MongoFieldDiffer m_differ;
+		FieldDigestsCache<KeyType> m_fieldDigests;
+	};
 }}}
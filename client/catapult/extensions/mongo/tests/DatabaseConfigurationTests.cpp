@@ -40,6 +40,7 @@ namespace catapult { namespace mongo {
 							{ "databaseName", "foo" },
 							{ "maxWriterThreads", "3" },
 							{ "maxDropBatchSize", "7" },
+							{ "maxBlockBatchSize", "11" },
 							{ "writeTimeout", "22s" }
 						}
 					},
@@ -64,6 +65,7 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("", config.DatabaseName);
 				EXPECT_EQ(0u, config.MaxWriterThreads);
 				EXPECT_EQ(0u, config.MaxDropBatchSize);
+				EXPECT_EQ(0u, config.MaxBlockBatchSize);
 				EXPECT_EQ(utils::TimeSpan(), config.WriteTimeout);
 				EXPECT_EQ(std::unordered_set<std::string>(), config.Plugins);
 			}
@@ -74,6 +76,7 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("foo", config.DatabaseName);
 				EXPECT_EQ(3u, config.MaxWriterThreads);
 				EXPECT_EQ(7u, config.MaxDropBatchSize);
+				EXPECT_EQ(11u, config.MaxBlockBatchSize);
 				EXPECT_EQ(utils::TimeSpan::FromSeconds(22), config.WriteTimeout);
 				EXPECT_EQ(std::unordered_set<std::string>({ "Alpha", "gamma" }), config.Plugins);
 			}
@@ -98,6 +101,7 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ("catapult", config.DatabaseName);
 		EXPECT_EQ(8u, config.MaxWriterThreads);
 		EXPECT_EQ(100u, config.MaxDropBatchSize);
+		EXPECT_EQ(100u, config.MaxBlockBatchSize);
 		EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.WriteTimeout);
 		EXPECT_FALSE(config.Plugins.empty());
 	}
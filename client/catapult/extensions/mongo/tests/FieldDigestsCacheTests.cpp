@@ -0,0 +1,159 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "mongo/src/FieldDigestsCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace mongo {
+
+#define TEST_CLASS FieldDigestsCacheTests
+
+	namespace {
+		FieldDigests CreateDigests(uint64_t seed) {
+			return { { nullptr, seed }, { nullptr, seed * 2 } };
+		}
+
+		void AssertDigests(const FieldDigestsCache<uint32_t>& cache, uint32_t key, uint64_t expectedSeed) {
+			const auto* pDigests = cache.tryGet(key);
+			ASSERT_TRUE(!!pDigests) << "key " << key;
+			ASSERT_EQ(2u, pDigests->size()) << "key " << key;
+			EXPECT_EQ(expectedSeed, (*pDigests)[0].Digest) << "key " << key;
+			EXPECT_EQ(expectedSeed * 2, (*pDigests)[1].Digest) << "key " << key;
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		FieldDigestsCache<uint32_t> cache(3);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(!!cache.tryGet(1));
+	}
+
+	TEST(TEST_CLASS, CanSetDigestsOfUnknownElements) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(3);
+
+		// Act:
+		cache.set(1, CreateDigests(11));
+		cache.set(2, CreateDigests(22));
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		AssertDigests(cache, 1, 11);
+		AssertDigests(cache, 2, 22);
+	}
+
+	TEST(TEST_CLASS, CanReplaceDigestsOfKnownElement) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(3);
+		cache.set(1, CreateDigests(11));
+
+		// Act:
+		cache.set(1, CreateDigests(33));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		AssertDigests(cache, 1, 33);
+	}
+
+	TEST(TEST_CLASS, CanRemoveDigests) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(3);
+		cache.set(1, CreateDigests(11));
+		cache.set(2, CreateDigests(22));
+
+		// Act:
+		cache.remove(1);
+		cache.remove(7);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_FALSE(!!cache.tryGet(1));
+		AssertDigests(cache, 2, 22);
+	}
+
+	TEST(TEST_CLASS, LeastRecentlySetDigestsAreEvictedWhenFull) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(3);
+		cache.set(1, CreateDigests(11));
+		cache.set(2, CreateDigests(22));
+		cache.set(3, CreateDigests(33));
+
+		// Act:
+		cache.set(4, CreateDigests(44));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_FALSE(!!cache.tryGet(1));
+		AssertDigests(cache, 2, 22);
+		AssertDigests(cache, 3, 33);
+		AssertDigests(cache, 4, 44);
+	}
+
+	TEST(TEST_CLASS, ReplacingDigestsMarksElementAsMostRecentlySet) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(3);
+		cache.set(1, CreateDigests(11));
+		cache.set(2, CreateDigests(22));
+		cache.set(3, CreateDigests(33));
+
+		// Act:
+		cache.set(1, CreateDigests(55));
+		cache.set(4, CreateDigests(44));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_FALSE(!!cache.tryGet(2));
+		AssertDigests(cache, 1, 55);
+		AssertDigests(cache, 3, 33);
+		AssertDigests(cache, 4, 44);
+	}
+
+	TEST(TEST_CLASS, RemovedElementsDoNotCountTowardsSize) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(2);
+		cache.set(1, CreateDigests(11));
+		cache.set(2, CreateDigests(22));
+		cache.remove(2);
+
+		// Act:
+		cache.set(3, CreateDigests(33));
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		AssertDigests(cache, 1, 11);
+		AssertDigests(cache, 3, 33);
+	}
+
+	TEST(TEST_CLASS, ZeroSizeCacheDoesNotTrackDigests) {
+		// Arrange:
+		FieldDigestsCache<uint32_t> cache(0);
+
+		// Act:
+		cache.set(1, CreateDigests(11));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(!!cache.tryGet(1));
+	}
+}}
@@ -0,0 +1,199 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "mongo/src/MongoFieldDiffer.h"
+#include "tests/TestHarness.h"
+#include <bsoncxx/builder/stream/document.hpp>
+#include <bsoncxx/json.hpp>
+
+using namespace bsoncxx::builder::stream;
+
+namespace catapult { namespace mongo {
+
+#define TEST_CLASS MongoFieldDifferTests
+
+	namespace {
+		std::vector<std::string> GetPaths(const FieldDigests& digests) {
+			std::vector<std::string> paths;
+			for (const auto& digest : digests)
+				paths.push_back(*digest.pPath);
+
+			return paths;
+		}
+
+		auto CreateSubdocument(int32_t x, int32_t y) {
+			return document()
+					<< "a" << 1
+					<< "s" << open_document
+						<< "x" << x
+						<< "y" << y
+					<< close_document
+					<< finalize;
+		}
+
+		void AssertUpdate(
+				const bsoncxx::document::value& previousDocument,
+				const bsoncxx::document::value& newDocument,
+				const bsoncxx::document::value& expectedUpdate) {
+			// Arrange:
+			MongoFieldDiffer differ;
+			auto previousDigests = differ.calculateDigests(previousDocument.view());
+
+			// Act:
+			auto fieldDiff = differ.diff(newDocument.view(), previousDigests);
+
+			// Assert:
+			ASSERT_TRUE(!!fieldDiff.Update);
+			EXPECT_EQ(bsoncxx::to_json(expectedUpdate.view()), bsoncxx::to_json(fieldDiff.Update->view()));
+		}
+	}
+
+	// region calculateDigests
+
+	TEST(TEST_CLASS, CanCalculateDigestsOfFlatDocument) {
+		// Arrange:
+		MongoFieldDiffer differ;
+		auto fieldsDocument = document() << "b" << 2 << "a" << "alpha" << finalize;
+
+		// Act:
+		auto digests = differ.calculateDigests(fieldsDocument.view());
+
+		// Assert: digests are sorted by path
+		EXPECT_EQ(std::vector<std::string>({ "a", "b" }), GetPaths(digests));
+		EXPECT_NE(digests[0].Digest, digests[1].Digest);
+	}
+
+	TEST(TEST_CLASS, CanCalculateDigestsOfDocumentWithSubdocument) {
+		// Arrange:
+		MongoFieldDiffer differ;
+
+		// Act:
+		auto digests = differ.calculateDigests(CreateSubdocument(3, 4).view());
+
+		// Assert: subdocument fields are tracked individually
+		EXPECT_EQ(std::vector<std::string>({ "a", "s", "s.x", "s.y" }), GetPaths(digests));
+	}
+
+	TEST(TEST_CLASS, DigestsDependOnFieldValues) {
+		// Arrange:
+		MongoFieldDiffer differ;
+
+		// Act:
+		auto digests1 = differ.calculateDigests(CreateSubdocument(3, 4).view());
+		auto digests2 = differ.calculateDigests(CreateSubdocument(3, 5).view());
+
+		// Assert: only digests of changed field differ
+		ASSERT_EQ(4u, digests1.size());
+		ASSERT_EQ(4u, digests2.size());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(digests1[i].Digest, digests2[i].Digest) << *digests1[i].pPath;
+
+		EXPECT_NE(digests1[3].Digest, digests2[3].Digest);
+	}
+
+	// endregion
+
+	// region diff
+
+	TEST(TEST_CLASS, DiffDoesNotCreateUpdateWhenDocumentsAreEqual) {
+		// Arrange:
+		MongoFieldDiffer differ;
+		auto previousDigests = differ.calculateDigests(CreateSubdocument(3, 4).view());
+
+		// Act:
+		auto fieldDiff = differ.diff(CreateSubdocument(3, 4).view(), previousDigests);
+
+		// Assert:
+		EXPECT_FALSE(!!fieldDiff.Update);
+		EXPECT_EQ(std::vector<std::string>({ "a", "s", "s.x", "s.y" }), GetPaths(fieldDiff.Digests));
+	}
+
+	TEST(TEST_CLASS, DiffReturnsDigestsOfNewDocument) {
+		// Arrange:
+		MongoFieldDiffer differ;
+		auto previousDigests = differ.calculateDigests(CreateSubdocument(3, 4).view());
+		auto expectedDigests = differ.calculateDigests(CreateSubdocument(7, 4).view());
+
+		// Act:
+		auto fieldDiff = differ.diff(CreateSubdocument(7, 4).view(), previousDigests);
+
+		// Assert:
+		ASSERT_EQ(expectedDigests.size(), fieldDiff.Digests.size());
+		for (auto i = 0u; i < expectedDigests.size(); ++i) {
+			EXPECT_EQ(expectedDigests[i].pPath, fieldDiff.Digests[i].pPath) << i;
+			EXPECT_EQ(expectedDigests[i].Digest, fieldDiff.Digests[i].Digest) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, DiffSetsChangedTopLevelFields) {
+		AssertUpdate(
+				document() << "a" << 1 << "b" << 2 << finalize,
+				document() << "a" << 1 << "b" << 3 << finalize,
+				document() << "$set" << open_document << "b" << 3 << close_document << finalize);
+	}
+
+	TEST(TEST_CLASS, DiffSetsOnlyChangedSubdocumentFields) {
+		AssertUpdate(
+				CreateSubdocument(3, 4),
+				CreateSubdocument(3, 5),
+				document() << "$set" << open_document << "s.y" << 5 << close_document << finalize);
+	}
+
+	TEST(TEST_CLASS, DiffSetsAddedFields) {
+		AssertUpdate(
+				document() << "a" << 1 << finalize,
+				document() << "a" << 1 << "b" << 2 << finalize,
+				document() << "$set" << open_document << "b" << 2 << close_document << finalize);
+	}
+
+	TEST(TEST_CLASS, DiffUnsetsRemovedFields) {
+		AssertUpdate(
+				document() << "a" << 1 << "b" << 2 << finalize,
+				document() << "a" << 1 << finalize,
+				document() << "$unset" << open_document << "b" << "" << close_document << finalize);
+	}
+
+	TEST(TEST_CLASS, DiffUnsetsRemovedSubdocumentAsWhole) {
+		AssertUpdate(
+				CreateSubdocument(3, 4),
+				document() << "a" << 1 << finalize,
+				document() << "$unset" << open_document << "s" << "" << close_document << finalize);
+	}
+
+	TEST(TEST_CLASS, DiffSetsSubdocumentAsWholeWhenFieldTypeChanges) {
+		AssertUpdate(
+				CreateSubdocument(3, 4),
+				document() << "a" << 1 << "s" << 5 << finalize,
+				document() << "$set" << open_document << "s" << 5 << close_document << finalize);
+	}
+
+	TEST(TEST_CLASS, DiffCanSetAndUnsetFields) {
+		AssertUpdate(
+				document() << "a" << 1 << "b" << 2 << finalize,
+				document() << "a" << 2 << "c" << 3 << finalize,
+				document()
+						<< "$set" << open_document << "a" << 2 << "c" << 3 << close_document
+						<< "$unset" << open_document << "b" << "" << close_document
+						<< finalize);
+	}
+
+	// endregion
+}}
@@ -88,6 +88,30 @@ namespace catapult { namespace mongo {
 			return decltype(pBlockStorage)(pBlockStorage.get(), [pMongoReceiptRegistry, pBlockStorage](const auto*) {});
 		}
 
+		std::shared_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(
+				uint32_t maxBlockBatchSize,
+				const std::shared_ptr<MongoBlockChangeCounters>& pCounters = std::make_shared<MongoBlockChangeCounters>()) {
+			auto pMongoReceiptRegistry = std::make_shared<MongoReceiptRegistry>();
+			auto mockReceiptType = utils::to_underlying_type(mocks::MockReceipt::Receipt_Type);
+			pMongoReceiptRegistry->registerPlugin(mocks::CreateMockReceiptMongoPlugin(mockReceiptType));
+			const auto& receiptRegistry = *pMongoReceiptRegistry;
+			auto pSubscriber = test::CreateMongoStorage<io::BlockChangeSubscriber>(
+					mocks::CreateMockTransactionMongoPlugin(),
+					test::DbInitializationType::None,
+					MongoErrorPolicy::Mode::Strict,
+					[maxBlockBatchSize, &receiptRegistry, pCounters](auto& context, const auto& transactionRegistry) {
+						return mongo::CreateMongoBlockChangeSubscriber(
+								context,
+								Max_Drop_Batch_Size,
+								maxBlockBatchSize,
+								transactionRegistry,
+								receiptRegistry,
+								pCounters);
+					});
+
+			return decltype(pSubscriber)(pSubscriber.get(), [pMongoReceiptRegistry, pSubscriber](const auto*) {});
+		}
+
 		size_t GetNumEntitiesAtHeight(
 				const std::string& collectionName,
 				const std::string& indexName,
@@ -726,4 +750,106 @@ namespace catapult { namespace mongo {
 	}
 
 	// endregion
+
+	// region CreateMongoBlockChangeSubscriber
+
+	namespace {
+		void AssertSavedBlocks(TestContext& context, Height height) {
+			ASSERT_EQ(height, context.storage().chainHeight());
+			BlockElementCounts blockElementCounts;
+			for (const auto& blockElement : context.elements()) {
+				if (blockElement.Block.Height <= height) {
+					AssertEqual(blockElement, Default_Transactions_Per_Block);
+					blockElementCounts.AddCounts(blockElement);
+				} else {
+					AssertNoBlockOrTransactions(blockElement.Block.Height);
+				}
+			}
+
+			AssertCollectionSizes(blockElementCounts);
+		}
+	}
+
+	TEST(TEST_CLASS, BlockChangeSubscriberDoesNotSaveBlocksBeforeFlush) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pSubscriber = CreateMongoBlockChangeSubscriber(100);
+
+		// Act:
+		for (const auto& blockElement : context.elements())
+			pSubscriber->notifyBlock(blockElement);
+
+		// Assert:
+		AssertSavedBlocks(context, Height(0));
+	}
+
+	TEST(TEST_CLASS, BlockChangeSubscriberSavesAllPendingBlocksOnFlush) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pSubscriber = CreateMongoBlockChangeSubscriber(100);
+		for (const auto& blockElement : context.elements())
+			pSubscriber->notifyBlock(blockElement);
+
+		// Act:
+		pSubscriber->flush();
+
+		// Assert:
+		AssertSavedBlocks(context, Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, BlockChangeSubscriberSavesPendingBlocksWhenMaxBlockBatchSizeIsReached) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pSubscriber = CreateMongoBlockChangeSubscriber(4);
+
+		// Act:
+		for (const auto& blockElement : context.elements())
+			pSubscriber->notifyBlock(blockElement);
+
+		// Assert: only complete batches are saved
+		AssertSavedBlocks(context, Height(8));
+	}
+
+	TEST(TEST_CLASS, BlockChangeSubscriberUpdatesCollectionCounters) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pCounters = std::make_shared<MongoBlockChangeCounters>();
+		auto pSubscriber = CreateMongoBlockChangeSubscriber(4, pCounters);
+
+		// Act:
+		for (const auto& blockElement : context.elements())
+			pSubscriber->notifyBlock(blockElement);
+
+		// Assert: blocks and transactions of complete batches are saved, remaining ones are pending
+		auto numPendingBlocks = Multiple_Blocks_Count - 8;
+		EXPECT_EQ(8u, pCounters->NumSavedDocuments[4].load());
+		EXPECT_EQ(numPendingBlocks, pCounters->NumPendingDocuments[4].load());
+		EXPECT_EQ(8 * Default_Transactions_Per_Block, pCounters->NumSavedDocuments[0].load());
+		EXPECT_EQ(numPendingBlocks * Default_Transactions_Per_Block, pCounters->NumPendingDocuments[0].load());
+
+		// - all diagnostic counters are exposed
+		std::vector<utils::DiagnosticCounter> counters;
+		AddMongoBlockChangeDiagnosticCounters(counters, pCounters);
+		ASSERT_EQ(2 * MongoBlockChangeCounters::Num_Collections, counters.size());
+		EXPECT_EQ("DB BLK PEND", counters[8].id().name());
+		EXPECT_EQ(numPendingBlocks, counters[8].value());
+		EXPECT_EQ("DB BLK SAVED", counters[9].id().name());
+		EXPECT_EQ(8u, counters[9].value());
+	}
+
+	TEST(TEST_CLASS, BlockChangeSubscriberSavesPendingBlocksBeforeDroppingBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pSubscriber = CreateMongoBlockChangeSubscriber(100);
+		for (const auto& blockElement : context.elements())
+			pSubscriber->notifyBlock(blockElement);
+
+		// Act:
+		pSubscriber->notifyDropBlocksAfter(Height(7));
+
+		// Assert:
+		AssertSavedBlocks(context, Height(7));
+	}
+
+	// endregion
 }}
@@ -108,4 +108,6 @@ namespace catapult { namespace mongo { namespace storages {
 	}
 
 	DEFINE_FLAT_CACHE_STORAGE_TESTS(AccountStateCacheTraits,)
+
+	MAKE_FLAT_CACHE_STORAGE_TEST(AccountStateCacheTraits,, ElementModifiedMultipleTimesIsSavedToStorage)
 }}}
@@ -110,6 +110,31 @@ namespace catapult { namespace test {
 			AssertDbContents({ element });
 		}
 
+		/// \note This test is not included in DEFINE_FLAT_CACHE_STORAGE_TESTS because it requires each mutation to change the element.
+		static void AssertElementModifiedMultipleTimesIsSavedToStorage() {
+			// Arrange:
+			CacheStorageWrapper storage;
+			auto cache = TTraits::CreateCache();
+			auto delta = cache.createDelta();
+
+			// - prepare the cache with a single element
+			auto element = TTraits::GenerateRandomElement(11);
+			TTraits::Add(delta, element);
+			storage.get().saveDelta(cache::CacheChanges(delta));
+			cache.commit(Height());
+
+			// Act:
+			for (auto i = 0u; i < 3; ++i) {
+				TTraits::Mutate(delta, element);
+				storage.get().saveDelta(cache::CacheChanges(delta));
+				cache.commit(Height());
+			}
+
+			// Assert:
+			EXPECT_EQ(1u, GetCollectionSize());
+			AssertDbContents({ element });
+		}
+
 		static void AssertDeletedElementIsRemovedFromStorage() {
 			// Arrange:
 			CacheStorageWrapper storage;
@@ -51,6 +51,7 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxHashesPerSyncAttempt = config.Node.MaxHashesPerSyncAttempt;
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
+			chainSynchronizerConfig.MaxBlockRangesPerSyncAttempt = config.Node.MaxBlockRangesPerSyncAttempt;
 			chainSynchronizerConfig.MaxRollbackBlocks = config.Blockchain.MaxRollbackBlocks;
 			return chainSynchronizerConfig;
 		}
@@ -78,8 +79,13 @@ namespace catapult { namespace sync {
 		}
 
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
-			auto utSynchronizer = chain::CreateUtSynchronizer(
-					state.config().Node.MinFeeMultiplier,
+			const auto& nodeConfig = state.config().Node;
+			auto numTableCells = nodeConfig.EnableUnconfirmedTransactionsReconciliation
+					? nodeConfig.UnconfirmedTransactionsReconciliationTableSize
+					: 0;
+			auto utSynchronizer = chain::CreateUtReconciliationSynchronizer(
+					numTableCells,
+					nodeConfig.MinFeeMultiplier,
 					state.timeSupplier(),
 					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
 					state.hooks().transactionRangeConsumerFactory()(Sync_Source),
@@ -34,9 +34,12 @@ namespace catapult { namespace syncsource {
 		struct HandlersConfiguration {
 			uint32_t MaxHashes;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
+			bool EnableUtReconciliation;
+			uint32_t UtReconciliationTableSize;
 
 			handlers::BlockRangeHandler PushBlockCallback;
 			model::ChainScoreSupplier ChainScoreSupplier;
+			handlers::UtShortHashesSupplier UtShortHashesSupplier;
 			handlers::UtRetriever UtRetriever;
 		};
 
@@ -48,6 +51,8 @@ namespace catapult { namespace syncsource {
 		void SetConfig(HandlersConfiguration& config, const config::NodeConfiguration& nodeConfig) {
 			config.MaxHashes = nodeConfig.MaxHashesPerSyncAttempt;
 			SetConfig(config.BlocksHandlerConfig, nodeConfig);
+			config.EnableUtReconciliation = nodeConfig.EnableUnconfirmedTransactionsReconciliation;
+			config.UtReconciliationTableSize = nodeConfig.UnconfirmedTransactionsReconciliationTableSize;
 		}
 
 		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
@@ -56,6 +61,7 @@ namespace catapult { namespace syncsource {
 
 			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks());
 			config.ChainScoreSupplier = [&chainScore = state.score()]() { return chainScore.get(); };
+			config.UtShortHashesSupplier = [&cache = state.utCache()]() { return cache.view().shortHashes(); };
 			config.UtRetriever = [&cache = state.utCache()](auto minDeadline, auto minFeeMultiplier, const auto& shortHashes) {
 				return cache.view().unknownTransactions(minDeadline, minFeeMultiplier, shortHashes);
 			};
@@ -81,6 +87,13 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			if (config.EnableUtReconciliation) {
+				handlers::RegisterReconcileTransactionsHandler(
+						handlers,
+						config.UtReconciliationTableSize,
+						config.UtShortHashesSupplier,
+						config.UtRetriever);
+			}
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
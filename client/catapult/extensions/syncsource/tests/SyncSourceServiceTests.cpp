@@ -87,6 +87,22 @@ namespace catapult { namespace syncsource {
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Blocks));
 
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions));
+		EXPECT_FALSE(handlers.canProcess(ionet::PacketType::Reconcile_Transactions));
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactionsHandlerIsRegisteredWhenReconciliationIsEnabled) {
+		// Arrange:
+		TestContext context;
+		const_cast<bool&>(context.testState().config().Node.EnableUnconfirmedTransactionsReconciliation) = true;
+
+		// Act:
+		context.boot();
+		const auto& handlers = context.testState().state().packetHandlers();
+
+		// Assert:
+		EXPECT_EQ(7u, handlers.size());
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Reconcile_Transactions));
 	}
 
 	// endregion
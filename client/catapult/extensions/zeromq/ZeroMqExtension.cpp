@@ -46,11 +46,26 @@ namespace catapult { namespace zeromq {
 					"zeromq.publisher",
 					extensions::ServiceRegistrarPhase::Initial));
 
+			// expose publish queue counters to the hosting process
+			bootstrapper.pluginManager().addDiagnosticCounterHook([pZeroEntityPublisher](auto& counters, const auto&) {
+				counters.emplace_back(utils::DiagnosticCounterId("ZMQ QUEUE"), [&publisher = *pZeroEntityPublisher]() {
+					return publisher.queueSize();
+				});
+				counters.emplace_back(utils::DiagnosticCounterId("ZMQ QUEUE MAX"), [&publisher = *pZeroEntityPublisher]() {
+					return publisher.maxQueueSize();
+				});
+				counters.emplace_back(utils::DiagnosticCounterId("ZMQ MESSAGES"), [&publisher = *pZeroEntityPublisher]() {
+					return publisher.numPublishedMessages();
+				});
+			});
+
 			// register subscriptions
 			auto& subscriptionManager = bootstrapper.subscriptionManager();
 			subscriptionManager.addBlockChangeSubscriber(CreateZeroMqBlockChangeSubscriber(*pZeroEntityPublisher));
 			subscriptionManager.addPtChangeSubscriber(CreateZeroMqPtChangeSubscriber(*pZeroEntityPublisher));
-			subscriptionManager.addUtChangeSubscriber(CreateZeroMqUtChangeSubscriber(*pZeroEntityPublisher));
+			subscriptionManager.addUtChangeSubscriber(config.CoalesceUnconfirmedTransactionChanges
+					? CreateZeroMqCoalescingUtChangeSubscriber(*pZeroEntityPublisher)
+					: CreateZeroMqUtChangeSubscriber(*pZeroEntityPublisher));
 			subscriptionManager.addFinalizationSubscriber(CreateZeroMqFinalizationSubscriber(*pZeroEntityPublisher));
 			subscriptionManager.addTransactionStatusSubscriber(CreateZeroMqTransactionStatusSubscriber(*pZeroEntityPublisher));
 		}
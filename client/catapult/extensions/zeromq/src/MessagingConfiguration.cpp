@@ -37,8 +37,9 @@ namespace catapult { namespace zeromq {
 
 		LOAD_PROPERTY(ListenInterface);
 		LOAD_PROPERTY(SubscriberPort);
+		LOAD_PROPERTY(CoalesceUnconfirmedTransactionChanges);
 
-		utils::VerifyBagSizeExact(bag, 2);
+		utils::VerifyBagSizeExact(bag, 3);
 		return config;
 	}
 
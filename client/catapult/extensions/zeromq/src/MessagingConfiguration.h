@@ -35,6 +35,11 @@ namespace catapult { namespace zeromq {
 		/// Subscriber port.
 		unsigned short SubscriberPort;
 
+		/// \c true if unconfirmed transaction changes delivered between two subscriber flushes should be coalesced
+		/// into net changes that are published when flushed.
+		/// \note The broker flushes subscribers once per spooled message, so changes are not coalesced across messages.
+		bool CoalesceUnconfirmedTransactionChanges;
+
 	private:
 		MessagingConfiguration() = default;
 
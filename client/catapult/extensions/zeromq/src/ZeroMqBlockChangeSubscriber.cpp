@@ -47,6 +47,10 @@ namespace catapult { namespace zeromq {
 				m_publisher.publishDropBlocks(height);
 			}
 
+			void flush() override {
+				// empty because messages are pushed by other calls
+			}
+
 		private:
 			ZeroMqEntityPublisher& m_publisher;
 		};
@@ -30,6 +30,7 @@
 #include "catapult/model/TransactionUtils.h"
 #include "catapult/thread/IoThreadPool.h"
 #include <boost/asio.hpp>
+#include <atomic>
 #include <set>
 
 namespace catapult { namespace zeromq {
@@ -39,11 +40,21 @@ namespace catapult { namespace zeromq {
 		explicit MessageGroup(const supplier<std::string>& errorMessageGenerator) : m_errorMessageGenerator(errorMessageGenerator)
 		{}
 
+	public:
+		size_t size() const {
+			return m_messages.size();
+		}
+
 	public:
 		void add(zmq::multipart_t&& message) {
 			m_messages.push_back(std::move(message));
 		}
 
+		void add(std::vector<zmq::multipart_t>&& messages) {
+			for (auto& message : messages)
+				m_messages.push_back(std::move(message));
+		}
+
 		void flush(zmq::socket_t& zmqSocket) {
 			bool result = true;
 			for (auto& message : m_messages)
@@ -62,7 +73,10 @@ namespace catapult { namespace zeromq {
 	public:
 		SynchronizedPublisher(const std::string& listenInterface, unsigned short port)
 				: m_zmqSocket(m_zmqContext, ZMQ_PUB)
-				, m_pPool(thread::CreateIoThreadPool(1, "ZeroMqEntityPublisher")) {
+				, m_pPool(thread::CreateIoThreadPool(1, "ZeroMqEntityPublisher"))
+				, m_queueSize(0)
+				, m_maxQueueSize(0)
+				, m_numPublishedMessages(0) {
 			// note that we want closing the socket to be synchronous
 			// setting linger to 0 means that all pending messages are discarded and the socket is closed immediately
 			m_zmqSocket.set(zmq::sockopt::linger, 0);
@@ -82,19 +96,56 @@ namespace catapult { namespace zeromq {
 			m_zmqSocket.close();
 		}
 
+	public:
+		size_t queueSize() const {
+			return m_queueSize;
+		}
+
+		size_t maxQueueSize() const {
+			return m_maxQueueSize;
+		}
+
+		uint64_t numPublishedMessages() const {
+			return m_numPublishedMessages;
+		}
+
 	public:
 		void queue(std::unique_ptr<MessageGroup>&& pMessageGroup) {
+			updateMaxQueueSize(++m_queueSize);
+
 			// dispatch function needs to be copyable
 			auto pMessageGroupShared = std::shared_ptr<MessageGroup>(std::move(pMessageGroup));
-			boost::asio::dispatch(m_pPool->ioContext(), [&zmqSocket = m_zmqSocket, pMessageGroup{std::move(pMessageGroupShared)}]() {
-				pMessageGroup->flush(zmqSocket);
+			boost::asio::dispatch(m_pPool->ioContext(), [this, pMessageGroup{std::move(pMessageGroupShared)}]() {
+				pMessageGroup->flush(m_zmqSocket);
+				m_numPublishedMessages += pMessageGroup->size();
+				--m_queueSize;
 			});
 		}
 
+	private:
+		void updateMaxQueueSize(size_t queueSize) {
+			auto maxQueueSize = m_maxQueueSize.load();
+			while (queueSize > maxQueueSize && !m_maxQueueSize.compare_exchange_weak(maxQueueSize, queueSize))
+			{}
+
+			if (queueSize <= maxQueueSize || queueSize < Queue_Size_Warning_Threshold)
+				return;
+
+			// only log when the high water mark reaches a power of two in order to avoid flooding the log
+			if (0 == (queueSize & (queueSize - 1)))
+				CATAPULT_LOG(warning) << "zeromq publish queue reached new maximum size " << queueSize;
+		}
+
+	private:
+		static constexpr size_t Queue_Size_Warning_Threshold = 1024;
+
 	private:
 		zmq::context_t m_zmqContext;
 		zmq::socket_t m_zmqSocket;
 		std::unique_ptr<thread::IoThreadPool> m_pPool;
+		std::atomic<size_t> m_queueSize;
+		std::atomic<size_t> m_maxQueueSize;
+		std::atomic<uint64_t> m_numPublishedMessages;
 	};
 
 	struct ZeroMqEntityPublisher::WeakTransactionInfo {
@@ -104,6 +155,7 @@ namespace catapult { namespace zeromq {
 				, EntityHash(transactionInfo.EntityHash)
 				, MerkleComponentHash(transactionInfo.MerkleComponentHash)
 				, OptionalAddresses(transactionInfo.OptionalExtractedAddresses.get())
+				, pSharedTransaction(transactionInfo.pEntity)
 		{}
 
 		explicit WeakTransactionInfo(const model::TransactionElement& element)
@@ -125,8 +177,33 @@ namespace catapult { namespace zeromq {
 		const Hash256& EntityHash;
 		const Hash256& MerkleComponentHash;
 		const model::UnresolvedAddressSet* OptionalAddresses;
+
+		/// Shared transaction storage (optional) that allows the transaction to be published without copying.
+		std::shared_ptr<const model::Transaction> pSharedTransaction;
 	};
 
+	namespace {
+		void ReleaseSharedTransaction(void*, void* pHint) {
+			delete static_cast<std::shared_ptr<const model::Transaction>*>(pHint);
+		}
+
+		void AddTransaction(
+				zmq::multipart_t& multipart,
+				const model::Transaction& transaction,
+				const std::shared_ptr<const model::Transaction>& pSharedTransaction) {
+			if (!pSharedTransaction) {
+				multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
+				return;
+			}
+
+			// zmq message references the transaction data directly and keeps it alive until the message has been sent
+			auto pHint = std::make_unique<std::shared_ptr<const model::Transaction>>(pSharedTransaction);
+			auto* pData = const_cast<model::Transaction*>(pSharedTransaction.get());
+			multipart.add(zmq::message_t(static_cast<void*>(pData), pSharedTransaction->Size, ReleaseSharedTransaction, pHint.get()));
+			pHint.release();
+		}
+	}
+
 	ZeroMqEntityPublisher::ZeroMqEntityPublisher(
 			const std::string& listenInterface,
 			unsigned short port,
@@ -137,6 +214,18 @@ namespace catapult { namespace zeromq {
 
 	ZeroMqEntityPublisher::~ZeroMqEntityPublisher() = default;
 
+	size_t ZeroMqEntityPublisher::queueSize() const {
+		return m_pSynchronizedPublisher->queueSize();
+	}
+
+	size_t ZeroMqEntityPublisher::maxQueueSize() const {
+		return m_pSynchronizedPublisher->maxQueueSize();
+	}
+
+	uint64_t ZeroMqEntityPublisher::numPublishedMessages() const {
+		return m_pSynchronizedPublisher->numPublishedMessages();
+	}
+
 	namespace {
 		auto CreateHeightMessageGenerator(const std::string& topicName, Height height) {
 			return [topicName, height]() {
@@ -190,6 +279,14 @@ namespace catapult { namespace zeromq {
 				return out.str();
 			};
 		}
+
+		auto CreateCountMessageGenerator(const std::string& topicName, size_t count) {
+			return [topicName, count]() {
+				std::ostringstream out;
+				out << "cannot publish " << count << " " << topicName << " messages";
+				return out.str();
+			};
+		}
 	}
 
 	void ZeroMqEntityPublisher::publishTransaction(
@@ -213,17 +310,59 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
-	void ZeroMqEntityPublisher::publishTransaction(
+	void ZeroMqEntityPublisher::publishTransactions(
 			TransactionMarker topicMarker,
+			const model::TransactionInfosSet& transactionInfos,
+			Height height) {
+		if (transactionInfos.empty())
+			return;
+
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateCountMessageGenerator("transaction", transactionInfos.size()));
+		for (const auto& transactionInfo : transactionInfos) {
+			WeakTransactionInfo weakTransactionInfo(transactionInfo);
+			std::vector<zmq::multipart_t> messages;
+			addMessages(messages, topicMarker, weakTransactionInfo, CreateTransactionPayloadBuilder(weakTransactionInfo, height));
+			pMessageGroup->add(std::move(messages));
+		}
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
+	void ZeroMqEntityPublisher::publishTransactionHashes(
+			TransactionMarker topicMarker,
+			const model::TransactionInfosSet& transactionInfos) {
+		if (transactionInfos.empty())
+			return;
+
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateCountMessageGenerator("transaction hash", transactionInfos.size()));
+		for (const auto& transactionInfo : transactionInfos) {
+			const auto& hash = transactionInfo.EntityHash;
+			std::vector<zmq::multipart_t> messages;
+			addMessages(messages, topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& multipart) {
+				multipart.addmem(static_cast<const void*>(&hash), Hash256::Size);
+			});
+			pMessageGroup->add(std::move(messages));
+		}
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
+	ZeroMqEntityPublisher::MessagePayloadBuilder ZeroMqEntityPublisher::CreateTransactionPayloadBuilder(
 			const WeakTransactionInfo& transactionInfo,
 			Height height) {
-		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, height](auto& multipart) {
-			const auto& transaction = transactionInfo.Transaction;
-			multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
+		return [&transactionInfo, height](auto& multipart) {
+			AddTransaction(multipart, transactionInfo.Transaction, transactionInfo.pSharedTransaction);
 			multipart.addmem(static_cast<const void*>(&transactionInfo.EntityHash), Hash256::Size);
 			multipart.addmem(static_cast<const void*>(&transactionInfo.MerkleComponentHash), Hash256::Size);
 			multipart.addtyp(height);
-		});
+		};
+	}
+
+	void ZeroMqEntityPublisher::publishTransaction(
+			TransactionMarker topicMarker,
+			const WeakTransactionInfo& transactionInfo,
+			Height height) {
+		publish("transaction", topicMarker, transactionInfo, CreateTransactionPayloadBuilder(transactionInfo, height));
 	}
 
 	void ZeroMqEntityPublisher::publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) {
@@ -249,8 +388,19 @@ namespace catapult { namespace zeromq {
 			TransactionMarker topicMarker,
 			const WeakTransactionInfo& transactionInfo,
 			const MessagePayloadBuilder& payloadBuilder) {
+		std::vector<zmq::multipart_t> messages;
+		addMessages(messages, topicMarker, transactionInfo, payloadBuilder);
+
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHashMessageGenerator(topicName, transactionInfo.EntityHash));
+		pMessageGroup->add(std::move(messages));
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
 
+	void ZeroMqEntityPublisher::addMessages(
+			std::vector<zmq::multipart_t>& messages,
+			TransactionMarker topicMarker,
+			const WeakTransactionInfo& transactionInfo,
+			const MessagePayloadBuilder& payloadBuilder) {
 		const auto& addresses = transactionInfo.OptionalAddresses
 				? *transactionInfo.OptionalAddresses
 				: model::ExtractAddresses(transactionInfo.Transaction, *m_pNotificationPublisher);
@@ -263,9 +413,7 @@ namespace catapult { namespace zeromq {
 			auto topic = CreateTopic(topicMarker, address);
 			multipart.addmem(topic.data(), topic.size());
 			payloadBuilder(multipart);
-			pMessageGroup->add(std::move(multipart));
+			messages.push_back(std::move(multipart));
 		}
-
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
 	}
 }}
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/functions.h"
 
@@ -95,6 +96,16 @@ namespace catapult { namespace zeromq {
 
 		~ZeroMqEntityPublisher();
 
+	public:
+		/// Gets the number of message groups queued for publishing.
+		size_t queueSize() const;
+
+		/// Gets the maximum number of message groups that were queued for publishing at once.
+		size_t maxQueueSize() const;
+
+		/// Gets the number of published messages.
+		uint64_t numPublishedMessages() const;
+
 	public:
 		/// Publishes the block header in \a blockElement.
 		void publishBlockHeader(const model::BlockElement& blockElement);
@@ -114,6 +125,12 @@ namespace catapult { namespace zeromq {
 		/// Publishes a transaction hash using \a topicMarker and \a transactionInfo.
 		void publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo);
 
+		/// Publishes transactions using \a topicMarker, \a transactionInfos and \a height as a single message group.
+		void publishTransactions(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos, Height height);
+
+		/// Publishes transaction hashes using \a topicMarker and \a transactionInfos as a single message group.
+		void publishTransactionHashes(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos);
+
 		/// Publishes a transaction status composed of \a transaction, \a hash and \a status.
 		void publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status);
 
@@ -124,12 +141,19 @@ namespace catapult { namespace zeromq {
 		struct WeakTransactionInfo;
 		using MessagePayloadBuilder = consumer<zmq::multipart_t&>;
 
+		static MessagePayloadBuilder CreateTransactionPayloadBuilder(const WeakTransactionInfo& transactionInfo, Height height);
+
 		void publishTransaction(TransactionMarker topicMarker, const WeakTransactionInfo& transactionInfo, Height height);
 		void publish(
 				const std::string& topicName,
 				TransactionMarker topicMarker,
 				const WeakTransactionInfo& transactionInfo,
 				const MessagePayloadBuilder& payloadBuilder);
+		void addMessages(
+				std::vector<zmq::multipart_t>& messages,
+				TransactionMarker topicMarker,
+				const WeakTransactionInfo& transactionInfo,
+				const MessagePayloadBuilder& payloadBuilder);
 
 	private:
 		class SynchronizedPublisher;
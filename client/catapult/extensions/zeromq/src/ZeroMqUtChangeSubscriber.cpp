@@ -21,6 +21,7 @@
 
 #include "ZeroMqUtChangeSubscriber.h"
 #include "ZeroMqEntityPublisher.h"
+#include "catapult/model/TransactionChangeTracker.h"
 
 namespace catapult { namespace zeromq {
 
@@ -30,27 +31,62 @@ namespace catapult { namespace zeromq {
 			explicit ZeroMqUtChangeSubscriber(ZeroMqEntityPublisher& publisher) : m_publisher(publisher)
 			{}
 
+		public:
+			void notifyAdds(const TransactionInfos& transactionInfos) override {
+				m_publisher.publishTransactions(TransactionMarker::Unconfirmed_Transaction_Add_Marker, transactionInfos, Height());
+			}
+
+			void notifyRemoves(const TransactionInfos& transactionInfos) override {
+				m_publisher.publishTransactionHashes(TransactionMarker::Unconfirmed_Transaction_Remove_Marker, transactionInfos);
+			}
+
+			void flush() override {
+				// empty because messages are pushed by other calls
+			}
+
+		private:
+			ZeroMqEntityPublisher& m_publisher;
+		};
+
+		class ZeroMqCoalescingUtChangeSubscriber : public cache::UtChangeSubscriber {
+		public:
+			explicit ZeroMqCoalescingUtChangeSubscriber(ZeroMqEntityPublisher& publisher) : m_publisher(publisher)
+			{}
+
 		public:
 			void notifyAdds(const TransactionInfos& transactionInfos) override {
 				for (const auto& transactionInfo : transactionInfos)
-					m_publisher.publishTransaction(TransactionMarker::Unconfirmed_Transaction_Add_Marker, transactionInfo, Height());
+					m_transactionChangeTracker.add(transactionInfo);
 			}
 
 			void notifyRemoves(const TransactionInfos& transactionInfos) override {
 				for (const auto& transactionInfo : transactionInfos)
-					m_publisher.publishTransactionHash(TransactionMarker::Unconfirmed_Transaction_Remove_Marker, transactionInfo);
+					m_transactionChangeTracker.remove(transactionInfo);
 			}
 
 			void flush() override {
-				// empty because messages are pushed by other calls
+				// publish removes before adds so that a subscriber never observes a (re)added transaction as removed
+				m_publisher.publishTransactionHashes(
+						TransactionMarker::Unconfirmed_Transaction_Remove_Marker,
+						m_transactionChangeTracker.removedTransactionInfos());
+				m_publisher.publishTransactions(
+						TransactionMarker::Unconfirmed_Transaction_Add_Marker,
+						m_transactionChangeTracker.addedTransactionInfos(),
+						Height());
+				m_transactionChangeTracker.reset();
 			}
 
 		private:
 			ZeroMqEntityPublisher& m_publisher;
+			model::TransactionChangeTracker m_transactionChangeTracker;
 		};
 	}
 
 	std::unique_ptr<cache::UtChangeSubscriber> CreateZeroMqUtChangeSubscriber(ZeroMqEntityPublisher& publisher) {
 		return std::make_unique<ZeroMqUtChangeSubscriber>(publisher);
 	}
+
+	std::unique_ptr<cache::UtChangeSubscriber> CreateZeroMqCoalescingUtChangeSubscriber(ZeroMqEntityPublisher& publisher) {
+		return std::make_unique<ZeroMqCoalescingUtChangeSubscriber>(publisher);
+	}
 }}
@@ -29,4 +29,8 @@ namespace catapult { namespace zeromq {
 
 	/// Creates a zeromq unconfirmed transactions subscriber around an entity \a publisher.
 	std::unique_ptr<cache::UtChangeSubscriber> CreateZeroMqUtChangeSubscriber(ZeroMqEntityPublisher& publisher);
+
+	/// Creates a zeromq unconfirmed transactions subscriber around an entity \a publisher that coalesces all changes
+	/// between flushes and only publishes the net changes when flushed.
+	std::unique_ptr<cache::UtChangeSubscriber> CreateZeroMqCoalescingUtChangeSubscriber(ZeroMqEntityPublisher& publisher);
 }}
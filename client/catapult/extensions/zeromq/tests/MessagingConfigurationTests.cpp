@@ -37,7 +37,8 @@ namespace catapult { namespace zeromq {
 						"messaging",
 						{
 							{ "listenInterface", "2.4.8.16" },
-							{ "subscriberPort", "9753" }
+							{ "subscriberPort", "9753" },
+							{ "coalesceUnconfirmedTransactionChanges", "true" }
 						}
 					}
 				};
@@ -51,12 +52,14 @@ namespace catapult { namespace zeromq {
 				// Assert:
 				EXPECT_EQ("", config.ListenInterface);
 				EXPECT_EQ(0u, config.SubscriberPort);
+				EXPECT_FALSE(config.CoalesceUnconfirmedTransactionChanges);
 			}
 
 			static void AssertCustom(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ("2.4.8.16", config.ListenInterface);
 				EXPECT_EQ(9753u, config.SubscriberPort);
+				EXPECT_TRUE(config.CoalesceUnconfirmedTransactionChanges);
 			}
 		};
 	}
@@ -77,6 +80,7 @@ namespace catapult { namespace zeromq {
 		// Assert:
 		EXPECT_EQ("0.0.0.0", config.ListenInterface);
 		EXPECT_EQ(7902u, config.SubscriberPort);
+		EXPECT_FALSE(config.CoalesceUnconfirmedTransactionChanges);
 	}
 
 	// endregion
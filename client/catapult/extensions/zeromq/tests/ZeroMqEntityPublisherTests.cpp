@@ -30,8 +30,10 @@
 #include "catapult/model/TransactionStatus.h"
 #include "zeromq/tests/test/ZeroMqTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace zeromq {
@@ -82,6 +84,14 @@ namespace catapult { namespace zeromq {
 				publisher().publishTransactionHash(topicMarker, transactionInfo);
 			}
 
+			void publishTransactions(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos, Height height) {
+				publisher().publishTransactions(topicMarker, transactionInfos, height);
+			}
+
+			void publishTransactionHashes(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos) {
+				publisher().publishTransactionHashes(topicMarker, transactionInfos);
+			}
+
 			void publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) {
 				publisher().publishTransactionStatus(transaction, hash, status);
 			}
@@ -364,6 +374,150 @@ namespace catapult { namespace zeromq {
 
 	// endregion
 
+	// region publishTransactions / publishTransactionHashes
+
+	namespace {
+		model::TransactionInfosSet CreateTransactionInfosWithCustomAddresses(size_t count) {
+			model::TransactionInfosSet transactionInfos;
+			for (auto i = 0u; i < count; ++i) {
+				auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0));
+				transactionInfo.OptionalExtractedAddresses = GenerateRandomExtractedAddresses();
+				transactionInfos.emplace(std::move(transactionInfo));
+			}
+
+			return transactionInfos;
+		}
+
+		model::UnresolvedAddressSet MergeAddresses(const model::TransactionInfosSet& transactionInfos) {
+			model::UnresolvedAddressSet addresses;
+			for (const auto& transactionInfo : transactionInfos)
+				addresses.insert(transactionInfo.OptionalExtractedAddresses->cbegin(), transactionInfo.OptionalExtractedAddresses->cend());
+
+			return addresses;
+		}
+
+		const model::TransactionInfo& FindTransactionInfoWithAddress(
+				const model::TransactionInfosSet& transactionInfos,
+				const std::vector<uint8_t>& topic) {
+			for (const auto& transactionInfo : transactionInfos) {
+				for (const auto& address : *transactionInfo.OptionalExtractedAddresses) {
+					if (CreateTopic(Marker, address) == topic)
+						return transactionInfo;
+				}
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT("no transaction info is associated with topic");
+		}
+	}
+
+	TEST(TEST_CLASS, CanPublishTransactions) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto transactionInfos = CreateTransactionInfosWithCustomAddresses(3);
+		auto addresses = MergeAddresses(transactionInfos);
+		Height height(123);
+		context.subscribeAll(Marker, addresses);
+
+		// Act:
+		context.publishTransactions(Marker, transactionInfos, height);
+
+		// Assert: each transaction is published to each of its addresses
+		auto& zmqSocket = context.zmqSocket();
+		test::AssertMessages(zmqSocket, Marker, addresses, [&transactionInfos, height](const auto& message, const auto& topic) {
+			test::AssertTransactionInfoMessage(message, topic, FindTransactionInfoWithAddress(transactionInfos, topic), height);
+		});
+		test::AssertNoPendingMessages(zmqSocket);
+	}
+
+	TEST(TEST_CLASS, CanPublishTransactionHashes) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto transactionInfos = CreateTransactionInfosWithCustomAddresses(3);
+		auto addresses = MergeAddresses(transactionInfos);
+		context.subscribeAll(Marker, addresses);
+
+		// Act:
+		context.publishTransactionHashes(Marker, transactionInfos);
+
+		// Assert: each transaction hash is published to each of its addresses
+		auto& zmqSocket = context.zmqSocket();
+		test::AssertMessages(zmqSocket, Marker, addresses, [&transactionInfos](const auto& message, const auto& topic) {
+			test::AssertTransactionHashMessage(message, topic, FindTransactionInfoWithAddress(transactionInfos, topic).EntityHash);
+		});
+		test::AssertNoPendingMessages(zmqSocket);
+	}
+
+	TEST(TEST_CLASS, PublishTransactionsAndTransactionHashesDeliverNoMessagesWhenTransactionInfosAreEmpty) {
+		// Arrange:
+		EntityPublisherContext context;
+		context.subscribe(Marker);
+		auto numPublishedMessages = context.publisher().numPublishedMessages();
+
+		// Act:
+		context.publishTransactions(Marker, model::TransactionInfosSet(), Height(123));
+		context.publishTransactionHashes(Marker, model::TransactionInfosSet());
+
+		// Assert:
+		test::AssertNoPendingMessages(context.zmqSocket());
+		EXPECT_EQ(numPublishedMessages, context.publisher().numPublishedMessages());
+	}
+
+	// endregion
+
+	// region zero copy
+
+	TEST(TEST_CLASS, PublishTransactionSharesTransactionInfoEntity) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0));
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*transactionInfo.pEntity));
+		context.subscribeAll(Marker, addresses);
+
+		// - keep a copy of the info that outlives the (original) entity
+		auto transactionInfoCopy = transactionInfo.copy();
+		transactionInfoCopy.pEntity = test::CopyEntity(*transactionInfo.pEntity);
+		std::weak_ptr<const model::Transaction> pWeakEntity = transactionInfo.pEntity;
+
+		// Act: publish and release the caller's reference to the entity before the message is received
+		context.publishTransaction(Marker, transactionInfo, Height(123));
+		transactionInfo.pEntity.reset();
+
+		// Assert: the published message contains the (still referenced) entity
+		test::AssertMessages(context.zmqSocket(), Marker, addresses, [&transactionInfoCopy](const auto& message, const auto& topic) {
+			test::AssertTransactionInfoMessage(message, topic, transactionInfoCopy, Height(123));
+		});
+
+		// - the entity is released once all messages have been sent and the publisher is destroyed
+		context.destroyPublisher();
+		EXPECT_TRUE(pWeakEntity.expired());
+	}
+
+	// endregion
+
+	// region counters
+
+	TEST(TEST_CLASS, PublisherCountersAreUpdatedWhenMessagesArePublished) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto transactionInfos = CreateTransactionInfosWithCustomAddresses(3);
+		auto addresses = MergeAddresses(transactionInfos);
+		context.subscribeAll(Marker, addresses);
+		auto numPublishedMessages = context.publisher().numPublishedMessages();
+
+		// Act:
+		context.publishTransactions(Marker, transactionInfos, Height(123));
+
+		// - wait for all messages to be sent
+		test::AssertMessages(context.zmqSocket(), Marker, addresses, [](const auto&, const auto&) {});
+		WAIT_FOR_ZERO_EXPR(context.publisher().queueSize());
+
+		// Assert: a message is published for each address
+		EXPECT_EQ(numPublishedMessages + addresses.size(), context.publisher().numPublishedMessages());
+		EXPECT_LE(1u, context.publisher().maxQueueSize());
+	}
+
+	// endregion
+
 	// region publishTransactionStatus
 
 	TEST(TEST_CLASS, CanPublishTransactionStatus) {
@@ -36,7 +36,13 @@ namespace catapult { namespace zeromq {
 			using MqContext::subscribeAll;
 
 		public:
-			MqSubscriberContext() : MqContextT(CreateZeroMqUtChangeSubscriber)
+			MqSubscriberContext() : MqSubscriberContext(CreateZeroMqUtChangeSubscriber)
+			{}
+
+		protected:
+			explicit MqSubscriberContext(
+					const std::function<std::unique_ptr<cache::UtChangeSubscriber> (ZeroMqEntityPublisher&)>& subscriberCreator)
+					: MqContextT(subscriberCreator)
 			{}
 
 		public:
@@ -75,6 +81,12 @@ namespace catapult { namespace zeromq {
 				waitForReceiveSuccess();
 			}
 		};
+
+		class CoalescingMqSubscriberContext : public MqSubscriberContext {
+		public:
+			CoalescingMqSubscriberContext() : MqSubscriberContext(CreateZeroMqCoalescingUtChangeSubscriber)
+			{}
+		};
 	}
 
 	// region basic tests
@@ -169,4 +181,81 @@ namespace catapult { namespace zeromq {
 	}
 
 	// endregion
+
+	// region coalescing
+
+	TEST(TEST_CLASS, CoalescingSubscriberDoesNotSendMessagesBeforeFlush) {
+		// Arrange:
+		CoalescingMqSubscriberContext context;
+		auto transactionInfos = test::CopyTransactionInfosToSet(test::CreateTransactionInfos(2));
+		context.subscribeAll(Add_Marker, transactionInfos);
+		context.subscribeAll(Remove_Marker, transactionInfos);
+
+		// Act:
+		context.notifyAdd(*transactionInfos.cbegin());
+		context.notifyRemove(*++transactionInfos.cbegin());
+
+		// Assert:
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
+	TEST(TEST_CLASS, CoalescingSubscriberCanAddSingleTransaction) {
+		auto notify = [](auto& context, const auto& transactionInfo) {
+			context.notifyAdd(transactionInfo);
+			context.flush();
+		};
+		test::AssertCanAddSingleTransaction<CoalescingMqSubscriberContext>(Add_Marker, notify);
+	}
+
+	TEST(TEST_CLASS, CoalescingSubscriberCanRemoveSingleTransaction) {
+		auto notify = [](auto& context, const auto& transactionInfo) {
+			context.notifyRemove(transactionInfo);
+			context.flush();
+		};
+		test::AssertCanRemoveSingleTransaction<CoalescingMqSubscriberContext>(Remove_Marker, notify);
+	}
+
+	TEST(TEST_CLASS, CoalescingSubscriberDoesNotSendMessagesForTransactionAddedAndRemovedBeforeFlush) {
+		// Arrange:
+		CoalescingMqSubscriberContext context;
+		auto transactionInfo = test::CreateRandomTransactionInfo();
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*transactionInfo.pEntity));
+		context.subscribeAll(Add_Marker, addresses);
+		context.subscribeAll(Remove_Marker, addresses);
+
+		// Act:
+		context.notifyAdd(transactionInfo);
+		context.notifyRemove(transactionInfo);
+		context.flush();
+
+		// Assert:
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
+	TEST(TEST_CLASS, CoalescingSubscriberDoesNotResendMessagesOnSubsequentFlush) {
+		// Arrange:
+		CoalescingMqSubscriberContext context;
+		auto transactionInfo = test::RemoveExtractedAddresses(test::CreateRandomTransactionInfo());
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*transactionInfo.pEntity));
+		context.subscribeAll(Add_Marker, addresses);
+
+		context.notifyAdd(transactionInfo);
+		context.flush();
+
+		test::AssertMessages(context.zmqSocket(), Add_Marker, addresses, [&transactionInfo](const auto& message, const auto& topic) {
+			test::AssertTransactionInfoMessage(message, topic, transactionInfo, Height());
+		});
+
+		// Act:
+		context.flush();
+
+		// Assert:
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
+	TEST(TEST_CLASS, CoalescingSubscriberFlushDoesNotSendMessagesWhenThereAreNoChanges) {
+		test::AssertFlushDoesNotSendMessages<CoalescingMqSubscriberContext>();
+	}
+
+	// endregion
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "BmPrivateKeyTree.h"
+#include <optional>
 
 namespace catapult { namespace crypto {
 
@@ -42,13 +43,18 @@ namespace catapult { namespace crypto {
 		const BmOptions& options() const;
 
 		/// Returns \c true if can sign at \a keyIdentifier.
+		/// \note When no tree is available, loading the next tree is retried.
 		bool canSign(const BmKeyIdentifier& keyIdentifier);
 
 		/// Creates the signature for \a dataBuffer at \a keyIdentifier.
 		BmTreeSignature sign(const BmKeyIdentifier& keyIdentifier, const RawBuffer& dataBuffer);
 
+	private:
+		std::unique_ptr<BmPrivateKeyTree> loadNextTree();
+
 	private:
 		PrivateKeyTreeFactory m_factory;
 		std::unique_ptr<BmPrivateKeyTree> m_pTree;
+		std::optional<BmKeyIdentifier> m_previousEndKeyIdentifier;
 	};
 }}
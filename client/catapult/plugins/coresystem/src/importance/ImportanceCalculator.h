@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace cache { class AccountStateCacheDelta; }
 	namespace model { struct BlockchainConfiguration; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace importance {
@@ -59,6 +60,12 @@ namespace catapult { namespace importance {
 	/// Creates an importance calculator for the blockchain described by \a config.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockchainConfiguration& config);
 
+	/// Creates an importance calculator for the blockchain described by \a config that distributes work across the threads of \a pool.
+	/// \note Calculated importances are independent of the number of threads.
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockchainConfiguration& config,
+			thread::IoThreadPool& pool);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
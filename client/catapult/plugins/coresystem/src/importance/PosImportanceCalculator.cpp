@@ -25,6 +25,8 @@
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/model/HeightGrouping.h"
 #include "catapult/state/AccountImportanceSnapshots.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
@@ -33,9 +35,45 @@
 namespace catapult { namespace importance {
 
 	namespace {
+		// minimum number of accounts processed by a single partition; smaller sets are not worth the thread overhead
+		constexpr size_t Min_Accounts_Per_Partition = 1024;
+
+		size_t CalculateNumPartitions(size_t numAccounts, size_t maxParallelism) {
+			return std::max<size_t>(1, std::min(maxParallelism, numAccounts / Min_Accounts_Per_Partition));
+		}
+
+		template<typename TItems, typename TAction>
+		void ForEachPartition(thread::IoThreadPool* pPool, TItems& items, size_t numPartitions, TAction action) {
+			if (1 == numPartitions) {
+				action(0, 0, items.size());
+				return;
+			}
+
+			// exceptions are rethrown in partition order so that failures are deterministic
+			std::vector<std::exception_ptr> exceptions(numPartitions);
+			thread::ParallelForPartition(pPool->ioContext(), items, numPartitions, [action, &exceptions](
+					auto itBegin,
+					auto itEnd,
+					auto startIndex,
+					auto batchIndex) {
+				try {
+					action(batchIndex, startIndex, startIndex + static_cast<size_t>(std::distance(itBegin, itEnd)));
+				} catch (...) {
+					exceptions[batchIndex] = std::current_exception();
+				}
+			}).get();
+
+			for (const auto& pException : exceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+		}
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockchainConfiguration& config) : m_config(config)
+			PosImportanceCalculator(const model::BlockchainConfiguration& config, thread::IoThreadPool* pPool)
+					: m_config(config)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -46,54 +84,105 @@ namespace catapult { namespace importance {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::debug);
 
 				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				//    (mutable lookups modify the delta, so they cannot be parallelized)
 				const auto& highValueAccounts = cache.highValueAccounts();
-				const auto& highValueAddresses = highValueAccounts.addresses();
 				std::vector<AccountSummary> accountSummaries;
-				accountSummaries.reserve(highValueAddresses.size());
+				accountSummaries.reserve(highValueAccounts.numAddresses());
+				highValueAccounts.forEachAddress([&cache, &accountSummaries](const auto& address) {
+					auto accountStateIter = cache.find(address);
+					accountSummaries.push_back(AccountSummary(AccountActivitySummary(), accountStateIter.get()));
+				});
+
+				// all remaining steps operate on disjoint account states, so they can be partitioned across threads;
+				// partial sums are reduced in partition order, and integer addition keeps results bit-identical
+				auto maxParallelism = m_pPool ? m_pPool->numWorkerThreads() : 1;
+				auto numPartitions = CalculateNumPartitions(accountSummaries.size(), maxParallelism);
 
 				// 2. calculate sums
-				auto importanceGrouping = m_config.ImportanceGrouping;
-				ImportanceCalculationContext context;
-				auto mosaicId = m_config.HarvestingMosaicId;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					const auto& activityBuckets = accountState.ActivityBuckets;
-					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
-				}
+				auto context = summarizeAccounts(importanceHeight, accountSummaries, numPartitions);
 
 				// 3. calculate importance parts
+				std::vector<Importance> partialActivityImportances(numPartitions);
+				ForEachPartition(m_pPool, accountSummaries, numPartitions, [this, &accountSummaries, &context, &partialActivityImportances](
+						size_t partitionIndex,
+						size_t startIndex,
+						size_t endIndex) {
+					Importance activityImportance;
+					for (auto i = startIndex; i < endIndex; ++i) {
+						auto& accountSummary = accountSummaries[i];
+						CalculateImportances(accountSummary, context, m_config);
+						activityImportance = activityImportance + accountSummary.ActivityImportance;
+					}
+
+					partialActivityImportances[partitionIndex] = activityImportance;
+				});
+
 				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
-				}
+				for (auto activityImportance : partialActivityImportances)
+					totalActivityImportance = totalActivityImportance + activityImportance;
 
 				// 4. calculate the final importance
 				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
-					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
-					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
-							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
-				}
+				ForEachPartition(m_pPool, accountSummaries, numPartitions, [
+						this,
+						importanceHeight,
+						&accountSummaries,
+						totalActivityImportance,
+						targetActivityImportanceRaw](size_t, size_t startIndex, size_t endIndex) {
+					for (auto i = startIndex; i < endIndex; ++i) {
+						const auto& accountSummary = accountSummaries[i];
+						auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
+						auto& accountState = *accountSummary.pAccountState;
+						FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
+						auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
+								? importance
+								: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
+						accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+					}
+				});
 
 				CATAPULT_LOG(debug)
-						<< "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)"
-						<< " at height " << importanceHeight;
+						<< "recalculated importances (" << accountSummaries.size() << " / " << cache.size() << " eligible)"
+						<< " at height " << importanceHeight << " using " << numPartitions << " partition(s)";
 
 				// 5. disable collection of activity for the removed accounts
 				cache.processHighValueRemovedAccounts(importanceHeight);
 			}
 
 		private:
+			ImportanceCalculationContext summarizeAccounts(
+					model::ImportanceHeight importanceHeight,
+					std::vector<AccountSummary>& accountSummaries,
+					size_t numPartitions) const {
+				std::vector<ImportanceCalculationContext> partialContexts(numPartitions);
+				ForEachPartition(m_pPool, accountSummaries, numPartitions, [this, importanceHeight, &accountSummaries, &partialContexts](
+						size_t partitionIndex,
+						size_t startIndex,
+						size_t endIndex) {
+					auto importanceGrouping = m_config.ImportanceGrouping;
+					auto mosaicId = m_config.HarvestingMosaicId;
+					auto& context = partialContexts[partitionIndex];
+					for (auto i = startIndex; i < endIndex; ++i) {
+						auto& accountSummary = accountSummaries[i];
+						const auto& accountState = *accountSummary.pAccountState;
+						const auto& activityBuckets = accountState.ActivityBuckets;
+						accountSummary.ActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
+						context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
+						context.TotalBeneficiaryCount += accountSummary.ActivitySummary.BeneficiaryCount;
+						context.TotalFeesPaid = context.TotalFeesPaid + accountSummary.ActivitySummary.TotalFeesPaid;
+					}
+				});
+
+				ImportanceCalculationContext context;
+				for (const auto& partialContext : partialContexts) {
+					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + partialContext.ActiveHarvestingMosaics;
+					context.TotalBeneficiaryCount += partialContext.TotalBeneficiaryCount;
+					context.TotalFeesPaid = context.TotalFeesPaid + partialContext.TotalFeesPaid;
+				}
+
+				return context;
+			}
+
 			Importance calculateFinalImportance(
 					const AccountSummary& accountSummary,
 					Importance totalActivityImportance,
@@ -110,10 +199,17 @@ namespace catapult { namespace importance {
 
 		private:
 			const model::BlockchainConfiguration m_config;
+			thread::IoThreadPool* m_pPool;
 		};
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockchainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return std::make_unique<PosImportanceCalculator>(config, nullptr);
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockchainConfiguration& config,
+			thread::IoThreadPool& pool) {
+		return std::make_unique<PosImportanceCalculator>(config, &pool);
 	}
 }}
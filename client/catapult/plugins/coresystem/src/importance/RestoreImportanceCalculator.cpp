@@ -33,23 +33,25 @@ namespace catapult { namespace importance {
 					cache::AccountStateCacheDelta& cache) const override {
 				const auto& highValueAccounts = cache.highValueAccounts();
 
-				PopAll(cache, highValueAccounts.addresses());
-				PopAll(cache, highValueAccounts.removedAddresses());
+				auto pop = [&cache](const auto& address) {
+					Pop(cache, address);
+				};
+
+				highValueAccounts.forEachAddress(pop);
+				highValueAccounts.forEachRemovedAddress(pop);
 
 				CATAPULT_LOG(debug) << "restored importances at height " << importanceHeight;
 			}
 
 		private:
-			static void PopAll(cache::AccountStateCacheDelta& cache, const model::AddressSet& addresses) {
-				for (const auto& address : addresses) {
-					auto accountStateIter = cache.find(address);
-					if (!accountStateIter.tryGet())
-						continue;
-
-					auto& accountState = accountStateIter.get();
-					accountState.ImportanceSnapshots.pop();
-					accountState.ActivityBuckets.pop();
-				}
+			static void Pop(cache::AccountStateCacheDelta& cache, const Address& address) {
+				auto accountStateIter = cache.find(address);
+				if (!accountStateIter.tryGet())
+					return;
+
+				auto& accountState = accountStateIter.get();
+				accountState.ImportanceSnapshots.pop();
+				accountState.ActivityBuckets.pop();
 			}
 		};
 	}
@@ -102,22 +102,24 @@ namespace catapult { namespace importance {
 				cache::StateVersion<PackedAccountEntry>::Write(output);
 
 				const auto& highValueAccounts = cache.highValueAccounts();
-				io::Write64(output, highValueAccounts.addresses().size());
-				io::Write64(output, highValueAccounts.removedAddresses().size());
+				io::Write64(output, highValueAccounts.numAddresses());
+				io::Write64(output, highValueAccounts.numRemovedAddresses());
 
-				writeAll(output, cache, highValueAccounts.addresses());
-				writeAll(output, cache, highValueAccounts.removedAddresses());
+				auto writeAccount = [this, &output, &cache](const auto& address) {
+					this->writeEntry(output, cache, address);
+				};
+
+				highValueAccounts.forEachAddress(writeAccount);
+				highValueAccounts.forEachRemovedAddress(writeAccount);
 
 				io::IndexFile(m_directory.file(Index_Filename)).set(importanceHeight.unwrap());
 			}
 
-			void writeAll(io::OutputStream& output, const cache::AccountStateCacheDelta& cache, const model::AddressSet& addresses) const {
-				for (const auto& address : addresses) {
-					auto accountStateIter = cache.find(address);
+			void writeEntry(io::OutputStream& output, const cache::AccountStateCacheDelta& cache, const Address& address) const {
+				auto accountStateIter = cache.find(address);
 
-					auto entry = pack(accountStateIter.get());
-					output.write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(PackedAccountEntry) });
-				}
+				auto entry = pack(accountStateIter.get());
+				output.write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(PackedAccountEntry) });
 			}
 
 			PackedAccountEntry pack(const state::AccountState& accountState) const {
@@ -95,8 +95,11 @@ namespace catapult { namespace plugins {
 
 		auto CreateRecalculateImportancesObserver(
 				const model::BlockchainConfiguration& config,
-				const config::CatapultDirectory& directory) {
-			auto pCommitCalculator = importance::CreateImportanceCalculator(config);
+				const config::CatapultDirectory& directory,
+				thread::IoThreadPool* pPool) {
+			auto pCommitCalculator = pPool
+					? importance::CreateImportanceCalculator(config, *pPool)
+					: importance::CreateImportanceCalculator(config);
 			auto pRollbackCalculator = importance::CreateRestoreImportanceCalculator();
 
 			if (0 == config.MaxRollbackBlocks) {
@@ -224,7 +227,7 @@ namespace catapult { namespace plugins {
 		});
 
 		auto dataDirectory = config::CatapultDataDirectory(manager.userConfig().DataDirectory);
-		manager.addTransientObserverHook([&config, dataDirectory](auto& builder) {
+		manager.addTransientObserverHook([&config, dataDirectory, pPool = manager.threadPool()](auto& builder) {
 			// important:
 			// HighValueAccountObserver and RecalculateImportancesObserver are both triggered by BlockNotification and must execute
 			// AFTER all state changes.
@@ -232,7 +235,7 @@ namespace catapult { namespace plugins {
 			// registered as transient observers independent of any transient observers registered by other plugins.
 			builder
 				.add(observers::CreateHighValueAccountObserver(observers::NotifyMode::Commit))
-				.add(CreateRecalculateImportancesObserver(config, dataDirectory.dir("importance")))
+				.add(CreateRecalculateImportancesObserver(config, dataDirectory.dir("importance"), pPool))
 				.add(observers::CreateHighValueAccountObserver(observers::NotifyMode::Rollback))
 				.add(observers::CreateBlockStatisticObserver(config.MaxDifficultyBlocks, config.DefaultDynamicFeeMultiplier));
 		});
@@ -26,6 +26,7 @@
 #include "catapult/state/AccountActivityBuckets.h"
 #include "tests/test/cache/AccountStateCacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace importance {
@@ -600,4 +601,98 @@ namespace catapult { namespace importance {
 	}
 
 	// endregion
+
+	// region parallel recalculation
+
+	namespace {
+		constexpr uint32_t Num_Parallel_Account_States = 4 * 1024 + 17;
+
+		Key CreateParallelAccountKey(uint32_t index) {
+			Key key;
+			key[0] = static_cast<uint8_t>(index & 0xFF);
+			key[1] = static_cast<uint8_t>((index >> 8) & 0xFF);
+			key[2] = 0xA5;
+			return key;
+		}
+
+		void SeedParallelAccounts(cache::AccountStateCacheDelta& delta, const model::BlockchainConfiguration& config) {
+			for (auto i = 0u; i < Num_Parallel_Account_States; ++i) {
+				auto key = CreateParallelAccountKey(i);
+				delta.addAccount(key, Height(1));
+				auto& accountState = delta.find(key).get();
+				accountState.Balances.credit(Harvesting_Mosaic_Id, config.MinHarvesterBalance + Amount((i * 7919) % 1'000'003));
+
+				// give some accounts activity in order to exercise all importance parts
+				if (0 == i % 3)
+					continue;
+
+				for (auto offset = 2u; offset >= 1; --offset) {
+					accountState.ActivityBuckets.update(Recalculation_Height - model::ImportanceHeight(offset), [i, offset](auto& bucket) {
+						bucket.TotalFeesPaid = Amount((i * offset * 31) % 997);
+						bucket.BeneficiaryCount = (i * offset) % 13;
+					});
+				}
+			}
+		}
+
+		std::vector<std::pair<Importance, uint64_t>> RecalculateWithPool(thread::IoThreadPool* pPool) {
+			// Arrange:
+			auto config = CreateBlockchainConfiguration(10);
+			CacheHolder holder(config.MinHarvesterBalance);
+			SeedParallelAccounts(holder.delta(), config);
+			auto pCalculator = pPool ? CreateImportanceCalculator(config, *pPool) : CreateImportanceCalculator(config);
+
+			// Act:
+			RecalculateTwice(*pCalculator, Recalculation_Height, holder.delta());
+
+			// Assert:
+			std::vector<std::pair<Importance, uint64_t>> results;
+			for (auto i = 0u; i < Num_Parallel_Account_States; ++i) {
+				const auto& accountState = holder.get(CreateParallelAccountKey(i));
+				auto rawScore = accountState.ActivityBuckets.get(Recalculation_Height).RawScore;
+				results.emplace_back(accountState.ImportanceSnapshots.current(), rawScore);
+			}
+
+			return results;
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelRecalculationProducesSameResultsAsSequentialRecalculation) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(4);
+
+		// Act:
+		auto sequentialResults = RecalculateWithPool(nullptr);
+		auto parallelResults = RecalculateWithPool(pPool.get());
+
+		// Assert:
+		auto numAccountsWithImportance = 0u;
+		ASSERT_EQ(sequentialResults.size(), parallelResults.size());
+		for (auto i = 0u; i < sequentialResults.size(); ++i) {
+			EXPECT_EQ(sequentialResults[i], parallelResults[i]) << "account " << i;
+			if (Importance() != sequentialResults[i].first)
+				++numAccountsWithImportance;
+		}
+
+		// Sanity:
+		EXPECT_EQ(Num_Parallel_Account_States, numAccountsWithImportance);
+	}
+
+	TEST(TEST_CLASS, ParallelRecalculationPropagatesPartitionExceptions) {
+		// Arrange: add a bucket with a height greater than the recalculation height to the last account
+		auto config = CreateBlockchainConfiguration(10);
+		CacheHolder holder(config.MinHarvesterBalance);
+		SeedParallelAccounts(holder.delta(), config);
+		holder.get(CreateParallelAccountKey(Num_Parallel_Account_States - 1)).ActivityBuckets.update(
+				Recalculation_Height + model::ImportanceHeight(1),
+				[](const auto&) {});
+
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		auto pCalculator = CreateImportanceCalculator(config, *pPool);
+
+		// Act + Assert:
+		EXPECT_THROW(Recalculate(*pCalculator, Recalculation_Height, holder.delta()), catapult_invalid_argument);
+	}
+
+	// endregion
 }}
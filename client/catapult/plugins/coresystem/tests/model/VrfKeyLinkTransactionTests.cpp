@@ -65,6 +65,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(VrfKeyLink)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(VrfKeyLink)
 
 	// endregion
 
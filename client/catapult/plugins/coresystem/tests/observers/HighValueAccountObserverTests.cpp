@@ -67,7 +67,7 @@ namespace catapult { namespace observers {
 			{}
 
 		public:
-			const auto& highValueAddresses() {
+			auto highValueAddresses() {
 				return cache().sub<cache::AccountStateCache>().highValueAccounts().addresses();
 			}
 
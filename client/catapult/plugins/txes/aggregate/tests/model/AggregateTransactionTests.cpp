@@ -61,6 +61,10 @@ namespace catapult { namespace model {
 		EXPECT_EQ(2u, AggregateTransaction::Current_Version);
 	}
 
+	TEST(TEST_CLASS, TransactionHasSchemaSize) {
+		test::AssertTransactionHasSchemaSize<AggregateTransaction>();
+	}
+
 #undef TRANSACTION_FIELDS
 
 	// endregion
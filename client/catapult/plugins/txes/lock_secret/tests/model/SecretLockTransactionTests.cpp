@@ -68,6 +68,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(SecretLock)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(SecretLock)
 
 	// endregion
 
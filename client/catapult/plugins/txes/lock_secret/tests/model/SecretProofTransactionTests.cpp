@@ -70,6 +70,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(SecretProof)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(SecretProof)
 
 	// endregion
 
@@ -110,18 +110,9 @@ namespace catapult { namespace cache {
 
 		/// Prunes the cache at \a height.
 		void prune(Height height) {
-			std::unordered_set<typename TDescriptor::KeyType, utils::ArrayHasher<typename TDescriptor::KeyType>> pendingRemovalIds;
-			ForEachIdentifierWithGroup(*m_pDelta, *m_pHeightGroupingDelta, height, [height, &pendingRemovalIds](auto& history) {
+			PruneIdentifiersWithGroup(*m_pDelta, *m_pHeightGroupingDelta, height, [height](auto& history) {
 				history.prune(height);
-
-				if (history.empty())
-					pendingRemovalIds.insert(history.id());
 			});
-
-			for (const auto& identifier : pendingRemovalIds)
-				m_pDelta->remove(identifier);
-
-			m_pHeightGroupingDelta->remove(height);
 		}
 
 	private:
@@ -128,6 +128,9 @@ namespace catapult { namespace model {
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS_WITH_ARGS(AccountMetadata, Entity_Type_Account_Metadata, 0)
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS_WITH_ARGS(MosaicMetadata, Entity_Type_Mosaic_Metadata, sizeof(uint64_t))
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS_WITH_ARGS(NamespaceMetadata, Entity_Type_Namespace_Metadata, sizeof(uint64_t))
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(AccountMetadata)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(MosaicMetadata)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(NamespaceMetadata)
 
 	// endregion
 
@@ -38,19 +38,47 @@ namespace catapult { namespace cache {
 		};
 
 		template<typename TTraits>
-		size_t FindAll(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Address& address, model::AddressSet& addresses) {
-			auto multisigIter = multisigCache.find(address);
-			if (!multisigIter.tryGet())
-				return 0;
+		class LinkedAddressesFinder {
+		public:
+			LinkedAddressesFinder(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, model::AddressSet& addresses)
+					: m_multisigCache(multisigCache)
+					, m_addresses(addresses)
+			{}
+
+		public:
+			size_t find(const Address& address) {
+				// each address is only looked up once, even when it is reachable via multiple paths
+				auto numLevelsIter = m_numLevelsByAddress.find(address);
+				if (m_numLevelsByAddress.cend() != numLevelsIter)
+					return numLevelsIter->second;
+
+				// insert a placeholder before recursing so that a (invalid) loop cannot cause unbounded recursion
+				m_numLevelsByAddress.emplace(address, 0);
+
+				auto multisigIter = m_multisigCache.find(address);
+				if (!multisigIter.tryGet())
+					return 0;
+
+				size_t numLevels = 0;
+				const auto& multisigEntry = multisigIter.get();
+				for (const auto& linkedAddress : TTraits::GetAddresses(multisigEntry)) {
+					m_addresses.insert(linkedAddress);
+					numLevels = std::max(numLevels, find(linkedAddress) + 1);
+				}
 
-			size_t numLevels = 0;
-			const auto& multisigEntry = multisigIter.get();
-			for (const auto& linkedAddress : TTraits::GetAddresses(multisigEntry)) {
-				addresses.insert(linkedAddress);
-				numLevels = std::max(numLevels, FindAll<TTraits>(multisigCache, linkedAddress, addresses) + 1);
+				m_numLevelsByAddress[address] = numLevels;
+				return numLevels;
 			}
 
-			return numLevels;
+		private:
+			const MultisigCacheTypes::CacheReadOnlyType& m_multisigCache;
+			model::AddressSet& m_addresses;
+			std::unordered_map<Address, size_t, utils::ArrayHasher<Address>> m_numLevelsByAddress;
+		};
+
+		template<typename TTraits>
+		size_t FindAll(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Address& address, model::AddressSet& addresses) {
+			return LinkedAddressesFinder<TTraits>(multisigCache, addresses).find(address);
 		}
 	}
 
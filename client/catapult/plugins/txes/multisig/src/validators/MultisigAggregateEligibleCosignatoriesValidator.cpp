@@ -76,6 +76,10 @@ namespace catapult { namespace validators {
 			}
 
 			void findEligibleCosignatories(const Address& address) {
+				// each address only needs to be visited once, even when it is reachable via multiple paths
+				if (!m_visitedAddresses.insert(address).second)
+					return;
+
 				// if the account is unknown or not multisig, only the address itself is eligible
 				if (!m_multisigCache.contains(address)) {
 					markEligible(address);
@@ -107,6 +111,7 @@ namespace catapult { namespace validators {
 			const cache::MultisigCache::CacheReadOnlyType& m_multisigCache;
 			const ValidatorContext& m_context;
 			std::unordered_map<Address, bool, utils::ArrayHasher<Address>> m_cosignatories;
+			model::AddressSet m_visitedAddresses;
 		};
 	}
 
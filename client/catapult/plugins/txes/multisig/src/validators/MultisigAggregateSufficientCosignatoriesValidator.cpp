@@ -94,6 +94,17 @@ namespace catapult { namespace validators {
 			}
 
 			bool isSatisfied(const Address& address, OperationType operationType) {
+				// each address only needs to be checked once, even when it is a cosignatory of multiple multisig accounts
+				auto satisfiedIter = m_satisfiedAddresses.find(address);
+				if (m_satisfiedAddresses.cend() != satisfiedIter)
+					return satisfiedIter->second;
+
+				auto isAddressSatisfied = calculateIsSatisfied(address, operationType);
+				m_satisfiedAddresses.emplace(address, isAddressSatisfied);
+				return isAddressSatisfied;
+			}
+
+			bool calculateIsSatisfied(const Address& address, OperationType operationType) {
 				// if the account is unknown or not multisig, fallback to default non-multisig verification
 				// (where transaction signer is required to be a cosignatory)
 				if (!m_multisigCache.contains(address))
@@ -119,6 +130,7 @@ namespace catapult { namespace validators {
 			const cache::MultisigCache::CacheReadOnlyType& m_multisigCache;
 			const ValidatorContext& m_context;
 			model::AddressSet m_cosignatories;
+			std::unordered_map<Address, bool, utils::ArrayHasher<Address>> m_satisfiedAddresses;
 		};
 	}
 
@@ -165,5 +165,58 @@ namespace catapult { namespace cache {
 		});
 	}
 
+	// endregion
+	// region converging paths
+
+	namespace {
+		template<typename TAction>
+		void RunMultisigConvergingPathsTest(TAction action) {
+			// Arrange:
+			//   / 1 \
+			// 0 - - - 2 - 3
+			auto addresses = test::GenerateRandomDataVector<Address>(4);
+			auto cache = test::MultisigCacheFactory::Create();
+			{
+				auto cacheDelta = cache.createDelta();
+				test::MakeMultisig(cacheDelta, addresses[0], { addresses[1], addresses[2] });
+				test::MakeMultisig(cacheDelta, addresses[1], { addresses[2] });
+				test::MakeMultisig(cacheDelta, addresses[2], { addresses[3] });
+				cache.commit(Height());
+			}
+
+			auto cacheView = cache.createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+
+			// Act:
+			action(readOnlyCache.sub<MultisigCache>(), addresses);
+		}
+	}
+
+	TEST(TEST_CLASS, CanFindAllDescendantsWhenPathsConverge) {
+		// Arrange:
+		RunMultisigConvergingPathsTest([](const auto& cache, const auto& addresses) {
+			// Act:
+			model::AddressSet descendants;
+			auto numLevels = FindDescendants(cache, addresses[0], descendants);
+
+			// Assert: longest path is used
+			EXPECT_EQ(3u, numLevels);
+			EXPECT_EQ(Pick(addresses, { 1, 2, 3 }), descendants);
+		});
+	}
+
+	TEST(TEST_CLASS, CanFindAllAncestorsWhenPathsConverge) {
+		// Arrange:
+		RunMultisigConvergingPathsTest([](const auto& cache, const auto& addresses) {
+			// Act:
+			model::AddressSet ancestors;
+			auto numLevels = FindAncestors(cache, addresses[3], ancestors);
+
+			// Assert: longest path is used
+			EXPECT_EQ(3u, numLevels);
+			EXPECT_EQ(Pick(addresses, { 0, 1, 2 }), ancestors);
+		});
+	}
+
 	// endregion
 }}
@@ -73,6 +73,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(MultisigAccountModification)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(MultisigAccountModification)
 
 	// endregion
 
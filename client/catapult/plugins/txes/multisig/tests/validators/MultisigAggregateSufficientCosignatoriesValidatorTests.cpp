@@ -313,6 +313,48 @@ namespace catapult { namespace validators {
 		AssertValidationResult(ValidationResult::Success, cache, aggregateSigner, *pSubTransaction, selectedCosignatories);
 	}
 
+	namespace {
+		void AssertMultisigCosignatorySharedByMultipleMultisigAccounts(ValidationResult expectedResult, bool includeSharedCosignatory) {
+			// Arrange:
+			auto embeddedSigner = test::GenerateRandomByteArray<Key>();
+			auto aggregateSigner = test::GenerateRandomByteArray<Key>();
+			auto cosignatories = test::GenerateRandomDataVector<Key>(2);
+			auto secondLevelCosignatories = test::GenerateRandomDataVector<Key>(3);
+
+			auto pSubTransaction = CreateEmbeddedTransaction(embeddedSigner);
+
+			// - create the cache making the embedded signer a 2-2-2 multisig where both cosignatories are 2-2-2 multisigs
+			//   sharing secondLevelCosignatories[2]
+			auto cache = test::MultisigCacheFactory::Create();
+			{
+				auto cacheDelta = cache.createDelta();
+				test::MakeMultisig(cacheDelta, ToAddress(embeddedSigner), ToAddresses(cosignatories), 2, 2);
+				test::MakeMultisig(cacheDelta, ToAddress(cosignatories[0]), ToAddresses({
+					secondLevelCosignatories[0], secondLevelCosignatories[2]
+				}), 2, 2);
+				test::MakeMultisig(cacheDelta, ToAddress(cosignatories[1]), ToAddresses({
+					secondLevelCosignatories[1], secondLevelCosignatories[2]
+				}), 2, 2);
+				cache.commit(Height());
+			}
+
+			// Assert:
+			auto selectedCosignatories = std::vector<Key>{ secondLevelCosignatories[0], secondLevelCosignatories[1] };
+			if (includeSharedCosignatory)
+				selectedCosignatories.push_back(secondLevelCosignatories[2]);
+
+			AssertValidationResult(expectedResult, cache, aggregateSigner, *pSubTransaction, selectedCosignatories);
+		}
+	}
+
+	TEST(TEST_CLASS, SufficientWhenCosignatorySharedByMultipleMultisigAccountsApproves) {
+		AssertMultisigCosignatorySharedByMultipleMultisigAccounts(ValidationResult::Success, true);
+	}
+
+	TEST(TEST_CLASS, InsufficientWhenCosignatorySharedByMultipleMultisigAccountsDoesNotApprove) {
+		AssertMultisigCosignatorySharedByMultipleMultisigAccounts(Failure_Result, false);
+	}
+
 	// endregion
 
 	// region multisig account modification handling
@@ -189,8 +189,8 @@ namespace catapult { namespace cache {
 
 	BasicNamespaceCacheDelta::CollectedIds BasicNamespaceCacheDelta::prune(Height height) {
 		BasicNamespaceCacheDelta::CollectedIds collectedIds;
-		const auto& heightGroupedSet = *m_pRootNamespaceIdsByExpiryHeight;
-		ForEachIdentifierWithGroup(*m_pHistoryById, heightGroupedSet, height, [this, height, &collectedIds](auto& history) {
+		PruneIdentifiersWithGroup(*m_pHistoryById, *m_pRootNamespaceIdsByExpiryHeight, height, [this, height, &collectedIds](
+				auto& history) {
 			auto originalSizes = GetNamespaceSizes(history);
 			auto removedIds = history.prune(height);
 			auto newSizes = GetNamespaceSizes(history);
@@ -199,9 +199,6 @@ namespace catapult { namespace cache {
 			for (auto removedId : removedIds)
 				m_pNamespaceById->remove(removedId);
 
-			if (history.empty())
-				m_pHistoryById->remove(history.id());
-
 			decrementActiveSize(originalSizes.Active - newSizes.Active);
 			decrementDeepSize(originalSizes.Deep - newSizes.Deep);
 		});
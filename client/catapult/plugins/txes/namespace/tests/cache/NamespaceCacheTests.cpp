@@ -20,6 +20,7 @@
 **/
 
 #include "src/cache/NamespaceCache.h"
+#include "src/cache/NamespaceBaseSets.h"
 #include "tests/test/NamespaceCacheTestUtils.h"
 #include "tests/test/NamespaceTestUtils.h"
 #include "tests/test/cache/CacheBasicTests.h"
@@ -1286,6 +1287,47 @@ namespace catapult { namespace cache {
 		AssertPrunedIds({ 7 }, prunedIds);
 	}
 
+	TEST(TEST_CLASS, PruneRemovesExpiryHeightGroupAndKeepsRenewedRootsInLaterGroup) {
+		// Arrange: create a delta directly around base sets so that the expiry height groups can be inspected
+		auto config = CacheConfiguration();
+		NamespaceBaseSets sets(config);
+		auto deltaSets = sets.rebase();
+		NamespaceSizes sizes{ 0, 0 };
+		BasicNamespaceCacheDelta delta(deltaSets, NamespaceCacheTypes::Options{ BlockDuration(11) }, sizes);
+
+		// - root 0 expires at height 10 but is renewed until height 110, root 1 expires at height 20
+		auto owner = test::CreateRandomOwner();
+		delta.insert(state::RootNamespace(NamespaceId(0), owner, test::CreateLifetime(0, 10)));
+		delta.insert(state::RootNamespace(NamespaceId(1), owner, test::CreateLifetime(10, 20)));
+		delta.insert(delta.find(NamespaceId(0)).get().root().renew(test::CreateLifetime(8, 110)));
+
+		// Sanity:
+		EXPECT_TRUE(deltaSets.pHeightGrouping->contains(Height(10)));
+		EXPECT_TRUE(deltaSets.pHeightGrouping->contains(Height(20)));
+		EXPECT_TRUE(deltaSets.pHeightGrouping->contains(Height(110)));
+
+		// Act: prune the original expiry height of root 0
+		auto prunedIds1 = delta.prune(Height(10));
+
+		// Assert: the group is removed but the renewed root is still present
+		AssertPrunedIds({}, prunedIds1);
+		EXPECT_FALSE(deltaSets.pHeightGrouping->contains(Height(10)));
+		EXPECT_TRUE(deltaSets.pHeightGrouping->contains(Height(20)));
+		EXPECT_TRUE(deltaSets.pHeightGrouping->contains(Height(110)));
+		EXPECT_TRUE(delta.contains(NamespaceId(0)));
+		EXPECT_EQ(Height(110), delta.find(NamespaceId(0)).get().root().lifetime().End);
+
+		// Act: prune the renewed expiry height of root 0
+		auto prunedIds2 = delta.prune(Height(110));
+
+		// Assert: the renewed root is pruned from its later group and that group is removed too
+		AssertPrunedIds({ 0 }, prunedIds2);
+		EXPECT_FALSE(deltaSets.pHeightGrouping->contains(Height(110)));
+		EXPECT_TRUE(deltaSets.pHeightGrouping->contains(Height(20)));
+		EXPECT_FALSE(delta.contains(NamespaceId(0)));
+		EXPECT_TRUE(delta.contains(NamespaceId(1)));
+	}
+
 	// endregion
 
 	// region cache init
@@ -67,6 +67,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(AddressAlias)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(AddressAlias)
 
 	// endregion
 
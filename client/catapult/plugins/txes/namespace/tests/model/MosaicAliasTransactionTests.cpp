@@ -67,6 +67,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(MosaicAlias)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(MosaicAlias)
 
 	// endregion
 
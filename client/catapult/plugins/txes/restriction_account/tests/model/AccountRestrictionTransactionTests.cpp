@@ -102,6 +102,9 @@ namespace catapult { namespace model {
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS_WITH_ARGS(AccountAddressRestriction, Entity_Type_Account_Address_Restriction)
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS_WITH_ARGS(AccountMosaicRestriction, Entity_Type_Account_Mosaic_Restriction)
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS_WITH_ARGS(AccountOperationRestriction, Entity_Type_Account_Operation_Restriction)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(AccountAddressRestriction)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(AccountMosaicRestriction)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(AccountOperationRestriction)
 
 	// endregion
 
@@ -70,6 +70,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(MosaicAddressRestriction)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(MosaicAddressRestriction)
 
 	// endregion
 
@@ -72,6 +72,7 @@ namespace catapult { namespace model {
 #undef TRANSACTION_FIELDS
 
 	ADD_BASIC_TRANSACTION_SIZE_PROPERTY_TESTS(MosaicGlobalRestriction)
+	ADD_SCHEMA_TRANSACTION_SIZE_TESTS(MosaicGlobalRestriction)
 
 	// endregion
 
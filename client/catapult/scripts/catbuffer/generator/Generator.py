@@ -0,0 +1,176 @@
+#!/usr/bin/python
+
+from pathlib import Path
+
+from catparser.ast import Array, FixedSizeBuffer, FixedSizeInteger
+from catparser.DisplayType import DisplayType
+
+HEADER_TEMPLATE = '''/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+// Code generated by catbuffer cpp layout generator; DO NOT EDIT.
+
+#pragma once
+#include "catapult/model/EntityType.h"
+
+namespace catapult { namespace test {
+
+	/// Fixed size layout of a transaction described by the catbuffer schemas.
+	struct SchemaTransactionLayout {
+		/// Transaction type.
+		model::EntityType Type;
+
+		/// Transaction version.
+		uint8_t Version;
+
+		/// Size of the fixed portion of the top-level transaction.
+		uint32_t Size;
+
+		/// Size of the fixed portion of the embedded transaction (zero when transaction cannot be embedded).
+		uint32_t EmbeddedSize;
+	};
+
+	/// Transaction layouts described by the catbuffer schemas.
+	constexpr SchemaTransactionLayout Schema_Transaction_Layouts[] = {
+{layouts}
+	};
+
+	/// Gets the size of the fixed portion of the transaction with \\a type and \\a version as described by the catbuffer schemas
+	/// or zero if no such transaction is described.
+	/// \\note The embedded transaction size is returned when \\a isEmbedded is \\c true.
+	constexpr uint32_t GetSchemaTransactionSize(model::EntityType type, uint8_t version, bool isEmbedded) {
+		for (const auto& layout : Schema_Transaction_Layouts) {
+			if (type == layout.Type && version == layout.Version)
+				return isEmbedded ? layout.EmbeddedSize : layout.Size;
+		}
+
+		return 0;
+	}
+}}
+'''
+
+
+class LayoutCalculator:
+	"""Calculates the sizes of the fixed portions of catbuffer structures."""
+
+	def __init__(self, ast_models):
+		self.model_map = {ast_model.name: ast_model for ast_model in ast_models}
+
+	def type_size(self, type_model):
+		"""Gets the size of a (non-array) type."""
+		if isinstance(type_model, (FixedSizeInteger, FixedSizeBuffer)):
+			return type_model.size
+
+		named_model = self.model_map[str(type_model)]
+		if DisplayType.STRUCT == named_model.display_type:
+			return self.struct_size(named_model)
+
+		return named_model.size
+
+	def field_size(self, field_model):
+		"""Gets the number of bytes occupied by a field within the fixed portion of its structure."""
+		field_type = field_model.field_type
+		if not isinstance(field_type, Array):
+			return self.type_size(field_type)
+
+		# arrays sized by other fields or filling the remainder of the structure are not part of the fixed portion
+		if not isinstance(field_type.size, int) or not field_type.size:
+			return 0
+
+		return field_type.size * self.type_size(field_type.element_type)
+
+	def struct_size(self, struct_model):
+		"""Gets the size of the fixed portion of a structure."""
+		size = 0
+		union_size = 0
+		for field_model in struct_model.fields:
+			if field_model.is_const:
+				continue
+
+			field_size = self.field_size(field_model)
+
+			# consecutive conditional fields share storage
+			if field_model.is_conditional:
+				union_size = max(union_size, field_size)
+				continue
+
+			size += union_size + field_size
+			union_size = 0
+
+		return size + union_size
+
+
+def _find_initializer_value(struct_model, property_name):
+	return next(initializer.value for initializer in struct_model.initializers if property_name == initializer.target_property_name)
+
+
+def _find_const_field(struct_model, field_name):
+	return next(field_model for field_model in struct_model.fields if field_model.is_const and field_name == field_model.name)
+
+
+def _find_enum_value(enum_model, value_name):
+	return next(value_model.value for value_model in enum_model.values if value_name == value_model.name)
+
+
+def _is_transaction(ast_model):
+	return DisplayType.STRUCT == ast_model.display_type \
+		and 'Transaction' == ast_model.factory_type \
+		and not ast_model.is_abstract \
+		and not ast_model.is_inline
+
+
+def build_layouts(ast_models):
+	"""Builds (name, type, version, size, embedded size) layout tuples for all concrete transactions."""
+	calculator = LayoutCalculator(ast_models)
+	transaction_type_model = calculator.model_map['TransactionType']
+
+	layouts = []
+	for ast_model in filter(_is_transaction, ast_models):
+		# aggregate transactions cannot be embedded
+		embedded_model = calculator.model_map.get(f'Embedded{ast_model.name}', None)
+
+		type_field = _find_const_field(ast_model, _find_initializer_value(ast_model, 'type'))
+		version_field = _find_const_field(ast_model, _find_initializer_value(ast_model, 'version'))
+		layouts.append((
+			ast_model.name,
+			_find_enum_value(transaction_type_model, type_field.value),
+			version_field.value,
+			calculator.struct_size(ast_model),
+			calculator.struct_size(embedded_model) if embedded_model else 0))
+
+	return sorted(layouts, key=lambda layout: (layout[1], layout[2]))
+
+
+def generate_files(ast_models, output_path: Path):
+	formatted_layouts = [
+		f'\t\t{{ static_cast<model::EntityType>(0x{entity_type:04X}), {version}, {size}, {embedded_size} }}, // {name}'
+		for (name, entity_type, version, size, embedded_size) in build_layouts(ast_models)
+	]
+
+	with open(output_path, 'w', encoding='utf8', newline='\n') as output_file:
+		output_file.write(HEADER_TEMPLATE.replace('{layouts}', '\n'.join(formatted_layouts)))
+
+
+class Generator:
+	@staticmethod
+	def generate(ast_models, output):
+		print(f'cpp catbuffer layout generator called with output: {output}')
+		generate_files(ast_models, Path(output))
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+set -ex
+
+git_root="$(git rev-parse --show-toplevel)"
+script_directory="$(dirname "$(readlink -f "$0")")"
+
+PYTHONPATH="${git_root}/catbuffer/parser:${script_directory}" python3 -m catparser \
+	--schema "${git_root}/catbuffer/schemas/symbol/all_generated.cats" \
+	--include "${git_root}/catbuffer/schemas/symbol" \
+	--output "${git_root}/client/catapult/tests/test/core/SchemaTransactionLayouts.h" \
+	--quiet \
+	--generator generator.Generator
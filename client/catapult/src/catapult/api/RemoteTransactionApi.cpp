@@ -22,8 +22,10 @@
 #include "RemoteTransactionApi.h"
 #include "RemoteApiUtils.h"
 #include "RemoteRequestDispatcher.h"
+#include "TransactionPackets.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/utils/ShortHashIblt.h"
 
 namespace catapult { namespace api {
 
@@ -56,6 +58,60 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct ReconcileTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = ReconciledTransactions;
+			static constexpr auto Packet_Type = ionet::PacketType::Reconcile_Transactions;
+			static constexpr auto Friendly_Name = "reconcile unconfirmed transactions";
+
+			static auto CreateRequestPacketPayload(
+					Timestamp minDeadline,
+					BlockFeeMultiplier minFeeMultiplier,
+					const utils::ShortHashIblt& knownShortHashesTable) {
+				ionet::PacketPayloadBuilder builder(Packet_Type);
+				builder.appendValue(minDeadline);
+				builder.appendValue(minFeeMultiplier);
+				builder.appendValues(std::vector<utils::ShortHashIblt::Cell>(
+						knownShortHashesTable.data(),
+						knownShortHashesTable.data() + knownShortHashesTable.size()));
+				return builder.build();
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				// data is prepended with status
+				auto dataSize = ionet::CalculatePacketDataSize(packet);
+				if (dataSize < sizeof(ReconcileTransactionsStatus))
+					return false;
+
+				auto status = reinterpret_cast<const ReconcileTransactionsStatus&>(*packet.Data());
+				const auto* pTransactionsData = packet.Data() + sizeof(ReconcileTransactionsStatus);
+				auto transactionsDataSize = dataSize - sizeof(ReconcileTransactionsStatus);
+				if (ReconcileTransactionsStatus::Decode_Failure == status)
+					return 0 == transactionsDataSize;
+
+				if (ReconcileTransactionsStatus::Success != status)
+					return false;
+
+				result.IsDecoded = true;
+				if (0 == transactionsDataSize)
+					return true;
+
+				auto offsets = ionet::ExtractEntityOffsets<model::Transaction>({ pTransactionsData, transactionsDataSize }, *this);
+				if (offsets.empty())
+					return false;
+
+				result.Transactions = model::TransactionRange::CopyVariable(
+						pTransactionsData,
+						transactionsDataSize,
+						offsets,
+						sizeof(uint64_t));
+				return true;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -81,6 +137,13 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), minDeadline, minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<ReconcileTraits> reconcileTransactions(
+					Timestamp minDeadline,
+					BlockFeeMultiplier minFeeMultiplier,
+					const utils::ShortHashIblt& knownShortHashesTable) const override {
+				return m_impl.dispatch(ReconcileTraits(m_registry), minDeadline, minFeeMultiplier, knownShortHashesTable);
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -24,10 +24,21 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
 
+namespace catapult { namespace utils { class ShortHashIblt; } }
+
 namespace catapult { namespace ionet { class PacketIo; } }
 
 namespace catapult { namespace api {
 
+	/// Result of a transactions reconciliation.
+	struct ReconciledTransactions {
+		/// \c true if the remote was able to decode the set difference.
+		bool IsDecoded = false;
+
+		/// Unconfirmed transactions unknown to the local node.
+		model::TransactionRange Transactions;
+	};
+
 	/// Api for retrieving transaction information from a remote node.
 	class RemoteTransactionApi : public RemoteApi {
 	protected:
@@ -42,6 +53,14 @@ namespace catapult { namespace api {
 				Timestamp minDeadline,
 				BlockFeeMultiplier minFeeMultiplier,
 				model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote that have a deadline at least \a minDeadline,
+		/// a fee multiplier at least \a minFeeMultiplier and do not have a short hash encoded in \a knownShortHashesTable.
+		/// \note Result is not decoded when the set difference between \a knownShortHashesTable and the remote is too large.
+		virtual thread::future<ReconciledTransactions> reconcileTransactions(
+				Timestamp minDeadline,
+				BlockFeeMultiplier minFeeMultiplier,
+				const utils::ShortHashIblt& knownShortHashesTable) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io and \a remoteIdentity
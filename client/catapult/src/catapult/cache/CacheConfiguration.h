@@ -42,6 +42,7 @@ namespace catapult { namespace cache {
 		CacheConfiguration()
 				: ShouldUseCacheDatabase(false)
 				, ShouldStorePatriciaTrees(false)
+				, ShouldPublishSnapshots(false)
 		{}
 
 		/// Creates a cache configuration around \a databaseDirectory and specified patricia tree storage \a mode.
@@ -58,6 +59,7 @@ namespace catapult { namespace cache {
 				, CacheDatabaseDirectory(databaseDirectory)
 				, CacheDatabaseConfig(databaseConfig)
 				, ShouldStorePatriciaTrees(PatriciaTreeStorageMode::Enabled == mode)
+				, ShouldPublishSnapshots(false)
 		{}
 
 	public:
@@ -72,5 +74,9 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// \c true if immutable snapshots should be published when changes are committed, \c false otherwise.
+		/// \note This is only supported by caches that do not use a cache database.
+		bool ShouldPublishSnapshots;
 	};
 }}
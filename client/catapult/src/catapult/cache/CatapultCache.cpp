@@ -326,7 +326,7 @@ namespace catapult { namespace cache {
 
 		for (const auto& pSubCache : m_subCaches) {
 			if (pSubCache)
-				pSubCache->commit();
+				pSubCache->commit(height);
 		}
 
 		// finally, update the dependent state and cache height
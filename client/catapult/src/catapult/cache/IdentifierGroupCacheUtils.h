@@ -21,20 +21,26 @@
 
 #pragma once
 #include "catapult/deltaset/BaseSetDelta.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/IdentifierGroup.h"
 #include "catapult/types.h"
+#include <vector>
 
 namespace catapult { namespace cache {
 
 	/// Adds \a identifier with grouping \a key to \a groupedSet.
 	template<typename TGroupedSet, typename TGroupingKey, typename TIdentifier>
 	void AddIdentifierWithGroup(TGroupedSet& groupedSet, const TGroupingKey& key, const TIdentifier& identifier) {
-		if (!groupedSet.contains(key))
-			groupedSet.insert(typename TGroupedSet::ElementType(key));
-
 		auto groupIter = groupedSet.find(key);
 		auto* pGroup = groupIter.get();
-		pGroup->add(identifier);
+		if (pGroup) {
+			pGroup->add(identifier);
+			return;
+		}
+
+		typename TGroupedSet::ElementType group(key);
+		group.add(identifier);
+		groupedSet.insert(group);
 	}
 
 	/// Calls \a action for each value in \a set with grouping \a key according to \a groupedSet.
@@ -84,4 +90,57 @@ namespace catapult { namespace cache {
 
 		return identifiers;
 	}
+
+	/// Touches all values in \a set with grouping \a height according to \a groupedSet and returns identifiers of all values
+	/// that are deactivating at \a height.
+	/// \note Each value is looked up once via the non-const \a set so that active to inactive transitions are visible.
+	template<typename TSet, typename TGroupedSet, typename TIdentifiers = typename TGroupedSet::ElementType::Identifiers>
+	TIdentifiers TouchIdentifiersWithGroup(TSet& set, const TGroupedSet& groupedSet, Height height) {
+		auto groupIter = groupedSet.find(height);
+		const auto* pGroup = groupIter.get();
+		if (!pGroup)
+			return {};
+
+		TIdentifiers identifiers;
+		for (const auto& identifier : pGroup->identifiers()) {
+			auto valueIter = set.find(identifier);
+			const auto* pValue = valueIter.get();
+			if (pValue && !pValue->isActive(height) && pValue->isActive(height - Height(1)))
+				identifiers.emplace(identifier);
+		}
+
+		return identifiers;
+	}
+
+	/// Prunes all values in \a set with grouping \a height according to \a groupedSet by passing them to \a action.
+	/// All values that are empty after pruning are removed from \a set and the group itself is removed from \a groupedSet.
+	template<typename TSet, typename TGroupedSet, typename TAction>
+	void PruneIdentifiersWithGroup(TSet& set, TGroupedSet& groupedSet, Height height, TAction action) {
+		using IdentifierType = typename TGroupedSet::ElementType::Identifiers::value_type;
+
+		// use const grouped set to avoid copying a group that is about to be removed
+		std::vector<IdentifierType> emptyIdentifiers;
+		{
+			auto groupIter = utils::as_const(groupedSet).find(height);
+			const auto* pGroup = groupIter.get();
+			if (!pGroup)
+				return;
+
+			for (const auto& identifier : pGroup->identifiers()) {
+				auto valueIter = set.find(identifier);
+				auto* pValue = valueIter.get();
+				if (!pValue)
+					continue;
+
+				action(*pValue);
+				if (pValue->empty())
+					emptyIdentifiers.push_back(identifier);
+			}
+		}
+
+		for (const auto& identifier : emptyIdentifiers)
+			set.remove(identifier);
+
+		groupedSet.remove(height);
+	}
 }}
@@ -142,8 +142,8 @@ namespace catapult { namespace cache {
 		/// to commit any changes to the original cache.
 		virtual std::unique_ptr<DetachedSubCacheView> createDetachedDelta() const = 0;
 
-		/// Commits all pending changes to the underlying storage.
-		virtual void commit() = 0;
+		/// Commits all pending changes to the underlying storage at \a height.
+		virtual void commit(Height height) = 0;
 
 	public:
 		/// Gets a const pointer to the underlying cache.
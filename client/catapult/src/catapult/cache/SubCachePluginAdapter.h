@@ -67,8 +67,8 @@ namespace catapult { namespace cache {
 					makeSubCacheViewIdentifier(SubCacheViewType::DetachedDelta));
 		}
 
-		void commit() override {
-			m_pCache->commit();
+		void commit(Height height) override {
+			Commit(*m_pCache, height, HeightAwareCommit<TCache>());
 		}
 
 	public:
@@ -107,6 +107,22 @@ namespace catapult { namespace cache {
 			return !!cache.createView()->tryMakeIterableView();
 		}
 
+		template<typename T, typename = void>
+		struct HeightAwareCommit : public std::false_type {};
+
+		template<typename T>
+		struct HeightAwareCommit<T, utils::traits::is_type_expression_t<decltype(reinterpret_cast<T*>(1)->commit(Height()))>>
+				: public std::true_type
+		{};
+
+		static void Commit(TCache& cache, Height, std::false_type) {
+			cache.commit();
+		}
+
+		static void Commit(TCache& cache, Height height, std::true_type) {
+			cache.commit(height);
+		}
+
 	private:
 		// region SubCacheViewAdapter
 
@@ -262,6 +262,11 @@ namespace catapult { namespace cache {
 			return m_cache;
 		}
 
+		/// Gets a typed const reference to the underlying cache.
+		const TCache& cache() const {
+			return m_cache;
+		}
+
 	private:
 		TCache m_cache;
 		size_t m_commitCounter;
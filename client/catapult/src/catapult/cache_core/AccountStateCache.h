@@ -22,7 +22,9 @@
 #pragma once
 #include "AccountStateCacheDelta.h"
 #include "AccountStateCacheView.h"
+#include "AccountStateSnapshot.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/utils/RcuPointer.h"
 
 namespace catapult { namespace cache {
 
@@ -46,8 +48,16 @@ namespace catapult { namespace cache {
 				const AccountStateCacheTypes::Options& options,
 				std::unique_ptr<HighValueAccounts>&& pHighValueAccounts)
 				: AccountStateBasicCache(config, AccountStateCacheTypes::Options(options), *pHighValueAccounts)
-				, m_pHighValueAccounts(std::move(pHighValueAccounts))
-		{}
+				, m_pHighValueAccounts(std::move(pHighValueAccounts)) {
+			if (!config.ShouldPublishSnapshots)
+				return;
+
+			if (config.ShouldUseCacheDatabase)
+				CATAPULT_THROW_INVALID_ARGUMENT("account state snapshots are not supported when cache database is used");
+
+			m_pSnapshotBuilder = std::make_unique<AccountStateSnapshotBuilder>(options);
+			m_pSnapshot = std::make_unique<utils::RcuPointer<AccountStateSnapshot>>(m_pSnapshotBuilder->build(Height()));
+		}
 
 	public:
 		/// Initializes the cache with \a highValueAccounts.
@@ -58,14 +68,36 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides AccountStateBasicCache::commit.
 		void commit(CacheDeltaType& delta) {
-			auto highValueAccounts = delta.detachHighValueAccounts();
+			// delta changes need to be applied to the snapshot builder before they are reset by commit
+			if (m_pSnapshotBuilder)
+				m_pSnapshotBuilder->update(delta);
+
+			// high value accounts are updated in place, so commit cost scales with the number of changed accounts
+			auto highValueAccountsChanges = delta.detachHighValueAccountsChanges();
 			AccountStateBasicCache::commit(delta);
-			*m_pHighValueAccounts = std::move(highValueAccounts);
+			m_pHighValueAccounts->apply(std::move(highValueAccountsChanges));
+		}
+
+		/// Publishes a snapshot at \a height that includes all committed changes.
+		/// \note This is a no-op when snapshots are disabled.
+		void publishSnapshot(Height height) {
+			if (m_pSnapshotBuilder)
+				m_pSnapshot->publish(m_pSnapshotBuilder->build(height));
+		}
+
+		/// Pins the last published snapshot.
+		/// \note Returns \c nullptr when snapshots are disabled.
+		std::shared_ptr<const AccountStateSnapshot> snapshot() const {
+			return m_pSnapshot ? m_pSnapshot->pin() : nullptr;
 		}
 
 	private:
 		// unique pointer to allow reference to be valid after moves of this cache
 		std::unique_ptr<HighValueAccounts> m_pHighValueAccounts;
+
+		// unique pointers to allow snapshots to be published without holding cache locks
+		std::unique_ptr<AccountStateSnapshotBuilder> m_pSnapshotBuilder;
+		std::unique_ptr<utils::RcuPointer<AccountStateSnapshot>> m_pSnapshot;
 	};
 
 	/// Synchronized cache composed of stateful account information.
@@ -92,6 +124,21 @@ namespace catapult { namespace cache {
 			return m_importanceGrouping;
 		}
 
+		/// Pins the last published snapshot without acquiring any cache locks.
+		/// \note Returns \c nullptr when snapshots are disabled.
+		std::shared_ptr<const AccountStateSnapshot> snapshot() const {
+			return cache().snapshot();
+		}
+
+	public:
+		using SynchronizedCacheWithInit<BasicAccountStateCache>::commit;
+
+		/// Commits all pending changes to the underlying storage and publishes a snapshot at \a height.
+		void commit(Height height) {
+			SynchronizedCacheWithInit<BasicAccountStateCache>::commit();
+			cache().publishSnapshot(height);
+		}
+
 	private:
 		model::NetworkIdentifier m_networkIdentifier;
 		uint64_t m_importanceGrouping;
@@ -173,11 +173,11 @@ namespace catapult { namespace cache {
 	void BasicAccountStateCacheDelta::processHighValueRemovedAccounts(model::ImportanceHeight importanceHeight) {
 		model::AddressSet filteredRemovedHighValueAddresses;
 
-		const auto& removedHighValueAddresses = m_highValueAccountsUpdater.removedAddresses();
-		for (const auto& address : removedHighValueAddresses) {
+		m_highValueAccountsUpdater.forEachRemovedAddress([this, importanceHeight, &filteredRemovedHighValueAddresses](
+				const auto& address) {
 			auto accountStateIter = find(address);
 			if (!accountStateIter.tryGet())
-				continue;
+				return;
 
 			auto& accountState = accountStateIter.get();
 			auto& activityBuckets = accountState.ActivityBuckets;
@@ -191,13 +191,13 @@ namespace catapult { namespace cache {
 
 			if (state::HasHistoricalInformation(accountState))
 				filteredRemovedHighValueAddresses.insert(address);
-		}
+		});
 
 		m_highValueAccountsUpdater.setRemovedAddresses(std::move(filteredRemovedHighValueAddresses));
 	}
 
-	HighValueAccounts BasicAccountStateCacheDelta::detachHighValueAccounts() {
-		return m_highValueAccountsUpdater.detachAccounts();
+	HighValueAccountsChanges BasicAccountStateCacheDelta::detachHighValueAccountsChanges() {
+		return m_highValueAccountsUpdater.detachChanges();
 	}
 
 	void BasicAccountStateCacheDelta::prune(Height height) {
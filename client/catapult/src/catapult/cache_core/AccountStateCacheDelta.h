@@ -159,8 +159,8 @@ namespace catapult { namespace cache {
 		/// Processes removed high value accounts at \a height.
 		void processHighValueRemovedAccounts(model::ImportanceHeight importanceHeight);
 
-		/// Detaches high value accounts from this delta.
-		HighValueAccounts detachHighValueAccounts();
+		/// Detaches pending high value accounts changes from this delta.
+		HighValueAccountsChanges detachHighValueAccountsChanges();
 
 		/// Prunes the cache at \a height.
 		void prune(Height height);
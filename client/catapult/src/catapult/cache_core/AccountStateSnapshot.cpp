@@ -0,0 +1,195 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AccountStateSnapshot.h"
+#include "AccountStateCacheDelta.h"
+#include "catapult/model/Address.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// first byte is network identifier, so use first hash bytes instead
+
+		size_t GetShardGroupIndex(const Address& address) {
+			return address[1];
+		}
+
+		size_t GetShardIndex(const Address& address) {
+			return address[2];
+		}
+	}
+
+	// region AccountStateSnapshot
+
+	const state::AccountState& AccountStateSnapshot::FindIterator::get() const {
+		if (!m_pAccountState)
+			CATAPULT_THROW_INVALID_ARGUMENT("value not found in account state snapshot");
+
+		return *m_pAccountState;
+	}
+
+	AccountStateSnapshot::AccountStateSnapshot(
+			Height height,
+			const AccountStateCacheTypes::Options& options,
+			const ShardGroups& shardGroups,
+			size_t size)
+			: m_height(height)
+			, m_options(options)
+			, m_shardGroups(shardGroups)
+			, m_size(size)
+	{}
+
+	Height AccountStateSnapshot::height() const {
+		return m_height;
+	}
+
+	model::NetworkIdentifier AccountStateSnapshot::networkIdentifier() const {
+		return m_options.NetworkIdentifier;
+	}
+
+	uint64_t AccountStateSnapshot::importanceGrouping() const {
+		return m_options.ImportanceGrouping;
+	}
+
+	Amount AccountStateSnapshot::minHarvesterBalance() const {
+		return m_options.MinHarvesterBalance;
+	}
+
+	Amount AccountStateSnapshot::maxHarvesterBalance() const {
+		return m_options.MaxHarvesterBalance;
+	}
+
+	MosaicId AccountStateSnapshot::harvestingMosaicId() const {
+		return m_options.HarvestingMosaicId;
+	}
+
+	size_t AccountStateSnapshot::size() const {
+		return m_size;
+	}
+
+	bool AccountStateSnapshot::contains(const Address& address) const {
+		return !!find(address).tryGet();
+	}
+
+	bool AccountStateSnapshot::contains(const Key& publicKey) const {
+		return !!find(publicKey).tryGet();
+	}
+
+	AccountStateSnapshot::FindIterator AccountStateSnapshot::find(const Address& address) const {
+		const auto& pShard = (*m_shardGroups[GetShardGroupIndex(address)])[GetShardIndex(address)];
+		if (!pShard)
+			return FindIterator(nullptr);
+
+		auto iter = pShard->find(address);
+		return FindIterator(pShard->cend() == iter ? nullptr : iter->second.get());
+	}
+
+	AccountStateSnapshot::FindIterator AccountStateSnapshot::find(const Key& publicKey) const {
+		// account states are only accessible by public key when the public key is known
+		auto iter = find(model::PublicKeyToAddress(publicKey, m_options.NetworkIdentifier));
+		const auto* pAccountState = iter.tryGet();
+		if (!pAccountState || Height() == pAccountState->PublicKeyHeight || publicKey != pAccountState->PublicKey)
+			return FindIterator(nullptr);
+
+		return iter;
+	}
+
+	// endregion
+
+	// region AccountStateSnapshotBuilder
+
+	AccountStateSnapshotBuilder::AccountStateSnapshotBuilder(const AccountStateCacheTypes::Options& options)
+			: m_options(options)
+			, m_generation(1)
+			, m_size(0)
+			, m_hasPendingChanges(false) {
+		for (auto& pShardGroup : m_shardGroups)
+			pShardGroup = std::make_shared<AccountStateSnapshot::ShardGroup>();
+
+		m_shardGroupGenerations.fill(m_generation);
+		for (auto& shardGenerations : m_shardGenerations)
+			shardGenerations.fill(0);
+	}
+
+	size_t AccountStateSnapshotBuilder::size() const {
+		return m_size;
+	}
+
+	bool AccountStateSnapshotBuilder::hasPendingChanges() const {
+		return m_hasPendingChanges;
+	}
+
+	void AccountStateSnapshotBuilder::update(const BasicAccountStateCacheDelta& delta) {
+		for (const auto* pAccountState : delta.removedElements()) {
+			if (prepareShard(pAccountState->Address).erase(pAccountState->Address))
+				--m_size;
+		}
+
+		auto addOrReplace = [this](const auto& accountStates) {
+			for (const auto* pAccountState : accountStates) {
+				auto& pShardAccountState = prepareShard(pAccountState->Address)[pAccountState->Address];
+				if (!pShardAccountState)
+					++m_size;
+
+				pShardAccountState = std::make_shared<const state::AccountState>(*pAccountState);
+			}
+		};
+
+		addOrReplace(delta.addedElements());
+		addOrReplace(delta.modifiedElements());
+	}
+
+	std::shared_ptr<const AccountStateSnapshot> AccountStateSnapshotBuilder::build(Height height) {
+		AccountStateSnapshot::ShardGroups shardGroups;
+		for (auto i = 0u; i < AccountStateSnapshot::Num_Shard_Groups; ++i)
+			shardGroups[i] = m_shardGroups[i];
+
+		// all shard groups and shards are now shared with the snapshot, so they need to be copied before being modified
+		++m_generation;
+		m_hasPendingChanges = false;
+		return std::make_shared<const AccountStateSnapshot>(height, m_options, shardGroups, m_size);
+	}
+
+	AccountStateSnapshot::Shard& AccountStateSnapshotBuilder::prepareShard(const Address& address) {
+		m_hasPendingChanges = true;
+
+		auto shardGroupIndex = GetShardGroupIndex(address);
+		auto& pShardGroup = m_shardGroups[shardGroupIndex];
+		if (m_generation != m_shardGroupGenerations[shardGroupIndex]) {
+			// only pointers to shards are copied
+			pShardGroup = std::make_shared<AccountStateSnapshot::ShardGroup>(*pShardGroup);
+			m_shardGroupGenerations[shardGroupIndex] = m_generation;
+		}
+
+		auto shardIndex = GetShardIndex(address);
+		auto& pShard = (*pShardGroup)[shardIndex];
+		auto& shardGeneration = m_shardGenerations[shardGroupIndex][shardIndex];
+		if (m_generation != shardGeneration) {
+			// only pointers to account states are copied
+			pShard = pShard ? std::make_shared<AccountStateSnapshot::Shard>(*pShard) : std::make_shared<AccountStateSnapshot::Shard>();
+			shardGeneration = m_generation;
+		}
+
+		return *pShard;
+	}
+
+	// endregion
+}}
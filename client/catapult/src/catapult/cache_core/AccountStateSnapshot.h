@@ -0,0 +1,160 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AccountStateCacheTypes.h"
+#include <array>
+#include <unordered_map>
+
+namespace catapult { namespace cache { class BasicAccountStateCacheDelta; } }
+
+namespace catapult { namespace cache {
+
+	/// Immutable snapshot of all account states in an account state cache at a specific height.
+	/// \note Snapshots are composed of a two level tree of shards. Shard groups, shards and account states are shared
+	///       with other snapshots until modified, so building a new snapshot only copies the paths to changed account states.
+	class AccountStateSnapshot {
+	public:
+		/// Number of shard groups.
+		static constexpr size_t Num_Shard_Groups = 256;
+
+		/// Number of shards in each shard group.
+		static constexpr size_t Num_Shards_Per_Group = 256;
+
+		/// Map of addresses to account states composing a single shard.
+		using Shard = std::unordered_map<Address, std::shared_ptr<const state::AccountState>, utils::ArrayHasher<Address>>;
+
+		/// Shards composing a shard group.
+		/// \note Shards without any account states are \c nullptr.
+		using ShardGroup = std::array<std::shared_ptr<Shard>, Num_Shards_Per_Group>;
+
+		/// Shard groups composing a snapshot.
+		using ShardGroups = std::array<std::shared_ptr<const ShardGroup>, Num_Shard_Groups>;
+
+		/// Iterator returned by find.
+		class FindIterator {
+		public:
+			/// Creates an iterator around \a pAccountState.
+			explicit FindIterator(const state::AccountState* pAccountState) : m_pAccountState(pAccountState)
+			{}
+
+		public:
+			/// Gets a const value.
+			/// \throws catapult_invalid_argument if this iterator does not point to a value.
+			const state::AccountState& get() const;
+
+			/// Tries to get a const value.
+			const state::AccountState* tryGet() const {
+				return m_pAccountState;
+			}
+
+		private:
+			const state::AccountState* m_pAccountState;
+		};
+
+	public:
+		/// Creates a snapshot at \a height around \a options, \a shardGroups and total number of account states (\a size).
+		AccountStateSnapshot(Height height, const AccountStateCacheTypes::Options& options, const ShardGroups& shardGroups, size_t size);
+
+	public:
+		/// Gets the height of the last change included in this snapshot.
+		Height height() const;
+
+		/// Gets the network identifier.
+		model::NetworkIdentifier networkIdentifier() const;
+
+		/// Gets the network importance grouping.
+		uint64_t importanceGrouping() const;
+
+		/// Gets the minimum harvester balance.
+		Amount minHarvesterBalance() const;
+
+		/// Gets the maximum harvester balance.
+		Amount maxHarvesterBalance() const;
+
+		/// Gets the harvesting mosaic id.
+		MosaicId harvestingMosaicId() const;
+
+		/// Gets the number of account states.
+		size_t size() const;
+
+	public:
+		/// Returns \c true if the account state identified by \a address is contained in this snapshot.
+		bool contains(const Address& address) const;
+
+		/// Returns \c true if the account state identified by \a publicKey is contained in this snapshot.
+		bool contains(const Key& publicKey) const;
+
+		/// Finds the account state identified by \a address.
+		FindIterator find(const Address& address) const;
+
+		/// Finds the account state identified by \a publicKey.
+		FindIterator find(const Key& publicKey) const;
+
+	private:
+		Height m_height;
+		AccountStateCacheTypes::Options m_options;
+		ShardGroups m_shardGroups;
+		size_t m_size;
+	};
+
+	/// Builds account state snapshots from account state cache deltas.
+	/// \note This class is not thread safe and is expected to only be used by the cache committer.
+	class AccountStateSnapshotBuilder {
+	public:
+		/// Creates an empty builder around \a options.
+		explicit AccountStateSnapshotBuilder(const AccountStateCacheTypes::Options& options);
+
+	public:
+		/// Gets the number of account states.
+		size_t size() const;
+
+		/// Returns \c true if there are changes that are not included in the last built snapshot.
+		bool hasPendingChanges() const;
+
+	public:
+		/// Applies all added, modified and removed account states in \a delta.
+		/// \note Only shard groups and shards that are changed and shared with a built snapshot are copied.
+		void update(const BasicAccountStateCacheDelta& delta);
+
+		/// Builds a snapshot at \a height that includes all applied changes.
+		std::shared_ptr<const AccountStateSnapshot> build(Height height);
+
+	private:
+		AccountStateSnapshot::Shard& prepareShard(const Address& address);
+
+	private:
+		using ShardGenerations = std::array<uint32_t, AccountStateSnapshot::Num_Shards_Per_Group>;
+
+	private:
+		AccountStateCacheTypes::Options m_options;
+
+		// shard groups and shards can only be modified in place when they were created in the current generation
+		// (incrementing the generation when building a snapshot implicitly marks all of them as shared)
+		std::array<std::shared_ptr<AccountStateSnapshot::ShardGroup>, AccountStateSnapshot::Num_Shard_Groups> m_shardGroups;
+		std::array<uint32_t, AccountStateSnapshot::Num_Shard_Groups> m_shardGroupGenerations;
+		std::array<ShardGenerations, AccountStateSnapshot::Num_Shard_Groups> m_shardGenerations;
+		uint32_t m_generation;
+
+		size_t m_size;
+		bool m_hasPendingChanges;
+	};
+}}
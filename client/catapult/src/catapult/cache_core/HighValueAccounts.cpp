@@ -24,6 +24,49 @@
 
 namespace catapult { namespace cache {
 
+	namespace {
+		template<typename TContainer>
+		bool Contains(const TContainer& container, const Address& address) {
+			return container.cend() != container.find(address);
+		}
+
+		template<typename TValue>
+		void AddToJournal(HeightAddressesMap& journal, const Address& address, const state::HeightIndexedHistoryMap<TValue>& historyMap) {
+			for (auto height : historyMap.heights())
+				journal[height].insert(address);
+		}
+
+		HeightAddressesMap CreateAccountHistoryJournal(const AddressAccountHistoryMap& accountHistories) {
+			HeightAddressesMap journal;
+			for (const auto& accountHistoryPair : accountHistories) {
+				AddToJournal(journal, accountHistoryPair.first, accountHistoryPair.second.balance());
+				AddToJournal(journal, accountHistoryPair.first, accountHistoryPair.second.vrfPublicKey());
+				AddToJournal(journal, accountHistoryPair.first, accountHistoryPair.second.votingPublicKeys());
+			}
+
+			return journal;
+		}
+
+		void ApplyAddressChanges(
+				model::AddressSet& addresses,
+				const model::AddressSet& addedAddresses,
+				const model::AddressSet& erasedAddresses) {
+			for (const auto& address : erasedAddresses)
+				addresses.erase(address);
+
+			addresses.insert(addedAddresses.cbegin(), addedAddresses.cend());
+		}
+	}
+
+	// region HighValueAccountsChanges
+
+	HighValueAccountsChanges::HighValueAccountsChanges()
+			: MinJournalHeight(Height(0))
+			, MaxJournalHeight(Height(std::numeric_limits<Height::ValueType>::max()))
+	{}
+
+	// endregion
+
 	// region HighValueAccounts
 
 	HighValueAccounts::HighValueAccounts()
@@ -36,6 +79,7 @@ namespace catapult { namespace cache {
 			: m_addresses(addresses)
 			, m_removedAddresses(removedAddresses)
 			, m_accountHistories(accountHistories)
+			, m_accountHistoryJournal(CreateAccountHistoryJournal(m_accountHistories))
 	{}
 
 	HighValueAccounts::HighValueAccounts(
@@ -43,8 +87,9 @@ namespace catapult { namespace cache {
 			model::AddressSet&& removedAddresses,
 			AddressAccountHistoryMap&& accountHistories)
 			: m_addresses(std::move(addresses))
-			, m_removedAddresses(removedAddresses)
+			, m_removedAddresses(std::move(removedAddresses))
 			, m_accountHistories(std::move(accountHistories))
+			, m_accountHistoryJournal(CreateAccountHistoryJournal(m_accountHistories))
 	{}
 
 	const model::AddressSet& HighValueAccounts::addresses() const {
@@ -59,6 +104,212 @@ namespace catapult { namespace cache {
 		return m_accountHistories;
 	}
 
+	const HeightAddressesMap& HighValueAccounts::accountHistoryJournal() const {
+		return m_accountHistoryJournal;
+	}
+
+	void HighValueAccounts::apply(HighValueAccountsChanges&& changes) {
+		ApplyAddressChanges(m_addresses, changes.AddedAddresses, changes.ErasedAddresses);
+		ApplyAddressChanges(m_removedAddresses, changes.AddedRemovedAddresses, changes.ErasedRemovedAddresses);
+
+		for (const auto& address : changes.ErasedAccountHistories)
+			m_accountHistories.erase(address);
+
+		for (auto& accountHistoryPair : changes.ModifiedAccountHistories)
+			m_accountHistories.insert_or_assign(accountHistoryPair.first, std::move(accountHistoryPair.second));
+
+		auto& journal = m_accountHistoryJournal;
+		journal.erase(journal.begin(), journal.lower_bound(changes.MinJournalHeight));
+		journal.erase(journal.upper_bound(changes.MaxJournalHeight), journal.end());
+		for (const auto& journalPair : changes.AddedJournalEntries)
+			journal[journalPair.first].insert(journalPair.second.cbegin(), journalPair.second.cend());
+	}
+
+	// endregion
+
+	// region AddressSetOverlay
+
+	namespace {
+		// set of addresses composed of original addresses and changes relative to them
+		class AddressSetOverlay {
+		public:
+			AddressSetOverlay(
+					const model::AddressSet& originalAddresses,
+					model::AddressSet& addedAddresses,
+					model::AddressSet& erasedAddresses)
+					: m_original(originalAddresses)
+					, m_added(addedAddresses)
+					, m_erased(erasedAddresses)
+			{}
+
+		public:
+			void insert(const Address& address) {
+				if (Contains(m_original, address))
+					m_erased.erase(address);
+				else
+					m_added.insert(address);
+			}
+
+			void erase(const Address& address) {
+				if (Contains(m_original, address))
+					m_erased.insert(address);
+				else
+					m_added.erase(address);
+			}
+
+		private:
+			const model::AddressSet& m_original;
+			model::AddressSet& m_added;
+			model::AddressSet& m_erased;
+		};
+
+		model::AddressSet MaterializeAddresses(
+				const model::AddressSet& originalAddresses,
+				const model::AddressSet& addedAddresses,
+				const model::AddressSet& erasedAddresses) {
+			auto addresses = originalAddresses;
+			ApplyAddressChanges(addresses, addedAddresses, erasedAddresses);
+			return addresses;
+		}
+
+		// added addresses are never contained in the original addresses and erased addresses are always contained in them
+
+		size_t CountAddresses(
+				const model::AddressSet& originalAddresses,
+				const model::AddressSet& addedAddresses,
+				const model::AddressSet& erasedAddresses) {
+			return originalAddresses.size() - erasedAddresses.size() + addedAddresses.size();
+		}
+
+		void ForEachAddress(
+				const model::AddressSet& originalAddresses,
+				const model::AddressSet& addedAddresses,
+				const model::AddressSet& erasedAddresses,
+				const consumer<const Address&>& consumer) {
+			for (const auto& address : originalAddresses) {
+				if (!Contains(erasedAddresses, address))
+					consumer(address);
+			}
+
+			for (const auto& address : addedAddresses)
+				consumer(address);
+		}
+	}
+
+	// endregion
+
+	// region AccountHistoriesOverlay
+
+	namespace {
+		// map of account histories composed of original account histories and changes relative to them
+		class AccountHistoriesOverlay {
+		public:
+			AccountHistoriesOverlay(
+					const AddressAccountHistoryMap& originalAccountHistories,
+					AddressAccountHistoryMap& modifiedAccountHistories,
+					model::AddressSet& erasedAddresses)
+					: m_original(originalAccountHistories)
+					, m_modified(modifiedAccountHistories)
+					, m_erased(erasedAddresses)
+			{}
+
+		public:
+			state::AccountHistory* tryGet(const Address& address) {
+				auto modifiedIter = m_modified.find(address);
+				if (m_modified.end() != modifiedIter)
+					return &modifiedIter->second;
+
+				auto originalIter = m_original.find(address);
+				if (m_original.cend() == originalIter || Contains(m_erased, address))
+					return nullptr;
+
+				// copy original account history on first access so that it can be modified
+				return &m_modified.emplace(address, originalIter->second).first->second;
+			}
+
+			state::AccountHistory& emplace(const Address& address) {
+				return m_modified.emplace(address, state::AccountHistory()).first->second;
+			}
+
+			void erase(const Address& address) {
+				m_modified.erase(address);
+
+				if (Contains(m_original, address))
+					m_erased.insert(address);
+			}
+
+		private:
+			const AddressAccountHistoryMap& m_original;
+			AddressAccountHistoryMap& m_modified;
+			model::AddressSet& m_erased;
+		};
+	}
+
+	// endregion
+
+	// region AccountHistoryJournalOverlay
+
+	namespace {
+		// account history journal composed of original journal entries and changes relative to them
+		class AccountHistoryJournalOverlay {
+		public:
+			AccountHistoryJournalOverlay(const HeightAddressesMap& originalJournal, HighValueAccountsChanges& changes)
+					: m_original(originalJournal)
+					, m_changes(changes)
+			{}
+
+		public:
+			bool hasAnyLess(Height height) const {
+				auto originalIter = m_original.lower_bound(m_changes.MinJournalHeight);
+				if (m_original.cend() != originalIter && originalIter->first <= m_changes.MaxJournalHeight && originalIter->first < height)
+					return true;
+
+				const auto& addedEntries = m_changes.AddedJournalEntries;
+				return !addedEntries.empty() && addedEntries.cbegin()->first < height;
+			}
+
+			model::AddressSet addressesGreater(Height height) const {
+				model::AddressSet addresses;
+				auto minHeight = std::max(height + Height(1), m_changes.MinJournalHeight);
+				for (auto iter = m_original.lower_bound(minHeight); m_original.cend() != iter; ++iter) {
+					if (iter->first > m_changes.MaxJournalHeight)
+						break;
+
+					addresses.insert(iter->second.cbegin(), iter->second.cend());
+				}
+
+				const auto& addedEntries = m_changes.AddedJournalEntries;
+				for (auto iter = addedEntries.upper_bound(height); addedEntries.cend() != iter; ++iter)
+					addresses.insert(iter->second.cbegin(), iter->second.cend());
+
+				return addresses;
+			}
+
+		public:
+			void add(Height height, const Address& address) {
+				m_changes.AddedJournalEntries[height].insert(address);
+			}
+
+			void pruneLess(Height height) {
+				m_changes.MinJournalHeight = std::max(m_changes.MinJournalHeight, height);
+
+				auto& addedEntries = m_changes.AddedJournalEntries;
+				addedEntries.erase(addedEntries.begin(), addedEntries.lower_bound(height));
+			}
+
+			void pruneGreater(Height height) {
+				m_changes.MaxJournalHeight = std::min(m_changes.MaxJournalHeight, height);
+
+				auto& addedEntries = m_changes.AddedJournalEntries;
+				addedEntries.erase(addedEntries.upper_bound(height), addedEntries.end());
+			}
+
+		private:
+			const HeightAddressesMap& m_original;
+			HighValueAccountsChanges& m_changes;
+		};
+	}
+
 	// endregion
 
 	// region HighValueAddressesUpdater
@@ -78,8 +329,8 @@ namespace catapult { namespace cache {
 		public:
 			HighValueAddressesUpdater(
 					const model::AddressSet& originalAddresses,
-					model::AddressSet& currentAddresses,
-					model::AddressSet& removedAddresses)
+					AddressSetOverlay& currentAddresses,
+					AddressSetOverlay& removedAddresses)
 					: m_original(originalAddresses)
 					, m_current(currentAddresses)
 					, m_removed(removedAddresses)
@@ -100,15 +351,15 @@ namespace catapult { namespace cache {
 					m_current.erase(address);
 
 					// need to check HasHistoricalInformation in order for multiblock syncs to work
-					if (m_original.cend() != m_original.find(address) || descriptor.HasHistoricalInformation)
+					if (Contains(m_original, address) || descriptor.HasHistoricalInformation)
 						m_removed.insert(address);
 				}
 			}
 
 		private:
 			const model::AddressSet& m_original;
-			model::AddressSet& m_current;
-			model::AddressSet& m_removed;
+			AddressSetOverlay& m_current;
+			AddressSetOverlay& m_removed;
 		};
 	}
 
@@ -124,8 +375,9 @@ namespace catapult { namespace cache {
 			using MemorySetType = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
 
 		public:
-			HighValueBalancesUpdater(AddressAccountHistoryMap& accountHistories, Height height)
+			HighValueBalancesUpdater(AccountHistoriesOverlay& accountHistories, AccountHistoryJournalOverlay& journal, Height height)
 					: m_accountHistories(accountHistories)
+					, m_journal(journal)
 					, m_height(height)
 			{}
 
@@ -136,35 +388,52 @@ namespace catapult { namespace cache {
 			}
 
 			void pruneGreater() {
-				for (auto& pair : m_accountHistories)
-					pair.second.pruneGreater(m_height);
+				// only account histories journaled at greater heights can have values at greater heights
+				for (const auto& address : m_journal.addressesGreater(m_height)) {
+					auto* pAccountHistory = m_accountHistories.tryGet(address);
+					if (!pAccountHistory)
+						continue;
+
+					pAccountHistory->pruneGreater(m_height);
+					m_touchedAddresses.insert(address);
+				}
+
+				m_journal.pruneGreater(m_height);
 			}
 
 			void prune(Amount minBalance) {
-				utils::map_erase_if(m_accountHistories, [minBalance](const auto& pair) {
-					return !pair.second.anyAtLeast(minBalance);
-				});
+				// untouched account histories are unchanged, so they still have at least one sufficient balance
+				for (const auto& address : m_touchedAddresses) {
+					const auto* pAccountHistory = m_accountHistories.tryGet(address);
+					if (pAccountHistory && !pAccountHistory->anyAtLeast(minBalance))
+						m_accountHistories.erase(address);
+				}
 			}
 
 		private:
 			void updateOne(const state::AccountState& accountState, const std::pair<Amount, bool>& effectiveBalancePair) {
-				auto accountHistoriesIter = m_accountHistories.find(accountState.Address);
+				auto* pAccountHistory = m_accountHistories.tryGet(accountState.Address);
 
 				// if this account has a newly high balance, start tracking it
-				if (m_accountHistories.cend() == accountHistoriesIter && effectiveBalancePair.second)
-					accountHistoriesIter = m_accountHistories.emplace(accountState.Address, state::AccountHistory()).first;
+				if (!pAccountHistory && effectiveBalancePair.second)
+					pAccountHistory = &m_accountHistories.emplace(accountState.Address);
 
 				// if this account is tracked, add tracked values
-				if (m_accountHistories.cend() != accountHistoriesIter) {
-					accountHistoriesIter->second.add(m_height, effectiveBalancePair.first);
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.vrf().get());
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
+				if (pAccountHistory) {
+					pAccountHistory->add(m_height, effectiveBalancePair.first);
+					pAccountHistory->add(m_height, accountState.SupplementalPublicKeys.vrf().get());
+					pAccountHistory->add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
+
+					m_journal.add(m_height, accountState.Address);
+					m_touchedAddresses.insert(accountState.Address);
 				}
 			}
 
 		private:
-			AddressAccountHistoryMap& m_accountHistories;
+			AccountHistoriesOverlay& m_accountHistories;
+			AccountHistoryJournalOverlay& m_journal;
 			Height m_height;
+			model::AddressSet m_touchedAddresses;
 		};
 	}
 
@@ -174,10 +443,7 @@ namespace catapult { namespace cache {
 
 	HighValueAccountsUpdater::HighValueAccountsUpdater(const AccountStateCacheTypes::Options& options, const HighValueAccounts& accounts)
 			: m_options(options)
-			, m_original(accounts.addresses())
-			, m_current(accounts.addresses())
-			, m_removed(accounts.removedAddresses())
-			, m_accountHistories(accounts.accountHistories())
+			, m_original(accounts)
 			, m_height(Height(1))
 	{}
 
@@ -185,16 +451,45 @@ namespace catapult { namespace cache {
 		return m_height;
 	}
 
-	const model::AddressSet& HighValueAccountsUpdater::addresses() const {
-		return m_current;
+	model::AddressSet HighValueAccountsUpdater::addresses() const {
+		return MaterializeAddresses(m_original.addresses(), m_changes.AddedAddresses, m_changes.ErasedAddresses);
 	}
 
-	const model::AddressSet& HighValueAccountsUpdater::removedAddresses() const {
-		return m_removed;
+	model::AddressSet HighValueAccountsUpdater::removedAddresses() const {
+		return MaterializeAddresses(m_original.removedAddresses(), m_changes.AddedRemovedAddresses, m_changes.ErasedRemovedAddresses);
 	}
 
-	const AddressAccountHistoryMap& HighValueAccountsUpdater::accountHistories() const {
-		return m_accountHistories;
+	size_t HighValueAccountsUpdater::numAddresses() const {
+		return CountAddresses(m_original.addresses(), m_changes.AddedAddresses, m_changes.ErasedAddresses);
+	}
+
+	size_t HighValueAccountsUpdater::numRemovedAddresses() const {
+		return CountAddresses(m_original.removedAddresses(), m_changes.AddedRemovedAddresses, m_changes.ErasedRemovedAddresses);
+	}
+
+	void HighValueAccountsUpdater::forEachAddress(const consumer<const Address&>& consumer) const {
+		ForEachAddress(m_original.addresses(), m_changes.AddedAddresses, m_changes.ErasedAddresses, consumer);
+	}
+
+	void HighValueAccountsUpdater::forEachRemovedAddress(const consumer<const Address&>& consumer) const {
+		ForEachAddress(m_original.removedAddresses(), m_changes.AddedRemovedAddresses, m_changes.ErasedRemovedAddresses, consumer);
+	}
+
+	AddressAccountHistoryMap HighValueAccountsUpdater::accountHistories() const {
+		AddressAccountHistoryMap accountHistories;
+		for (const auto& accountHistoryPair : m_original.accountHistories()) {
+			if (!Contains(m_changes.ErasedAccountHistories, accountHistoryPair.first))
+				accountHistories.insert(accountHistoryPair);
+		}
+
+		for (const auto& accountHistoryPair : m_changes.ModifiedAccountHistories)
+			accountHistories.insert_or_assign(accountHistoryPair.first, accountHistoryPair.second);
+
+		return accountHistories;
+	}
+
+	const HighValueAccountsChanges& HighValueAccountsUpdater::changes() const {
+		return m_changes;
 	}
 
 	void HighValueAccountsUpdater::setHeight(Height height) {
@@ -202,7 +497,22 @@ namespace catapult { namespace cache {
 	}
 
 	void HighValueAccountsUpdater::setRemovedAddresses(model::AddressSet&& removedAddresses) {
-		m_removed = std::move(removedAddresses);
+		auto isRemoved = [&removedAddresses](const auto& address) {
+			return Contains(removedAddresses, address);
+		};
+
+		AddressSetOverlay overlay(m_original.removedAddresses(), m_changes.AddedRemovedAddresses, m_changes.ErasedRemovedAddresses);
+		for (const auto& address : m_original.removedAddresses()) {
+			if (!isRemoved(address))
+				overlay.erase(address);
+		}
+
+		utils::map_erase_if(m_changes.AddedRemovedAddresses, [isRemoved](const auto& address) {
+			return !isRemoved(address);
+		});
+
+		for (const auto& address : removedAddresses)
+			overlay.insert(address);
 	}
 
 	void HighValueAccountsUpdater::update(const deltaset::DeltaElements<MemorySetType>& deltas) {
@@ -211,20 +521,40 @@ namespace catapult { namespace cache {
 	}
 
 	void HighValueAccountsUpdater::prune(Height height) {
-		utils::map_erase_if(m_accountHistories, [height, minBalance = m_options.MinVoterBalance](auto& pair) {
-			pair.second.pruneLess(height);
-			return !pair.second.anyAtLeast(minBalance);
-		});
-	}
-
-	HighValueAccounts HighValueAccountsUpdater::detachAccounts() {
-		auto accounts = HighValueAccounts(std::move(m_current), std::move(m_removed), std::move(m_accountHistories));
+		// all journal entries less than height are dropped by prune, so histories are only visited once per prune height
+		AccountHistoryJournalOverlay journal(m_original.accountHistoryJournal(), m_changes);
+		if (!journal.hasAnyLess(height))
+			return;
+
+		// copy all retained original account histories so that they can be pruned
+		AccountHistoriesOverlay accountHistories(
+				m_original.accountHistories(),
+				m_changes.ModifiedAccountHistories,
+				m_changes.ErasedAccountHistories);
+		for (const auto& accountHistoryPair : m_original.accountHistories())
+			accountHistories.tryGet(accountHistoryPair.first);
+
+		journal.pruneLess(height);
+
+		model::AddressSet prunedAddresses;
+		for (auto& accountHistoryPair : m_changes.ModifiedAccountHistories) {
+			accountHistoryPair.second.pruneLess(height);
+
+			// pruneLess can move the last value less than height to height
+			if (accountHistoryPair.second.anyAtLeast(m_options.MinVoterBalance))
+				journal.add(height, accountHistoryPair.first);
+			else
+				prunedAddresses.insert(accountHistoryPair.first);
+		}
 
-		m_current.clear();
-		m_removed.clear();
-		m_accountHistories.clear();
+		for (const auto& address : prunedAddresses)
+			accountHistories.erase(address);
+	}
 
-		return accounts;
+	HighValueAccountsChanges HighValueAccountsUpdater::detachChanges() {
+		auto changes = std::move(m_changes);
+		m_changes = HighValueAccountsChanges();
+		return changes;
 	}
 
 	namespace {
@@ -245,7 +575,11 @@ namespace catapult { namespace cache {
 			};
 		};
 
-		HighValueAddressesUpdater updater(m_original, m_current, m_removed);
+		const auto& originalRemovedAddresses = m_original.removedAddresses();
+		AddressSetOverlay currentAddresses(m_original.addresses(), m_changes.AddedAddresses, m_changes.ErasedAddresses);
+		AddressSetOverlay removedAddresses(originalRemovedAddresses, m_changes.AddedRemovedAddresses, m_changes.ErasedRemovedAddresses);
+
+		HighValueAddressesUpdater updater(m_original.addresses(), currentAddresses, removedAddresses);
 		updater.update(deltas.Added, hasHighValue);
 		updater.update(deltas.Copied, hasHighValue);
 		updater.update(deltas.Removed, [](const auto&) { return HighValueAccountDescriptor{ false, false }; });
@@ -262,7 +596,13 @@ namespace catapult { namespace cache {
 			return std::make_pair(Amount(), false);
 		};
 
-		HighValueBalancesUpdater updater(m_accountHistories, m_height);
+		AccountHistoriesOverlay accountHistories(
+				m_original.accountHistories(),
+				m_changes.ModifiedAccountHistories,
+				m_changes.ErasedAccountHistories);
+		AccountHistoryJournalOverlay journal(m_original.accountHistoryJournal(), m_changes);
+
+		HighValueBalancesUpdater updater(accountHistories, journal, m_height);
 		updater.pruneGreater();
 		updater.update(deltas.Added, effectiveBalanceCalculator);
 		updater.update(deltas.Copied, effectiveBalanceCalculator);
@@ -23,12 +23,53 @@
 #include "AccountStateCacheTypes.h"
 #include "catapult/model/ContainerTypes.h"
 #include "catapult/state/AccountHistory.h"
+#include "catapult/functions.h"
+#include <map>
 
 namespace catapult { namespace cache {
 
 	/// Map of addresses to account histories.
 	using AddressAccountHistoryMap = std::unordered_map<Address, state::AccountHistory, utils::ArrayHasher<Address>>;
 
+	/// Map of heights to addresses of account histories that were updated at each height.
+	using HeightAddressesMap = std::map<Height, model::AddressSet>;
+
+	/// Changes to a high value accounts container.
+	/// \note All changes are relative to the container against which they were collected.
+	struct HighValueAccountsChanges {
+	public:
+		/// Creates empty changes.
+		HighValueAccountsChanges();
+
+	public:
+		/// High value (harvester eligible) addresses that were added.
+		model::AddressSet AddedAddresses;
+
+		/// High value (harvester eligible) addresses that were erased.
+		model::AddressSet ErasedAddresses;
+
+		/// Removed high value addresses that were added.
+		model::AddressSet AddedRemovedAddresses;
+
+		/// Removed high value addresses that were erased.
+		model::AddressSet ErasedRemovedAddresses;
+
+		/// Account histories that were added or modified.
+		AddressAccountHistoryMap ModifiedAccountHistories;
+
+		/// Addresses of account histories that were erased.
+		model::AddressSet ErasedAccountHistories;
+
+		/// Account history journal entries that were added.
+		HeightAddressesMap AddedJournalEntries;
+
+		/// Minimum height of retained account history journal entries.
+		Height MinJournalHeight;
+
+		/// Maximum height of retained account history journal entries.
+		Height MaxJournalHeight;
+	};
+
 	/// High value accounts container.
 	class HighValueAccounts {
 	public:
@@ -58,10 +99,19 @@ namespace catapult { namespace cache {
 		/// Gets the high value (voter eligible) account histories.
 		const AddressAccountHistoryMap& accountHistories() const;
 
+		/// Gets the account history journal (addresses of account histories updated at each height).
+		/// \note This is required for rollbacks that do not need to visit all account histories.
+		const HeightAddressesMap& accountHistoryJournal() const;
+
+	public:
+		/// Applies \a changes to this container in place.
+		void apply(HighValueAccountsChanges&& changes);
+
 	private:
 		model::AddressSet m_addresses;
 		model::AddressSet m_removedAddresses;
 		AddressAccountHistoryMap m_accountHistories;
+		HeightAddressesMap m_accountHistoryJournal;
 	};
 
 	/// High value accounts updater.
@@ -78,14 +128,31 @@ namespace catapult { namespace cache {
 		Height height() const;
 
 		/// Gets the (current) high value (harvester eligible) addresses.
-		const model::AddressSet& addresses() const;
+		/// \note The returned set is materialized from the original container and all pending changes.
+		model::AddressSet addresses() const;
 
 		/// Gets the (removed) high value (harvester eligible) addresses that were once high value but no longer.
 		/// \note This is required for deterministic rollback.
-		const model::AddressSet& removedAddresses() const;
+		model::AddressSet removedAddresses() const;
+
+		/// Gets the number of (current) high value (harvester eligible) addresses.
+		size_t numAddresses() const;
+
+		/// Gets the number of (removed) high value (harvester eligible) addresses.
+		size_t numRemovedAddresses() const;
+
+		/// Calls \a consumer with each (current) high value (harvester eligible) address without materializing them.
+		void forEachAddress(const consumer<const Address&>& consumer) const;
+
+		/// Calls \a consumer with each (removed) high value (harvester eligible) address without materializing them.
+		void forEachRemovedAddress(const consumer<const Address&>& consumer) const;
 
 		/// Gets the high value (voter eligible) account histories.
-		const AddressAccountHistoryMap& accountHistories() const;
+		/// \note The returned map is materialized from the original container and all pending changes.
+		AddressAccountHistoryMap accountHistories() const;
+
+		/// Gets the pending changes relative to the original container.
+		const HighValueAccountsChanges& changes() const;
 
 	public:
 		/// Sets the \a height of the update operation.
@@ -101,8 +168,9 @@ namespace catapult { namespace cache {
 		void prune(Height height);
 
 	public:
-		/// Detaches the underlying data associated with this updater and converts it to a high value accounts container.
-		HighValueAccounts detachAccounts();
+		/// Detaches all pending changes associated with this updater.
+		/// \note Afterwards, this updater reflects the original container until the detached changes are applied to it.
+		HighValueAccountsChanges detachChanges();
 
 	private:
 		void updateHarvestingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
@@ -110,10 +178,8 @@ namespace catapult { namespace cache {
 
 	private:
 		AccountStateCacheTypes::Options m_options;
-		const model::AddressSet& m_original;
-		model::AddressSet m_current;
-		model::AddressSet m_removed;
-		AddressAccountHistoryMap m_accountHistories;
+		const HighValueAccounts& m_original;
+		HighValueAccountsChanges m_changes;
 		Height m_height;
 	};
 }}
@@ -21,15 +21,16 @@
 
 #include "ImportanceView.h"
 #include "AccountStateCache.h"
+#include "AccountStateSnapshot.h"
 #include "catapult/model/Address.h"
 
 namespace catapult { namespace cache {
 
 	namespace {
-		template<typename TAction>
+		template<typename TCache, typename TAction>
 		bool ForwardIfAccountHasImportanceAtHeight(
 				const state::AccountState& accountState,
-				const ReadOnlyAccountStateCache& cache,
+				const TCache& cache,
 				Height height,
 				TAction action) {
 			if (state::AccountType::Remote == accountState.AccountType) {
@@ -49,9 +50,9 @@ namespace catapult { namespace cache {
 			return action(accountState);
 		}
 
-		template<typename TAction>
+		template<typename TCache, typename TAction>
 		bool FindAccountStateWithImportance(
-				const ReadOnlyAccountStateCache& cache,
+				const TCache& cache,
 				const Address& address,
 				Height height,
 				TAction action) {
@@ -62,8 +63,8 @@ namespace catapult { namespace cache {
 			return false;
 		}
 
-		template<typename TAction>
-		bool FindAccountStateWithImportance(const ReadOnlyAccountStateCache& cache, const Key& publicKey, Height height, TAction action) {
+		template<typename TCache, typename TAction>
+		bool FindAccountStateWithImportance(const TCache& cache, const Key& publicKey, Height height, TAction action) {
 			auto accountStateKeyIter = cache.find(publicKey);
 			if (accountStateKeyIter.tryGet())
 				return ForwardIfAccountHasImportanceAtHeight(accountStateKeyIter.get(), cache, height, action);
@@ -72,16 +73,46 @@ namespace catapult { namespace cache {
 			auto address = model::PublicKeyToAddress(publicKey, cache.networkIdentifier());
 			return FindAccountStateWithImportance(cache, address, height, action);
 		}
+
+		template<typename TCache>
+		bool TryGetAccountImportance(const TCache& cache, const Key& publicKey, Height height, Importance& importance) {
+			return FindAccountStateWithImportance(cache, publicKey, height, [&importance](const auto& accountState) {
+				importance = accountState.ImportanceSnapshots.current();
+				return true;
+			});
+		}
+
+		template<typename TCache>
+		bool CanHarvest(const TCache& cache, const Address& address, Height height) {
+			auto mosaicId = cache.harvestingMosaicId();
+			auto minHarvesterBalance = cache.minHarvesterBalance();
+			auto maxHarvesterBalance = cache.maxHarvesterBalance();
+			return FindAccountStateWithImportance(cache, address, height, [mosaicId, minHarvesterBalance, maxHarvesterBalance](
+					const auto& accountState) {
+				auto currentImportance = accountState.ImportanceSnapshots.current();
+				if (Importance(0) == currentImportance)
+					return false;
+
+				auto balance = accountState.Balances.get(mosaicId);
+				return minHarvesterBalance <= balance && balance <= maxHarvesterBalance;
+			});
+		}
 	}
 
-	ImportanceView::ImportanceView(const ReadOnlyAccountStateCache& cache) : m_cache(cache)
+	ImportanceView::ImportanceView(const ReadOnlyAccountStateCache& cache)
+			: m_pCache(&cache)
+			, m_pSnapshot(nullptr)
+	{}
+
+	ImportanceView::ImportanceView(const AccountStateSnapshot& snapshot)
+			: m_pCache(nullptr)
+			, m_pSnapshot(&snapshot)
 	{}
 
 	bool ImportanceView::tryGetAccountImportance(const Key& publicKey, Height height, Importance& importance) const {
-		return FindAccountStateWithImportance(m_cache, publicKey, height, [&importance](const auto& accountState) {
-			importance = accountState.ImportanceSnapshots.current();
-			return true;
-		});
+		return m_pCache
+				? TryGetAccountImportance(*m_pCache, publicKey, height, importance)
+				: TryGetAccountImportance(*m_pSnapshot, publicKey, height, importance);
 	}
 
 	Importance ImportanceView::getAccountImportanceOrDefault(const Key& publicKey, Height height) const {
@@ -90,17 +121,6 @@ namespace catapult { namespace cache {
 	}
 
 	bool ImportanceView::canHarvest(const Address& address, Height height) const {
-		auto mosaicId = m_cache.harvestingMosaicId();
-		auto minHarvesterBalance = m_cache.minHarvesterBalance();
-		auto maxHarvesterBalance = m_cache.maxHarvesterBalance();
-		return FindAccountStateWithImportance(m_cache, address, height, [mosaicId, minHarvesterBalance, maxHarvesterBalance](
-				const auto& accountState) {
-			auto currentImportance = accountState.ImportanceSnapshots.current();
-			if (Importance(0) == currentImportance)
-				return false;
-
-			auto balance = accountState.Balances.get(mosaicId);
-			return minHarvesterBalance <= balance && balance <= maxHarvesterBalance;
-		});
+		return m_pCache ? CanHarvest(*m_pCache, address, height) : CanHarvest(*m_pSnapshot, address, height);
 	}
 }}
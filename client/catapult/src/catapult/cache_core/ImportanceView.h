@@ -22,7 +22,12 @@
 #pragma once
 #include "catapult/types.h"
 
-namespace catapult { namespace cache { class ReadOnlyAccountStateCache; } }
+namespace catapult {
+	namespace cache {
+		class AccountStateSnapshot;
+		class ReadOnlyAccountStateCache;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -32,6 +37,9 @@ namespace catapult { namespace cache {
 		/// Creates a view around \a cache.
 		explicit ImportanceView(const ReadOnlyAccountStateCache& cache);
 
+		/// Creates a view around \a snapshot.
+		explicit ImportanceView(const AccountStateSnapshot& snapshot);
+
 	public:
 		/// Tries to populate \a importance with the importance for \a publicKey at \a height.
 		bool tryGetAccountImportance(const Key& publicKey, Height height, Importance& importance) const;
@@ -43,6 +51,7 @@ namespace catapult { namespace cache {
 		bool canHarvest(const Address& address, Height height) const;
 
 	private:
-		const ReadOnlyAccountStateCache& m_cache;
+		const ReadOnlyAccountStateCache* m_pCache;
+		const AccountStateSnapshot* m_pSnapshot;
 	};
 }}
@@ -37,6 +37,7 @@ namespace catapult { namespace cache {
 		TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
 				: model::TransactionInfo(transactionInfo.copy())
 				, Id(id)
+				, MaxFeeMultiplier(model::CalculateTransactionMaxFeeMultiplier(*pEntity))
 		{}
 
 	public:
@@ -46,19 +47,42 @@ namespace catapult { namespace cache {
 
 	public:
 		size_t Id;
+
+		// cached so that the index entry can be recreated on removal without recalculation
+		BlockFeeMultiplier MaxFeeMultiplier;
+	};
+
+	struct MaxFeeMultiplierIndexEntry {
+	public:
+		BlockFeeMultiplier MaxFeeMultiplier;
+		size_t Id;
+		const TransactionData* pData;
+
+	public:
+		bool operator<(const MaxFeeMultiplierIndexEntry& rhs) const {
+			return MaxFeeMultiplier != rhs.MaxFeeMultiplier ? MaxFeeMultiplier < rhs.MaxFeeMultiplier : Id < rhs.Id;
+		}
 	};
 
+	namespace {
+		MaxFeeMultiplierIndexEntry CreateIndexEntry(const TransactionData& data) {
+			return { data.MaxFeeMultiplier, data.Id, &data };
+		}
+	}
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			utils::FileSize maxResponseSize,
 			utils::FileSize cacheSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_cacheSize(cacheSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
@@ -82,6 +106,39 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEach(UtCacheIterationOrder order, const TransactionInfoConsumer& consumer) const {
+		switch (order) {
+		case UtCacheIterationOrder::Max_Fee_Multiplier_Ascending:
+			for (const auto& entry : m_maxFeeMultiplierIndex) {
+				if (!consumer(*entry.pData))
+					return;
+			}
+
+			return;
+
+		case UtCacheIterationOrder::Max_Fee_Multiplier_Descending: {
+			// walk fee multiplier groups from highest to lowest, but walk each group forward so older transactions are preferred
+			auto groupEndIter = m_maxFeeMultiplierIndex.cend();
+			while (m_maxFeeMultiplierIndex.cbegin() != groupEndIter) {
+				auto maxFeeMultiplier = std::prev(groupEndIter)->MaxFeeMultiplier;
+				auto groupBeginIter = m_maxFeeMultiplierIndex.lower_bound({ maxFeeMultiplier, 0, nullptr });
+				for (auto iter = groupBeginIter; groupEndIter != iter; ++iter) {
+					if (!consumer(*iter->pData))
+						return;
+				}
+
+				groupEndIter = groupBeginIter;
+			}
+
+			return;
+		}
+
+		default:
+			forEach(consumer);
+			return;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -134,6 +191,7 @@ namespace catapult { namespace cache {
 					utils::FileSize& cacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 					IdLookup& idLookup,
 					AccountWeights& weights,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
@@ -141,6 +199,7 @@ namespace catapult { namespace cache {
 					, m_cacheSize(cacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 					, m_idLookup(idLookup)
 					, m_weights(weights)
 					, m_writeLock(std::move(writeLock))
@@ -164,7 +223,11 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace_hint(
+						m_transactionDataContainer.cend(),
+						transactionInfo,
+						m_idSequence);
+				m_maxFeeMultiplierIndex.insert(CreateIndexEntry(*dataIter));
 
 				m_weights.increment(transactionInfo.pEntity->SignerPublicKey, transactionSize);
 
@@ -186,6 +249,7 @@ namespace catapult { namespace cache {
 				m_weights.decrement(dataIter->pEntity->SignerPublicKey, transactionSize);
 				m_cacheSize = utils::FileSize::FromBytes(m_cacheSize.bytes() - transactionSize);
 
+				m_maxFeeMultiplierIndex.erase(CreateIndexEntry(*dataIter));
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -208,6 +272,7 @@ namespace catapult { namespace cache {
 
 				m_cacheSize = utils::FileSize();
 				m_transactionDataContainer.clear();
+				m_maxFeeMultiplierIndex.clear();
 				m_idLookup.clear();
 				m_weights.reset();
 				return transactionInfosCopy;
@@ -218,6 +283,7 @@ namespace catapult { namespace cache {
 			utils::FileSize& m_cacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 			IdLookup& m_idLookup;
 			AccountWeights& m_weights;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
@@ -230,6 +296,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		cache::MaxFeeMultiplierIndex MaxFeeMultiplierIndex;
 		utils::FileSize CacheSize;
 
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
@@ -250,6 +317,7 @@ namespace catapult { namespace cache {
 				m_options.MaxResponseSize,
 				m_pImpl->CacheSize,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
 				m_pImpl->IdLookup,
 				std::move(readLock));
 	}
@@ -261,6 +329,7 @@ namespace catapult { namespace cache {
 				m_pImpl->CacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Weights,
 				std::move(writeLock)));
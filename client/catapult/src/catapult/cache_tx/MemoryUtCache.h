@@ -29,7 +29,12 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct MaxFeeMultiplierIndexEntry;
+		struct TransactionData;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -37,6 +42,22 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Internal index of transaction data ordered by max fee multiplier and then by arrival.
+	/// \note std::set is used to allow incomplete type.
+	using MaxFeeMultiplierIndex = std::set<MaxFeeMultiplierIndexEntry>;
+
+	/// Orders in which unconfirmed transactions can be iterated.
+	enum class UtCacheIterationOrder {
+		/// Oldest transactions first.
+		Arrival,
+
+		/// Transactions with lowest max fee multipliers first; older transactions first when equal.
+		Max_Fee_Multiplier_Ascending,
+
+		/// Transactions with highest max fee multipliers first; older transactions first when equal.
+		Max_Fee_Multiplier_Descending
+	};
+
 	/// Read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -46,11 +67,13 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), current cache size (\a cacheSize),
-		/// a transaction data container (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// a transaction data container (\a transactionDataContainer), a max fee multiplier index (\a maxFeeMultiplierIndex)
+		/// and an id lookup (\a idLookup) with lock context \a readLock.
 		MemoryUtCacheView(
 				utils::FileSize maxResponseSize,
 				utils::FileSize cacheSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
@@ -67,6 +90,10 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos in \a order until all are consumed or \c false is returned by consumer.
+		/// \note Iteration is an index walk, so consuming a prefix does not depend on the number of transactions in the cache.
+		void forEach(UtCacheIterationOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// \note Each short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -82,6 +109,7 @@ namespace catapult { namespace cache {
 		utils::FileSize m_maxResponseSize;
 		utils::FileSize m_cacheSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
@@ -35,12 +35,21 @@ namespace catapult { namespace cache {
 			uint32_t transactionLimit,
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo&>& filter) {
+		return GetFirstTransactionInfoPointers(utCacheView, transactionLimit, countRetriever, UtCacheIterationOrder::Arrival, filter);
+	}
+
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			UtCacheIterationOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
 		std::vector<const model::TransactionInfo*> transactionInfoPointers;
 		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
 
 		if (0 != transactionLimit) {
 			uint32_t totalTransactionsCount = 0;
-			utCacheView.forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
+			utCacheView.forEach(order, [transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
 					const auto& transactionInfo) {
 				auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
 				if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
@@ -57,39 +66,4 @@ namespace catapult { namespace cache {
 
 		return transactionInfoPointers;
 	}
-
-	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
-			const MemoryUtCacheView& utCacheView,
-			uint32_t transactionLimit,
-			const EmbeddedCountRetriever& countRetriever,
-			const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
-			const predicate<const model::TransactionInfo&>& filter) {
-		// 1. load all UTs
-		std::vector<const model::TransactionInfo*> allTransactionInfoPointers;
-		allTransactionInfoPointers.reserve(utCacheView.size());
-		utCacheView.forEach([&allTransactionInfoPointers](const auto& transactionInfo) {
-			allTransactionInfoPointers.push_back(&transactionInfo);
-			return true;
-		});
-
-		// 2. sort by predicate (use stable_sort to prefer older when otherwise equal)
-		std::sort(allTransactionInfoPointers.begin(), allTransactionInfoPointers.end(), sortComparer);
-
-		// 3. select candidates
-		uint32_t totalTransactionsCount = 0;
-		std::vector<const model::TransactionInfo*> candidateTransactionInfoPointers;
-		candidateTransactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
-		for (const auto* pTransactionInfo : allTransactionInfoPointers) {
-			auto currentTransactionsCount = countRetriever(*pTransactionInfo->pEntity);
-			if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
-				break;
-
-			if (filter(*pTransactionInfo)) {
-				totalTransactionsCount += currentTransactionsCount;
-				candidateTransactionInfoPointers.push_back(pTransactionInfo);
-			}
-		}
-
-		return candidateTransactionInfoPointers;
-	}
 }}
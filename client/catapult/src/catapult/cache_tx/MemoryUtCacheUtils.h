@@ -44,13 +44,13 @@ namespace catapult { namespace cache {
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo&>& filter);
 
-	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView that pass \a filter after sorting
-	/// by \a sortComparer where \a countRetriever returns the total number of transactions contained within a top-level transaction.
+	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView iterated in \a order that pass \a filter
+	/// where \a countRetriever returns the total number of transactions contained within a top-level transaction.
 	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t transactionLimit,
 			const EmbeddedCountRetriever& countRetriever,
-			const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
+			UtCacheIterationOrder order,
 			const predicate<const model::TransactionInfo&>& filter);
 }}
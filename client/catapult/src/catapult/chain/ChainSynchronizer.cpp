@@ -60,6 +60,11 @@ namespace catapult { namespace chain {
 				return m_numBytes;
 			}
 
+			bool canAcceptMore() {
+				utils::SpinLockGuard guard(m_spinLock);
+				return m_numBytes < m_maxSize && !m_dirty;
+			}
+
 			bool shouldStartSync() {
 				utils::SpinLockGuard guard(m_spinLock);
 				if (m_numBytes >= m_maxSize || m_hasPendingSync || m_dirty)
@@ -161,6 +166,10 @@ namespace catapult { namespace chain {
 				return m_numBlocks;
 			}
 
+			const auto& sourceIdentity() const {
+				return m_sourceIdentity;
+			}
+
 		private:
 			size_t m_numBlocks;
 			model::NodeIdentity m_sourceIdentity;
@@ -184,24 +193,63 @@ namespace catapult { namespace chain {
 			};
 		}
 
-		NodeInteractionFuture CompleteChainBlocksFrom(RangeAggregator& rangeAggregator, UnprocessedElements& unprocessedElements) {
+		ionet::NodeInteractionResultCode CompleteChainBlocks(RangeAggregator& rangeAggregator, UnprocessedElements& unprocessedElements) {
 			if (rangeAggregator.empty())
-				return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
+				return ionet::NodeInteractionResultCode::Neutral;
 
 			auto mergedRange = rangeAggregator.merge();
-			auto addResult = unprocessedElements.add(std::move(mergedRange))
+			return unprocessedElements.add(std::move(mergedRange))
 					? ionet::NodeInteractionResultCode::Success
 					: ionet::NodeInteractionResultCode::Neutral;
-			return thread::make_ready_future(std::move(addResult));
 		}
 
+		NodeInteractionFuture CompleteChainBlocksFrom(RangeAggregator& rangeAggregator, UnprocessedElements& unprocessedElements) {
+			return thread::make_ready_future(CompleteChainBlocks(rangeAggregator, unprocessedElements));
+		}
+
+		struct ChainBlocksFromOptions {
+			uint64_t ForkDepth;
+			uint32_t NumRemainingRanges;
+		};
+
 		NodeInteractionFuture ChainBlocksFrom(
 				const std::function<thread::future<model::BlockRange>(Height)>& futureSupplier,
 				Height height,
-				uint64_t forkDepth,
+				const ChainBlocksFromOptions& options,
+				const std::shared_ptr<RangeAggregator>& pRangeAggregator,
+				UnprocessedElements& unprocessedElements);
+
+		NodeInteractionFuture StreamChainBlocksFrom(
+				const std::function<thread::future<model::BlockRange>(Height)>& futureSupplier,
+				Height height,
+				uint32_t numRemainingRanges,
+				const model::NodeIdentity& sourceIdentity,
+				UnprocessedElements& unprocessedElements) {
+			// remaining ranges extend an accepted range, so each one can be forwarded without waiting for the others
+			// (this is equivalent to the chain comparison bypass in compareChains, but does not wait for the next sync attempt)
+			CATAPULT_LOG(debug) << "streaming chain synchronization at " << height;
+			auto nextFuture = ChainBlocksFrom(
+					futureSupplier,
+					height,
+					{ 0, numRemainingRanges },
+					std::make_shared<RangeAggregator>(sourceIdentity),
+					unprocessedElements);
+			return thread::compose(std::move(nextFuture), [](auto&& nodeInteractionFuture) {
+				// interaction is successful because at least one range has already been accepted
+				auto code = nodeInteractionFuture.get();
+				return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral == code
+						? ionet::NodeInteractionResultCode::Success
+						: code);
+			});
+		}
+
+		NodeInteractionFuture ChainBlocksFrom(
+				const std::function<thread::future<model::BlockRange>(Height)>& futureSupplier,
+				Height height,
+				const ChainBlocksFromOptions& options,
 				const std::shared_ptr<RangeAggregator>& pRangeAggregator,
 				UnprocessedElements& unprocessedElements) {
-			return thread::compose(futureSupplier(height), [futureSupplier, forkDepth, pRangeAggregator, &unprocessedElements](
+			return thread::compose(futureSupplier(height), [futureSupplier, options, pRangeAggregator, &unprocessedElements](
 					auto&& blocksFuture) {
 				try {
 					auto range = blocksFuture.get();
@@ -219,16 +267,28 @@ namespace catapult { namespace chain {
 							<< " blocks (heights " << range.cbegin()->Height << " - " << endHeight << ")";
 
 					pRangeAggregator->add(std::move(range));
-					if (forkDepth <= pRangeAggregator->numBlocks()) {
+					auto nextHeight = endHeight + Height(1);
+					if (options.ForkDepth <= pRangeAggregator->numBlocks()) {
 						CATAPULT_LOG(debug)
 								<< "completing chain synchronization with " << pRangeAggregator->numBlocks() << " blocks"
-								<< " (fork depth = " << forkDepth << ")";
-						return CompleteChainBlocksFrom(*pRangeAggregator, unprocessedElements);
+								<< " (fork depth = " << options.ForkDepth << ")";
+						auto code = CompleteChainBlocks(*pRangeAggregator, unprocessedElements);
+
+						// stop when the range was rejected or processing of a previous range failed
+						if (ionet::NodeInteractionResultCode::Success != code || options.NumRemainingRanges <= 1
+								|| !unprocessedElements.canAcceptMore())
+							return thread::make_ready_future(std::move(code));
+
+						return StreamChainBlocksFrom(
+								futureSupplier,
+								nextHeight,
+								options.NumRemainingRanges - 1,
+								pRangeAggregator->sourceIdentity(),
+								unprocessedElements);
 					}
 
-					auto nextHeight = endHeight + Height(1);
 					CATAPULT_LOG(debug) << "resuming chain synchronization at " << nextHeight;
-					return ChainBlocksFrom(futureSupplier, nextHeight, forkDepth, pRangeAggregator, unprocessedElements);
+					return ChainBlocksFrom(futureSupplier, nextHeight, options, pRangeAggregator, unprocessedElements);
 				} catch (const catapult_runtime_error& e) {
 					CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
 					return thread::make_ready_future(ionet::NodeInteractionResultCode::Failure);
@@ -253,6 +313,7 @@ namespace catapult { namespace chain {
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions{ config.MaxHashesPerSyncAttempt, localFinalizedHeightSupplier }
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
+					, m_maxBlockRangesPerSyncAttempt(config.MaxBlockRangesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
 							3 * config.MaxChainBytesPerSyncAttempt))
@@ -312,7 +373,7 @@ namespace catapult { namespace chain {
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
 						compareResult.CommonBlockHeight + Height(1),
-						compareResult.ForkDepth,
+						{ compareResult.ForkDepth, m_maxBlockRangesPerSyncAttempt },
 						std::make_shared<RangeAggregator>(remoteChainApi.remoteIdentity()),
 						*m_pUnprocessedElements);
 			}
@@ -321,6 +382,7 @@ namespace catapult { namespace chain {
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
+			uint32_t m_maxBlockRangesPerSyncAttempt;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
 		};
 
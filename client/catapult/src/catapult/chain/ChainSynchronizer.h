@@ -54,6 +54,12 @@ namespace catapult { namespace chain {
 		/// Maximum chain bytes per sync attempt.
 		uint32_t MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of block ranges pulled per sync attempt.
+		/// \note Ranges after the first one are forwarded to the consumer as soon as they are received.
+		///       Unprocessed ranges already let a later sync attempt skip chain comparison, but that attempt only starts
+		///       on the next synchronizer task tick; streaming pulls the remaining ranges immediately instead.
+		uint32_t MaxBlockRangesPerSyncAttempt;
+
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
 	};
@@ -23,6 +23,7 @@
 #include "EntitiesSynchronizer.h"
 #include "catapult/api/RemoteTransactionApi.h"
 #include "catapult/model/NodeIdentity.h"
+#include "catapult/utils/ShortHashIblt.h"
 
 namespace catapult { namespace chain {
 
@@ -34,11 +35,13 @@ namespace catapult { namespace chain {
 
 		public:
 			UtTraits(
+					uint32_t numTableCells,
 					BlockFeeMultiplier minFeeMultiplier,
 					const TimeSupplier& timeSupplier,
 					const ShortHashesSupplier& shortHashesSupplier,
 					const handlers::TransactionRangeHandler& transactionRangeConsumer)
-					: m_minFeeMultiplier(minFeeMultiplier)
+					: m_numTableCells(numTableCells)
+					, m_minFeeMultiplier(minFeeMultiplier)
 					, m_timeSupplier(timeSupplier)
 					, m_shortHashesSupplier(shortHashesSupplier)
 					, m_transactionRangeConsumer(transactionRangeConsumer)
@@ -46,7 +49,25 @@ namespace catapult { namespace chain {
 
 		public:
 			thread::future<model::TransactionRange> apiCall(const RemoteApiType& api) const {
-				return api.unconfirmedTransactions(m_timeSupplier(), m_minFeeMultiplier, m_shortHashesSupplier());
+				if (0 == m_numTableCells)
+					return api.unconfirmedTransactions(m_timeSupplier(), m_minFeeMultiplier, m_shortHashesSupplier());
+
+				auto minDeadline = m_timeSupplier();
+				auto pShortHashes = std::make_shared<model::ShortHashRange>(m_shortHashesSupplier());
+				utils::ShortHashIblt knownShortHashesTable(m_numTableCells);
+				for (const auto& shortHash : *pShortHashes)
+					knownShortHashesTable.insert(shortHash);
+
+				auto reconcileFuture = api.reconcileTransactions(minDeadline, m_minFeeMultiplier, knownShortHashesTable);
+				return thread::compose(std::move(reconcileFuture), [&api, minDeadline, minFeeMultiplier = m_minFeeMultiplier, pShortHashes](
+						auto&& completedReconcileFuture) {
+					auto reconciledTransactions = completedReconcileFuture.get();
+					if (reconciledTransactions.IsDecoded)
+						return thread::make_ready_future(std::move(reconciledTransactions.Transactions));
+
+					CATAPULT_LOG(debug) << "remote could not reconcile short hashes, falling back to pulling with all short hashes";
+					return api.unconfirmedTransactions(minDeadline, minFeeMultiplier, std::move(*pShortHashes));
+				});
 			}
 
 			void consume(model::TransactionRange&& range, const model::NodeIdentity& sourceIdentity) const {
@@ -54,6 +75,7 @@ namespace catapult { namespace chain {
 			}
 
 		private:
+			uint32_t m_numTableCells;
 			BlockFeeMultiplier m_minFeeMultiplier;
 			TimeSupplier m_timeSupplier;
 			ShortHashesSupplier m_shortHashesSupplier;
@@ -67,7 +89,23 @@ namespace catapult { namespace chain {
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer,
 			const predicate<>& shouldExecute) {
-		auto traits = UtTraits(minFeeMultiplier, timeSupplier, shortHashesSupplier, transactionRangeConsumer);
+		return CreateUtReconciliationSynchronizer(
+				0,
+				minFeeMultiplier,
+				timeSupplier,
+				shortHashesSupplier,
+				transactionRangeConsumer,
+				shouldExecute);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtReconciliationSynchronizer(
+			uint32_t numTableCells,
+			BlockFeeMultiplier minFeeMultiplier,
+			const TimeSupplier& timeSupplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer,
+			const predicate<>& shouldExecute) {
+		auto traits = UtTraits(numTableCells, minFeeMultiplier, timeSupplier, shortHashesSupplier, transactionRangeConsumer);
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
 		return CreateConditionalRemoteNodeSynchronizer(pSynchronizer, shouldExecute);
 	}
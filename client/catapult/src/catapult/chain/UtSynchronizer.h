@@ -42,4 +42,18 @@ namespace catapult { namespace chain {
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer,
 			const predicate<>& shouldExecute);
+
+	/// Creates an unconfirmed transactions synchronizer around the specified time supplier (\a timeSupplier),
+	/// short hashes supplier (\a shortHashesSupplier) and transaction range consumer (\a transactionRangeConsumer)
+	/// for transactions with fee multipliers at least \a minFeeMultiplier that sends short hash tables with \a numTableCells cells
+	/// instead of all short hashes.
+	/// \note Remote operation is only initiated when \a shouldExecute returns \c true.
+	/// \note All short hashes are sent when \a numTableCells is zero or the remote is unable to decode the set difference.
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtReconciliationSynchronizer(
+			uint32_t numTableCells,
+			BlockFeeMultiplier minFeeMultiplier,
+			const TimeSupplier& timeSupplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer,
+			const predicate<>& shouldExecute);
 }}
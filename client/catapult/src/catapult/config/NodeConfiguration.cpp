@@ -41,10 +41,18 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(EnableAddressReuse);
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
+		LOAD_NODE_PROPERTY(EnablePerWorkerIoContexts);
+		LOAD_NODE_PROPERTY(EnableWorkerThreadPinning);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(EnableCacheSnapshots);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(EnableStorageCompression);
+		LOAD_NODE_PROPERTY(StorageCompressionLevel);
+		LOAD_NODE_PROPERTY(EnableSpoolSegmentFiles);
+		LOAD_NODE_PROPERTY(SpoolPollInterval);
+		LOAD_NODE_PROPERTY(MaxSpoolBlockChangeBatchSize);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -52,6 +60,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(MaxHashesPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxBlockRangesPerSyncAttempt);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -63,6 +72,8 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(TransactionSelectionStrategy);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(EnableUnconfirmedTransactionsReconciliation);
+		LOAD_NODE_PROPERTY(UnconfirmedTransactionsReconciliationTableSize);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -152,7 +163,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 9 + 4 + 4 + 5 + 9);
+		utils::VerifyBagSizeExact(bag, 51 + 9 + 4 + 4 + 5 + 9);
 		return config;
 	}
 
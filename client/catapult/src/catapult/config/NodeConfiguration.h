@@ -46,9 +46,19 @@ namespace catapult { namespace config {
 		/// \c true if a single thread pool should be used, \c false if multiple thread pools should be used.
 		bool EnableSingleThreadPool;
 
+		/// \c true if each worker of the primary thread pool should run its own io context.
+		bool EnablePerWorkerIoContexts;
+
+		/// \c true if the workers of the primary thread pool should be pinned to cpus.
+		bool EnableWorkerThreadPinning;
+
 		/// \c true if cache data should be saved in a database.
 		bool EnableCacheDatabaseStorage;
 
+		/// \c true if caches that support snapshots should publish them on commit so that they can be read without locking.
+		/// \note This is ignored when cache data is saved in a database.
+		bool EnableCacheSnapshots;
+
 		/// \c true if temporary sync files should be automatically cleaned up.
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
@@ -57,6 +67,21 @@ namespace catapult { namespace config {
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// \c true if block and statement payloads should be compressed when stored.
+		bool EnableStorageCompression;
+
+		/// Compression level used when storage compression is enabled.
+		uint32_t StorageCompressionLevel;
+
+		/// \c true if spooled messages should be appended to shared segment files instead of being written to one file each.
+		bool EnableSpoolSegmentFiles;
+
+		/// Time between polls of the spool queues by the broker process.
+		utils::TimeSpan SpoolPollInterval;
+
+		/// Maximum number of block change messages delivered by the broker process between subscriber flushes.
+		uint32_t MaxSpoolBlockChangeBatchSize;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -72,6 +97,10 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of block ranges pulled per sync attempt.
+		/// \note When greater than one, ranges are forwarded for processing while subsequent ranges are being pulled.
+		uint32_t MaxBlockRangesPerSyncAttempt;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -100,6 +129,15 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		utils::FileSize UnconfirmedTransactionsCacheMaxSize;
 
+		/// \c true if unconfirmed transactions should be pulled by reconciling short hash tables instead of sending all short hashes.
+		/// \note Peers must support reconcile transactions requests, which are only served when this is enabled.
+		bool EnableUnconfirmedTransactionsReconciliation;
+
+		/// Number of cells in short hash tables sent when reconciling unconfirmed transactions.
+		/// \note Larger tables requested by peers are rejected.
+		/// \note This should be at least one and a half times the expected set difference between peers.
+		uint32_t UnconfirmedTransactionsReconciliationTableSize;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -206,9 +206,9 @@ namespace catapult { namespace crypto {
 
 		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
 			bool aggregateResult = true;
-			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
-				aggregateResult &= valid[offset + i];
+			for (auto i = offset; i < offset + count; ++i) {
+				valid[i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				aggregateResult &= valid[i];
 			}
 
 			return aggregateResult;
@@ -38,26 +38,36 @@ namespace catapult { namespace crypto {
 	}
 
 	bool AggregateBmPrivateKeyTree::canSign(const BmKeyIdentifier& keyIdentifier) {
+		// retry when no tree is available because the factory might be able to load a tree that was not available before
+		if (!m_pTree)
+			m_pTree = loadNextTree();
+
 		while (m_pTree && m_pTree->options().EndKeyIdentifier < keyIdentifier) {
-			auto oldEndKeyIdentifier = m_pTree->options().EndKeyIdentifier;
-			m_pTree->wipe(oldEndKeyIdentifier);
-			m_pTree = m_factory();
-			if (!m_pTree)
-				break;
-
-			auto newStartKeyIdentifier = m_pTree->options().StartKeyIdentifier;
-			if (oldEndKeyIdentifier >= newStartKeyIdentifier) {
-				std::ostringstream out;
-				out
-						<< "PrivateKeyTreeFactory returned overlapping tree, previous end " << oldEndKeyIdentifier
-						<< ", new start " << newStartKeyIdentifier;
-				CATAPULT_THROW_RUNTIME_ERROR(out.str().c_str());
-			}
+			m_previousEndKeyIdentifier = m_pTree->options().EndKeyIdentifier;
+			m_pTree->wipe(*m_previousEndKeyIdentifier);
+			m_pTree = loadNextTree();
 		}
 
 		return m_pTree && m_pTree->canSign(keyIdentifier);
 	}
 
+	std::unique_ptr<BmPrivateKeyTree> AggregateBmPrivateKeyTree::loadNextTree() {
+		auto pTree = m_factory();
+		if (!pTree || !m_previousEndKeyIdentifier)
+			return pTree;
+
+		auto newStartKeyIdentifier = pTree->options().StartKeyIdentifier;
+		if (*m_previousEndKeyIdentifier >= newStartKeyIdentifier) {
+			std::ostringstream out;
+			out
+					<< "PrivateKeyTreeFactory returned overlapping tree, previous end " << *m_previousEndKeyIdentifier
+					<< ", new start " << newStartKeyIdentifier;
+			CATAPULT_THROW_RUNTIME_ERROR(out.str().c_str());
+		}
+
+		return pTree;
+	}
+
 	namespace {
 		BmKeyIdentifier Decrease(const BmKeyIdentifier& keyIdentifier) {
 			return { keyIdentifier.KeyId - 1 };
@@ -391,5 +391,41 @@ namespace catapult { namespace crypto {
 		return true;
 	}
 
+	std::vector<bool> VerifyMulti(const RandomFiller& randomFiller, const BmTreeSignatureInput* pSignatureInputs, size_t count) {
+		// each tree signature is composed of a root and a bottom ed25519 signature, so all of them can be batch verified together
+		// note: storage is reserved upfront because signature inputs reference keys, signatures and boundaries
+		std::vector<Key> publicKeys;
+		std::vector<Signature> signatures;
+		std::vector<uint64_t> boundaries;
+		std::vector<SignatureInput> signatureInputs;
+		publicKeys.reserve(2 * count);
+		signatures.reserve(2 * count);
+		boundaries.reserve(count);
+		signatureInputs.reserve(2 * count);
+
+		auto addSignatureInput = [&publicKeys, &signatures, &signatureInputs](const auto& pair, std::vector<RawBuffer>&& buffers) {
+			publicKeys.push_back(pair.ParentPublicKey.template copyTo<Key>());
+			signatures.push_back(pair.Signature.template copyTo<Signature>());
+			signatureInputs.push_back({ publicKeys.back(), std::move(buffers), signatures.back() });
+		};
+
+		for (auto i = 0u; i < count; ++i) {
+			const auto& signatureInput = pSignatureInputs[i];
+			const auto& signature = signatureInput.Signature;
+			boundaries.push_back(signatureInput.KeyIdentifier.KeyId);
+
+			addSignatureInput(signature.Root, { signature.Bottom.ParentPublicKey, ToBuffer(boundaries.back()) });
+			addSignatureInput(signature.Bottom, { signatureInput.Buffer });
+		}
+
+		auto signatureResults = VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size()).first;
+
+		std::vector<bool> results(count);
+		for (auto i = 0u; i < count; ++i)
+			results[i] = signatureResults[2 * i] && signatureResults[2 * i + 1];
+
+		return results;
+	}
+
 	// endregion
 }}
@@ -23,6 +23,7 @@
 #include "BmOptions.h"
 #include "BmTreeSignature.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/io/SeekableStream.h"
 #include <memory>
 
@@ -88,4 +89,21 @@ namespace catapult { namespace crypto {
 
 	/// Verifies \a signature of \a buffer at \a keyIdentifier.
 	bool Verify(const BmTreeSignature& signature, const BmKeyIdentifier& keyIdentifier, const RawBuffer& buffer);
+
+	/// Tree signature input.
+	struct BmTreeSignatureInput {
+		/// Tree signature.
+		const BmTreeSignature& Signature;
+
+		/// Key identifier.
+		BmKeyIdentifier KeyIdentifier;
+
+		/// Signed buffer.
+		RawBuffer Buffer;
+	};
+
+	/// Verifies all \a count tree signatures pointed to by \a pSignatureInputs using batch verification.
+	/// \a randomFiller is used to generate random bytes.
+	/// Returns a vector of bools that indicates the verification result for each individual tree signature.
+	std::vector<bool> VerifyMulti(const RandomFiller& randomFiller, const BmTreeSignatureInput* pSignatureInputs, size_t count);
 }}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BmPrivateKeyTreePrefetcher.h"
+#include "catapult/utils/Logging.h"
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		size_t CountKeys(const BmOptions& options) {
+			return static_cast<size_t>(options.EndKeyIdentifier.KeyId - options.StartKeyIdentifier.KeyId + 1);
+		}
+	}
+
+	BmPrivateKeyTreePrefetcher::BmPrivateKeyTreePrefetcher(const PrivateKeyTreeFactory& factory)
+			: m_factory(factory)
+			, m_numReadyKeys(0)
+	{}
+
+	size_t BmPrivateKeyTreePrefetcher::numReadyKeys() const {
+		return m_numReadyKeys;
+	}
+
+	bool BmPrivateKeyTreePrefetcher::prefetch() {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		loadIfEmpty();
+		return !!m_pNextTree;
+	}
+
+	std::unique_ptr<BmPrivateKeyTree> BmPrivateKeyTreePrefetcher::next() {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		loadIfEmpty();
+
+		m_numReadyKeys = 0;
+		return std::move(m_pNextTree);
+	}
+
+	void BmPrivateKeyTreePrefetcher::loadIfEmpty() {
+		// factory is only called while the lock is held, so a tree is never loaded twice
+		if (m_pNextTree)
+			return;
+
+		m_pNextTree = m_factory();
+		if (!m_pNextTree)
+			return;
+
+		m_numReadyKeys = CountKeys(m_pNextTree->options());
+		CATAPULT_LOG(debug) << "prefetched voting private key tree with " << m_numReadyKeys << " keys";
+	}
+}}
@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BmPrivateKeyTree.h"
+#include "catapult/functions.h"
+#include <atomic>
+#include <mutex>
+
+namespace catapult { namespace crypto {
+
+	/// Prefetches Bellare-Miner private key trees so that loading a tree and deriving its keys
+	/// does not need to happen when the first key of the tree is used for signing.
+	class BmPrivateKeyTreePrefetcher {
+	private:
+		using PrivateKeyTreeFactory = supplier<std::unique_ptr<BmPrivateKeyTree>>;
+
+	public:
+		/// Creates a prefetcher around \a factory.
+		explicit BmPrivateKeyTreePrefetcher(const PrivateKeyTreeFactory& factory);
+
+	public:
+		/// Gets the number of keys in the prefetched tree that are ready for signing.
+		size_t numReadyKeys() const;
+
+	public:
+		/// Prefetches the next tree if it has not already been prefetched.
+		/// Returns \c true if a prefetched tree is available.
+		bool prefetch();
+
+		/// Gets the next tree, loading it on demand if it has not already been prefetched.
+		std::unique_ptr<BmPrivateKeyTree> next();
+
+	private:
+		void loadIfEmpty();
+
+	private:
+		PrivateKeyTreeFactory m_factory;
+		std::unique_ptr<BmPrivateKeyTree> m_pNextTree;
+		std::atomic<size_t> m_numReadyKeys;
+		std::mutex m_mutex;
+	};
+}}
@@ -27,4 +27,8 @@ namespace catapult { namespace extensions {
 	cache::MemoryCacheOptions GetUtCacheOptions(const config::NodeConfiguration& config) {
 		return cache::MemoryCacheOptions(config.UnconfirmedTransactionsCacheMaxResponseSize, config.UnconfirmedTransactionsCacheMaxSize);
 	}
+
+	io::FileQueueStorageMode GetSpoolStorageMode(const config::NodeConfiguration& config) {
+		return config.EnableSpoolSegmentFiles ? io::FileQueueStorageMode::Segment_Files : io::FileQueueStorageMode::Message_Files;
+	}
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/io/FileQueue.h"
 
 namespace catapult { namespace config { struct NodeConfiguration; } }
 
@@ -28,4 +29,7 @@ namespace catapult { namespace extensions {
 
 	/// Extracts unconfirmed transactions cache options from \a config.
 	cache::MemoryCacheOptions GetUtCacheOptions(const config::NodeConfiguration& config);
+
+	/// Extracts the storage mode of spool file queues from \a config.
+	io::FileQueueStorageMode GetSpoolStorageMode(const config::NodeConfiguration& config);
 }}
@@ -62,6 +62,16 @@ namespace catapult { namespace extensions {
 			, RequiredRole(requiredRole)
 			, Config(config)
 			, ImportanceRetriever([totalChainImportance, &cache](const auto& publicKey) {
+				// prefer snapshot when available because it can be read without waiting for an in progress commit
+				auto pSnapshot = cache.sub<cache::AccountStateCache>().snapshot();
+				if (pSnapshot) {
+					cache::ImportanceView importanceView(*pSnapshot);
+					return ImportanceDescriptor{
+						importanceView.getAccountImportanceOrDefault(publicKey, pSnapshot->height()),
+						totalChainImportance
+					};
+				}
+
 				auto cacheView = cache.createView();
 				const auto& accountStateCache = cacheView.sub<cache::AccountStateCache>();
 				cache::ReadOnlyAccountStateCache readOnlyAccountStateCache(accountStateCache);
@@ -35,6 +35,18 @@ namespace catapult { namespace extensions {
 	}
 #endif
 
+	namespace {
+		thread::IoThreadPoolOptions CreatePrimaryPoolOptions(const config::NodeConfiguration& config) {
+			// when a single thread pool is used, parallel work is posted to the primary pool, so its io context must be shared
+			auto isPerWorker = config.EnablePerWorkerIoContexts && !config.EnableSingleThreadPool;
+
+			thread::IoThreadPoolOptions options;
+			options.Mode = isPerWorker ? thread::IoThreadPoolMode::Per_Worker : thread::IoThreadPoolMode::Shared;
+			options.PinWorkerThreads = config.EnableWorkerThreadPinning;
+			return options;
+		}
+	}
+
 	ProcessBootstrapper::ProcessBootstrapper(
 			const config::CatapultConfiguration& config,
 			const std::string& resourcesPath,
@@ -46,6 +58,7 @@ namespace catapult { namespace extensions {
 			, m_pMultiServicePool(std::make_unique<thread::MultiServicePool>(
 					servicePoolName,
 					thread::MultiServicePool::DefaultPoolConcurrency(),
+					CreatePrimaryPoolOptions(m_config.Node),
 					m_config.Node.EnableSingleThreadPool
 							? thread::MultiServicePool::IsolatedPoolMode::Disabled
 							: thread::MultiServicePool::IsolatedPoolMode::Enabled))
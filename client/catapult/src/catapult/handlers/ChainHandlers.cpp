@@ -140,18 +140,8 @@ namespace catapult { namespace handlers {
 				auto numBlocks = ClampNumBlocks(info, config);
 				auto numResponseBytes = ClampNumResponseBytes(info, config);
 
-				uint32_t payloadSize = 0;
-				std::vector<std::shared_ptr<const model::Block>> blocks;
-				for (auto i = 0u; i < numBlocks; ++i) {
-					// always return at least one block
-					auto pBlock = storageView.loadBlock(info.pRequest->Height + Height(i));
-					if (!blocks.empty() && payloadSize + pBlock->Size > numResponseBytes)
-						break;
-
-					payloadSize += pBlock->Size;
-					blocks.push_back(std::move(pBlock));
-				}
-
+				// always return at least one block
+				auto blocks = storageView.loadBlockRange(info.pRequest->Height, numBlocks, numResponseBytes);
 				auto payload = ionet::PacketPayloadFactory::FromEntities(RequestType::Packet_Type, blocks);
 				context.response(std::move(payload));
 			};
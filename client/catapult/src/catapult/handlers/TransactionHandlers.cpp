@@ -21,6 +21,10 @@
 
 #include "TransactionHandlers.h"
 #include "HandlerUtils.h"
+#include "catapult/api/TransactionPackets.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/utils/ShortHashIblt.h"
+#include <algorithm>
 
 namespace catapult { namespace handlers {
 
@@ -52,4 +56,77 @@ namespace catapult { namespace handlers {
 			return utRetriever(filter.Deadline, filter.FeeMultiplier, shortHashes);
 		}));
 	}
+
+	namespace {
+		struct ParsedReconcileRequest {
+		public:
+			using FilterType = TransactionsFilter;
+			using HashType = utils::ShortHashIblt::Cell;
+
+		public:
+			bool IsValid = false;
+			TransactionsFilter FilterValue;
+			std::vector<utils::ShortHashIblt::Cell> Cells;
+
+		public:
+			static void SetAll(ParsedReconcileRequest& request, const utils::ShortHashIblt::Cell* pCell, size_t count) {
+				request.Cells.assign(pCell, pCell + count);
+			}
+		};
+
+		ionet::PacketPayload CreateReconcileResponse(
+				api::ReconcileTransactionsStatus status,
+				const UnconfirmedTransactions& transactions) {
+			ionet::PacketPayloadBuilder builder(ionet::PacketType::Reconcile_Transactions);
+			builder.appendValue(status);
+			builder.appendEntities(transactions);
+			return builder.build();
+		}
+	}
+
+	void RegisterReconcileTransactionsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			uint32_t maxNumCells,
+			const UtShortHashesSupplier& utShortHashesSupplier,
+			const UtRetriever& utRetriever) {
+		// local table is as large as requested table, so bound it by the (rounded up) configured table size
+		constexpr auto Num_Hashes = utils::ShortHashIblt::Num_Hashes;
+		auto maxTableSize = std::max<size_t>(1, (maxNumCells + Num_Hashes - 1) / Num_Hashes) * Num_Hashes;
+		handlers.registerHandler(ionet::PacketType::Reconcile_Transactions, [maxTableSize, utShortHashesSupplier, utRetriever](
+				const auto& packet,
+				auto& context) {
+			auto request = detail::ParsePullRequest<ParsedReconcileRequest>(packet);
+			if (!request.IsValid || request.Cells.empty() || 0 != request.Cells.size() % Num_Hashes)
+				return;
+
+			if (request.Cells.size() > maxTableSize) {
+				CATAPULT_LOG(warning) << "rejecting short hash table with " << request.Cells.size() << " cells for " << packet;
+				return;
+			}
+
+			auto localShortHashes = utShortHashesSupplier();
+			utils::ShortHashIblt iblt(request.Cells.size());
+			for (const auto& shortHash : localShortHashes)
+				iblt.insert(shortHash);
+
+			iblt.subtract(utils::ShortHashIblt(request.Cells.data(), request.Cells.size()));
+			auto decodeResult = iblt.decode();
+			if (!decodeResult.IsDecoded) {
+				CATAPULT_LOG(debug) << "unable to decode short hash set difference for " << packet;
+				context.response(CreateReconcileResponse(api::ReconcileTransactionsStatus::Decode_Failure, {}));
+				return;
+			}
+
+			// short hashes only known locally are the only ones the remote is missing
+			utils::ShortHashesSet knownShortHashes;
+			knownShortHashes.reserve(localShortHashes.size());
+			for (const auto& shortHash : localShortHashes) {
+				if (decodeResult.Positive.cend() == decodeResult.Positive.find(shortHash))
+					knownShortHashes.insert(shortHash);
+			}
+
+			auto transactions = utRetriever(request.FilterValue.Deadline, request.FilterValue.FeeMultiplier, knownShortHashes);
+			context.response(CreateReconcileResponse(api::ReconcileTransactionsStatus::Success, transactions));
+		});
+	}
 }}
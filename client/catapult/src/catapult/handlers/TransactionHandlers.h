@@ -35,6 +35,9 @@ namespace catapult { namespace handlers {
 	/// Prototype for a function that retrieves unconfirmed transactions given a filter and a set of short hashes.
 	using UtRetriever = std::function<UnconfirmedTransactions (Timestamp, BlockFeeMultiplier, const utils::ShortHashesSet&)>;
 
+	/// Prototype for a function that supplies the short hashes of all unconfirmed transactions.
+	using UtShortHashesSupplier = supplier<model::ShortHashRange>;
+
 	/// Registers a push transactions handler in \a handlers that forwards transactions to \a transactionRangeHandler
 	/// given a transaction \a registry composed of known transactions.
 	void RegisterPushTransactionsHandler(
@@ -45,4 +48,13 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Registers a reconcile transactions handler in \a handlers that reconciles the requested short hash table with the short hashes
+	/// supplied by \a utShortHashesSupplier and responds with the unconfirmed transactions returned by the retriever (\a utRetriever).
+	/// \note Requested tables with more cells than a table created with \a maxNumCells cells are rejected.
+	void RegisterReconcileTransactionsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			uint32_t maxNumCells,
+			const UtShortHashesSupplier& utShortHashesSupplier,
+			const UtRetriever& utRetriever);
 }}
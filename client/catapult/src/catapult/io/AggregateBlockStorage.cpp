@@ -49,6 +49,12 @@ namespace catapult { namespace io {
 				m_pBlockChangeSubscriber->notifyBlock(blockElement);
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				m_pStorage->saveBlocks(blockElements);
+				for (const auto& blockElement : blockElements)
+					m_pBlockChangeSubscriber->notifyBlock(blockElement);
+			}
+
 			void dropBlocksAfter(Height height) override {
 				m_pStorage->dropBlocksAfter(height);
 				m_pBlockChangeSubscriber->notifyDropBlocksAfter(height);
@@ -62,6 +68,13 @@ namespace catapult { namespace io {
 				return m_pStorage->loadBlock(height);
 			}
 
+			std::vector<std::shared_ptr<const model::Block>> loadBlockRange(
+					Height height,
+					size_t maxBlocks,
+					size_t maxBytes) const override {
+				return m_pStorage->loadBlockRange(height, maxBlocks, maxBytes);
+			}
+
 			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
 				return m_pStorage->loadBlockElement(height);
 			}
@@ -38,10 +38,7 @@ namespace catapult { namespace io {
 			outputStream.write({ ToBytePointer(key), sizeof(model::ReceiptSource) });
 
 			Write32(outputStream, utils::checked_cast<size_t, uint32_t>(statement.size()));
-			for (auto i = 0u; i < statement.size(); ++i) {
-				const auto& receipt = statement.receiptAt(i);
-				outputStream.write({ ToBytePointer(receipt), receipt.Size });
-			}
+			outputStream.write(statement.receipts());
 		}
 
 		template<typename TUnresolvedKey, typename TResolutionStatement>
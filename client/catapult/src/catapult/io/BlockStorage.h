@@ -43,6 +43,13 @@ namespace catapult { namespace io {
 		/// Saves \a blockElement.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Saves all \a blockElements, which must have consecutive heights.
+		/// \note By default, each block element is saved individually.
+		virtual void saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				saveBlock(blockElement);
+		}
+
 		/// Drops all blocks after \a height.
 		virtual void dropBlocksAfter(Height height) = 0;
 	};
@@ -53,6 +60,29 @@ namespace catapult { namespace io {
 		/// Gets the block at \a height.
 		virtual std::shared_ptr<const model::Block> loadBlock(Height height) const = 0;
 
+		/// Gets at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note The first block is always returned irrespective of \a maxBytes.
+		/// \note By default, each block is loaded individually.
+		virtual std::vector<std::shared_ptr<const model::Block>> loadBlockRange(Height height, size_t maxBlocks, size_t maxBytes) const {
+			std::vector<std::shared_ptr<const model::Block>> blocks;
+			size_t totalSize = 0;
+			auto currentHeight = chainHeight();
+			for (auto i = 0u; i < maxBlocks; ++i) {
+				auto blockHeight = height + Height(i);
+				if (!blocks.empty() && blockHeight > currentHeight)
+					break;
+
+				auto pBlock = loadBlock(blockHeight);
+				if (!blocks.empty() && totalSize + pBlock->Size > maxBytes)
+					break;
+
+				totalSize += pBlock->Size;
+				blocks.push_back(std::move(pBlock));
+			}
+
+			return blocks;
+		}
+
 		/// Gets the block element (owning a block) at \a height.
 		virtual std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const = 0;
 
@@ -95,6 +95,16 @@ namespace catapult { namespace io {
 		return m_storage.loadBlock(height);
 	}
 
+	std::vector<std::shared_ptr<const model::Block>> BlockStorageView::loadBlockRange(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		requireHeight(height, "block range");
+
+		auto numAvailableBlocks = static_cast<size_t>((chainHeight() - height).unwrap() + 1);
+		return m_storage.loadBlockRange(height, std::min(maxBlocks, numAvailableBlocks), maxBytes);
+	}
+
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
 		if (m_cachedData.contains(height))
@@ -139,8 +149,7 @@ namespace catapult { namespace io {
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
-		for (const auto& blockElement : blockElements)
-			m_stagingStorage.saveBlock(blockElement);
+		m_stagingStorage.saveBlocks(blockElements);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
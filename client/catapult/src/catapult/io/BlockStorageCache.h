@@ -46,6 +46,10 @@ namespace catapult { namespace io {
 		/// Gets the block at \a height.
 		std::shared_ptr<const model::Block> loadBlock(Height height) const;
 
+		/// Gets at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note The first block is always returned irrespective of \a maxBytes.
+		std::vector<std::shared_ptr<const model::Block>> loadBlockRange(Height height, size_t maxBlocks, size_t maxBytes) const;
+
 		/// Gets the block element (owning a block) at \a height.
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const;
 
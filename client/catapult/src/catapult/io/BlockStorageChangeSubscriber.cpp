@@ -39,6 +39,10 @@ namespace catapult { namespace io {
 				m_pStorage->dropBlocksAfter(height);
 			}
 
+			void flush() override {
+				// empty because changes are committed in notifyBlock and notifyDropBlocksAfter
+			}
+
 		private:
 			std::unique_ptr<LightBlockStorage> m_pStorage;
 		};
@@ -33,11 +33,15 @@ namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			const std::shared_ptr<const PayloadCodec>& pPayloadCodec)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
-			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
-			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
+			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat", pPayloadCodec })
+			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt", pPayloadCodec })
 			, m_hashFile(dataDirectory, "hashes")
 			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string())
 	{}
@@ -66,22 +70,19 @@ namespace catapult { namespace io {
 	void FileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
 		auto currentHeight = chainHeight();
 		auto height = blockElement.Block.Height;
-
-		if (height != currentHeight + Height(1)) {
-			std::ostringstream out;
-			out << "cannot save block with height " << height << " when storage height is " << currentHeight;
-			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
-		}
+		requireNextHeight(height, currentHeight);
 
 		{
 			// write element
 			auto pBlockStream = m_blockDatabase.outputStream(height.unwrap());
 			WriteBlockElement(blockElement, *pBlockStream);
+			pBlockStream->flush();
 
 			// write statements
 			if (blockElement.OptionalStatement) {
 				auto pBlockStatementStream = m_statementDatabase.outputStream(height.unwrap());
 				WriteBlockStatement(*blockElement.OptionalStatement, *pBlockStatementStream);
+				pBlockStatementStream->flush();
 			}
 		}
 
@@ -92,6 +93,54 @@ namespace catapult { namespace io {
 			m_indexFile.set(height.unwrap());
 	}
 
+	void FileBlockStorage::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+		if (blockElements.empty())
+			return;
+
+		auto currentHeight = chainHeight();
+		for (const auto& blockElement : blockElements) {
+			requireNextHeight(blockElement.Block.Height, currentHeight);
+			currentHeight = blockElement.Block.Height;
+		}
+
+		// 1. write all elements
+		auto startHeight = blockElements.front().Block.Height;
+		m_blockDatabase.writeRange(startHeight.unwrap(), blockElements.size(), [startHeight, &blockElements](auto id, auto& output) {
+			WriteBlockElement(blockElements[id - startHeight.unwrap()], output);
+		});
+
+		// 2. write statements, grouping consecutive elements with statements
+		for (auto i = 0u; i < blockElements.size();) {
+			if (!blockElements[i].OptionalStatement) {
+				++i;
+				continue;
+			}
+
+			auto runStartIndex = i;
+			while (i < blockElements.size() && blockElements[i].OptionalStatement)
+				++i;
+
+			m_statementDatabase.writeRange(startHeight.unwrap() + runStartIndex, i - runStartIndex, [startHeight, &blockElements](
+					auto id,
+					auto& output) {
+				WriteBlockStatement(*blockElements[id - startHeight.unwrap()].OptionalStatement, output);
+			});
+		}
+
+		// 3. write hashes
+		if (FileBlockStorageMode::Hash_Index == m_mode) {
+			std::vector<Hash256> hashes;
+			hashes.reserve(blockElements.size());
+			for (const auto& blockElement : blockElements)
+				hashes.push_back(blockElement.EntityHash);
+
+			m_hashFile.saveRange(startHeight, hashes);
+		}
+
+		// 4. update the index last so that the new blocks are only visible after all of their data is durable
+		m_indexFile.setDurable(currentHeight.unwrap());
+	}
+
 	void FileBlockStorage::dropBlocksAfter(Height height) {
 		m_indexFile.set(height.unwrap());
 	}
@@ -116,6 +165,39 @@ namespace catapult { namespace io {
 		return ReadBlock(*pBlockStream);
 	}
 
+	std::vector<std::shared_ptr<const model::Block>> FileBlockStorage::loadBlockRange(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		requireHeight(height, "block range");
+
+		auto numAvailableBlocks = static_cast<size_t>((chainHeight() - height).unwrap() + 1);
+		auto numBlocks = std::min(maxBlocks, numAvailableBlocks);
+
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		size_t totalSize = 0;
+		while (blocks.size() < numBlocks && (blocks.empty() || totalSize < maxBytes)) {
+			// stored element sizes are upper bounds of block sizes, so the read can be bounded by the remaining byte budget
+			auto startHeight = height + Height(blocks.size());
+			auto payloads = m_blockDatabase.readRange(startHeight.unwrap(), numBlocks - blocks.size(), maxBytes - totalSize);
+			for (const auto& payload : payloads) {
+				// blocks are stored at the start of their elements
+				const auto* pBlock = reinterpret_cast<const model::Block*>(payload.Data.pData);
+				if (payload.Data.Size < sizeof(model::Block) || pBlock->Size > payload.Data.Size)
+					CATAPULT_THROW_RUNTIME_ERROR_1("stored block has invalid size at height", startHeight);
+
+				if (!blocks.empty() && totalSize + pBlock->Size > maxBytes)
+					return blocks;
+
+				totalSize += pBlock->Size;
+				blocks.push_back(std::shared_ptr<const model::Block>(payload.pBuffer, pBlock));
+				startHeight = startHeight + Height(1);
+			}
+		}
+
+		return blocks;
+	}
+
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
@@ -155,7 +237,16 @@ namespace catapult { namespace io {
 
 	// endregion
 
-	// region requireHeight
+	// region requireNextHeight / requireHeight
+
+	void FileBlockStorage::requireNextHeight(Height height, Height currentHeight) const {
+		if (height == currentHeight + Height(1))
+			return;
+
+		std::ostringstream out;
+		out << "cannot save block with height " << height << " when storage height is " << currentHeight;
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
 
 	void FileBlockStorage::requireHeight(Height height, const char* description) const {
 		auto chainHeight = this->chainHeight();
@@ -43,20 +43,30 @@ namespace catapult { namespace io {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
 		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// When \a pPayloadCodec is provided, it is used to encode (compress) stored block and statement payloads.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				const std::shared_ptr<const PayloadCodec>& pPayloadCodec = nullptr);
 
 	public:
 		// LightBlockStorage
 		Height chainHeight() const override;
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
 		void saveBlock(const model::BlockElement& blockElement) override;
+
+		/// Saves all \a blockElements as a single group.
+		/// \note Each touched file is written once and durably synced, and the index file is updated last.
+		void saveBlocks(const std::vector<model::BlockElement>& blockElements) override;
 		void dropBlocksAfter(Height height) override;
 
 		// BlockStorage
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+
+		/// Gets at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note Blocks stored in the same file are read together and reference the buffer they were read into.
+		std::vector<std::shared_ptr<const model::Block>> loadBlockRange(Height height, size_t maxBlocks, size_t maxBytes) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
 
@@ -64,6 +74,7 @@ namespace catapult { namespace io {
 		void purge() override;
 
 	private:
+		void requireNextHeight(Height height, Height currentHeight) const;
 		void requireHeight(Height height, const char* description) const;
 
 	private:
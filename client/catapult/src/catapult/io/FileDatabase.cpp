@@ -20,6 +20,7 @@
 **/
 
 #include "FileDatabase.h"
+#include "BufferInputStreamAdapter.h"
 #include "FileStream.h"
 #include "PodIoUtils.h"
 #include "catapult/exceptions.h"
@@ -61,6 +62,118 @@ namespace catapult { namespace io {
 		};
 
 		// endregion
+
+		// region DecodedInputStream
+
+		class DecodedInputStream : public InputStream {
+		public:
+			explicit DecodedInputStream(std::vector<uint8_t>&& payload)
+					: m_payload(std::move(payload))
+					, m_stream(m_payload)
+			{}
+
+		public:
+			bool eof() const override {
+				return m_stream.eof();
+			}
+
+			void read(const MutableRawBuffer& buffer) override {
+				m_stream.read(buffer);
+			}
+
+		private:
+			std::vector<uint8_t> m_payload;
+			BufferInputStreamAdapter<std::vector<uint8_t>> m_stream;
+		};
+
+		// endregion
+
+		// region EncodingOutputStream
+
+		class EncodingOutputStream : public OutputStream {
+		public:
+			EncodingOutputStream(OutputStream& stream, const PayloadCodec& codec)
+					: m_stream(stream)
+					, m_codec(codec)
+			{}
+
+			EncodingOutputStream(std::unique_ptr<OutputStream>&& pStream, const PayloadCodec& codec)
+					: m_pStream(std::move(pStream))
+					, m_stream(*m_pStream)
+					, m_codec(codec)
+			{}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_payload.insert(m_payload.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override {
+				if (m_payload.empty())
+					return;
+
+				m_stream.write(m_codec.encode(m_payload));
+				m_payload.clear();
+			}
+
+		private:
+			std::unique_ptr<OutputStream> m_pStream; // optional owned stream
+			OutputStream& m_stream;
+			const PayloadCodec& m_codec;
+			std::vector<uint8_t> m_payload;
+		};
+
+		// endregion
+
+		// region BufferedRawFileOutputStream
+
+		constexpr size_t Write_Buffer_Size = 64 * 1024;
+
+		// buffered output stream around a non-owned raw file
+		class BufferedRawFileOutputStream : public OutputStream {
+		public:
+			explicit BufferedRawFileOutputStream(RawFile& rawFile)
+					: m_rawFile(rawFile)
+					, m_numBytesWritten(0) {
+				m_buffer.reserve(Write_Buffer_Size);
+			}
+
+		public:
+			uint64_t numBytesWritten() const {
+				return m_numBytesWritten;
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_numBytesWritten += buffer.Size;
+
+				if (m_buffer.size() + buffer.Size > Write_Buffer_Size)
+					flush();
+
+				// bypass the buffer for large writes
+				if (buffer.Size > Write_Buffer_Size) {
+					m_rawFile.write(buffer);
+					return;
+				}
+
+				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override {
+				if (m_buffer.empty())
+					return;
+
+				m_rawFile.write(m_buffer);
+				m_buffer.clear();
+			}
+
+		private:
+			RawFile& m_rawFile;
+			std::vector<uint8_t> m_buffer;
+			uint64_t m_numBytesWritten;
+		};
+
+		// endregion
 	}
 
 	// region FileDatabase
@@ -94,6 +207,11 @@ namespace catapult { namespace io {
 		auto rawFileSize = rawFile.size();
 
 		if (bypassHeader()) {
+			if (m_options.pPayloadCodec) {
+				FileStream bodyStream(std::move(rawFile));
+				return decodeInputStream(bodyStream, rawFileSize, pSize);
+			}
+
 			if (pSize)
 				*pSize = rawFileSize;
 
@@ -119,20 +237,111 @@ namespace catapult { namespace io {
 		if (0 == bodyEndOffset) // payload extends to end of file
 			bodyEndOffset = rawFileSize;
 
+		auto bodySize = bodyEndOffset - pBodyStream->position();
+		if (m_options.pPayloadCodec)
+			return decodeInputStream(*pBodyStream, bodySize, pSize);
+
 		if (pSize)
-			*pSize = bodyEndOffset - pBodyStream->position();
+			*pSize = bodySize;
 
 		return std::make_unique<InputStreamSlice>(std::move(pBodyStream), bodyEndOffset);
 	}
 
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
+		auto rawFile = openForWrite(id);
+		if (!bypassHeader()) {
+			// update the header
+			rawFile.seek(getHeaderOffset(id));
+			Write64(rawFile, rawFile.size());
+
+			// seek to the body
+			rawFile.seek(rawFile.size());
+		}
+
+		auto pStream = std::make_unique<FileStream>(std::move(rawFile));
+		if (!m_options.pPayloadCodec)
+			return PORTABLE_MOVE(pStream);
+
+		return std::make_unique<EncodingOutputStream>(std::move(pStream), *m_options.pPayloadCodec);
+	}
+
+	void FileDatabase::writeRange(uint64_t startId, size_t count, const PayloadWriter& writePayload) {
+		auto endId = startId + count;
+		for (auto id = startId; id < endId;) {
+			// group all payloads stored in the same file
+			auto fileEndId = std::min(endId, (id / m_options.BatchSize + 1) * m_options.BatchSize);
+			writeFileRange(id, fileEndId, writePayload);
+			id = fileEndId;
+		}
+	}
+
+	std::vector<FileDatabase::SharedPayload> FileDatabase::readRange(uint64_t startId, size_t maxCount, size_t maxSize) const {
+		if (0 == maxCount)
+			return {};
+
+		auto rawFile = RawFile(getFilePath(startId, false), OpenMode::Read_Only);
+		auto rawFileSize = rawFile.size();
+
+		// calculate the offsets of all candidate payloads; payload i spans [offsets[i], offsets[i + 1])
+		std::vector<uint64_t> offsets;
+		if (bypassHeader()) {
+			offsets = { 0, rawFileSize };
+		} else {
+			auto fileEndId = (startId / m_options.BatchSize + 1) * m_options.BatchSize;
+			auto numCandidates = std::min<uint64_t>(maxCount, fileEndId - startId);
+
+			// read one extra offset (when available) to determine the end of the last candidate
+			offsets.resize(numCandidates + 1);
+			auto numOffsetsToRead = std::min<uint64_t>(numCandidates + 1, fileEndId - startId);
+			rawFile.seek(getHeaderOffset(startId));
+			rawFile.read({ reinterpret_cast<uint8_t*>(offsets.data()), numOffsetsToRead * sizeof(uint64_t) });
+
+			if (0 == offsets[0]) {
+				std::ostringstream out;
+				out << "cannot read payload at " << startId << " that has not been written";
+				CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+			}
+
+			// unwritten trailing payloads extend to the end of the file
+			auto iter = std::find(offsets.begin() + 1, offsets.end(), 0u);
+			if (offsets.end() != iter) {
+				*iter = rawFileSize;
+				offsets.erase(iter + 1, offsets.end());
+			}
+		}
+
+		// always read the first payload
+		auto numPayloads = 1u;
+		while (numPayloads + 1 < offsets.size() && offsets[numPayloads + 1] - offsets[0] <= maxSize)
+			++numPayloads;
+
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(offsets[numPayloads] - offsets[0]);
+		rawFile.seek(offsets[0]);
+		rawFile.read(*pBuffer);
+
+		std::vector<SharedPayload> payloads;
+		for (auto i = 0u; i < numPayloads; ++i) {
+			RawBuffer data(pBuffer->data() + (offsets[i] - offsets[0]), offsets[i + 1] - offsets[i]);
+			if (m_options.pPayloadCodec && m_options.pPayloadCodec->isEncoded(data)) {
+				auto pDecodedBuffer = std::make_shared<std::vector<uint8_t>>(m_options.pPayloadCodec->decode(data));
+				payloads.push_back({ pDecodedBuffer, *pDecodedBuffer });
+				continue;
+			}
+
+			payloads.push_back({ pBuffer, data });
+		}
+
+		return payloads;
+	}
+
+	RawFile FileDatabase::openForWrite(uint64_t id) {
 		auto filePath = getFilePath(id, true);
 
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
 		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
 
 		if (bypassHeader())
-			return std::make_unique<FileStream>(std::move(rawFile));
+			return rawFile;
 
 		auto headerOffset = getHeaderOffset(id);
 		auto headerSize = m_options.BatchSize * sizeof(uint64_t);
@@ -155,13 +364,52 @@ namespace catapult { namespace io {
 			}
 		}
 
-		// update the header
-		rawFile.seek(headerOffset);
-		Write64(rawFile, rawFile.size());
+		return rawFile;
+	}
+
+	void FileDatabase::writeFileRange(uint64_t startId, uint64_t endId, const PayloadWriter& writePayload) {
+		auto rawFile = openForWrite(startId);
+
+		// write all bodies
+		auto bodiesStartOffset = rawFile.size();
+		rawFile.seek(bodiesStartOffset);
+
+		std::vector<uint64_t> bodyOffsets;
+		BufferedRawFileOutputStream bodyStream(rawFile);
+		for (auto id = startId; id < endId; ++id) {
+			bodyOffsets.push_back(bodiesStartOffset + bodyStream.numBytesWritten());
+			if (!m_options.pPayloadCodec) {
+				writePayload(id, bodyStream);
+				continue;
+			}
+
+			EncodingOutputStream payloadStream(bodyStream, *m_options.pPayloadCodec);
+			writePayload(id, payloadStream);
+			payloadStream.flush();
+		}
+
+		bodyStream.flush();
+
+		// update the (contiguous) header entries for all written ids
+		if (!bypassHeader()) {
+			rawFile.seek(getHeaderOffset(startId));
+			rawFile.write({ reinterpret_cast<const uint8_t*>(bodyOffsets.data()), bodyOffsets.size() * sizeof(uint64_t) });
+		}
+
+		rawFile.sync();
+	}
+
+	std::unique_ptr<InputStream> FileDatabase::decodeInputStream(InputStream& bodyStream, uint64_t bodySize, size_t* pSize) const {
+		std::vector<uint8_t> payload(bodySize);
+		bodyStream.read(payload);
+
+		if (m_options.pPayloadCodec->isEncoded(payload))
+			payload = m_options.pPayloadCodec->decode(payload);
+
+		if (pSize)
+			*pSize = payload.size();
 
-		// seek to the body and return
-		rawFile.seek(rawFile.size());
-		return std::make_unique<FileStream>(std::move(rawFile));
+		return std::make_unique<DecodedInputStream>(std::move(payload));
 	}
 
 	bool FileDatabase::bypassHeader() const {
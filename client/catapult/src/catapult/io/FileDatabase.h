@@ -20,8 +20,11 @@
 **/
 
 #pragma once
+#include "PayloadCodec.h"
+#include "RawFile.h"
 #include "Stream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/functions.h"
 
 namespace catapult { namespace io {
 
@@ -35,6 +38,21 @@ namespace catapult { namespace io {
 
 			/// Extension of created files.
 			std::string FileExtension;
+
+			/// Optional codec used to encode written payloads and decode read payloads.
+			std::shared_ptr<const PayloadCodec> pPayloadCodec = nullptr;
+		};
+
+		/// Writes the payload with the specified id to an output stream.
+		using PayloadWriter = consumer<uint64_t, OutputStream&>;
+
+		/// Payload that shares ownership of the buffer containing it.
+		struct SharedPayload {
+			/// Buffer containing the payload.
+			std::shared_ptr<const std::vector<uint8_t>> pBuffer;
+
+			/// Payload data within the buffer.
+			RawBuffer Data;
 		};
 
 	public:
@@ -49,9 +67,23 @@ namespace catapult { namespace io {
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
 		/// Gets an output stream for \a id.
+		/// \note When a payload codec is configured, the payload is encoded and written when the stream is flushed.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
+		/// Writes the payloads for \a count consecutive ids starting at \a startId by calling \a writePayload for each id.
+		/// \note Each file is opened once and durably synced after all of its payloads are written.
+		void writeRange(uint64_t startId, size_t count, const PayloadWriter& writePayload);
+
+		/// Reads the payloads for at most \a maxCount consecutive ids starting at \a startId that are stored in the same file
+		/// and have a total (stored) size of at most \a maxSize.
+		/// \note The first payload is always read irrespective of \a maxSize.
+		/// \note All payloads are read with a single file read and share the buffer they were read into (unless decoded).
+		std::vector<SharedPayload> readRange(uint64_t startId, size_t maxCount, size_t maxSize) const;
+
 	private:
+		RawFile openForWrite(uint64_t id);
+		void writeFileRange(uint64_t startId, uint64_t endId, const PayloadWriter& writePayload);
+		std::unique_ptr<InputStream> decodeInputStream(InputStream& bodyStream, uint64_t bodySize, size_t* pSize) const;
 		bool bypassHeader() const;
 		uint64_t getHeaderOffset(uint64_t id) const;
 		std::string getFilePath(uint64_t id, bool createDirectories) const;
@@ -20,15 +20,19 @@
 **/
 
 #include "FileQueue.h"
+#include "PodIoUtils.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
 
 namespace catapult { namespace io {
 
 	namespace {
+		constexpr auto Segment_Header_Size = File_Queue_Messages_Per_Segment * sizeof(uint64_t);
+
 		const std::filesystem::path& CreateDirectory(const std::filesystem::path& directory) {
 			config::CatapultDirectory(directory).create();
 			return directory;
@@ -47,6 +51,38 @@ namespace catapult { namespace io {
 			out << utils::HexFormat(value) << ".dat";
 			return out.str();
 		}
+
+		std::string GetSegmentFilename(uint64_t value) {
+			std::ostringstream out;
+			out << utils::HexFormat(value - value % File_Queue_Messages_Per_Segment) << ".seg";
+			return out.str();
+		}
+
+		uint64_t GetSegmentHeaderOffset(uint64_t value) {
+			return value % File_Queue_Messages_Per_Segment * sizeof(uint64_t);
+		}
+
+		bool IsLastMessageInSegment(uint64_t value) {
+			return File_Queue_Messages_Per_Segment - 1 == value % File_Queue_Messages_Per_Segment;
+		}
+
+		uint64_t ReadSegmentMessageEndOffset(RawFile& segmentFile, uint64_t value) {
+			segmentFile.seek(GetSegmentHeaderOffset(value));
+			return Read64(segmentFile);
+		}
+
+		uint64_t ReadSegmentMessageStartOffset(RawFile& segmentFile, uint64_t value) {
+			// a message starts where the closest preceding message stored in this segment file ends
+			// (preceding messages stored in their own files have zero end offsets and are skipped)
+			auto segmentStartValue = value - value % File_Queue_Messages_Per_Segment;
+			for (auto previousValue = value; previousValue > segmentStartValue; --previousValue) {
+				auto previousEndOffset = ReadSegmentMessageEndOffset(segmentFile, previousValue - 1);
+				if (0 != previousEndOffset)
+					return previousEndOffset;
+			}
+
+			return Segment_Header_Size;
+		}
 	}
 
 	// region FileQueueWriter
@@ -55,12 +91,24 @@ namespace catapult { namespace io {
 	{}
 
 	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename)
+			: FileQueueWriter(directory, indexFilename, FileQueueStorageMode::Message_Files)
+	{}
+
+	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename, FileQueueStorageMode storageMode)
 			: m_directory(CreateDirectory(directory))
+			, m_storageMode(storageMode)
 			, m_indexFile((m_directory / indexFilename).generic_string(), LockMode::None)
 			, m_indexValue(CreateIfNotExists(m_indexFile) ? 0 : m_indexFile.get())
+			, m_hasSegmentMessage(false)
 	{}
 
 	void FileQueueWriter::write(const RawBuffer& buffer) {
+		if (FileQueueStorageMode::Segment_Files == m_storageMode) {
+			m_segmentMessage.insert(m_segmentMessage.end(), buffer.pData, buffer.pData + buffer.Size);
+			m_hasSegmentMessage = true;
+			return;
+		}
+
 		if (!m_pOutputStream) {
 			auto filename = (m_directory / GetFilename(m_indexValue)).generic_string();
 			RawFile outputFile(filename, OpenMode::Read_Write);
@@ -71,6 +119,11 @@ namespace catapult { namespace io {
 	}
 
 	void FileQueueWriter::flush() {
+		if (FileQueueStorageMode::Segment_Files == m_storageMode) {
+			flushToSegmentFile();
+			return;
+		}
+
 		if (!m_pOutputStream)
 			return;
 
@@ -79,6 +132,47 @@ namespace catapult { namespace io {
 		m_indexValue = m_indexFile.increment();
 	}
 
+	void FileQueueWriter::flushToSegmentFile() {
+		if (!m_hasSegmentMessage)
+			return;
+
+		if (!m_pSegmentFile) {
+			auto filename = (m_directory / GetSegmentFilename(m_indexValue)).generic_string();
+			auto isNewFile = !std::filesystem::exists(filename);
+			m_pSegmentFile = std::make_unique<RawFile>(filename, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append, LockMode::None);
+
+			if (isNewFile) {
+				m_pSegmentFile->write(std::vector<uint8_t>(Segment_Header_Size));
+			} else {
+				// messages are only ever appended, so all committed messages end at or before the start of the next message;
+				// only the dead tail following them (e.g. after a crash or a writer index rollback) is discarded
+				m_pSegmentFile->seek(ReadSegmentMessageStartOffset(*m_pSegmentFile, m_indexValue));
+				m_pSegmentFile->truncate();
+
+				// clear the header entries of all discarded messages so that they are not mistaken for committed ones
+				auto headerOffset = GetSegmentHeaderOffset(m_indexValue);
+				m_pSegmentFile->seek(headerOffset);
+				m_pSegmentFile->write(std::vector<uint8_t>(Segment_Header_Size - headerOffset));
+			}
+		}
+
+		// append the message body before updating the header so that readers never observe a partially written message
+		m_pSegmentFile->seek(m_pSegmentFile->size());
+		m_pSegmentFile->write(m_segmentMessage);
+
+		auto endOffset = m_pSegmentFile->size();
+		m_pSegmentFile->seek(GetSegmentHeaderOffset(m_indexValue));
+		Write64(*m_pSegmentFile, endOffset);
+
+		// close a full segment file before committing its last message so that readers are able to remove it
+		if (IsLastMessageInSegment(m_indexValue))
+			m_pSegmentFile.reset();
+
+		m_segmentMessage.clear();
+		m_hasSegmentMessage = false;
+		m_indexValue = m_indexFile.increment();
+	}
+
 	// endregion
 
 	// region FileQueueReader
@@ -90,6 +184,58 @@ namespace catapult { namespace io {
 			outputFile.read(buffer);
 			return buffer;
 		}
+
+		class MessageFile {
+		public:
+			MessageFile(const std::filesystem::path& directory, uint64_t value)
+					: m_messageFilename(directory / GetFilename(value))
+					, m_segmentFilename(directory / GetSegmentFilename(value))
+					, m_value(value)
+					, m_isSegment(!std::filesystem::exists(m_messageFilename) && std::filesystem::exists(m_segmentFilename))
+			{}
+
+		public:
+			const std::filesystem::path& filename() const {
+				return m_isSegment ? m_segmentFilename : m_messageFilename;
+			}
+
+			bool exists() const {
+				return m_isSegment || std::filesystem::exists(m_messageFilename);
+			}
+
+		public:
+			std::vector<uint8_t> read() const {
+				if (!m_isSegment)
+					return ReadAllContents(m_messageFilename.generic_string());
+
+				RawFile segmentFile(m_segmentFilename.generic_string(), OpenMode::Read_Only, LockMode::None);
+				auto endOffset = ReadSegmentMessageEndOffset(segmentFile, m_value);
+				if (0 == endOffset)
+					CATAPULT_THROW_RUNTIME_ERROR_2("file queue segment file does not contain message", m_segmentFilename, m_value);
+
+				auto startOffset = ReadSegmentMessageStartOffset(segmentFile, m_value);
+				std::vector<uint8_t> buffer(endOffset - startOffset);
+				segmentFile.seek(startOffset);
+				segmentFile.read(buffer);
+				return buffer;
+			}
+
+			void remove() const {
+				if (!m_isSegment)
+					std::filesystem::remove(m_messageFilename);
+
+				// a segment file is owned by the range of messages it spans irrespective of how each message is stored,
+				// so remove it after the last message in its range is consumed even if that message has its own file
+				if (IsLastMessageInSegment(m_value))
+					std::filesystem::remove(m_segmentFilename);
+			}
+
+		private:
+			std::filesystem::path m_messageFilename;
+			std::filesystem::path m_segmentFilename;
+			uint64_t m_value;
+			bool m_isSegment;
+		};
 	}
 
 	FileQueueReader::FileQueueReader(const std::string& directory) : FileQueueReader(directory, "index_reader.dat", "index.dat")
@@ -119,34 +265,52 @@ namespace catapult { namespace io {
 	}
 
 	bool FileQueueReader::tryReadNextMessageConditional(const predicate<const std::vector<uint8_t>&>& predicate) {
-		return process([predicate](const auto& nextMessageFilename) {
-			auto buffer = ReadAllContents(nextMessageFilename);
+		return process([predicate](const auto& readMessage) {
+			auto buffer = readMessage();
 			return predicate(buffer);
 		});
 	}
 
+	bool FileQueueReader::tryPeekMessage(size_t offset, const consumer<const std::vector<uint8_t>&>& consumer) const {
+		auto messageIndexValue = m_readerIndexFile.get() + offset;
+		if (!m_writerIndexFile.exists() || messageIndexValue >= m_writerIndexFile.get())
+			return false;
+
+		MessageFile messageFile(m_directory, messageIndexValue);
+		if (!messageFile.exists())
+			CATAPULT_THROW_RUNTIME_ERROR_1("peeking into file queue failed due to missing message file", messageFile.filename());
+
+		consumer(messageFile.read());
+		return true;
+	}
+
 	void FileQueueReader::skip(uint32_t count) {
-		for (auto i = 0u; i < count; ++i) {
-			process([](const auto&) {
-				return true;
-			});
-		}
+		// skipped messages have already been peeked, so consume them without reading them again
+		auto readerIndexValue = m_readerIndexFile.get();
+		auto writerIndexValue = m_writerIndexFile.exists() ? m_writerIndexFile.get() : 0;
+		if (readerIndexValue >= writerIndexValue)
+			return;
+
+		auto endIndexValue = std::min<uint64_t>(readerIndexValue + count, writerIndexValue);
+		m_readerIndexFile.set(endIndexValue);
+		for (auto value = readerIndexValue; value < endIndexValue; ++value)
+			MessageFile(m_directory, value).remove();
 	}
 
-	bool FileQueueReader::process(const predicate<const std::string&>& processFilename) {
+	bool FileQueueReader::process(const predicate<const supplier<std::vector<uint8_t>>&>& processMessage) {
 		auto readerIndexValue = m_readerIndexFile.get();
 		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
 			return false;
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!std::filesystem::exists(nextMessageFilename))
-			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
+		MessageFile messageFile(m_directory, readerIndexValue);
+		if (!messageFile.exists())
+			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", messageFile.filename());
 
-		if (!processFilename(nextMessageFilename.generic_string()))
+		if (!processMessage([&messageFile]() { return messageFile.read(); }))
 			return false; // file was not fully processed, so don't delete it
 
 		m_readerIndexFile.increment();
-		std::filesystem::remove(nextMessageFilename);
+		messageFile.remove();
 		return true;
 	}
 
@@ -27,8 +27,21 @@
 
 namespace catapult { namespace io {
 
+	/// Number of messages stored in each file queue segment file.
+	constexpr uint64_t File_Queue_Messages_Per_Segment = 1024;
+
+	/// File queue message storage modes.
+	enum class FileQueueStorageMode {
+		/// Each message is stored in its own file.
+		Message_Files,
+
+		/// Consecutive messages are appended to shared segment files.
+		/// \note Each segment file starts with a header containing the end offset of each message stored in it.
+		Segment_Files
+	};
+
 	/// File based queue writer where each message is represented by a file (with incrementing names) in a directory.
-	/// \note Each call to flush will additionally create a new file.
+	/// \note Each call to flush will additionally create a new file (or append a message to a segment file).
 	class FileQueueWriter final : public OutputStream {
 	public:
 		/// Creates a file queue writer around \a directory.
@@ -37,18 +50,32 @@ namespace catapult { namespace io {
 		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename).
 		FileQueueWriter(const std::string& directory, const std::string& indexFilename);
 
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// that stores messages according to \a storageMode.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, FileQueueStorageMode storageMode);
+
 	public:
 		void write(const RawBuffer& buffer) override;
 		void flush() override;
 
+	private:
+		void flushToSegmentFile();
+
 	private:
 		std::filesystem::path m_directory;
+		FileQueueStorageMode m_storageMode;
 		IndexFile m_indexFile;
 		uint64_t m_indexValue;
 		std::unique_ptr<BufferedOutputFileStream> m_pOutputStream;
+
+		std::unique_ptr<RawFile> m_pSegmentFile;
+		std::vector<uint8_t> m_segmentMessage;
+		bool m_hasSegmentMessage;
 	};
 
 	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory.
+	/// \note Messages stored in segment files are read transparently and each segment file is removed after its last message
+	///       is consumed.
 	class FileQueueReader final {
 	public:
 		/// Creates a file queue reader around \a directory.
@@ -70,11 +97,16 @@ namespace catapult { namespace io {
 		/// When \a predicate returns \c false, processing is stopped and message is not consumed.
 		bool tryReadNextMessageConditional(const predicate<const std::vector<uint8_t>&>& predicate);
 
+		/// Tries to read the message \a offset messages after the next message and forwards it to \a consumer if successful.
+		/// \note The message is not consumed.
+		bool tryPeekMessage(size_t offset, const consumer<const std::vector<uint8_t>&>& consumer) const;
+
 		/// Skips at most the next \a count messages.
+		/// \note Skipped messages are consumed without being read.
 		void skip(uint32_t count);
 
 	private:
-		bool process(const predicate<const std::string&>& processFilename);
+		bool process(const predicate<const supplier<std::vector<uint8_t>>&>& processMessage);
 
 	private:
 		std::filesystem::path m_directory;
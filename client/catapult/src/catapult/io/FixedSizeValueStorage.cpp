@@ -69,6 +69,29 @@ namespace catapult { namespace io {
 		m_pCachedStorageFile->write({ reinterpret_cast<const uint8_t*>(&value), sizeof(TValue) });
 	}
 
+	template<typename TKey, typename TValue>
+	void FixedSizeValueStorage<TKey, TValue>::saveRange(TKey key, const std::vector<TValue>& values) {
+		// close the cached file because its cached size will be stale after this write
+		reset();
+
+		const auto* pData = reinterpret_cast<const uint8_t*>(values.data());
+		auto numValues = values.size();
+		while (numValues) {
+			auto pFixedSizeValueStorage = openStorageFile(key, OpenMode::Read_Append);
+			seekStorageFile(*pFixedSizeValueStorage, key);
+
+			auto count = Files_Per_Storage_Directory - (key.unwrap() % Files_Per_Storage_Directory);
+			count = std::min<size_t>(numValues, count);
+
+			pFixedSizeValueStorage->write(RawBuffer(pData, count * sizeof(TValue)));
+			pFixedSizeValueStorage->sync();
+
+			pData += count * sizeof(TValue);
+			numValues -= count;
+			key = key + TKey(count);
+		}
+	}
+
 	template<typename TKey, typename TValue>
 	void FixedSizeValueStorage<TKey, TValue>::reset() {
 		m_cachedDirectoryId = Unset_Directory_Id;
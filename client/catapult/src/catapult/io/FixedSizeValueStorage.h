@@ -44,6 +44,10 @@ namespace catapult { namespace io {
 		/// \note Expects ascending keys.
 		void save(TKey key, const TValue& value);
 
+		/// Saves \a values at consecutive keys starting at \a key.
+		/// \note Each storage file is written once and durably synced.
+		void saveRange(TKey key, const std::vector<TValue>& values);
+
 		/// Closes cached file.
 		void reset();
 
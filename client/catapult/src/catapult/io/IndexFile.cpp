@@ -45,6 +45,13 @@ namespace catapult { namespace io {
 		Write64(indexFile, value);
 	}
 
+	void IndexFile::setDurable(uint64_t value) {
+		auto indexFile = open(OpenMode::Read_Append);
+		indexFile.seek(0);
+		Write64(indexFile, value);
+		indexFile.sync();
+	}
+
 	uint64_t IndexFile::increment() {
 		if (!exists()) {
 			set(0);
@@ -42,6 +42,9 @@ namespace catapult { namespace io {
 		/// Sets the index value to \a value.
 		void set(uint64_t value);
 
+		/// Sets the index value to \a value and durably syncs the index file.
+		void setDurable(uint64_t value);
+
 		/// Increments the index value by one and returns the new value.
 		uint64_t increment();
 
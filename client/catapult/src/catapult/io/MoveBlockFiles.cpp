@@ -26,6 +26,33 @@
 
 namespace catapult { namespace io {
 
+	namespace {
+		constexpr size_t Max_Blocks_Per_Save = 100;
+
+		std::shared_ptr<const model::BlockElement> LoadBlockElementWithStatement(const PrunableBlockStorage& storage, Height height) {
+			auto pBlockElement = storage.loadBlockElement(height);
+			auto blockStatementPair = storage.loadBlockStatementData(height);
+
+			if (blockStatementPair.second) {
+				auto pBlockStatement = std::make_shared<model::BlockStatement>();
+				BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
+				ReadBlockStatement(blockStatementStream, *pBlockStatement);
+				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
+			}
+
+			return pBlockElement;
+		}
+
+		void SaveBlocks(BlockStorage& storage, const std::vector<std::shared_ptr<const model::BlockElement>>& blockElements) {
+			std::vector<model::BlockElement> blockElementsToSave;
+			blockElementsToSave.reserve(blockElements.size());
+			for (const auto& pBlockElement : blockElements)
+				blockElementsToSave.push_back(*pBlockElement);
+
+			storage.saveBlocks(blockElementsToSave);
+		}
+	}
+
 	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
 		if (startHeight < Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid height passed", startHeight);
@@ -33,19 +60,16 @@ namespace catapult { namespace io {
 		if (startHeight <= destinationStorage.chainHeight())
 			destinationStorage.dropBlocksAfter(startHeight - Height(1));
 
+		// save blocks in groups to amortize file opens and syncs
+		std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
 		auto sourceHeight = sourceStorage.chainHeight();
 		for (auto height = startHeight; height <= sourceHeight; height = height + Height(1)) {
-			auto pBlockElement = sourceStorage.loadBlockElement(height);
-			auto blockStatementPair = sourceStorage.loadBlockStatementData(height);
+			blockElements.push_back(LoadBlockElementWithStatement(sourceStorage, height));
 
-			if (blockStatementPair.second) {
-				auto pBlockStatement = std::make_shared<model::BlockStatement>();
-				BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
-				ReadBlockStatement(blockStatementStream, *pBlockStatement);
-				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
+			if (Max_Blocks_Per_Save == blockElements.size() || sourceHeight == height) {
+				SaveBlocks(destinationStorage, blockElements);
+				blockElements.clear();
 			}
-
-			destinationStorage.saveBlock(*pBlockElement);
 		}
 
 		sourceStorage.purge();
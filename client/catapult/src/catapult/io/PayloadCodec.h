@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Codec used to encode payloads before they are stored and to decode them after they are loaded.
+	class PayloadCodec {
+	public:
+		virtual ~PayloadCodec() = default;
+
+	public:
+		/// Returns \c true if \a buffer contains an encoded payload.
+		/// \note This allows payloads stored before encoding was enabled to be loaded unchanged.
+		virtual bool isEncoded(const RawBuffer& buffer) const = 0;
+
+		/// Encodes the payload in \a buffer.
+		virtual std::vector<uint8_t> encode(const RawBuffer& buffer) const = 0;
+
+		/// Decodes the encoded payload in \a buffer.
+		/// \throws catapult_file_io_error if \a buffer cannot be decoded.
+		virtual std::vector<uint8_t> decode(const RawBuffer& buffer) const = 0;
+	};
+}}
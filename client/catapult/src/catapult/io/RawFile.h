@@ -82,6 +82,10 @@ namespace catapult { namespace io {
 		/// Truncates the file at its current position.
 		void truncate();
 
+		/// Durably flushes all written data to the underlying storage device.
+		/// Throws catapult_file_io_error exception if sync has failed.
+		void sync();
+
 	private:
 		class FileDescriptorHolder final {
 		public:
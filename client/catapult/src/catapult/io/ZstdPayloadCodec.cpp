@@ -0,0 +1,170 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ZstdPayloadCodec.h"
+#include "catapult/exceptions.h"
+#include <zdict.h>
+#include <zstd.h>
+#include <cstring>
+
+namespace catapult { namespace io {
+
+	namespace {
+		// region contexts
+
+		struct ContextDeleter {
+			void operator()(ZSTD_CCtx* pContext) const {
+				ZSTD_freeCCtx(pContext);
+			}
+
+			void operator()(ZSTD_DCtx* pContext) const {
+				ZSTD_freeDCtx(pContext);
+			}
+
+			void operator()(ZSTD_CDict* pDictionary) const {
+				ZSTD_freeCDict(pDictionary);
+			}
+
+			void operator()(ZSTD_DDict* pDictionary) const {
+				ZSTD_freeDDict(pDictionary);
+			}
+		};
+
+		// contexts are not thread safe but are expensive to create, so reuse one per thread
+		ZSTD_CCtx& GetCompressionContext() {
+			thread_local std::unique_ptr<ZSTD_CCtx, ContextDeleter> t_pContext(ZSTD_createCCtx());
+			return *t_pContext;
+		}
+
+		ZSTD_DCtx& GetDecompressionContext() {
+			thread_local std::unique_ptr<ZSTD_DCtx, ContextDeleter> t_pContext(ZSTD_createDCtx());
+			return *t_pContext;
+		}
+
+		void CheckResult(size_t result, const char* message) {
+			if (ZSTD_isError(result))
+				CATAPULT_THROW_FILE_IO_ERROR(std::string(message).append(": ").append(ZSTD_getErrorName(result)).c_str());
+		}
+
+		// endregion
+
+		// region ZstdPayloadCodec
+
+		class ZstdPayloadCodec : public PayloadCodec {
+		public:
+			ZstdPayloadCodec(int level, const std::vector<uint8_t>& dictionary) : m_level(level) {
+				if (dictionary.empty())
+					return;
+
+				m_pCompressionDictionary.reset(ZSTD_createCDict(dictionary.data(), dictionary.size(), level));
+				m_pDecompressionDictionary.reset(ZSTD_createDDict(dictionary.data(), dictionary.size()));
+				if (!m_pCompressionDictionary || !m_pDecompressionDictionary)
+					CATAPULT_THROW_INVALID_ARGUMENT("could not load zstd dictionary");
+			}
+
+		public:
+			bool isEncoded(const RawBuffer& buffer) const override {
+				// raw block and statement payloads start with a size or count that can never match the frame magic number
+				uint32_t magic;
+				if (buffer.Size < sizeof(uint32_t))
+					return false;
+
+				std::memcpy(&magic, buffer.pData, sizeof(uint32_t));
+				return ZSTD_MAGICNUMBER == magic;
+			}
+
+			std::vector<uint8_t> encode(const RawBuffer& buffer) const override {
+				std::vector<uint8_t> encoded(ZSTD_compressBound(buffer.Size));
+				auto& context = GetCompressionContext();
+				auto size = m_pCompressionDictionary
+						? ZSTD_compress_usingCDict(
+								&context,
+								encoded.data(),
+								encoded.size(),
+								buffer.pData,
+								buffer.Size,
+								m_pCompressionDictionary.get())
+						: ZSTD_compressCCtx(&context, encoded.data(), encoded.size(), buffer.pData, buffer.Size, m_level);
+				CheckResult(size, "could not compress payload");
+
+				encoded.resize(size);
+				return encoded;
+			}
+
+			std::vector<uint8_t> decode(const RawBuffer& buffer) const override {
+				auto decodedSize = ZSTD_getFrameContentSize(buffer.pData, buffer.Size);
+				if (ZSTD_CONTENTSIZE_ERROR == decodedSize || ZSTD_CONTENTSIZE_UNKNOWN == decodedSize)
+					CATAPULT_THROW_FILE_IO_ERROR("could not determine decompressed payload size");
+
+				std::vector<uint8_t> decoded(static_cast<size_t>(decodedSize));
+				auto& context = GetDecompressionContext();
+				auto size = m_pDecompressionDictionary
+						? ZSTD_decompress_usingDDict(
+								&context,
+								decoded.data(),
+								decoded.size(),
+								buffer.pData,
+								buffer.Size,
+								m_pDecompressionDictionary.get())
+						: ZSTD_decompressDCtx(&context, decoded.data(), decoded.size(), buffer.pData, buffer.Size);
+				CheckResult(size, "could not decompress payload");
+
+				if (size != decoded.size())
+					CATAPULT_THROW_FILE_IO_ERROR("decompressed payload has unexpected size");
+
+				return decoded;
+			}
+
+		private:
+			int m_level;
+			std::unique_ptr<ZSTD_CDict, ContextDeleter> m_pCompressionDictionary;
+			std::unique_ptr<ZSTD_DDict, ContextDeleter> m_pDecompressionDictionary;
+		};
+
+		// endregion
+	}
+
+	std::unique_ptr<PayloadCodec> CreateZstdPayloadCodec(int level, const std::vector<uint8_t>& dictionary) {
+		return std::make_unique<ZstdPayloadCodec>(level, dictionary);
+	}
+
+	std::vector<uint8_t> TrainZstdDictionary(const std::vector<std::vector<uint8_t>>& samples, size_t dictionaryCapacity) {
+		std::vector<uint8_t> samplesBuffer;
+		std::vector<size_t> sampleSizes;
+		for (const auto& sample : samples) {
+			samplesBuffer.insert(samplesBuffer.end(), sample.cbegin(), sample.cend());
+			sampleSizes.push_back(sample.size());
+		}
+
+		std::vector<uint8_t> dictionary(dictionaryCapacity);
+		auto size = ZDICT_trainFromBuffer(
+				dictionary.data(),
+				dictionary.size(),
+				samplesBuffer.data(),
+				sampleSizes.data(),
+				static_cast<unsigned>(sampleSizes.size()));
+		if (ZDICT_isError(size))
+			CATAPULT_THROW_RUNTIME_ERROR(std::string("could not train zstd dictionary: ").append(ZDICT_getErrorName(size)).c_str());
+
+		dictionary.resize(size);
+		return dictionary;
+	}
+}}
@@ -0,0 +1,35 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PayloadCodec.h"
+#include <memory>
+
+namespace catapult { namespace io {
+
+	/// Creates a codec that compresses each payload into a single self-contained zstd frame
+	/// using compression \a level and an optional (trained) \a dictionary.
+	/// \note The same dictionary must be used to decode all payloads encoded with a dictionary.
+	std::unique_ptr<PayloadCodec> CreateZstdPayloadCodec(int level, const std::vector<uint8_t>& dictionary = {});
+
+	/// Trains a zstd dictionary with a maximum size of \a dictionaryCapacity from representative payload \a samples.
+	std::vector<uint8_t> TrainZstdDictionary(const std::vector<std::vector<uint8_t>>& samples, size_t dictionaryCapacity);
+}}
@@ -0,0 +1,41 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketIo.h"
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// Write-optimized interface for writing packets.
+	class BatchPacketWriter {
+	public:
+		virtual ~BatchPacketWriter() = default;
+
+	public:
+		/// Returns \c true if \a payload is well formed and can be written.
+		virtual bool isWritable(const PacketPayload& payload) const = 0;
+
+		/// Writes all \a payloads as a single gathered write and calls \a callback on completion.
+		/// \note If any payload is malformed, no payloads are written, so callers should check isWritable before coalescing.
+		virtual void writeMultiple(const std::vector<PacketPayload>& payloads, const PacketIo::WriteCallback& callback) = 0;
+	};
+}}
@@ -20,6 +20,7 @@
 **/
 
 #include "BufferedPacketIo.h"
+#include "BatchPacketWriter.h"
 #include "PacketIo.h"
 #include "catapult/utils/Logging.h"
 #include <deque>
@@ -36,6 +37,11 @@ namespace catapult { namespace ionet {
 					, m_payload(payload)
 			{}
 
+		public:
+			const PacketPayload& payload() const {
+				return m_payload;
+			}
+
 		public:
 			template<typename TCallback>
 			void invoke(TCallback callback) {
@@ -130,15 +136,103 @@ namespace catapult { namespace ionet {
 
 		// endregion
 
+		// region CoalescingWriteRequestQueue
+
+		// write queue implementation that coalesces all queued writes (up to a maximum size) into a single batch write
+		template<typename TCallbackWrapper>
+		class CoalescingWriteRequestQueue {
+		private:
+			using WriteCallback = PacketIo::WriteCallback;
+
+		public:
+			CoalescingWriteRequestQueue(
+					TCallbackWrapper& wrapper,
+					const std::shared_ptr<BatchPacketWriter>& pWriter,
+					size_t maxCoalescedWriteSize)
+					: m_wrapper(wrapper)
+					, m_pWriter(pWriter)
+					, m_maxCoalescedWriteSize(maxCoalescedWriteSize)
+					, m_numActiveRequests(0)
+			{}
+
+		public:
+			void push(const WriteRequest& request, const WriteCallback& callback) {
+				m_requests.emplace_back(request.payload(), callback);
+
+				if (0 != m_numActiveRequests) {
+					CATAPULT_LOG(trace) << "queuing work because in progress operation detected";
+					return;
+				}
+
+				next();
+			}
+
+		private:
+			void next() {
+				// always write at least one payload, even if it is larger than the maximum coalesced write size;
+				// a malformed payload is always written alone so that its failure does not fail any other request
+				std::vector<PacketPayload> payloads;
+				size_t numBytes = 0;
+				for (const auto& request : m_requests) {
+					if (!m_pWriter->isWritable(request.first)) {
+						if (payloads.empty())
+							payloads.push_back(request.first);
+
+						break;
+					}
+
+					auto payloadSize = request.first.header().Size;
+					if (!payloads.empty() && numBytes + payloadSize > m_maxCoalescedWriteSize)
+						break;
+
+					payloads.push_back(request.first);
+					numBytes += payloadSize;
+				}
+
+				// note that requests should only be popped after the operation is complete
+				m_numActiveRequests = payloads.size();
+				m_pWriter->writeMultiple(payloads, m_wrapper.wrap([this](auto code) {
+					this->complete(code);
+				}));
+			}
+
+			void complete(SocketOperationCode code) {
+				// pop all coalesced requests before executing any user handler
+				std::vector<WriteCallback> callbacks;
+				for (auto i = 0u; i < m_numActiveRequests; ++i) {
+					callbacks.push_back(std::move(m_requests.front().second));
+					m_requests.pop_front();
+				}
+
+				m_numActiveRequests = 0;
+				for (const auto& callback : callbacks)
+					callback(code);
+
+				// if requests are pending, start the next batch
+				if (!m_requests.empty())
+					next();
+			}
+
+		private:
+			TCallbackWrapper& m_wrapper;
+			std::shared_ptr<BatchPacketWriter> m_pWriter;
+			size_t m_maxCoalescedWriteSize;
+			size_t m_numActiveRequests;
+			std::deque<std::pair<PacketPayload, WriteCallback>> m_requests;
+		};
+
+		// endregion
+
 		// region QueuedOperation
 
-		// protects RequestQueue via a strand
-		template<typename TRequest, typename TCallback>
+		// protects request queue via a strand
+		template<typename TRequest, typename TCallback, typename TRequestQueue>
 		class QueuedOperation {
 		public:
-			explicit QueuedOperation(boost::asio::io_context::strand& strand)
+			template<typename... TArgs>
+			explicit QueuedOperation(boost::asio::io_context::strand& strand, TArgs&&... args)
 					: m_strand(strand)
-					, m_requests(m_strand)
+					, m_requests(m_strand, std::forward<TArgs>(args)...)
 			{}
 
 		public:
@@ -150,38 +244,50 @@ namespace catapult { namespace ionet {
 
 		private:
 			boost::asio::io_context::strand& m_strand;
-			RequestQueue<TRequest, TCallback, boost::asio::io_context::strand> m_requests;
+			TRequestQueue m_requests;
 		};
 
-		using QueuedWriteOperation = QueuedOperation<WriteRequest, PacketIo::WriteCallback>;
-		using QueuedReadOperation = QueuedOperation<ReadRequest, PacketIo::ReadCallback>;
+		template<typename TRequest, typename TCallback>
+		using BasicQueuedOperation = QueuedOperation<
+			TRequest,
+			TCallback,
+			RequestQueue<TRequest, TCallback, boost::asio::io_context::strand>>;
+
+		using QueuedWriteOperation = BasicQueuedOperation<WriteRequest, PacketIo::WriteCallback>;
+		using QueuedCoalescingWriteOperation = QueuedOperation<
+			WriteRequest,
+			PacketIo::WriteCallback,
+			CoalescingWriteRequestQueue<boost::asio::io_context::strand>>;
+		using QueuedReadOperation = BasicQueuedOperation<ReadRequest, PacketIo::ReadCallback>;
 
 		// endregion
 
 		// region BufferedPacketIo
 
+		template<typename TWriteOperation>
 		class BufferedPacketIo
 				: public PacketIo
-				, public std::enable_shared_from_this<BufferedPacketIo> {
+				, public std::enable_shared_from_this<BufferedPacketIo<TWriteOperation>> {
 		public:
-			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand)
+			template<typename... TArgs>
+			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand, TArgs&&... writeArgs)
 					: m_pIo(pIo)
 					, m_strand(strand)
-					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand))
+					, m_pWriteOperation(std::make_unique<TWriteOperation>(m_strand, std::forward<TArgs>(writeArgs)...))
 					, m_pReadOperation(std::make_unique<QueuedReadOperation>(m_strand))
 			{}
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
 				auto request = WriteRequest(*m_pIo, payload);
-				m_pWriteOperation->push(request, [pThis = shared_from_this(), callback](auto code) {
+				m_pWriteOperation->push(request, [pThis = this->shared_from_this(), callback](auto code) {
 					callback(code);
 				});
 			}
 
 			void read(const ReadCallback& callback) override {
 				auto request = ReadRequest(*m_pIo);
-				m_pReadOperation->push(request, [pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+				m_pReadOperation->push(request, [pThis = this->shared_from_this(), callback](auto code, const auto* pPacket) {
 					callback(code, pPacket);
 				});
 			}
@@ -189,7 +295,7 @@ namespace catapult { namespace ionet {
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
 			boost::asio::io_context::strand& m_strand;
-			std::unique_ptr<QueuedWriteOperation> m_pWriteOperation;
+			std::unique_ptr<TWriteOperation> m_pWriteOperation;
 			std::unique_ptr<QueuedReadOperation> m_pReadOperation;
 		};
 
@@ -197,6 +303,14 @@ namespace catapult { namespace ionet {
 	}
 
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand) {
-		return std::make_shared<BufferedPacketIo>(pIo, strand);
+		return std::make_shared<BufferedPacketIo<QueuedWriteOperation>>(pIo, strand);
+	}
+
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<BatchPacketWriter>& pWriter,
+			boost::asio::io_context::strand& strand,
+			size_t maxCoalescedWriteSize) {
+		return std::make_shared<BufferedPacketIo<QueuedCoalescingWriteOperation>>(pIo, strand, pWriter, maxCoalescedWriteSize);
 	}
 }}
@@ -22,10 +22,23 @@
 #pragma once
 #include "IoTypes.h"
 
-namespace catapult { namespace ionet { class PacketIo; } }
+namespace catapult {
+	namespace ionet {
+		class BatchPacketWriter;
+		class PacketIo;
+	}
+}
 
 namespace catapult { namespace ionet {
 
 	/// Adds buffering to \a pIo using \a strand for synchronization.
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand);
+
+	/// Adds buffering to \a pIo using \a strand for synchronization.
+	/// Queued writes of up to \a maxCoalescedWriteSize bytes are coalesced and written with a single call to \a pWriter.
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<BatchPacketWriter>& pWriter,
+			boost::asio::io_context::strand& strand,
+			size_t maxCoalescedWriteSize);
 }}
@@ -20,6 +20,7 @@
 **/
 
 #include "PacketSocket.h"
+#include "BatchPacketWriter.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
 #include "WorkingBuffer.h"
@@ -177,64 +178,65 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
-					callback(SocketOperationCode::Malformed_Data);
+				write(std::vector<PacketPayload>{ payload }, callback);
+			}
+
+			void write(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback) {
+				for (const auto& payload : payloads) {
+					if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
+						CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+						callback(SocketOperationCode::Malformed_Data);
+						return;
+					}
+				}
+
+				if (payloads.empty()) {
+					callback(SocketOperationCode::Success);
 					return;
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				// write headers and data buffers of all payloads as a single buffer sequence
+				auto pContext = std::make_shared<WriteContext>(payloads, callback);
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
 		private:
 			struct WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
+				WriteContext(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback)
+						: m_payloads(payloads)
+						, m_callback(callback) {
+					size_t numBuffers = 0;
+					for (const auto& payload : m_payloads)
+						numBuffers += 1 + payload.buffers().size();
+
+					m_buffers.reserve(numBuffers);
+					for (const auto& payload : m_payloads) {
+						const auto& header = payload.header();
+						m_buffers.push_back(boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+
+						for (const auto& rawBuffer : payload.buffers())
+							m_buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
+					}
+				}
 
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+				const auto& buffers() const {
+					return m_buffers;
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
-				}
-
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
-
-					return false;
+				void complete(const boost::system::error_code& ec) {
+					m_callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}
 
 			private:
-				const PacketPayload m_payload;
+				const std::vector<PacketPayload> m_payloads;
 				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		private:
 			Socket& m_socket;
 			TSocketCallbackWrapper& m_wrapper;
@@ -494,9 +496,13 @@ namespace catapult { namespace ionet {
 			utils::StackTimer m_timer;
 		};
 
+		// maximum number of bytes of queued payloads that are coalesced into a single buffered write
+		constexpr size_t Max_Coalesced_Write_Size = 256 * 1024;
+
 		// implements PacketSocket using an explicit strand and ensures deterministic shutdown by using enable_shared_from_this
 		class StrandedPacketSocket final
 				: public PacketSocket
+				, public BatchPacketWriter
 				, public std::enable_shared_from_this<StrandedPacketSocket> {
 		private:
 			using SocketType = BasicPacketSocket<StrandedPacketSocket>;
@@ -505,6 +511,7 @@ namespace catapult { namespace ionet {
 			StrandedPacketSocket(const std::shared_ptr<SocketGuard>& pSocketGuard, const PacketSocketOptions& options)
 					: m_strandWrapper(pSocketGuard->strand())
 					, m_socket(pSocketGuard, options, *this)
+					, m_maxPacketDataSize(options.MaxPacketDataSize)
 					, m_id(s_idCounter.fetch_add(1))
 			{}
 
@@ -527,6 +534,14 @@ namespace catapult { namespace ionet {
 				post([payload, callback](auto& socket) { socket.write(payload, callback); });
 			}
 
+			bool isWritable(const PacketPayload& payload) const override {
+				return IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize);
+			}
+
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+				post([payloads, callback](auto& socket) { socket.write(payloads, callback); });
+			}
+
 			void read(const ReadCallback& callback) override {
 				post([callback](auto& socket) { socket.read(callback, false); });
 			}
@@ -556,7 +571,7 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return CreateBufferedPacketIo(shared_from_this(), strand());
+				return CreateBufferedPacketIo(shared_from_this(), shared_from_this(), strand(), Max_Coalesced_Write_Size);
 			}
 
 		public:
@@ -619,6 +634,7 @@ namespace catapult { namespace ionet {
 		private:
 			thread::StrandOwnerLifetimeExtender<StrandedPacketSocket> m_strandWrapper;
 			SocketType m_socket;
+			size_t m_maxPacketDataSize;
 			SocketIdentifier m_id;
 		};
 
@@ -670,12 +686,14 @@ namespace catapult { namespace ionet {
 					, m_acceptor(acceptor)
 					, m_accept(accept)
 					, m_options(options)
+					, m_acceptedSocket(m_ioContext)
 			{}
 
 		public:
 			void start() {
-				m_acceptor.async_accept([pThis = shared_from_this()](const auto& ec, auto&& socket) {
-					pThis->handleAccept(ec, std::move(socket));
+				// accept into a socket owned by m_ioContext, which is not necessarily the io context of the acceptor
+				m_acceptor.async_accept(m_acceptedSocket, [pThis = shared_from_this()](const auto& ec) {
+					pThis->handleAccept(ec, std::move(pThis->m_acceptedSocket));
 				});
 			}
 
@@ -736,6 +754,7 @@ namespace catapult { namespace ionet {
 			boost::asio::ip::tcp::acceptor& m_acceptor;
 			AcceptCallback m_accept;
 			PacketSocketOptions m_options;
+			NetworkSocket m_acceptedSocket;
 			std::string m_host;
 			std::shared_ptr<StrandedPacketSocket> m_pSocket;
 		};
@@ -113,6 +113,7 @@ namespace catapult { namespace ionet {
 	using AcceptCallback = consumer<const PacketSocketInfo&>;
 
 	/// Accepts a connection using \a ioContext and \a acceptor and calls \a accept on completion configuring the socket with \a options.
+	/// \note The accepted socket is owned by \a ioContext, which can be different from the io context of \a acceptor.
 	void Accept(
 			boost::asio::io_context& ioContext,
 			boost::asio::ip::tcp::acceptor& acceptor,
@@ -67,6 +67,9 @@ namespace catapult { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Unconfirmed transactions have been requested by a peer via short hash set reconciliation. */ \
+	ENUM_VALUE(Reconcile_Transactions, 13) \
+	\
 	/* partial transactions packets have types [0x100, 0x110) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -33,10 +33,41 @@
 #include "catapult/subscribers/UtChangeReader.h"
 #include "catapult/thread/Scheduler.h"
 #include "catapult/utils/StackLogger.h"
+#include <atomic>
+#include <sstream>
 
 namespace catapult { namespace local {
 
 	namespace {
+		// counters tracking the progress of a single spool queue
+		struct QueueCounters {
+			// number of messages pending when the queue was last polled
+			std::atomic<uint64_t> NumPendingMessages{ 0 };
+
+			// total number of consumed messages
+			std::atomic<uint64_t> NumConsumedMessages{ 0 };
+		};
+
+		thread::Task CreateCountersLoggingTask(const std::vector<utils::DiagnosticCounter>& counters) {
+			thread::Task task;
+			task.StartDelay = utils::TimeSpan::FromMinutes(1);
+			task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMinutes(1));
+			task.Name = "logging task";
+			task.Callback = [&counters]() {
+				std::ostringstream table;
+				table << "--- current broker counter values ---";
+				for (const auto& counter : counters) {
+					table.width(utils::DiagnosticCounterId::Max_Counter_Name_Size);
+					table << std::endl << counter.id().name() << " : " << counter.value();
+				}
+
+				CATAPULT_LOG(info) << table.str();
+				return thread::make_ready_future(thread::TaskResult::Continue);
+			};
+
+			return task;
+		}
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -63,6 +94,7 @@ namespace catapult { namespace local {
 
 				CATAPULT_LOG(debug) << "initializing cache";
 				m_catapultCache = m_pluginManager.createCache();
+				m_pluginManager.addDiagnosticCounters(m_counters, m_catapultCache);
 
 				utils::StackLogger stackLogger("booting broker", utils::LogLevel::info);
 				startIngestion();
@@ -75,40 +107,103 @@ namespace catapult { namespace local {
 				m_pBootstrapper->pool().shutdown();
 			}
 
+			const std::vector<utils::DiagnosticCounter>& counters() const override {
+				return m_counters;
+			}
+
 		private:
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
 				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
 				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("finalization", *m_pFinalizationSubscriber, ReadNextFinalization));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
-						auto& inputStream,
-						auto& subscriber) {
+				pScheduler->addTask(createBatchedIngestionTask(
+						"block_change",
+						"BLK CHG",
+						m_pBootstrapper->config().Node.MaxSpoolBlockChangeBatchSize,
+						*m_pBlockChangeSubscriber,
+						ReadNextBlockChange));
+				pScheduler->addTask(createIngestionTask(
+						"unconfirmed_transactions_change",
+						"UT CHG",
+						*m_pUtChangeSubscriber,
+						ReadNextUtChange));
+				pScheduler->addTask(createIngestionTask(
+						"partial_transactions_change",
+						"PT CHG",
+						*m_pPtChangeSubscriber,
+						ReadNextPtChange));
+				pScheduler->addTask(createIngestionTask("finalization", "FIN", *m_pFinalizationSubscriber, ReadNextFinalization));
+
+				auto readNextStateChange = [&catapultCache = m_catapultCache](auto& inputStream, auto& subscriber) {
 					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
-				}));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
+				};
+				pScheduler->addTask(createIngestionTask("state_change", "STATE", *m_pStateChangeSubscriber, readNextStateChange));
+				pScheduler->addTask(createIngestionTask(
+						"transaction_status",
+						"TX STAT",
+						*m_pTransactionStatusSubscriber,
+						ReadNextTransactionStatus));
+
+				pScheduler->addTask(CreateCountersLoggingTask(m_counters));
+			}
+
+			template<typename TSubscriber, typename TMessageReader>
+			thread::Task createIngestionTask(
+					const std::string& queueName,
+					const std::string& counterPrefix,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage) {
+				return createIngestionTask(queueName, counterPrefix, [&subscriber, readNextMessage](auto& reader) {
+					return subscribers::ReadAll(reader, subscriber, readNextMessage);
+				});
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
-			thread::Task createIngestionTask(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			thread::Task createBatchedIngestionTask(
+					const std::string& queueName,
+					const std::string& counterPrefix,
+					uint32_t maxBatchSize,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage) {
+				return createIngestionTask(queueName, counterPrefix, [maxBatchSize, &subscriber, readNextMessage](auto& reader) {
+					return subscribers::ReadAllBatched(reader, std::max<uint32_t>(1, maxBatchSize), subscriber, readNextMessage);
+				});
+			}
+
+			thread::Task createIngestionTask(
+					const std::string& queueName,
+					const std::string& counterPrefix,
+					const std::function<size_t (io::FileQueueReader&)>& readAll) {
+				auto& queueCounters = addQueueCounters(counterPrefix);
+				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
+
 				thread::Task task;
 				task.StartDelay = utils::TimeSpan::FromMilliseconds(100);
-				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
+				task.NextDelay = thread::CreateUniformDelayGenerator(m_pBootstrapper->config().Node.SpoolPollInterval);
 				task.Name = queueName;
-
-				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
+				task.Callback = [readAll, queuePath, &queueCounters]() {
+					io::FileQueueReader reader(queuePath, "index_broker_r.dat", "index.dat");
+					queueCounters.NumPendingMessages = reader.pending();
+					queueCounters.NumConsumedMessages += readAll(reader);
 					return thread::make_ready_future(thread::TaskResult::Continue);
 				};
 
 				return task;
 			}
 
+			QueueCounters& addQueueCounters(const std::string& counterPrefix) {
+				m_queueCounters.push_back(std::make_unique<QueueCounters>());
+				const auto& queueCounters = *m_queueCounters.back();
+				m_counters.emplace_back(utils::DiagnosticCounterId(counterPrefix + " LAG"), [&queueCounters]() {
+					return queueCounters.NumPendingMessages.load();
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId(counterPrefix + " MSGS"), [&queueCounters]() {
+					return queueCounters.NumConsumedMessages.load();
+				});
+				return *m_queueCounters.back();
+			}
+
 		private:
 			// make sure modules are unloaded last
 			std::vector<plugins::PluginModule> m_pluginModules;
@@ -126,6 +221,9 @@ namespace catapult { namespace local {
 			std::unique_ptr<subscribers::TransactionStatusSubscriber> m_pTransactionStatusSubscriber;
 
 			plugins::PluginManager& m_pluginManager;
+
+			std::vector<std::unique_ptr<QueueCounters>> m_queueCounters;
+			std::vector<utils::DiagnosticCounter> m_counters;
 		};
 	}
 
@@ -21,14 +21,21 @@
 
 #pragma once
 #include "catapult/local/ProcessHost.h"
+#include "catapult/utils/DiagnosticCounter.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace extensions { class ProcessBootstrapper; } }
 
 namespace catapult { namespace local {
 
 	/// Represents a broker.
-	class Broker : public ProcessHost {};
+	class Broker : public ProcessHost {
+	public:
+		/// Gets the broker counters.
+		/// \note Counters are only valid while the broker is alive.
+		virtual const std::vector<utils::DiagnosticCounter>& counters() const = 0;
+	};
 
 	/// Creates and boots a broker around the specified bootstrapper (\a pBootstrapper).
 	std::unique_ptr<Broker> CreateBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper);
@@ -21,6 +21,7 @@
 
 #include "ChainImporter.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/extensions/ConfigurationUtils.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
@@ -49,9 +50,11 @@ namespace catapult { namespace local {
 		std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeSubscriber(
 				subscribers::SubscriptionManager& subscriptionManager,
 				const cache::CatapultCache& catapultCache,
-				const config::CatapultDataDirectory& dataDirectory) {
+				const config::CatapultDataDirectory& dataDirectory,
+				io::FileQueueStorageMode spoolStorageMode) {
+			auto stateChangeDirectory = dataDirectory.spoolDir("state_change").str();
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
-					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
+					std::make_unique<io::FileQueueWriter>(stateChangeDirectory, "index_server.dat", spoolStorageMode),
 					[&catapultCache]() { return catapultCache.changesStorages(); }));
 			return subscriptionManager.createStateChangeSubscriber();
 		}
@@ -82,7 +85,8 @@ namespace catapult { namespace local {
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_catapultCache,
-							m_dataDirectory))
+							m_dataDirectory,
+							extensions::GetSpoolStorageMode(m_config.Node)))
 					, m_pluginManager(m_pBootstrapper->pluginManager())
 			{}
 
@@ -93,6 +97,7 @@ namespace catapult { namespace local {
 		public:
 			void boot() {
 				CATAPULT_LOG(info) << "registering system plugins";
+				m_pluginManager.setThreadPool(m_pBootstrapper->pool().pushIsolatedPool("plugins"));
 				m_pluginModules = LoadAllPlugins(*m_pBootstrapper);
 
 				CATAPULT_LOG(debug) << "initializing cache";
@@ -133,6 +138,10 @@ namespace catapult { namespace local {
 					m_pStateChangeSubscriber->notifyStateChange(loadedBlockStatus.StateChangeInfo);
 				});
 
+				// write out any blocks buffered by block change subscribers
+				if (m_pBlockChangeSubscriber)
+					m_pBlockChangeSubscriber->flush();
+
 				// fix up index
 				auto stateChangeDir = m_dataDirectory.spoolDir("state_change");
 				std::filesystem::copy(stateChangeDir.file("index_server.dat"), stateChangeDir.file("index.dat"));
@@ -153,9 +153,11 @@ namespace catapult { namespace local {
 		std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeSubscriber(
 				subscribers::SubscriptionManager& subscriptionManager,
 				const cache::CatapultCache& catapultCache,
-				const config::CatapultDataDirectory& dataDirectory) {
+				const config::CatapultDataDirectory& dataDirectory,
+				io::FileQueueStorageMode spoolStorageMode) {
+			auto stateChangeDirectory = dataDirectory.spoolDir("state_change").str();
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
-					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
+					std::make_unique<io::FileQueueWriter>(stateChangeDirectory, "index_server.dat", spoolStorageMode),
 					[&catapultCache]() { return catapultCache.changesStorages(); }));
 			subscriptionManager.addStateChangeSubscriber(std::make_unique<CommitImportanceFilesStateChangeSubscriber>(dataDirectory));
 			return subscriptionManager.createStateChangeSubscriber();
@@ -218,7 +220,8 @@ namespace catapult { namespace local {
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_catapultCache,
-							m_dataDirectory))
+							m_dataDirectory,
+							extensions::GetSpoolStorageMode(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pluginManager(m_pBootstrapper->pluginManager())
 					, m_isBooted(false) {
@@ -233,6 +236,7 @@ namespace catapult { namespace local {
 		public:
 			void boot() {
 				CATAPULT_LOG(info) << "registering system plugins";
+				m_pluginManager.setThreadPool(m_pBootstrapper->pool().pushIsolatedPool("plugins"));
 				m_pluginModules = LoadAllPlugins(*m_pBootstrapper);
 
 				CATAPULT_LOG(debug) << "initializing cache";
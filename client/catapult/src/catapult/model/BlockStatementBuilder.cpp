@@ -36,26 +36,54 @@ namespace catapult { namespace model {
 		m_activeSource = source;
 	}
 
+	namespace {
+		template<typename TResolutionStatements>
+		void TruncateResolutionStatements(TResolutionStatements& statements, uint32_t maxSourcePrimaryId) {
+			for (auto iter = statements.begin(); statements.end() != iter;) {
+				auto& statement = iter->second;
+
+				// entries are ordered by source, so only statements with a trailing entry above the max need to be truncated
+				auto numRetainedEntries = statement.size();
+				while (numRetainedEntries > 0 && statement.entryAt(numRetainedEntries - 1).Source.PrimaryId > maxSourcePrimaryId)
+					--numRetainedEntries;
+
+				if (0 == numRetainedEntries) {
+					iter = statements.erase(iter);
+					continue;
+				}
+
+				if (statement.size() != numRetainedEntries) {
+					typename TResolutionStatements::mapped_type truncatedStatement(iter->first);
+					for (auto i = 0u; i < numRetainedEntries; ++i)
+						truncatedStatement.addResolution(statement.entryAt(i).ResolvedValue, statement.entryAt(i).Source);
+
+					statement = std::move(truncatedStatement);
+				}
+
+				++iter;
+			}
+		}
+	}
+
 	void BlockStatementBuilder::popSource() {
 		if (0 == m_activeSource.PrimaryId)
 			return;
 
-		setSource({ m_activeSource.PrimaryId - 1, 0 });
-		auto pTruncatedStatement = std::make_unique<BlockStatement>();
-		DeepCopyTo(*pTruncatedStatement, *m_pStatement, m_activeSource.PrimaryId);
-		m_pStatement = std::move(pTruncatedStatement);
+		// truncate statements in place instead of copying all retained statements
+		auto poppedPrimaryId = m_activeSource.PrimaryId;
+		setSource({ poppedPrimaryId - 1, 0 });
+
+		auto& transactionStatements = m_pStatement->TransactionStatements;
+		transactionStatements.erase(transactionStatements.lower_bound({ poppedPrimaryId, 0 }), transactionStatements.end());
+
+		TruncateResolutionStatements(m_pStatement->AddressResolutionStatements, m_activeSource.PrimaryId);
+		TruncateResolutionStatements(m_pStatement->MosaicResolutionStatements, m_activeSource.PrimaryId);
 	}
 
 	void BlockStatementBuilder::addReceipt(const Receipt& receipt) {
+		// sources are usually increasing, so hint insertion at the end
 		auto& statements = m_pStatement->TransactionStatements;
-		auto iter = statements.find(m_activeSource);
-		if (statements.end() == iter) {
-			TransactionStatement statement(m_activeSource);
-			statement.addReceipt(receipt);
-			statements.emplace(m_activeSource, std::move(statement));
-			return;
-		}
-
+		auto iter = statements.try_emplace(statements.end(), m_activeSource, m_activeSource);
 		iter->second.addReceipt(receipt);
 	}
 
@@ -66,14 +94,7 @@ namespace catapult { namespace model {
 				const ReceiptSource& source,
 				const TUnresolved& unresolved,
 				const TResolved& resolved) {
-			auto iter = statements.find(unresolved);
-			if (statements.end() == iter) {
-				typename TResolutionStatements::value_type::second_type statement(unresolved);
-				statement.addResolution(resolved, source);
-				statements.emplace(unresolved, std::move(statement));
-				return;
-			}
-
+			auto iter = statements.try_emplace(unresolved, unresolved).first;
 			iter->second.addResolution(resolved, source);
 		}
 	}
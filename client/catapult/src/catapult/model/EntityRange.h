@@ -115,6 +115,8 @@ namespace catapult { namespace model {
 			SingleBufferRange(const uint8_t* pData, size_t dataSize, const std::vector<size_t>& offsets, uint8_t alignment)
 					: SubRange(CalculateTotalSize(dataSize, offsets, alignment))
 					, m_buffer(SubRange::totalSize()) {
+				SubRange::entities().reserve(offsets.size());
+
 				size_t totalPadding = 0;
 				for (auto i = 0u; i < offsets.size(); ++i) {
 					auto offset = offsets[i];
@@ -141,15 +143,14 @@ namespace catapult { namespace model {
 
 		public:
 			std::vector<std::shared_ptr<TEntity>> detachEntities() {
+				// moving the buffer preserves its data, so entity pointers remain valid
 				std::vector<std::shared_ptr<TEntity>> entities(SubRange::size());
-				auto offsets = generateOffsets();
 				auto pBufferShared = std::make_shared<decltype(m_buffer)>(std::move(m_buffer));
 
+				// all entities share ownership of the buffer, so no allocations are made per entity
 				size_t i = 0;
-				for (auto offset : offsets) {
-					auto pEntity = reinterpret_cast<TEntity*>(&(*pBufferShared)[offset]);
-					entities[i++] = std::shared_ptr<TEntity>(pEntity, [pBufferShared](const auto*) {});
-				}
+				for (auto* pEntity : SubRange::entities())
+					entities[i++] = std::shared_ptr<TEntity>(pBufferShared, pEntity);
 
 				return entities;
 			}
@@ -228,6 +229,7 @@ namespace catapult { namespace model {
 			explicit MultiBufferRange(std::vector<EntityRangeStorage>&& ranges)
 					: SubRange(CalculateTotalSize(ranges))
 					, m_ranges(std::move(ranges)) {
+				SubRange::entities().reserve(CalculateSize(m_ranges));
 				for (auto& range : m_ranges) {
 					for (auto* pEntity : range.subRange().entities())
 						SubRange::entities().push_back(pEntity);
@@ -253,6 +255,7 @@ namespace catapult { namespace model {
 		public:
 			MultiBufferRange copy() const {
 				std::vector<EntityRangeStorage> copyRanges;
+				copyRanges.reserve(m_ranges.size());
 				for (const auto& range : m_ranges)
 					copyRanges.push_back(range.copySubRange());
 
@@ -260,6 +263,14 @@ namespace catapult { namespace model {
 			}
 
 		private:
+			static size_t CalculateSize(const std::vector<EntityRangeStorage>& ranges) {
+				size_t size = 0;
+				for (const auto& range : ranges)
+					size += range.subRange().size();
+
+				return size;
+			}
+
 			static size_t CalculateTotalSize(const std::vector<EntityRangeStorage>& ranges) {
 				size_t totalSize = 0;
 				for (const auto& range : ranges)
@@ -42,23 +42,22 @@ namespace catapult { namespace model {
 		/// Creates an embedded transaction plugin around \a publishEmbeddedFunc.
 		template<typename TEmbeddedTransaction, typename TPublishEmbeddedFunc>
 		static std::unique_ptr<EmbeddedTransactionPlugin> CreateEmbedded(TPublishEmbeddedFunc publishEmbeddedFunc) {
-			return std::make_unique<EmbeddedTransactionPluginT<TEmbeddedTransaction>>(publishEmbeddedFunc);
+			return std::make_unique<EmbeddedTransactionPluginT<TEmbeddedTransaction, TPublishEmbeddedFunc>>(publishEmbeddedFunc);
 		}
 
 		/// Creates a transaction plugin that supports embedding around \a publishFunc and \a publishEmbeddedFunc.
 		template<typename TTransaction, typename TEmbeddedTransaction, typename TPublishFunc, typename TPublishEmbeddedFunc>
 		static std::unique_ptr<TransactionPlugin> Create(TPublishFunc publishFunc, TPublishEmbeddedFunc publishEmbeddedFunc) {
-			return std::make_unique<TransactionPluginT<TTransaction, TEmbeddedTransaction>>(publishFunc, publishEmbeddedFunc);
+			using PluginType = TransactionPluginT<TTransaction, TEmbeddedTransaction, TPublishFunc>;
+			return std::make_unique<PluginType>(publishFunc, publishEmbeddedFunc);
 		}
 
 	private:
-		template<typename TTransaction, typename TDerivedTransaction, typename TPlugin>
+		// publish function is stored by its concrete type so that it can be inlined into publishImpl
+		template<typename TTransaction, typename TDerivedTransaction, typename TPlugin, typename TPublishFunc>
 		class BasicTransactionPluginT : public TPlugin {
-		private:
-			using PublishFunc = consumer<const TDerivedTransaction&, const PublishContext&, NotificationSubscriber&>;
-
 		public:
-			explicit BasicTransactionPluginT(const PublishFunc& publishFunc) : m_publishFunc(publishFunc)
+			explicit BasicTransactionPluginT(const TPublishFunc& publishFunc) : m_publishFunc(publishFunc)
 			{}
 
 		public:
@@ -81,18 +80,23 @@ namespace catapult { namespace model {
 			}
 
 		private:
-			PublishFunc m_publishFunc;
+			TPublishFunc m_publishFunc;
 		};
 
-		template<typename TEmbeddedTransaction>
-		class EmbeddedTransactionPluginT
-				: public BasicTransactionPluginT<EmbeddedTransaction, TEmbeddedTransaction, EmbeddedTransactionPlugin> {
+		template<typename TEmbeddedTransaction, typename TPublishEmbeddedFunc>
+		using BasicEmbeddedTransactionPluginT = BasicTransactionPluginT<
+				EmbeddedTransaction,
+				TEmbeddedTransaction,
+				EmbeddedTransactionPlugin,
+				TPublishEmbeddedFunc>;
+
+		template<typename TEmbeddedTransaction, typename TPublishEmbeddedFunc>
+		class EmbeddedTransactionPluginT : public BasicEmbeddedTransactionPluginT<TEmbeddedTransaction, TPublishEmbeddedFunc> {
 		private:
-			using BaseType = BasicTransactionPluginT<EmbeddedTransaction, TEmbeddedTransaction, EmbeddedTransactionPlugin>;
+			using BaseType = BasicEmbeddedTransactionPluginT<TEmbeddedTransaction, TPublishEmbeddedFunc>;
 
 		public:
-			template<typename TPublishEmbeddedFunc>
-			explicit EmbeddedTransactionPluginT(TPublishEmbeddedFunc publishEmbeddedFunc) : BaseType(publishEmbeddedFunc)
+			explicit EmbeddedTransactionPluginT(const TPublishEmbeddedFunc& publishEmbeddedFunc) : BaseType(publishEmbeddedFunc)
 			{}
 
 		public:
@@ -116,14 +120,14 @@ namespace catapult { namespace model {
 			}
 		};
 
-		template<typename TTransaction, typename TEmbeddedTransaction>
-		class TransactionPluginT : public BasicTransactionPluginT<Transaction, TTransaction, TransactionPlugin> {
+		template<typename TTransaction, typename TEmbeddedTransaction, typename TPublishFunc>
+		class TransactionPluginT : public BasicTransactionPluginT<Transaction, TTransaction, TransactionPlugin, TPublishFunc> {
 		private:
-			using BaseType = BasicTransactionPluginT<Transaction, TTransaction, TransactionPlugin>;
+			using BaseType = BasicTransactionPluginT<Transaction, TTransaction, TransactionPlugin, TPublishFunc>;
 
 		public:
-			template<typename TPublishFunc, typename TPublishEmbeddedFunc>
-			TransactionPluginT(TPublishFunc publishFunc, TPublishEmbeddedFunc publishEmbeddedFunc)
+			template<typename TPublishEmbeddedFunc>
+			TransactionPluginT(const TPublishFunc& publishFunc, TPublishEmbeddedFunc publishEmbeddedFunc)
 					: BaseType(publishFunc)
 					, m_pEmbeddedTransactionPlugin(CreateEmbedded<TEmbeddedTransaction>(publishEmbeddedFunc))
 			{}
@@ -166,13 +170,19 @@ namespace catapult { namespace model {
 		};
 	};
 
+/// Wraps \a PUBLISH specialized for \a TRANSACTION_TYPE in a stateless functor so that it is bound at compile time.
+#define BIND_TRANSACTION_PUBLISHER(PUBLISH, TRANSACTION_TYPE) \
+	[](const TRANSACTION_TYPE& transaction, const PublishContext& context, NotificationSubscriber& sub) { \
+		PUBLISH<TRANSACTION_TYPE>(transaction, context, sub); \
+	}
+
 /// Defines a transaction plugin factory for \a NAME transaction with \a OPTIONS using \a PUBLISH.
 #define DEFINE_TRANSACTION_PLUGIN_FACTORY(NAME, OPTIONS, PUBLISH) \
 	std::unique_ptr<TransactionPlugin> Create##NAME##TransactionPlugin() { \
 		using Factory = TransactionPluginFactory<TransactionPluginFactoryOptions::OPTIONS>; \
 		return Factory::Create<NAME##Transaction, Embedded##NAME##Transaction>( \
-				PUBLISH<NAME##Transaction>, \
-				PUBLISH<Embedded##NAME##Transaction>); \
+				BIND_TRANSACTION_PUBLISHER(PUBLISH, NAME##Transaction), \
+				BIND_TRANSACTION_PUBLISHER(PUBLISH, Embedded##NAME##Transaction)); \
 	}
 
 /// Defines a transaction plugin factory for \a NAME transaction with \a OPTIONS using \a PUBLISH accepting \a CONFIG_TYPE configuration.
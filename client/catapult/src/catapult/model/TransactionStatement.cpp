@@ -21,7 +21,6 @@
 
 #include "TransactionStatement.h"
 #include "catapult/crypto/Hashes.h"
-#include "catapult/utils/MemoryUtils.h"
 
 namespace catapult { namespace model {
 
@@ -33,11 +32,15 @@ namespace catapult { namespace model {
 	}
 
 	size_t TransactionStatement::size() const {
-		return m_receipts.size();
+		return m_receiptOffsets.size();
 	}
 
 	const Receipt& TransactionStatement::receiptAt(size_t index) const {
-		return *m_receipts[index];
+		return reinterpret_cast<const Receipt&>(m_receiptsBuffer[m_receiptOffsets[index]]);
+	}
+
+	RawBuffer TransactionStatement::receipts() const {
+		return m_receiptsBuffer;
 	}
 
 	Hash256 TransactionStatement::hash() const {
@@ -51,11 +54,9 @@ namespace catapult { namespace model {
 		hashBuilder.update({ reinterpret_cast<const uint8_t*>(&m_source), sizeof(ReceiptSource) });
 
 		auto receiptHeaderSize = sizeof(Receipt::Size);
-		for (const auto& pReceipt : m_receipts) {
-			hashBuilder.update({
-				reinterpret_cast<const uint8_t*>(pReceipt.get()) + receiptHeaderSize,
-				pReceipt->Size - receiptHeaderSize
-			});
+		for (auto offset : m_receiptOffsets) {
+			const auto& receipt = reinterpret_cast<const Receipt&>(m_receiptsBuffer[offset]);
+			hashBuilder.update({ &m_receiptsBuffer[offset] + receiptHeaderSize, receipt.Size - receiptHeaderSize });
 		}
 
 		Hash256 hash;
@@ -64,15 +65,20 @@ namespace catapult { namespace model {
 	}
 
 	void TransactionStatement::addReceipt(const Receipt& receipt) {
-		// make a copy of the receipt
-		auto pReceiptCopy = utils::MakeUniqueWithSize<Receipt>(receipt.Size);
-		std::memcpy(static_cast<void*>(pReceiptCopy.get()), &receipt, receipt.Size);
+		// insertion sort by receipt type (scan from back because receipts are usually added in order)
+		auto index = m_receiptOffsets.size();
+		while (index > 0 && receiptAt(index - 1).Type > receipt.Type)
+			--index;
+
+		auto offset = m_receiptOffsets.size() == index ? m_receiptsBuffer.size() : m_receiptOffsets[index];
+		auto insertIter = m_receiptsBuffer.cbegin() + static_cast<std::ptrdiff_t>(offset);
+		const auto* pReceiptData = reinterpret_cast<const uint8_t*>(&receipt);
+		m_receiptsBuffer.insert(insertIter, pReceiptData, pReceiptData + receipt.Size);
 
-		// insertion sort by receipt type
-		auto iter = std::find_if(m_receipts.cbegin(), m_receipts.cend(), [&receipt](const auto& pReceipt) {
-			return pReceipt->Type > receipt.Type;
-		});
+		// shift offsets of all receipts following the inserted receipt
+		for (auto i = index; i < m_receiptOffsets.size(); ++i)
+			m_receiptOffsets[i] += receipt.Size;
 
-		m_receipts.insert(iter, std::move(pReceiptCopy));
+		m_receiptOffsets.insert(m_receiptOffsets.cbegin() + static_cast<std::ptrdiff_t>(index), offset);
 	}
 }}
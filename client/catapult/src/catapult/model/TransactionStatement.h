@@ -22,6 +22,8 @@
 #pragma once
 #include "Receipt.h"
 #include "ReceiptSource.h"
+#include "catapult/utils/RawBuffer.h"
+#include <vector>
 
 namespace catapult { namespace model {
 
@@ -41,6 +43,9 @@ namespace catapult { namespace model {
 		/// Gets the receipt at \a index.
 		const Receipt& receiptAt(size_t index) const;
 
+		/// Gets a buffer containing all attached receipts laid out contiguously in sorted order.
+		RawBuffer receipts() const;
+
 		/// Calculates a unique hash for this statement.
 		Hash256 hash() const;
 
@@ -50,6 +55,7 @@ namespace catapult { namespace model {
 
 	private:
 		ReceiptSource m_source;
-		std::vector<std::unique_ptr<Receipt>> m_receipts;
+		std::vector<uint8_t> m_receiptsBuffer;
+		std::vector<size_t> m_receiptOffsets;
 	};
 }}
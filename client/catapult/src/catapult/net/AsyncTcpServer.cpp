@@ -64,7 +64,8 @@ namespace catapult { namespace net {
 					thread::IoThreadPool& pool,
 					const boost::asio::ip::tcp::endpoint& endpoint,
 					const AsyncTcpServerSettings& settings)
-					: m_ioContext(pool.ioContext())
+					: m_pool(pool)
+					, m_ioContext(pool.ioContext())
 					, m_acceptorStrand(m_ioContext)
 					, m_acceptor(m_ioContext)
 					, m_settings(settings)
@@ -199,10 +200,12 @@ namespace catapult { namespace net {
 				auto acceptHandler = [pThis = shared_from_this()](const auto& socketInfo) {
 					pThis->handleAccept(socketInfo);
 				};
-				ionet::Accept(m_ioContext, m_acceptor, m_settings.PacketSocketOptions, acceptHandler);
+				// shard accepted connections across the io contexts of the pool
+				ionet::Accept(m_pool.nextIoContext(), m_acceptor, m_settings.PacketSocketOptions, acceptHandler);
 			}
 
 		private:
+			thread::IoThreadPool& m_pool;
 			boost::asio::io_context& m_ioContext;
 			boost::asio::io_context::strand m_acceptorStrand;
 			boost::asio::ip::tcp::acceptor m_acceptor;
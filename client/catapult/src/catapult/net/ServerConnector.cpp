@@ -41,7 +41,7 @@ namespace catapult { namespace net {
 					const Key& serverPublicKey,
 					const ConnectionSettings& settings,
 					const std::string& name)
-					: m_ioContext(pool.ioContext())
+					: m_pool(pool)
 					, m_serverPublicKey(serverPublicKey)
 					, m_settings(settings)
 					, m_name(name)
@@ -66,12 +66,14 @@ namespace catapult { namespace net {
 					return callback(PeerConnectCode::Self_Connection_Error, ionet::PacketSocketInfo());
 				}
 
-				auto pRequest = thread::MakeTimedCallback(m_ioContext, callback, PeerConnectCode::Timed_Out, ionet::PacketSocketInfo());
+				// shard outgoing connections across the io contexts of the pool
+				auto& ioContext = m_pool.nextIoContext();
+				auto pRequest = thread::MakeTimedCallback(ioContext, callback, PeerConnectCode::Timed_Out, ionet::PacketSocketInfo());
 				pRequest->setTimeout(m_settings.Timeout);
 
 				auto socketOptions = m_settings.toSocketOptions();
 				const auto& endpoint = node.endpoint();
-				auto cancel = ionet::Connect(m_ioContext, socketOptions, endpoint, [pThis = shared_from_this(), identityKey, pRequest](
+				auto cancel = ionet::Connect(ioContext, socketOptions, endpoint, [pThis = shared_from_this(), identityKey, pRequest](
 						auto result,
 						const auto& connectedSocketInfo) {
 					if (ionet::ConnectResult::Connected != result)
@@ -110,7 +112,7 @@ namespace catapult { namespace net {
 			}
 
 		private:
-			boost::asio::io_context& m_ioContext;
+			thread::IoThreadPool& m_pool;
 			Key m_serverPublicKey;
 			ConnectionSettings m_settings;
 
@@ -33,6 +33,7 @@ namespace catapult { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
 			, m_inflationConfig(inflationConfig)
+			, m_pThreadPool(nullptr)
 	{}
 
 	// region config
@@ -54,8 +55,11 @@ namespace catapult { namespace plugins {
 	}
 
 	cache::CacheConfiguration PluginManager::cacheConfig(const std::string& name) const {
-		if (!m_storageConfig.PreferCacheDatabase)
-			return cache::CacheConfiguration();
+		if (!m_storageConfig.PreferCacheDatabase) {
+			auto cacheConfig = cache::CacheConfiguration();
+			cacheConfig.ShouldPublishSnapshots = m_storageConfig.EnableCacheSnapshots;
+			return cacheConfig;
+		}
 
 		return cache::CacheConfiguration(
 				(std::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
@@ -65,6 +69,18 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region thread pool
+
+	void PluginManager::setThreadPool(thread::IoThreadPool* pPool) {
+		m_pThreadPool = pPool;
+	}
+
+	thread::IoThreadPool* PluginManager::threadPool() const {
+		return m_pThreadPool;
+	}
+
+	// endregion
+
 	// region transactions
 
 	void PluginManager::addTransactionSupport(std::unique_ptr<model::TransactionPlugin>&& pTransactionPlugin) {
@@ -35,6 +35,8 @@
 #include "catapult/validators/ValidatorTypes.h"
 #include "catapult/plugins.h"
 
+namespace catapult { namespace thread { class IoThreadPool; } }
+
 namespace catapult { namespace plugins {
 
 	/// Additional storage configuration.
@@ -44,6 +46,7 @@ namespace catapult { namespace plugins {
 		StorageConfiguration()
 				: PreferCacheDatabase(false)
 				, CacheDatabaseConfig() // default initialize
+				, EnableCacheSnapshots(false)
 		{}
 
 	public:
@@ -55,6 +58,9 @@ namespace catapult { namespace plugins {
 
 		/// Cache database configuration.
 		config::NodeConfiguration::CacheDatabaseSubConfiguration CacheDatabaseConfig;
+
+		/// \c true if caches that support snapshots should publish them when a cache database is not used.
+		bool EnableCacheSnapshots;
 	};
 
 	/// Manager for registering plugins.
@@ -110,6 +116,17 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region thread pool
+
+		/// Sets the thread pool (\a pPool) that plugins can use to parallelize work.
+		void setThreadPool(thread::IoThreadPool* pPool);
+
+		/// Gets the thread pool that plugins can use to parallelize work.
+		/// \note This is \c nullptr when plugins should not parallelize work.
+		thread::IoThreadPool* threadPool() const;
+
+		// endregion
+
 		// region transactions
 
 		/// Adds support for a transaction described by \a pTransactionPlugin.
@@ -225,6 +242,7 @@ namespace catapult { namespace plugins {
 		StorageConfiguration m_storageConfig;
 		config::UserConfiguration m_userConfig;
 		config::InflationConfiguration m_inflationConfig;
+		thread::IoThreadPool* m_pThreadPool;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
 
@@ -42,7 +42,7 @@ namespace catapult { namespace state {
 	template<typename TAccountPublicKey>
 	PUBLIC_KEY_ACCESSOR_T& PUBLIC_KEY_ACCESSOR_T::operator=(const PublicKeyAccessor& accessor) {
 		if (accessor.m_pKey)
-			m_pKey = std::make_shared<TAccountPublicKey>(*accessor.m_pKey);
+			m_pKey = std::make_unique<TAccountPublicKey>(*accessor.m_pKey);
 		else
 			m_pKey.reset();
 
@@ -67,7 +67,7 @@ namespace catapult { namespace state {
 		if (m_pKey)
 			CATAPULT_THROW_INVALID_ARGUMENT("must call unset before resetting key with value");
 
-		m_pKey = std::make_shared<TAccountPublicKey>(key);
+		m_pKey = std::make_unique<TAccountPublicKey>(key);
 	}
 
 	template<typename TAccountPublicKey>
@@ -95,7 +95,7 @@ namespace catapult { namespace state {
 	template<typename TPinnedAccountPublicKey>
 	PUBLIC_KEYS_ACCESSOR_T& PUBLIC_KEYS_ACCESSOR_T::operator=(const PublicKeysAccessor& accessor) {
 		if (accessor.m_pKeys)
-			m_pKeys = std::make_shared<std::vector<TPinnedAccountPublicKey>>(*accessor.m_pKeys);
+			m_pKeys = std::make_unique<std::vector<TPinnedAccountPublicKey>>(*accessor.m_pKeys);
 		else
 			m_pKeys.reset();
 
@@ -174,7 +174,7 @@ namespace catapult { namespace state {
 	template<typename TPinnedAccountPublicKey>
 	void PUBLIC_KEYS_ACCESSOR_T::add(const TPinnedAccountPublicKey& key) {
 		if (!m_pKeys)
-			m_pKeys = std::make_shared<std::vector<TPinnedAccountPublicKey>>();
+			m_pKeys = std::make_unique<std::vector<TPinnedAccountPublicKey>>();
 
 		EnsureNoOverlap(*m_pKeys, key);
 
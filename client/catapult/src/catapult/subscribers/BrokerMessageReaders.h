@@ -41,6 +41,12 @@ namespace catapult { namespace subscribers {
 				subscriber.flush();
 			}
 		};
+
+		template<typename TSubscriber, typename TMessageReader>
+		void ReadAllWithoutFlush(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			while (!inputStream.eof())
+				readNextMessage(inputStream, subscriber);
+		}
 	}
 
 	// endregion
@@ -48,21 +54,49 @@ namespace catapult { namespace subscribers {
 	/// Reads all messages from \a inputStream into \a subscriber using \a readNextMessage.
 	template<typename TSubscriber, typename TMessageReader>
 	void ReadAll(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		while (!inputStream.eof())
-			readNextMessage(inputStream, subscriber);
-
+		detail::ReadAllWithoutFlush(inputStream, subscriber, readNextMessage);
 		detail::Flusher<TSubscriber>::Flush(subscriber);
 	}
 
 	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
+	/// Returns the number of consumed messages.
 	template<typename TSubscriber, typename TMessageReader>
-	void ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		bool shouldContinue = true;
-		while (shouldContinue) {
-			shouldContinue = reader.tryReadNextMessage([&subscriber, readNextMessage](const auto& buffer) {
-				io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
-				ReadAll(inputStream, subscriber, readNextMessage);
-			});
+	size_t ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		auto processMessage = [&subscriber, readNextMessage](const auto& buffer) {
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+			ReadAll(inputStream, subscriber, readNextMessage);
+		};
+
+		size_t numMessages = 0;
+		while (reader.tryReadNextMessage(processMessage))
+			++numMessages;
+
+		return numMessages;
+	}
+
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage in batches of at most \a maxBatchSize messages.
+	/// \note \a subscriber is flushed once per batch and messages are only consumed after the flush,
+	///       so a batch that is interrupted before being flushed will be reprocessed.
+	///       Returns the number of consumed messages.
+	template<typename TSubscriber, typename TMessageReader>
+	size_t ReadAllBatched(io::FileQueueReader& reader, uint32_t maxBatchSize, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		auto processMessage = [&subscriber, readNextMessage](const auto& buffer) {
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+			detail::ReadAllWithoutFlush(inputStream, subscriber, readNextMessage);
+		};
+
+		size_t numConsumedMessages = 0;
+		while (true) {
+			auto numMessages = 0u;
+			while (numMessages < maxBatchSize && reader.tryPeekMessage(numMessages, processMessage))
+				++numMessages;
+
+			if (0 == numMessages)
+				return numConsumedMessages;
+
+			detail::Flusher<TSubscriber>::Flush(subscriber);
+			reader.skip(numMessages);
+			numConsumedMessages += numMessages;
 		}
 	}
 
@@ -79,15 +113,37 @@ namespace catapult { namespace subscribers {
 	};
 
 	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	/// Returns the number of consumed messages.
 	template<typename TSubscriber, typename TMessageReader>
-	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
+	size_t ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
 		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
 
 		auto numPendingMessages = reader.pending();
 		if (0 == numPendingMessages)
-			return;
+			return 0;
 
 		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
-		subscribers::ReadAll(reader, subscriber, readNextMessage);
+		return subscribers::ReadAll(reader, subscriber, readNextMessage);
+	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage
+	/// in batches of at most \a maxBatchSize messages.
+	/// Returns the number of consumed messages.
+	template<typename TSubscriber, typename TMessageReader>
+	size_t ReadAllBatched(
+			const MessageQueueDescriptor& descriptor,
+			uint32_t maxBatchSize,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage) {
+		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
+
+		auto numPendingMessages = reader.pending();
+		if (0 == numPendingMessages)
+			return 0;
+
+		CATAPULT_LOG(debug)
+				<< "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath
+				<< " in batches of at most " << maxBatchSize;
+		return subscribers::ReadAllBatched(reader, maxBatchSize, subscriber, readNextMessage);
 	}
 }}
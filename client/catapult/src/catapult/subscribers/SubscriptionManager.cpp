@@ -31,12 +31,26 @@
 #include "catapult/cache_tx/AggregateUtCache.h"
 #include "catapult/config/CatapultConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/ZstdPayloadCodec.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::shared_ptr<const io::PayloadCodec> CreateStoragePayloadCodec(const config::NodeConfiguration& config) {
+			if (!config.EnableStorageCompression)
+				return nullptr;
+
+			return io::CreateZstdPayloadCodec(static_cast<int>(config.StorageCompressionLevel));
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::CatapultConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory, m_config.Node.FileDatabaseBatchSize)) {
+			, m_pStorage(std::make_unique<io::FileBlockStorage>(
+					m_config.User.DataDirectory,
+					m_config.Node.FileDatabaseBatchSize,
+					io::FileBlockStorageMode::Hash_Index,
+					CreateStoragePayloadCodec(m_config.Node))) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
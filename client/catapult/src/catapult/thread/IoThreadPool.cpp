@@ -26,20 +26,29 @@
 #include "catapult/utils/Logging.h"
 #include "catapult/exceptions.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <thread>
 
 namespace catapult { namespace thread {
 
 	namespace {
+		using IoContexts = std::vector<std::unique_ptr<boost::asio::io_context>>;
+
 		// helper RAII class to simplify a restartable thread pool with limitless work
 		class ThreadPoolContext {
 		public:
-			explicit ThreadPoolContext(boost::asio::io_context& ioContext) : m_work(boost::asio::make_work_guard(ioContext)) {
-				ioContext.reset();
+			explicit ThreadPoolContext(const IoContexts& ioContexts) {
+				for (const auto& pIoContext : ioContexts) {
+					m_works.push_back(boost::asio::make_work_guard(*pIoContext));
+					pIoContext->restart();
+				}
 			}
 
 			~ThreadPoolContext() {
 				// destroy the work before waiting for the thread pool threads to stop
-				m_work.reset();
+				for (auto& work : m_works)
+					work.reset();
+
 				m_threads.join();
 			}
 
@@ -54,18 +63,28 @@ namespace catapult { namespace thread {
 			}
 
 		private:
-			boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_work;
+			std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_works;
 			ThreadGroup m_threads;
 		};
 
 		class DefaultIoThreadPool : public IoThreadPool {
 		public:
-			DefaultIoThreadPool(size_t numWorkerThreads, const std::string& name)
+			DefaultIoThreadPool(size_t numWorkerThreads, const std::string& name, const IoThreadPoolOptions& options)
 					: m_numConfiguredWorkerThreads(numWorkerThreads)
 					, m_name(name)
 					, m_tag(m_name.empty() ? std::string() : " (" + m_name + ")")
-					, m_numWorkerThreads(0)
-			{}
+					, m_options(options)
+					, m_nextIoContextIndex(0)
+					, m_numWorkerThreads(0) {
+				if (IoThreadPoolMode::Shared == m_options.Mode) {
+					m_ioContexts.push_back(std::make_unique<boost::asio::io_context>());
+					return;
+				}
+
+				// each io context is run by a single thread
+				for (auto i = 0u; i < std::max<size_t>(1, numWorkerThreads); ++i)
+					m_ioContexts.push_back(std::make_unique<boost::asio::io_context>(1));
+			}
 
 			~DefaultIoThreadPool() override {
 				join();
@@ -81,7 +100,15 @@ namespace catapult { namespace thread {
 			}
 
 			boost::asio::io_context& ioContext() override {
-				return m_ioContext;
+				if (1 == m_ioContexts.size())
+					return *m_ioContexts[0];
+
+				// distribute long-lived consumers (e.g. timers, acceptors, strands) across all workers
+				return *m_ioContexts[m_nextIoContextIndex++ % m_ioContexts.size()];
+			}
+
+			boost::asio::io_context& nextIoContext() override {
+				return ioContext();
 			}
 
 		public:
@@ -91,11 +118,14 @@ namespace catapult { namespace thread {
 
 				// spawn the number of configured threads
 				CATAPULT_LOG(trace) << "spawning threads" << m_tag;
-				m_pContext = std::make_unique<ThreadPoolContext>(m_ioContext);
+				m_pContext = std::make_unique<ThreadPoolContext>(m_ioContexts);
 				for (auto i = 0u; i < m_numConfiguredWorkerThreads; ++i) {
 					m_pContext->createThread([this, i]() {
 						thread::SetThreadName(std::to_string(i) + this->m_tag + " worker");
-						ioWorkerFunction();
+						if (m_options.PinWorkerThreads)
+							pinWorkerThread(i);
+
+						ioWorkerFunction(*m_ioContexts[i % m_ioContexts.size()]);
 					});
 				}
 
@@ -115,11 +145,17 @@ namespace catapult { namespace thread {
 			}
 
 		private:
-			void ioWorkerFunction() {
+			void pinWorkerThread(size_t workerId) {
+				auto numCpus = std::max<size_t>(1, std::thread::hardware_concurrency());
+				if (!SetThreadAffinity(workerId % numCpus))
+					CATAPULT_LOG(warning) << "unable to pin worker thread " << workerId << m_tag;
+			}
+
+			void ioWorkerFunction(boost::asio::io_context& ioContext) {
 				CATAPULT_LOG(trace) << "worker thread started" << m_tag;
 
 				auto incrementDecrementGuard = utils::MakeIncrementDecrementGuard(m_numWorkerThreads);
-				m_ioContext.run();
+				ioContext.run();
 
 				CATAPULT_LOG(trace) << "worker thread finished" << m_tag;
 			}
@@ -128,14 +164,20 @@ namespace catapult { namespace thread {
 			size_t m_numConfiguredWorkerThreads;
 			std::string m_name;
 			std::string m_tag;
+			IoThreadPoolOptions m_options;
 
-			boost::asio::io_context m_ioContext;
+			IoContexts m_ioContexts;
+			std::atomic<size_t> m_nextIoContextIndex;
 			std::unique_ptr<ThreadPoolContext> m_pContext;
 			std::atomic<uint32_t> m_numWorkerThreads;
 		};
 	}
 
 	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name) {
-		return std::make_unique<DefaultIoThreadPool>(numWorkerThreads, name ? std::string(name) : std::string());
+		return CreateIoThreadPool(numWorkerThreads, name, IoThreadPoolOptions());
+	}
+
+	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name, const IoThreadPoolOptions& options) {
+		return std::make_unique<DefaultIoThreadPool>(numWorkerThreads, name ? std::string(name) : std::string(), options);
 	}
 }}
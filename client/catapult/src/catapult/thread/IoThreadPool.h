@@ -27,7 +27,25 @@ namespace boost { namespace asio { class io_context; } }
 
 namespace catapult { namespace thread {
 
-	/// Represents a thread pool that shares a single io context across multiple threads.
+	/// Io thread pool modes.
+	enum class IoThreadPoolMode {
+		/// All worker threads share a single io context.
+		Shared,
+
+		/// Each worker thread runs its own io context.
+		Per_Worker
+	};
+
+	/// Io thread pool options.
+	struct IoThreadPoolOptions {
+		/// Pool mode.
+		IoThreadPoolMode Mode = IoThreadPoolMode::Shared;
+
+		/// \c true if each worker thread should be pinned to a single cpu.
+		bool PinWorkerThreads = false;
+	};
+
+	/// Represents a thread pool that runs one or more io contexts across multiple threads.
 	class IoThreadPool {
 	public:
 		virtual ~IoThreadPool() = default;
@@ -40,8 +58,14 @@ namespace catapult { namespace thread {
 		virtual const std::string& name() const = 0;
 
 		/// Gets the underlying io_context.
+		/// \note In per worker mode, worker io contexts are returned round-robin, so callers must retain the returned io context
+		///       when all of their work needs to be executed by the same worker thread.
 		virtual boost::asio::io_context& ioContext() = 0;
 
+		/// Gets the io_context that should host the next independent unit of work (e.g. a connection).
+		/// \note This is equivalent to ioContext() and shares its round-robin position in per worker mode.
+		virtual boost::asio::io_context& nextIoContext() = 0;
+
 	public:
 		/// Starts the thread pool.
 		/// \note All worker threads will be active when this function returns.
@@ -54,4 +78,7 @@ namespace catapult { namespace thread {
 	/// Creates an io thread pool with the specified number of threads (\a numWorkerThreads).
 	/// Optional friendly \a name can be provided to tag logs.
 	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name = nullptr);
+
+	/// Creates an io thread pool with the specified number of threads (\a numWorkerThreads), friendly \a name and \a options.
+	std::unique_ptr<IoThreadPool> CreateIoThreadPool(size_t numWorkerThreads, const char* name, const IoThreadPoolOptions& options);
 }}
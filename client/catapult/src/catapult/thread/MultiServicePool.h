@@ -122,11 +122,22 @@ namespace catapult { namespace thread {
 		/// isolated pool mode (\a isolatedPoolMode).
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
 		MultiServicePool(const std::string& name, size_t numWorkerThreads, IsolatedPoolMode isolatedPoolMode = IsolatedPoolMode::Enabled)
+				: MultiServicePool(name, numWorkerThreads, IoThreadPoolOptions(), isolatedPoolMode)
+		{}
+
+		/// Creates a pool with the specified number of threads (\a numWorkerThreads), \a name and primary pool options (\a poolOptions)
+		/// with optional isolated pool mode (\a isolatedPoolMode).
+		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
+		MultiServicePool(
+				const std::string& name,
+				size_t numWorkerThreads,
+				const IoThreadPoolOptions& poolOptions,
+				IsolatedPoolMode isolatedPoolMode = IsolatedPoolMode::Enabled)
 				: m_name(name)
 				, m_isolatedPoolMode(isolatedPoolMode)
 				, m_numTotalIsolatedPoolThreads(0)
 				, m_numServiceGroups(0)
-				, m_pPool(CreateThreadPool(numWorkerThreads, name))
+				, m_pPool(CreateThreadPool(numWorkerThreads, name, poolOptions))
 		{}
 
 		/// Destroys the pool.
@@ -188,6 +199,12 @@ namespace catapult { namespace thread {
 		/// Creates a new isolated thread pool with the specified number of threads (\a numWorkerThreads) and \a name.
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
 		thread::IoThreadPool* pushIsolatedPool(const std::string& name, size_t numWorkerThreads) {
+			return pushIsolatedPool(name, numWorkerThreads, IoThreadPoolOptions());
+		}
+
+		/// Creates a new isolated thread pool with the specified number of threads (\a numWorkerThreads), \a name and \a poolOptions.
+		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
+		thread::IoThreadPool* pushIsolatedPool(const std::string& name, size_t numWorkerThreads, const IoThreadPoolOptions& poolOptions) {
 			class PoolServiceAdapter {
 			public:
 				explicit PoolServiceAdapter(std::unique_ptr<thread::IoThreadPool>&& pPool) : m_pPool(std::move(pPool))
@@ -206,7 +223,7 @@ namespace catapult { namespace thread {
 			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode)
 				return m_pPool.get();
 
-			auto pPool = CreateThreadPool(numWorkerThreads, name);
+			auto pPool = CreateThreadPool(numWorkerThreads, name, poolOptions);
 			auto* pPoolRaw = pPool.get();
 
 			registerService(std::make_shared<PoolServiceAdapter>(std::move(pPool)), name + " (isolated pool)");
@@ -238,9 +255,12 @@ namespace catapult { namespace thread {
 		}
 
 	private:
-		static std::unique_ptr<thread::IoThreadPool> CreateThreadPool(size_t numWorkerThreads, const std::string& name) {
+		static std::unique_ptr<thread::IoThreadPool> CreateThreadPool(
+				size_t numWorkerThreads,
+				const std::string& name,
+				const IoThreadPoolOptions& poolOptions) {
 			numWorkerThreads = DefaultPoolConcurrency() == numWorkerThreads ? std::thread::hardware_concurrency() : numWorkerThreads;
-			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, name.c_str());
+			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, name.c_str(), poolOptions);
 			pPool->start();
 			return pPool;
 		}
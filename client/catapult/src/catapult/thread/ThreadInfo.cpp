@@ -26,6 +26,9 @@
 #else
 #include <errno.h>
 #include <pthread.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 #endif
 
 namespace catapult { namespace thread {
@@ -81,6 +84,22 @@ namespace catapult { namespace thread {
 #else
 		// musl libc (from alpine) defines __GNU_SOURCE__ but it only has pthread_setname_np
 		return std::string();
+#endif
+	}
+
+	bool SetThreadAffinity(size_t cpuId) {
+#ifdef __linux__
+		if (cpuId >= CPU_SETSIZE)
+			return false;
+
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(cpuId, &cpuSet);
+		return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+#else
+		// pinning is only supported on linux
+		static_cast<void>(cpuId);
+		return false;
 #endif
 	}
 }}
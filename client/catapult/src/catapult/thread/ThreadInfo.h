@@ -33,4 +33,8 @@ namespace catapult { namespace thread {
 
 	/// Gets a thread name in a platform-dependent way.
 	std::string GetThreadName();
+
+	/// Pins the current thread to the cpu with index \a cpuId in a platform-dependent way.
+	/// \note Returns \c false if the thread could not be pinned or pinning is not supported on this platform.
+	bool SetThreadAffinity(size_t cpuId);
 }}
@@ -0,0 +1,56 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <memory>
+
+namespace catapult { namespace utils {
+
+	/// Read-copy-update pointer to an immutable value.
+	/// \note Readers pin the current version without waiting for the writer and keep it alive for as long as it is pinned.
+	///       A version replaced by the writer is reclaimed when the last reader unpins it.
+	template<typename TValue>
+	class RcuPointer : public NonCopyable {
+	public:
+		/// Creates an empty pointer.
+		RcuPointer() = default;
+
+		/// Creates a pointer around initial version \a pValue.
+		explicit RcuPointer(std::shared_ptr<const TValue>&& pValue) : m_pValue(std::move(pValue))
+		{}
+
+	public:
+		/// Pins the current version.
+		/// \note Returned version is never modified and is not affected by subsequent publishes.
+		std::shared_ptr<const TValue> pin() const {
+			return std::atomic_load(&m_pValue);
+		}
+
+		/// Publishes \a pValue as the current version.
+		void publish(std::shared_ptr<const TValue>&& pValue) {
+			std::atomic_store(&m_pValue, std::move(pValue));
+		}
+
+	private:
+		std::shared_ptr<const TValue> m_pValue;
+	};
+}}
@@ -0,0 +1,153 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashIblt.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		uint64_t Mix(ShortHash shortHash, size_t seed) {
+			// splitmix64 finalizer, which is sufficient because short hashes are already derived from cryptographic hashes
+			auto value = static_cast<uint64_t>(shortHash.unwrap()) | (static_cast<uint64_t>(seed + 1) << 32);
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+			return value ^ (value >> 31);
+		}
+
+		uint32_t CalculateCheck(ShortHash shortHash) {
+			return static_cast<uint32_t>(Mix(shortHash, ShortHashIblt::Num_Hashes));
+		}
+
+		size_t CalculateCellIndex(ShortHash shortHash, size_t hashIndex, size_t numCells) {
+			// each hash function maps into its own partition so that every short hash touches Num_Hashes distinct cells
+			auto partitionSize = numCells / ShortHashIblt::Num_Hashes;
+			return hashIndex * partitionSize + static_cast<size_t>(Mix(shortHash, hashIndex) % partitionSize);
+		}
+
+		bool IsMappedToCell(ShortHash shortHash, size_t index, size_t numCells) {
+			for (auto i = 0u; i < ShortHashIblt::Num_Hashes; ++i) {
+				if (index == CalculateCellIndex(shortHash, i, numCells))
+					return true;
+			}
+
+			return false;
+		}
+
+		void Update(std::vector<ShortHashIblt::Cell>& cells, ShortHash shortHash, int32_t delta) {
+			auto check = CalculateCheck(shortHash);
+			for (auto i = 0u; i < ShortHashIblt::Num_Hashes; ++i) {
+				auto& cell = cells[CalculateCellIndex(shortHash, i, cells.size())];
+				cell.Count += delta;
+				cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ shortHash.unwrap());
+				cell.CheckSum ^= check;
+			}
+		}
+
+		bool IsPure(const ShortHashIblt::Cell& cell) {
+			return (1 == cell.Count || -1 == cell.Count) && CalculateCheck(cell.KeySum) == cell.CheckSum;
+		}
+
+		bool IsEmpty(const ShortHashIblt::Cell& cell) {
+			return 0 == cell.Count && ShortHash() == cell.KeySum && 0 == cell.CheckSum;
+		}
+	}
+
+	ShortHashIblt::ShortHashIblt(size_t numCells)
+			: m_cells(std::max<size_t>(1, (numCells + Num_Hashes - 1) / Num_Hashes) * Num_Hashes, Cell())
+	{}
+
+	ShortHashIblt::ShortHashIblt(const Cell* pCells, size_t numCells) : m_cells(pCells, pCells + numCells) {
+		if (0 == numCells || 0 != numCells % Num_Hashes)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("number of cells must be a nonzero multiple of number of hashes", numCells);
+	}
+
+	size_t ShortHashIblt::size() const {
+		return m_cells.size();
+	}
+
+	const ShortHashIblt::Cell* ShortHashIblt::data() const {
+		return m_cells.data();
+	}
+
+	void ShortHashIblt::insert(const ShortHash& shortHash) {
+		Update(m_cells, shortHash, 1);
+	}
+
+	void ShortHashIblt::subtract(const ShortHashIblt& other) {
+		if (m_cells.size() != other.m_cells.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_2("cannot subtract tables with different sizes", m_cells.size(), other.m_cells.size());
+
+		for (auto i = 0u; i < m_cells.size(); ++i) {
+			auto& cell = m_cells[i];
+			const auto& otherCell = other.m_cells[i];
+			cell.Count -= otherCell.Count;
+			cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ otherCell.KeySum.unwrap());
+			cell.CheckSum ^= otherCell.CheckSum;
+		}
+	}
+
+	ShortHashIblt::DecodeResult ShortHashIblt::decode() const {
+		auto cells = m_cells;
+		std::vector<size_t> pureIndexes;
+		for (auto i = 0u; i < cells.size(); ++i) {
+			if (IsPure(cells[i]))
+				pureIndexes.push_back(i);
+		}
+
+		// repeatedly peel pure cells, which might expose new pure cells
+		// (tables can be supplied by remote peers, so stop when a table could not have been produced by inserting short hashes)
+		DecodeResult result;
+		auto numPeeledShortHashes = 0u;
+		while (!pureIndexes.empty()) {
+			auto index = pureIndexes.back();
+			pureIndexes.pop_back();
+
+			const auto& cell = cells[index];
+			if (!IsPure(cell))
+				continue;
+
+			auto shortHash = cell.KeySum;
+			if (!IsMappedToCell(shortHash, index, cells.size()))
+				return DecodeResult();
+
+			// in a valid table, each short hash is peeled at most once and each peel empties at least one cell
+			if (result.Positive.count(shortHash) || result.Negative.count(shortHash) || cells.size() == numPeeledShortHashes)
+				return DecodeResult();
+
+			auto count = cell.Count;
+			auto& shortHashes = 1 == count ? result.Positive : result.Negative;
+			shortHashes.insert(shortHash);
+			Update(cells, shortHash, -count);
+			++numPeeledShortHashes;
+
+			for (auto i = 0u; i < Num_Hashes; ++i) {
+				auto cellIndex = CalculateCellIndex(shortHash, i, cells.size());
+				if (IsPure(cells[cellIndex]))
+					pureIndexes.push_back(cellIndex);
+			}
+		}
+
+		result.IsDecoded = std::all_of(cells.cbegin(), cells.cend(), IsEmpty);
+		return result;
+	}
+}}
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Invertible bloom lookup table over short hashes.
+	/// \note Subtracting two tables produces a table that encodes only their set difference, so the difference can be recovered
+	///       from a table sized proportionally to the (expected) difference instead of to the sets themselves.
+	class ShortHashIblt {
+	public:
+		/// Number of cells each short hash is mapped to.
+		static constexpr size_t Num_Hashes = 3;
+
+#pragma pack(push, 1)
+
+		/// Table cell.
+		struct Cell {
+			/// Signed number of short hashes mapped to this cell.
+			int32_t Count;
+
+			/// Xor of all short hashes mapped to this cell.
+			ShortHash KeySum;
+
+			/// Xor of the check values of all short hashes mapped to this cell.
+			uint32_t CheckSum;
+		};
+
+#pragma pack(pop)
+
+		/// Result of decoding a table.
+		struct DecodeResult {
+			/// \c true if the table was fully decoded.
+			bool IsDecoded = false;
+
+			/// Short hashes only present in the minuend.
+			ShortHashesSet Positive;
+
+			/// Short hashes only present in the subtrahend.
+			ShortHashesSet Negative;
+		};
+
+	public:
+		/// Creates an empty table with (at least) \a numCells cells.
+		/// \note Number of cells is rounded up to a nonzero multiple of Num_Hashes.
+		explicit ShortHashIblt(size_t numCells);
+
+		/// Creates a table around \a numCells cells pointed to by \a pCells.
+		/// \note \a numCells must be a nonzero multiple of Num_Hashes.
+		ShortHashIblt(const Cell* pCells, size_t numCells);
+
+	public:
+		/// Gets the number of cells.
+		size_t size() const;
+
+		/// Gets a const pointer to the cells.
+		const Cell* data() const;
+
+	public:
+		/// Inserts \a shortHash into the table.
+		void insert(const ShortHash& shortHash);
+
+		/// Subtracts \a other from this table.
+		/// \note Both tables must have the same number of cells.
+		void subtract(const ShortHashIblt& other);
+
+		/// Decodes the set difference encoded in this table.
+		/// \note Decoding fails (without peeling indefinitely) when the table could not have been produced by inserting short hashes.
+		DecodeResult decode() const;
+
+	private:
+		std::vector<Cell> m_cells;
+	};
+}}
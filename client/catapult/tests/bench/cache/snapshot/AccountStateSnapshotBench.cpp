@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateSnapshot.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Currency_Mosaic_Id = MosaicId(1111);
+
+		AccountStateCacheTypes::Options CreateAccountStateCacheOptions() {
+			auto options = AccountStateCacheTypes::Options();
+			options.NetworkIdentifier = model::NetworkIdentifier::Testnet;
+			options.ImportanceGrouping = 1;
+			options.VotingSetGrouping = 1;
+			options.MinHarvesterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			options.MaxHarvesterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			options.MinVoterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			options.CurrencyMosaicId = Currency_Mosaic_Id;
+			options.HarvestingMosaicId = MosaicId(2222);
+			return options;
+		}
+
+		std::vector<Address> SeedAccounts(AccountStateCache& cache, AccountStateSnapshotBuilder& builder, size_t numAccounts) {
+			std::vector<Address> addresses(numAccounts);
+			auto delta = cache.createDelta();
+			for (auto& address : addresses) {
+				bench::FillWithRandomData(address);
+				delta->addAccount(address, Height(1));
+			}
+
+			builder.update(*delta);
+			cache.commit();
+			builder.build(Height(1));
+			return addresses;
+		}
+
+		void BenchmarkCommit(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			auto numModifiedAccounts = static_cast<size_t>(state.range(1));
+
+			auto options = CreateAccountStateCacheOptions();
+			AccountStateCache cache(CacheConfiguration(), options);
+			AccountStateSnapshotBuilder builder(options);
+			auto addresses = SeedAccounts(cache, builder, numAccounts);
+
+			// keep the previous snapshot alive, like a reader would, so that changed shards must be copied
+			auto pSnapshot = builder.build(Height(1));
+			auto height = Height(1);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto delta = cache.createDelta();
+				for (auto i = 0u; i < numModifiedAccounts; ++i)
+					delta->find(addresses[bench::Random() % numAccounts]).get().Balances.credit(Currency_Mosaic_Id, Amount(1));
+
+				state.ResumeTiming();
+
+				// only measure the snapshot specific commit cost
+				builder.update(*delta);
+				height = height + Height(1);
+				pSnapshot = builder.build(height);
+
+				state.PauseTiming();
+				cache.commit();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numModifiedAccounts * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	for (auto numAccounts : { 100'000, 1'000'000 }) {
+		benchmark::RegisterBenchmark("BenchmarkCommit", catapult::cache::BenchmarkCommit)
+				->Unit(benchmark::kMicrosecond)
+				->ArgNames({ "accounts", "modified" })
+				->Args({ numAccounts, 10 })
+				->Args({ numAccounts, 1'000 });
+	}
+}
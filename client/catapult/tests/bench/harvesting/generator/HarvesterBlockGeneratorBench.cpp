@@ -0,0 +1,262 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "extensions/harvesting/src/HarvesterBlockGenerator.h"
+#include "extensions/harvesting/src/HarvestingUtFacadeFactory.h"
+#include "plugins/coresystem/src/plugins/VrfKeyLinkTransactionPlugin.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "catapult/cache_core/BlockStatisticCacheSubCachePlugin.h"
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/chain/ExecutionConfiguration.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/TransactionPlugin.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace harvesting {
+
+	namespace {
+		constexpr auto Cache_Height = Height(1);
+		constexpr auto Bench_Notification_Type = static_cast<model::NotificationType>(std::numeric_limits<uint32_t>::max());
+
+		// region bench execution configuration
+
+		// each entity raises a single notification containing its hash
+		struct BenchNotification : public model::Notification {
+		public:
+			explicit BenchNotification(const Hash256& hash)
+					: Notification(Bench_Notification_Type, sizeof(BenchNotification))
+					, Hash(hash)
+			{}
+
+		public:
+			Hash256 Hash;
+		};
+
+		class BenchNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				subscriber.notify(BenchNotification(entityInfo.hash()));
+			}
+		};
+
+		// rejects (approximately) \a rejectionPercentage percent of all transactions based on their hashes
+		class BenchValidator : public validators::stateful::AggregateNotificationValidator {
+		public:
+			explicit BenchValidator(uint8_t rejectionPercentage)
+					: m_name("BenchValidator")
+					, m_rejectionPercentage(rejectionPercentage)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { m_name };
+			}
+
+			validators::ValidationResult validate(
+					const model::Notification& notification,
+					const validators::ValidatorContext&) const override {
+				if (Bench_Notification_Type != notification.Type)
+					return validators::ValidationResult::Success;
+
+				const auto& hash = static_cast<const BenchNotification&>(notification).Hash;
+				return Hash256() != hash && hash[0] % 100 < m_rejectionPercentage
+						? validators::ValidationResult::Failure
+						: validators::ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			uint8_t m_rejectionPercentage;
+		};
+
+		class BenchObserver : public observers::AggregateNotificationObserver {
+		public:
+			BenchObserver() : m_name("BenchObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { m_name };
+			}
+
+			void notify(const model::Notification&, observers::ObserverContext&) const override
+			{}
+
+		private:
+			std::string m_name;
+		};
+
+		chain::ExecutionConfiguration CreateExecutionConfiguration(uint8_t rejectionPercentage) {
+			chain::ExecutionConfiguration executionConfig;
+			executionConfig.Network.Identifier = model::NetworkIdentifier::Testnet;
+			executionConfig.pObserver = std::make_shared<BenchObserver>();
+			executionConfig.pValidator = std::make_shared<BenchValidator>(rejectionPercentage);
+			executionConfig.pNotificationPublisher = std::make_shared<BenchNotificationPublisher>();
+			executionConfig.ResolverContextFactory = [](const auto&) { return model::ResolverContext(); };
+			return executionConfig;
+		}
+
+		// endregion
+
+		// region BenchContext
+
+		class BenchContext {
+		public:
+			BenchContext(size_t numTransactions, uint8_t rejectionPercentage)
+					: m_config(CreateBlockchainConfiguration())
+					, m_cache(CreateSubCaches(m_config))
+					, m_utFacadeFactory(
+							m_cache,
+							m_config,
+							CreateExecutionConfiguration(rejectionPercentage),
+							[](auto) { return Hash256(); })
+					, m_utCache(cache::MemoryCacheOptions(utils::FileSize::FromMegabytes(10), utils::FileSize::FromMegabytes(100))) {
+				m_transactionRegistry.registerPlugin(plugins::CreateVrfKeyLinkTransactionPlugin());
+				m_speculativeGenerator = CreateSpeculativeHarvesterBlockGenerator(
+						model::TransactionSelectionStrategy::Oldest,
+						m_transactionRegistry,
+						m_utFacadeFactory,
+						m_utCache);
+
+				seedUtCache(numTransactions);
+
+				auto cacheDelta = m_cache.createDelta();
+				m_cache.commit(Cache_Height);
+			}
+
+		public:
+			void prepare(uint32_t maxTransactionsPerBlock) {
+				m_speculativeGenerator.Preparer(Cache_Height + Height(1), Timestamp(), maxTransactionsPerBlock);
+			}
+
+			std::unique_ptr<model::Block> generate(uint32_t maxTransactionsPerBlock) {
+				model::BlockHeader blockHeader;
+				std::memset(static_cast<void*>(&blockHeader), 0, sizeof(model::BlockHeader));
+				blockHeader.Type = model::Entity_Type_Block_Normal;
+				blockHeader.Height = Cache_Height + Height(1);
+				return m_speculativeGenerator.Generator(blockHeader, maxTransactionsPerBlock);
+			}
+
+		private:
+			void seedUtCache(size_t numTransactions) {
+				auto modifier = m_utCache.modifier();
+				for (auto i = 0u; i < numTransactions; ++i) {
+					auto pTransaction = std::make_shared<model::Transaction>();
+					std::memset(static_cast<void*>(pTransaction.get()), 0, sizeof(model::Transaction));
+					pTransaction->Size = sizeof(model::Transaction);
+					pTransaction->Type = model::Entity_Type_Vrf_Key_Link;
+					pTransaction->Deadline = Timestamp(i + 1);
+					bench::FillWithRandomData(pTransaction->SignerPublicKey);
+
+					Hash256 hash;
+					bench::FillWithRandomData(hash);
+					modifier.add(model::TransactionInfo(std::move(pTransaction), hash));
+				}
+			}
+
+		private:
+			static model::BlockchainConfiguration CreateBlockchainConfiguration() {
+				auto config = model::BlockchainConfiguration::Uninitialized();
+				config.ImportanceGrouping = 1;
+				config.VotingSetGrouping = 1;
+				config.MaxDifficultyBlocks = 60;
+				return config;
+			}
+
+			static std::vector<std::unique_ptr<cache::SubCachePlugin>> CreateSubCaches(const model::BlockchainConfiguration& config) {
+				auto options = cache::AccountStateCacheTypes::Options();
+				options.NetworkIdentifier = model::NetworkIdentifier::Testnet;
+				options.ImportanceGrouping = config.ImportanceGrouping;
+				options.VotingSetGrouping = config.VotingSetGrouping;
+				options.MinHarvesterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+				options.MaxHarvesterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+				options.MinVoterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+
+				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(2);
+				subCaches[cache::AccountStateCache::Id] = std::make_unique<cache::AccountStateCacheSubCachePlugin>(
+						cache::CacheConfiguration(),
+						options);
+				subCaches[cache::BlockStatisticCache::Id] = std::make_unique<cache::BlockStatisticCacheSubCachePlugin>(
+						config.MaxDifficultyBlocks);
+				return subCaches;
+			}
+
+		private:
+			model::BlockchainConfiguration m_config;
+			cache::CatapultCache m_cache;
+			model::TransactionRegistry m_transactionRegistry;
+			HarvestingUtFacadeFactory m_utFacadeFactory;
+			cache::MemoryUtCache m_utCache;
+			SpeculativeBlockGenerator m_speculativeGenerator;
+		};
+
+		// endregion
+
+		void BenchmarkGenerate(benchmark::State& state) {
+			auto numTransactions = static_cast<uint32_t>(state.range(0));
+			auto rejectionPercentage = static_cast<uint8_t>(state.range(1));
+			auto isPrepared = 0 != state.range(2);
+
+			BenchContext context(numTransactions, rejectionPercentage);
+			size_t numBlockTransactions = 0;
+			for (auto _ : state) {
+				// only block generation is timed because preparation happens between harvest attempts
+				if (isPrepared) {
+					state.PauseTiming();
+					context.prepare(numTransactions);
+					state.ResumeTiming();
+				}
+
+				auto pBlock = context.generate(numTransactions);
+				if (!pBlock)
+					state.SkipWithError("block generation failed");
+
+				numBlockTransactions = model::CalculateBlockTransactionsInfo(*pBlock).Count;
+			}
+
+			state.counters["block_txes"] = static_cast<double>(numBlockTransactions);
+			state.SetItemsProcessed(static_cast<int64_t>(numTransactions * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	for (auto rejectionPercentage : { 0, 50, 90 }) {
+		benchmark::RegisterBenchmark("BenchmarkGenerate", catapult::harvesting::BenchmarkGenerate)
+				->Unit(benchmark::kMicrosecond)
+				->ArgNames({ "txes", "rejected%", "prepared" })
+				->Args({ 1'000, rejectionPercentage, 0 })
+				->Args({ 1'000, rejectionPercentage, 1 });
+	}
+}
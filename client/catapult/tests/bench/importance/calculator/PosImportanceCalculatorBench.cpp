@@ -0,0 +1,114 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "plugins/coresystem/src/importance/ImportanceCalculator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/BlockchainConfiguration.h"
+#include "catapult/state/AccountActivityBuckets.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+namespace catapult { namespace importance {
+
+	namespace {
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(9876);
+		constexpr auto Min_Harvester_Balance = Amount(10'000'000'000);
+
+		model::BlockchainConfiguration CreateBlockchainConfiguration() {
+			auto config = model::BlockchainConfiguration::Uninitialized();
+			config.HarvestingMosaicId = Harvesting_Mosaic_Id;
+			config.ImportanceGrouping = 1;
+			config.TotalChainImportance = Importance(7'842'928'625'000'000);
+			config.ImportanceActivityPercentage = 5;
+			config.MinHarvesterBalance = Min_Harvester_Balance;
+			return config;
+		}
+
+		cache::AccountStateCacheTypes::Options CreateAccountStateCacheOptions(const model::BlockchainConfiguration& config) {
+			auto options = cache::AccountStateCacheTypes::Options();
+			options.NetworkIdentifier = model::NetworkIdentifier::Testnet;
+			options.ImportanceGrouping = config.ImportanceGrouping;
+			options.VotingSetGrouping = 1;
+			options.MinHarvesterBalance = config.MinHarvesterBalance;
+			options.MaxHarvesterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			options.MinVoterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			options.CurrencyMosaicId = MosaicId(1111);
+			options.HarvestingMosaicId = config.HarvestingMosaicId;
+			return options;
+		}
+
+		void SeedAccounts(cache::AccountStateCacheDelta& delta, size_t numAccounts) {
+			for (auto i = 0u; i < numAccounts; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+				delta.addAccount(address, Height(1));
+
+				auto& accountState = delta.find(address).get();
+				accountState.Balances.credit(Harvesting_Mosaic_Id, Min_Harvester_Balance + Amount(bench::Random() % 1'000'000'000));
+				accountState.ActivityBuckets.update(model::ImportanceHeight(1), [](auto& bucket) {
+					bucket.TotalFeesPaid = Amount(bench::Random() % 1'000'000);
+					bucket.BeneficiaryCount = static_cast<uint32_t>(bench::Random() % 100);
+				});
+			}
+
+			delta.updateHighValueAccounts(Height(1));
+		}
+
+		void BenchmarkRecalculate(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+
+			auto config = CreateBlockchainConfiguration();
+			cache::AccountStateCache cache(cache::CacheConfiguration(), CreateAccountStateCacheOptions(config));
+			auto delta = cache.createDelta();
+			SeedAccounts(*delta, numAccounts);
+
+			auto pPool = thread::CreateIoThreadPool(std::max(1u, std::thread::hardware_concurrency()), "importance");
+			pPool->start();
+
+			auto pCalculator = 0 == state.range(1)
+					? CreateImportanceCalculator(config)
+					: CreateImportanceCalculator(config, *pPool);
+			auto importanceHeight = model::ImportanceHeight(1);
+			for (auto _ : state) {
+				importanceHeight = importanceHeight + model::ImportanceHeight(1);
+				pCalculator->recalculate(ImportanceRollbackMode::Disabled, importanceHeight, *delta);
+			}
+
+			pPool->join();
+
+			state.counters["threads"] = static_cast<double>(0 == state.range(1) ? 1 : pPool->numWorkerThreads());
+			state.SetItemsProcessed(static_cast<int64_t>(numAccounts * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	for (auto numAccounts : { 10'000, 100'000, 1'000'000 }) {
+		benchmark::RegisterBenchmark("BenchmarkRecalculate", catapult::importance::BenchmarkRecalculate)
+				->Unit(benchmark::kMillisecond)
+				->ArgNames({ "accounts", "parallel" })
+				->Args({ numAccounts, 0 })
+				->Args({ numAccounts, 1 });
+	}
+}
@@ -0,0 +1,244 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/BlockElementSerializer.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/ZstdPayloadCodec.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Num_Blocks = 1000u;
+		constexpr auto Num_Transactions_Per_Block = 50u;
+		constexpr auto Transaction_Size = 176u;
+		constexpr auto Num_Dictionary_Samples = 100u;
+		constexpr auto Dictionary_Capacity = 64 * 1024u;
+		constexpr auto File_Database_Batch_Size = 100u;
+		constexpr auto Compression_Level = 3;
+
+		enum class CompressionMode { None, Zstd, Zstd_Dictionary };
+
+		// region blocks
+
+		// blocks contain transfer-like transactions that reference a small set of accounts and mosaics
+		// in order to approximate the repetitiveness of real chain data
+		class AccountPool {
+		public:
+			AccountPool() {
+				for (auto& key : m_keys)
+					bench::FillWithRandomData(key);
+
+				for (auto& address : m_addresses)
+					bench::FillWithRandomData(address);
+
+				for (auto& mosaicId : m_mosaicIds)
+					mosaicId = bench::Random();
+			}
+
+		public:
+			void fillTransaction(uint8_t* pTransaction) const {
+				auto* pData = pTransaction;
+				auto append = [&pData](const auto* pSource, size_t size) {
+					std::memcpy(pData, pSource, size);
+					pData += size;
+				};
+
+				uint32_t size = Transaction_Size;
+				uint64_t amount = bench::Random() % 1'000'000;
+				Signature signature;
+				bench::FillWithRandomData(signature);
+
+				append(&size, sizeof(uint32_t));
+				pData += sizeof(uint32_t); // reserved
+				append(signature.data(), Signature::Size);
+				append(m_keys[bench::Random() % m_keys.size()].data(), Key::Size);
+				pData += 8; // version, network, type and fee
+				pData += 8; // deadline
+				append(m_addresses[bench::Random() % m_addresses.size()].data(), Address::Size);
+				append(&m_mosaicIds[bench::Random() % m_mosaicIds.size()], sizeof(uint64_t));
+				append(&amount, sizeof(uint64_t));
+			}
+
+		private:
+			std::array<Key, 10> m_keys;
+			std::array<Address, 20> m_addresses;
+			std::array<uint64_t, 3> m_mosaicIds;
+		};
+
+		struct BlockElements {
+			std::vector<std::unique_ptr<model::Block>> Blocks;
+			std::vector<model::BlockElement> Elements;
+		};
+
+		BlockElements GenerateBlockElements(size_t count) {
+			AccountPool accountPool;
+			BlockElements blockElements;
+			for (auto i = 0u; i < count; ++i) {
+				auto headerSize = model::GetBlockHeaderSize(model::Entity_Type_Block_Normal);
+				uint32_t size = headerSize + Num_Transactions_Per_Block * Transaction_Size;
+				auto pBlock = utils::MakeUniqueWithSize<model::Block>(size);
+				std::memset(static_cast<void*>(pBlock.get()), 0, size);
+				bench::FillWithRandomData(pBlock->Signature);
+				pBlock->Size = size;
+				pBlock->Type = model::Entity_Type_Block_Normal;
+				pBlock->Height = Height(i + 1);
+
+				auto* pTransactions = reinterpret_cast<uint8_t*>(pBlock.get()) + headerSize;
+				for (auto j = 0u; j < Num_Transactions_Per_Block; ++j)
+					accountPool.fillTransaction(pTransactions + j * Transaction_Size);
+
+				blockElements.Blocks.push_back(std::move(pBlock));
+			}
+
+			for (const auto& pBlock : blockElements.Blocks) {
+				blockElements.Elements.emplace_back(*pBlock);
+				bench::FillWithRandomData(blockElements.Elements.back().EntityHash);
+				bench::FillWithRandomData(blockElements.Elements.back().GenerationHash);
+				for (const auto& transaction : pBlock->Transactions()) {
+					blockElements.Elements.back().Transactions.emplace_back(transaction);
+					bench::FillWithRandomData(blockElements.Elements.back().Transactions.back().EntityHash);
+					bench::FillWithRandomData(blockElements.Elements.back().Transactions.back().MerkleComponentHash);
+				}
+			}
+
+			return blockElements;
+		}
+
+		std::vector<uint8_t> SerializeBlockElement(const model::BlockElement& blockElement) {
+			class BufferOutputStream : public OutputStream {
+			public:
+				explicit BufferOutputStream(std::vector<uint8_t>& buffer) : m_buffer(buffer)
+				{}
+
+			public:
+				void write(const RawBuffer& buffer) override {
+					m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+				}
+
+				void flush() override
+				{}
+
+			private:
+				std::vector<uint8_t>& m_buffer;
+			};
+
+			std::vector<uint8_t> buffer;
+			BufferOutputStream outputStream(buffer);
+			WriteBlockElement(blockElement, outputStream);
+			return buffer;
+		}
+
+		// endregion
+
+		// region storage
+
+		std::shared_ptr<const PayloadCodec> CreatePayloadCodec(CompressionMode mode, const std::vector<model::BlockElement>& elements) {
+			switch (mode) {
+			case CompressionMode::Zstd:
+				return CreateZstdPayloadCodec(Compression_Level);
+
+			case CompressionMode::Zstd_Dictionary: {
+				std::vector<std::vector<uint8_t>> samples;
+				for (auto i = 0u; i < Num_Dictionary_Samples; ++i)
+					samples.push_back(SerializeBlockElement(elements[i]));
+
+				return CreateZstdPayloadCodec(Compression_Level, TrainZstdDictionary(samples, Dictionary_Capacity));
+			}
+
+			default:
+				return nullptr;
+			}
+		}
+
+		uint64_t GetBlockFilesSize(const std::filesystem::path& directory) {
+			uint64_t size = 0;
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+				if (entry.is_regular_file() && ".dat" == entry.path().extension() && "hashes.dat" != entry.path().filename())
+					size += entry.file_size();
+			}
+
+			return size;
+		}
+
+		class StorageDirectoryGuard {
+		public:
+			StorageDirectoryGuard()
+					: m_directory(std::filesystem::temp_directory_path() / ("bench.compression." + std::to_string(bench::Random()))) {
+				std::filesystem::create_directories(m_directory);
+			}
+
+			~StorageDirectoryGuard() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			const std::filesystem::path& path() const {
+				return m_directory;
+			}
+
+		private:
+			std::filesystem::path m_directory;
+		};
+
+		// endregion
+
+		void BenchmarkLoadBlockElement(benchmark::State& state) {
+			auto mode = static_cast<CompressionMode>(state.range(0));
+			auto blockElements = GenerateBlockElements(Num_Blocks);
+			auto pPayloadCodec = CreatePayloadCodec(mode, blockElements.Elements);
+
+			StorageDirectoryGuard directoryGuard;
+			FileBlockStorage storage(
+					directoryGuard.path().generic_string(),
+					File_Database_Batch_Size,
+					FileBlockStorageMode::None,
+					pPayloadCodec);
+			storage.saveBlocks(blockElements.Elements);
+
+			uint64_t uncompressedSize = 0;
+			for (const auto& element : blockElements.Elements)
+				uncompressedSize += SerializeBlockElement(element).size();
+
+			for (auto _ : state) {
+				auto height = Height(bench::Random() % Num_Blocks + 1);
+				benchmark::DoNotOptimize(storage.loadBlockElement(height));
+			}
+
+			auto storedSize = GetBlockFilesSize(directoryGuard.path());
+			state.counters["bytes/block"] = static_cast<double>(storedSize) / Num_Blocks;
+			state.counters["ratio"] = static_cast<double>(uncompressedSize) / static_cast<double>(storedSize);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkLoadBlockElement", catapult::io::BenchmarkLoadBlockElement)
+			->Unit(benchmark::kMicrosecond)
+			->ArgName("mode")
+			->Arg(0) // none
+			->Arg(1) // zstd
+			->Arg(2); // zstd with dictionary
+}
@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Num_Blocks = 500u;
+		constexpr auto Block_Payload_Size = 4 * 1024u;
+		constexpr auto File_Database_Batch_Size = 100u;
+
+		// region blocks
+
+		// mirrors the blocks saved by the StorageIntegrityTests stress writer (random block data, no transaction elements)
+		struct BlockElements {
+			std::vector<std::unique_ptr<model::Block>> Blocks;
+			std::vector<model::BlockElement> Elements;
+		};
+
+		BlockElements GenerateBlockElements(Height startHeight, size_t count) {
+			BlockElements blockElements;
+			for (auto i = 0u; i < count; ++i) {
+				uint32_t size = sizeof(model::BlockHeader) + Block_Payload_Size;
+				auto pBlock = utils::MakeUniqueWithSize<model::Block>(size);
+				bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pBlock.get()), size });
+				pBlock->Size = size;
+				pBlock->Type = model::Entity_Type_Block_Normal;
+				pBlock->Height = startHeight + Height(i);
+				blockElements.Blocks.push_back(std::move(pBlock));
+			}
+
+			for (const auto& pBlock : blockElements.Blocks) {
+				blockElements.Elements.emplace_back(*pBlock);
+				bench::FillWithRandomData(blockElements.Elements.back().EntityHash);
+				bench::FillWithRandomData(blockElements.Elements.back().GenerationHash);
+			}
+
+			return blockElements;
+		}
+
+		// endregion
+
+		// region storage directory
+
+		class StorageDirectory {
+		public:
+			StorageDirectory()
+					: m_directory(std::filesystem::temp_directory_path() / ("bench.storage." + std::to_string(bench::Random())))
+			{}
+
+			~StorageDirectory() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			std::string prepare() {
+				std::filesystem::remove_all(m_directory);
+				std::filesystem::create_directories(m_directory / "00000");
+
+				// seed hashes for heights 0 and 1 and mark storage height as 1, so that blocks can be saved starting at height 2
+				std::vector<uint8_t> hashes(2 * Hash256::Size);
+				RawFile hashFile((m_directory / "00000" / "hashes.dat").generic_string(), OpenMode::Read_Write);
+				hashFile.write(hashes);
+
+				IndexFile((m_directory / "index.dat").generic_string()).set(1);
+				return m_directory.generic_string();
+			}
+
+		private:
+			std::filesystem::path m_directory;
+		};
+
+		// endregion
+
+		void SaveBlocks(FileBlockStorage& storage, const std::vector<model::BlockElement>& elements, size_t numBlocksPerSave) {
+			if (0 == numBlocksPerSave) {
+				for (const auto& element : elements)
+					storage.saveBlock(element);
+
+				return;
+			}
+
+			for (auto iter = elements.cbegin(); elements.cend() != iter;) {
+				auto count = std::min<size_t>(numBlocksPerSave, static_cast<size_t>(elements.cend() - iter));
+				storage.saveBlocks(std::vector<model::BlockElement>(iter, iter + static_cast<std::ptrdiff_t>(count)));
+				iter += static_cast<std::ptrdiff_t>(count);
+			}
+		}
+
+		// note: a group size of zero saves each block individually via saveBlock
+		void BenchmarkSaveBlocks(benchmark::State& state) {
+			auto numBlocksPerSave = static_cast<size_t>(state.range(0));
+			auto blockElements = GenerateBlockElements(Height(2), Num_Blocks);
+			StorageDirectory directory;
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				FileBlockStorage storage(directory.prepare(), File_Database_Batch_Size);
+				state.ResumeTiming();
+
+				SaveBlocks(storage, blockElements.Elements, numBlocksPerSave);
+			}
+
+			state.counters["blocks/s"] = benchmark::Counter(
+					static_cast<double>(Num_Blocks * state.iterations()),
+					benchmark::Counter::kIsRate);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkSaveBlocks", catapult::io::BenchmarkSaveBlocks)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(0)
+			->Arg(1)
+			->Arg(10)
+			->Arg(50)
+			->Arg(100);
+}
@@ -20,6 +20,8 @@
 **/
 
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/api/TransactionPackets.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -27,17 +29,19 @@
 
 namespace catapult { namespace api {
 
+#define TEST_CLASS RemoteTransactionApiTests
+
 	namespace {
 		using TransactionType = mocks::MockTransaction;
 
-		std::shared_ptr<ionet::Packet> CreatePacketWithTransactions(uint16_t numTransactions) {
+		std::shared_ptr<ionet::Packet> CreatePacketWithTransactions(uint16_t numTransactions, uint32_t prefixSize = 0) {
 			// Arrange: create transactions with variable (incrementing) sizes
 			uint32_t variableDataSize = numTransactions * (numTransactions + 1) / 2;
-			uint32_t payloadSize = numTransactions * SizeOf32<TransactionType>() + variableDataSize;
+			uint32_t payloadSize = prefixSize + numTransactions * SizeOf32<TransactionType>() + variableDataSize;
 			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
 			test::FillWithRandomData({ pPacket->Data(), payloadSize });
 
-			auto* pData = pPacket->Data();
+			auto* pData = pPacket->Data() + prefixSize;
 			for (uint16_t i = 0u; i < numTransactions; ++i) {
 				auto& transaction = reinterpret_cast<TransactionType&>(*pData);
 				transaction.Size = SizeOf32<TransactionType>() + i + 1;
@@ -51,6 +55,28 @@ namespace catapult { namespace api {
 			return pPacket;
 		}
 
+		void AssertTransactions(const uint8_t* pExpectedData, const model::TransactionRange& transactions) {
+			ASSERT_EQ(3u, transactions.size());
+
+			auto parsedIter = transactions.cbegin();
+			for (auto i = 0u; i < transactions.size(); ++i, ++parsedIter) {
+				std::string message = "comparing transaction at " + std::to_string(i);
+				const auto& actualTransaction = *parsedIter;
+
+				// expected data is unprocessed packet data, which contains unaligned data
+				// `transactions` is the (processed) result, which is aligned
+				std::vector<uint8_t> expectedTransactionBuffer(actualTransaction.Size);
+				std::memcpy(&expectedTransactionBuffer[0], pExpectedData, actualTransaction.Size);
+				const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(expectedTransactionBuffer[0]);
+
+				ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
+				EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
+				EXPECT_EQ(expectedTransaction, actualTransaction) << message;
+
+				pExpectedData += expectedTransaction.Size;
+			}
+		}
+
 		struct UtTraits {
 			static constexpr uint32_t Request_Data_Header_Size = sizeof(Timestamp) + sizeof(BlockFeeMultiplier);
 			static constexpr uint32_t Request_Data_Size = 3 * sizeof(utils::ShortHash);
@@ -89,26 +115,58 @@ namespace catapult { namespace api {
 			}
 
 			static void ValidateResponse(const ionet::Packet& response, const model::TransactionRange& transactions) {
-				ASSERT_EQ(3u, transactions.size());
+				AssertTransactions(response.Data(), transactions);
+			}
+		};
+
+		struct ReconcileTraits {
+			static constexpr uint32_t Request_Data_Header_Size = sizeof(Timestamp) + sizeof(BlockFeeMultiplier);
+			static constexpr uint32_t Status_Size = sizeof(ReconcileTransactionsStatus);
+
+			static utils::ShortHashIblt KnownShortHashesTable() {
+				utils::ShortHashIblt iblt(6);
+				for (auto value : { 123u, 234u, 345u })
+					iblt.insert(utils::ShortHash(value));
 
-				const auto* pExpectedData = response.Data();
-				auto parsedIter = transactions.cbegin();
-				for (auto i = 0u; i < transactions.size(); ++i, ++parsedIter) {
-					std::string message = "comparing transaction at " + std::to_string(i);
-					const auto& actualTransaction = *parsedIter;
+				return iblt;
+			}
 
-					// `response` is the (unprocessed) response Packet, which contains unaligned data
-					// `transactions` is the (processed) result, which is aligned
-					std::vector<uint8_t> expectedTransactionBuffer(actualTransaction.Size);
-					std::memcpy(&expectedTransactionBuffer[0], pExpectedData, actualTransaction.Size);
-					const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(expectedTransactionBuffer[0]);
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.reconcileTransactions(Timestamp(84), BlockFeeMultiplier(17), KnownShortHashesTable());
+			}
 
-					ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
-					EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
-					EXPECT_EQ(expectedTransaction, actualTransaction) << message;
+			static auto CreateResponsePacket(ReconcileTransactionsStatus status, uint16_t numTransactions) {
+				auto pResponsePacket = CreatePacketWithTransactions(numTransactions, Status_Size);
+				pResponsePacket->Type = ionet::PacketType::Reconcile_Transactions;
+				reinterpret_cast<ReconcileTransactionsStatus&>(*pResponsePacket->Data()) = status;
+				return pResponsePacket;
+			}
 
-					pExpectedData += expectedTransaction.Size;
-				}
+			static auto CreateValidResponsePacket() {
+				return CreateResponsePacket(ReconcileTransactionsStatus::Success, 3);
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				auto expectedTable = KnownShortHashesTable();
+				auto cellsSize = expectedTable.size() * sizeof(utils::ShortHashIblt::Cell);
+
+				EXPECT_EQ(ionet::PacketType::Reconcile_Transactions, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Header_Size + cellsSize, packet.Size);
+				EXPECT_EQ(Timestamp(84), reinterpret_cast<const Timestamp&>(*packet.Data()));
+				EXPECT_EQ(BlockFeeMultiplier(17), reinterpret_cast<const BlockFeeMultiplier&>(packet.Data()[sizeof(Timestamp)]));
+				EXPECT_EQ_MEMORY(packet.Data() + Request_Data_Header_Size, expectedTable.data(), cellsSize);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const ReconciledTransactions& reconciledTransactions) {
+				EXPECT_TRUE(reconciledTransactions.IsDecoded);
+				AssertTransactions(response.Data() + Status_Size, reconciledTransactions.Transactions);
 			}
 		};
 
@@ -126,4 +184,53 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteTransactionApi, Reconcile)
+
+	// region reconcileTransactions - status
+
+	namespace {
+		void AssertReconcileResponse(const std::shared_ptr<ionet::Packet>& pResponsePacket, bool expectedIsDecoded) {
+			// Arrange:
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemoteTransactionApiTraits::Create(*pPacketIo);
+
+			// Act:
+			auto result = ReconcileTraits::Invoke(*pApi).get();
+
+			// Assert:
+			EXPECT_EQ(expectedIsDecoded, result.IsDecoded);
+			EXPECT_EQ(0u, result.Transactions.size());
+		}
+
+		void AssertReconcileResponseIsMalformed(const std::shared_ptr<ionet::Packet>& pResponsePacket) {
+			// Arrange:
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemoteTransactionApiTraits::Create(*pPacketIo);
+
+			// Act + Assert:
+			EXPECT_THROW(ReconcileTraits::Invoke(*pApi).get(), catapult_api_error);
+		}
+	}
+
+	TEST(TEST_CLASS, ReconcileResponseWithSuccessStatusAndNoTransactionsIsDecoded) {
+		AssertReconcileResponse(ReconcileTraits::CreateResponsePacket(ReconcileTransactionsStatus::Success, 0), true);
+	}
+
+	TEST(TEST_CLASS, ReconcileResponseWithDecodeFailureStatusIsNotDecoded) {
+		AssertReconcileResponse(ReconcileTraits::CreateResponsePacket(ReconcileTransactionsStatus::Decode_Failure, 0), false);
+	}
+
+	TEST(TEST_CLASS, ReconcileResponseWithDecodeFailureStatusAndTransactionsIsMalformed) {
+		AssertReconcileResponseIsMalformed(ReconcileTraits::CreateResponsePacket(ReconcileTransactionsStatus::Decode_Failure, 3));
+	}
+
+	TEST(TEST_CLASS, ReconcileResponseWithUnknownStatusIsMalformed) {
+		AssertReconcileResponseIsMalformed(ReconcileTraits::CreateResponsePacket(static_cast<ReconcileTransactionsStatus>(2), 0));
+	}
+
+	// endregion
 }}
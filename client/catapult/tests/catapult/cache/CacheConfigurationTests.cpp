@@ -35,6 +35,7 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize(), config.CacheDatabaseConfig.MaxWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(config.ShouldPublishSnapshots);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathButNotPatriciaTreeStorage_DefaultConfig) {
@@ -46,6 +47,7 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabaseConfig.MaxWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(config.ShouldPublishSnapshots);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathButNotPatriciaTreeStorage_CustomConfig) {
@@ -59,6 +61,7 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.CacheDatabaseConfig.MaxWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(config.ShouldPublishSnapshots);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathAndPatriciaTreeStorage_DefaultConfig) {
@@ -70,6 +73,7 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabaseConfig.MaxWriteBatchSize);
 		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(config.ShouldPublishSnapshots);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathAndPatriciaTreeStorage_CustomConfig) {
@@ -83,5 +87,6 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.CacheDatabaseConfig.MaxWriteBatchSize);
 		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(config.ShouldPublishSnapshots);
 	}
 }}
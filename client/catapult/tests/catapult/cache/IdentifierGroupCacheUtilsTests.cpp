@@ -34,7 +34,8 @@ namespace catapult { namespace cache {
 		using TestCacheDescriptor = test::TestCacheTypes::TestActivityCacheDescriptor;
 
 		using HeightGroupedBaseSetType = test::TestCacheTypes::HeightGroupedBaseSetType;
-		using BaseSetType = test::TestCacheTypes::BaseActivitySetType;
+		using BaseActivitySetType = test::TestCacheTypes::BaseActivitySetType;
+		using BaseSetType = test::TestCacheTypes::BaseSetType;
 
 		TestIdentifierGroup AddValues(TestIdentifierGroup&& group, std::initializer_list<int> values) {
 			for (auto value : values)
@@ -112,7 +113,7 @@ namespace catapult { namespace cache {
 		template<typename TAction>
 		void RunHeightGroupedTest(Height deactivateHeight, TAction action) {
 			// Arrange:
-			BaseSetType set;
+			BaseActivitySetType set;
 			auto pDelta = set.rebase();
 			pDelta->insert(TestCacheDescriptor::ValueType("a", deactivateHeight));
 			pDelta->insert(TestCacheDescriptor::ValueType("xyz", deactivateHeight));
@@ -330,4 +331,145 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region TouchIdentifiersWithGroup
+
+	TEST(TEST_CLASS, TouchIdentifiersWithGroup_ReturnsNothingWhenNoIdentifiersInGroup) {
+		// Arrange:
+		RunHeightGroupedTest([](auto& delta, auto& groupedDelta) {
+			// Sanity:
+			EXPECT_FALSE(groupedDelta.contains(Height(5)));
+
+			// Act:
+			auto identifiers = TouchIdentifiersWithGroup(delta, groupedDelta, Height(5));
+
+			// Assert: nothing was found
+			EXPECT_TRUE(identifiers.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, TouchIdentifiersWithGroup_ReturnsAllValuesInGroupThatDeactivateAtHeight) {
+		// Arrange:
+		RunHeightGroupedTest(Height(6), [](auto& delta, auto& groupedDelta) {
+			// Act:
+			auto identifiers = TouchIdentifiersWithGroup(delta, groupedDelta, Height(6));
+
+			// Assert:
+			EXPECT_EQ(3u, identifiers.size());
+			EXPECT_CONTAINS(identifiers, 1);
+			EXPECT_CONTAINS(identifiers, 3);
+			EXPECT_CONTAINS(identifiers, 9);
+		});
+	}
+
+	TEST(TEST_CLASS, TouchIdentifiersWithGroup_ReturnsNothingWhenAllValuesInGroupStayActiveOrInactive) {
+		// Arrange:
+		for (auto deactivateHeight : { Height(5), Height(7) }) {
+			RunHeightGroupedTest(deactivateHeight, [](auto& delta, auto& groupedDelta) {
+				// Act:
+				auto identifiers = TouchIdentifiersWithGroup(delta, groupedDelta, Height(6));
+
+				// Assert:
+				EXPECT_TRUE(identifiers.empty());
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, TouchIdentifiersWithGroup_ReturnsAllValuesInGroupThatDeactivateAtHeightAndIgnoresUnknownValues) {
+		// Arrange:
+		RunHeightGroupedTest(Height(3), [](auto& delta, auto& groupedDelta) {
+			// Act:
+			auto identifiers = TouchIdentifiersWithGroup(delta, groupedDelta, Height(3));
+
+			// Assert:
+			EXPECT_EQ(2u, identifiers.size());
+			EXPECT_CONTAINS(identifiers, 4);
+			EXPECT_CONTAINS(identifiers, 100);
+		});
+	}
+
+	// endregion
+
+	// region PruneIdentifiersWithGroup
+
+	namespace {
+		template<typename TAction>
+		void RunPruneTest(TAction action) {
+			// Arrange:
+			BaseSetType set;
+			auto pDelta = set.rebase();
+			for (auto size : { 1u, 3u, 4u, 9u, 100u })
+				pDelta->insert(std::string(size, 'a'));
+
+			HeightGroupedBaseSetType groupedSet;
+			auto pGroupedDelta = groupedSet.rebase();
+			pGroupedDelta->insert(AddValues(TestIdentifierGroup(Height(3)), { 100, 7, 4 }));
+			pGroupedDelta->insert(AddValues(TestIdentifierGroup(Height(6)), { 1, 3, 9 }));
+
+			// Act + Assert:
+			action(*pDelta, *pGroupedDelta);
+		}
+	}
+
+	TEST(TEST_CLASS, PruneIdentifiersWithGroup_DoesNothingWhenNoIdentifiersInGroup) {
+		// Arrange:
+		RunPruneTest([](auto& delta, auto& groupedDelta) {
+			// Act:
+			auto numActionCalls = 0u;
+			PruneIdentifiersWithGroup(delta, groupedDelta, Height(5), [&numActionCalls](auto&) {
+				++numActionCalls;
+			});
+
+			// Assert:
+			EXPECT_EQ(0u, numActionCalls);
+			EXPECT_EQ(5u, delta.size());
+			EXPECT_EQ(2u, groupedDelta.size());
+		});
+	}
+
+	TEST(TEST_CLASS, PruneIdentifiersWithGroup_RemovesGroupAndAllValuesInGroupThatBecomeEmpty) {
+		// Arrange:
+		RunPruneTest([](auto& delta, auto& groupedDelta) {
+			// Act: empty all values with size less than five
+			auto numActionCalls = 0u;
+			PruneIdentifiersWithGroup(delta, groupedDelta, Height(6), [&numActionCalls](auto& value) {
+				++numActionCalls;
+				if (value.size() < 5)
+					value.clear();
+			});
+
+			// Assert:
+			EXPECT_EQ(3u, numActionCalls);
+			EXPECT_EQ(3u, delta.size());
+			EXPECT_FALSE(delta.contains(1));
+			EXPECT_FALSE(delta.contains(3));
+			EXPECT_TRUE(delta.contains(9));
+
+			EXPECT_EQ(1u, groupedDelta.size());
+			EXPECT_FALSE(groupedDelta.contains(Height(6)));
+		});
+	}
+
+	TEST(TEST_CLASS, PruneIdentifiersWithGroup_RemovesGroupAndIgnoresUnknownValues) {
+		// Arrange:
+		RunPruneTest([](auto& delta, auto& groupedDelta) {
+			// Act: empty all values
+			auto numActionCalls = 0u;
+			PruneIdentifiersWithGroup(delta, groupedDelta, Height(3), [&numActionCalls](auto& value) {
+				++numActionCalls;
+				value.clear();
+			});
+
+			// Assert: value with id 7 is in group but not in underlying set
+			EXPECT_EQ(2u, numActionCalls);
+			EXPECT_EQ(3u, delta.size());
+			EXPECT_FALSE(delta.contains(4));
+			EXPECT_FALSE(delta.contains(100));
+
+			EXPECT_EQ(1u, groupedDelta.size());
+			EXPECT_FALSE(groupedDelta.contains(Height(3)));
+		});
+	}
+
+	// endregion
 }}
@@ -515,7 +515,7 @@ namespace catapult { namespace cache {
 			auto pDelta = adapter.createDelta();
 			auto pDeltaRaw = static_cast<test::SimpleCacheDelta*>(pDelta->get());
 			pDeltaRaw->increment();
-			adapter.commit();
+			adapter.commit(Height(1));
 		}
 
 		// Act:
@@ -552,7 +552,7 @@ namespace catapult { namespace cache {
 			auto pDelta = adapter.createDelta();
 			auto pDeltaRaw = static_cast<test::SimpleCacheDelta*>(pDelta->get());
 			pDeltaRaw->increment();
-			adapter.commit();
+			adapter.commit(Height(1));
 		}
 
 		// Act:
@@ -562,6 +562,51 @@ namespace catapult { namespace cache {
 		AssertView<test::SimpleCacheView>(pView, 6, SubCacheViewType::View);
 	}
 
+	namespace {
+		class HeightAwareSimpleCache : public SimpleCache {
+		public:
+			using SimpleCache::SimpleCache;
+
+		public:
+			const std::vector<Height>& commitHeights() const {
+				return m_commitHeights;
+			}
+
+		public:
+			using SimpleCache::commit;
+
+			void commit(Height height) {
+				SimpleCache::commit();
+				m_commitHeights.push_back(height);
+			}
+
+		private:
+			std::vector<Height> m_commitHeights;
+		};
+	}
+
+	TEST(TEST_CLASS, CanCommitChangesAtHeightWhenCacheSupportsHeightAwareCommit) {
+		// Arrange:
+		auto pCache = std::make_unique<HeightAwareSimpleCache>(test::SimpleCacheViewMode::Iterable);
+		const auto& cache = *pCache;
+		SubCachePluginAdapter<
+				HeightAwareSimpleCache,
+				test::SimpleCacheExtensionStorageTraits<test::SimpleCacheDefaultViewExtension, test::SimpleCacheDefaultDeltaExtension>
+		> adapter(std::move(pCache));
+
+		// Act:
+		for (auto height : { Height(7), Height(11) }) {
+			auto pDelta = adapter.createDelta();
+			static_cast<test::SimpleCacheDelta*>(pDelta->get())->increment();
+			adapter.commit(height);
+		}
+
+		// Assert: all changes were committed at the specified heights
+		auto pView = adapter.createView();
+		AssertView<test::SimpleCacheView>(pView, 2, SubCacheViewType::View);
+		EXPECT_EQ(std::vector<Height>({ Height(7), Height(11) }), cache.commitHeights());
+	}
+
 	// endregion
 
 	// region createStorage
@@ -746,7 +791,7 @@ namespace catapult { namespace cache {
 			}
 
 			void commit() {
-				m_cache.commit();
+				m_cache.commit(Height(1));
 			}
 
 		private:
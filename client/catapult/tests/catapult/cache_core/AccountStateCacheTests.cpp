@@ -1679,9 +1679,9 @@ namespace catapult { namespace cache {
 
 	// endregion
 
-	// region detachHighValueAccounts
+	// region detachHighValueAccountsChanges
 
-	TEST(TEST_CLASS, DetachHighValueAccountsIsDestructive) {
+	TEST(TEST_CLASS, DetachHighValueAccountsChangesIsDestructive) {
 		// Arrange: set min balance to 1M
 		auto options = Default_Cache_Options;
 		options.MinHarvesterBalance = Amount(1'000'000);
@@ -1696,12 +1696,53 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), delta->highValueAccounts().addresses());
 
 		// Act:
-		auto detachedAccounts = delta->detachHighValueAccounts();
+		auto detachedChanges = delta->detachHighValueAccountsChanges();
 
-		// Assert:
+		// Assert: delta reports (unchanged) committed addresses
 		EXPECT_TRUE(delta->highValueAccounts().addresses().empty());
 
-		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), detachedAccounts.addresses());
+		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), detachedChanges.AddedAddresses);
+		EXPECT_TRUE(detachedChanges.ErasedAddresses.empty());
+	}
+
+	TEST(TEST_CLASS, CommitAppliesHighValueAccountsChangesInPlace) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHarvesterBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		std::vector<Address> addresses;
+		{
+			auto delta = cache.createDelta();
+			addresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+			delta->updateHighValueAccounts(Height(1));
+			cache.commit();
+		}
+
+		const auto* pOriginalHighValueAccounts = &cache.createView()->highValueAccounts();
+
+		// - lower the balance of one account and raise the balance of another
+		auto delta = cache.createDelta();
+		delta->find(addresses[0]).get().Balances.debit(Harvesting_Mosaic_Id, Amount(200'000));
+		delta->find(addresses[1]).get().Balances.credit(Harvesting_Mosaic_Id, Amount(200'000));
+		delta->updateHighValueAccounts(Height(2));
+
+		// Sanity: only changed addresses are pending
+		EXPECT_EQ(model::AddressSet({ addresses[1] }), delta->highValueAccounts().changes().AddedAddresses);
+		EXPECT_EQ(model::AddressSet({ addresses[0] }), delta->highValueAccounts().changes().ErasedAddresses);
+
+		// Act:
+		cache.commit();
+
+		// Assert: committed accounts were updated in place and the delta reflects them
+		const auto& highValueAccounts = cache.createView()->highValueAccounts();
+		EXPECT_EQ(pOriginalHighValueAccounts, &highValueAccounts);
+		EXPECT_EQ(model::AddressSet({ addresses[1], addresses[2] }), highValueAccounts.addresses());
+		EXPECT_EQ(model::AddressSet({ addresses[0] }), highValueAccounts.removedAddresses());
+
+		EXPECT_EQ(highValueAccounts.addresses(), delta->highValueAccounts().addresses());
+		EXPECT_TRUE(delta->highValueAccounts().changes().AddedAddresses.empty());
+		EXPECT_TRUE(delta->highValueAccounts().changes().ErasedAddresses.empty());
 	}
 
 	// endregion
@@ -1765,6 +1806,125 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region snapshots
+
+	namespace {
+		CacheConfiguration CreateSnapshotCacheConfiguration() {
+			auto config = CacheConfiguration();
+			config.ShouldPublishSnapshots = true;
+			return config;
+		}
+
+		void AddAccount(AccountStateCacheDelta& delta, const Address& address, Amount balance) {
+			delta.addAccount(address, Height(1));
+			delta.find(address).get().Balances.credit(Harvesting_Mosaic_Id, balance);
+		}
+	}
+
+	TEST(TEST_CLASS, SnapshotIsNotAvailableWhenSnapshotsAreDisabled) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+		AddAccount(*delta, test::GenerateRandomAddress(), Amount(100));
+
+		// Act:
+		cache.commit(Height(7));
+
+		// Assert:
+		EXPECT_FALSE(!!cache.snapshot());
+	}
+
+	TEST(TEST_CLASS, CannotCreateCacheWithSnapshotsWhenCacheDatabaseIsEnabled) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto config = CacheConfiguration(dbDirGuard.name(), PatriciaTreeStorageMode::Disabled);
+		config.ShouldPublishSnapshots = true;
+
+		// Act + Assert:
+		EXPECT_THROW(AccountStateCache(config, Default_Cache_Options), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, EmptySnapshotIsAvailableWhenSnapshotsAreEnabled) {
+		// Act:
+		AccountStateCache cache(CreateSnapshotCacheConfiguration(), Default_Cache_Options);
+
+		// Assert:
+		auto pSnapshot = cache.snapshot();
+		ASSERT_TRUE(!!pSnapshot);
+		EXPECT_EQ(Height(), pSnapshot->height());
+		EXPECT_EQ(0u, pSnapshot->size());
+		EXPECT_EQ(Harvesting_Mosaic_Id, pSnapshot->harvestingMosaicId());
+	}
+
+	TEST(TEST_CLASS, CommitAtHeightPublishesSnapshot) {
+		// Arrange:
+		AccountStateCache cache(CreateSnapshotCacheConfiguration(), Default_Cache_Options);
+		auto address = test::GenerateRandomAddress();
+		auto delta = cache.createDelta();
+		AddAccount(*delta, address, Amount(100));
+
+		// Act:
+		cache.commit(Height(7));
+
+		// Assert:
+		auto pSnapshot = cache.snapshot();
+		ASSERT_TRUE(!!pSnapshot);
+		EXPECT_EQ(Height(7), pSnapshot->height());
+		EXPECT_EQ(1u, pSnapshot->size());
+		EXPECT_EQ(Amount(100), pSnapshot->find(address).get().Balances.get(Harvesting_Mosaic_Id));
+	}
+
+	TEST(TEST_CLASS, CommitWithoutHeightDefersSnapshotPublishing) {
+		// Arrange:
+		AccountStateCache cache(CreateSnapshotCacheConfiguration(), Default_Cache_Options);
+		auto addresses = test::GenerateRandomDataVector<Address>(2);
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		AddAccount(*delta, addresses[0], Amount(100));
+		cache.commit();
+		auto pSnapshot1 = cache.snapshot();
+
+		AddAccount(*delta, addresses[1], Amount(200));
+		cache.commit(Height(7));
+		auto pSnapshot2 = cache.snapshot();
+
+		// Assert: first commit did not publish a snapshot
+		EXPECT_EQ(Height(), pSnapshot1->height());
+		EXPECT_EQ(0u, pSnapshot1->size());
+
+		// - second commit published a snapshot including changes from both commits
+		EXPECT_EQ(Height(7), pSnapshot2->height());
+		EXPECT_EQ(2u, pSnapshot2->size());
+		EXPECT_TRUE(pSnapshot2->contains(addresses[0]));
+		EXPECT_TRUE(pSnapshot2->contains(addresses[1]));
+	}
+
+	TEST(TEST_CLASS, PinnedSnapshotIsUnaffectedBySubsequentCommits) {
+		// Arrange:
+		AccountStateCache cache(CreateSnapshotCacheConfiguration(), Default_Cache_Options);
+		auto address = test::GenerateRandomAddress();
+		auto delta = cache.createDelta();
+		AddAccount(*delta, address, Amount(100));
+		cache.commit(Height(7));
+		auto pSnapshot = cache.snapshot();
+
+		// Act:
+		delta->find(address).get().Balances.credit(Harvesting_Mosaic_Id, Amount(50));
+		cache.commit(Height(8));
+
+		// Assert:
+		EXPECT_EQ(Height(7), pSnapshot->height());
+		EXPECT_EQ(Amount(100), pSnapshot->find(address).get().Balances.get(Harvesting_Mosaic_Id));
+
+		auto pNewSnapshot = cache.snapshot();
+		EXPECT_EQ(Height(8), pNewSnapshot->height());
+		EXPECT_EQ(Amount(150), pNewSnapshot->find(address).get().Balances.get(Harvesting_Mosaic_Id));
+	}
+
+	// endregion
+
 	// region cache init
 
 	TEST(TEST_CLASS, CanSpecifyInitialValuesViaInit) {
@@ -0,0 +1,342 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_core/AccountStateSnapshot.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
+#include "tests/test/cache/AccountStateCacheTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS AccountStateSnapshotTests
+
+	namespace {
+		constexpr auto Default_Cache_Options = test::CreateDefaultAccountStateCacheOptions(MosaicId(1111), MosaicId(2222));
+
+		Address GenerateAddressInShard(uint8_t shardGroupIndex, uint8_t shardIndex) {
+			auto address = test::GenerateRandomAddress();
+			address[1] = shardGroupIndex;
+			address[2] = shardIndex;
+			return address;
+		}
+
+		void Credit(AccountStateCache& cache, AccountStateSnapshotBuilder& builder, const Address& address, Amount amount) {
+			auto delta = cache.createDelta();
+			delta->find(address).get().Balances.credit(MosaicId(2222), amount);
+			builder.update(*delta);
+			cache.commit();
+		}
+
+		Amount GetBalance(const AccountStateSnapshot& snapshot, const Address& address) {
+			return snapshot.find(address).get().Balances.get(MosaicId(2222));
+		}
+
+		void AddAccounts(AccountStateCache& cache, AccountStateSnapshotBuilder& builder, const std::vector<Address>& addresses) {
+			auto delta = cache.createDelta();
+			for (const auto& address : addresses)
+				delta->addAccount(address, Height(1));
+
+			builder.update(*delta);
+			cache.commit();
+		}
+	}
+
+	// region AccountStateSnapshotBuilder
+
+	TEST(TEST_CLASS, BuilderIsInitiallyEmpty) {
+		// Act:
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+
+		// Assert:
+		EXPECT_EQ(0u, builder.size());
+		EXPECT_FALSE(builder.hasPendingChanges());
+	}
+
+	TEST(TEST_CLASS, BuilderCanApplyAddedAccountStates) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+
+		// Act:
+		AddAccounts(cache, builder, addresses);
+
+		// Assert:
+		EXPECT_EQ(3u, builder.size());
+		EXPECT_TRUE(builder.hasPendingChanges());
+
+		auto pSnapshot = builder.build(Height(7));
+		EXPECT_EQ(3u, pSnapshot->size());
+		for (const auto& address : addresses)
+			EXPECT_TRUE(pSnapshot->contains(address)) << address;
+	}
+
+	TEST(TEST_CLASS, BuilderCanApplyModifiedAccountStates) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		AddAccounts(cache, builder, addresses);
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->find(addresses[1]).get().Balances.credit(MosaicId(2222), Amount(123));
+			builder.update(*delta);
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, builder.size());
+
+		auto pSnapshot = builder.build(Height(7));
+		EXPECT_EQ(3u, pSnapshot->size());
+		EXPECT_EQ(Amount(), pSnapshot->find(addresses[0]).get().Balances.get(MosaicId(2222)));
+		EXPECT_EQ(Amount(123), pSnapshot->find(addresses[1]).get().Balances.get(MosaicId(2222)));
+		EXPECT_EQ(Amount(), pSnapshot->find(addresses[2]).get().Balances.get(MosaicId(2222)));
+	}
+
+	TEST(TEST_CLASS, BuilderCanApplyRemovedAccountStates) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		AddAccounts(cache, builder, addresses);
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->queueRemove(addresses[1], Height(1));
+			delta->commitRemovals();
+			builder.update(*delta);
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(2u, builder.size());
+
+		auto pSnapshot = builder.build(Height(7));
+		EXPECT_EQ(2u, pSnapshot->size());
+		EXPECT_TRUE(pSnapshot->contains(addresses[0]));
+		EXPECT_FALSE(pSnapshot->contains(addresses[1]));
+		EXPECT_TRUE(pSnapshot->contains(addresses[2]));
+	}
+
+	TEST(TEST_CLASS, BuildClearsPendingChanges) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		AddAccounts(cache, builder, test::GenerateRandomDataVector<Address>(3));
+
+		// Act:
+		builder.build(Height(7));
+
+		// Assert:
+		EXPECT_EQ(3u, builder.size());
+		EXPECT_FALSE(builder.hasPendingChanges());
+	}
+
+	TEST(TEST_CLASS, BuildCreatesSnapshotWithHeightAndOptions) {
+		// Arrange:
+		auto options = Default_Cache_Options;
+		options.NetworkIdentifier = model::NetworkIdentifier::Mainnet;
+		options.ImportanceGrouping = 123;
+		options.MinHarvesterBalance = Amount(234);
+		options.MaxHarvesterBalance = Amount(345);
+		options.HarvestingMosaicId = MosaicId(456);
+		AccountStateSnapshotBuilder builder(options);
+
+		// Act:
+		auto pSnapshot = builder.build(Height(7));
+
+		// Assert:
+		EXPECT_EQ(Height(7), pSnapshot->height());
+		EXPECT_EQ(model::NetworkIdentifier::Mainnet, pSnapshot->networkIdentifier());
+		EXPECT_EQ(123u, pSnapshot->importanceGrouping());
+		EXPECT_EQ(Amount(234), pSnapshot->minHarvesterBalance());
+		EXPECT_EQ(Amount(345), pSnapshot->maxHarvesterBalance());
+		EXPECT_EQ(MosaicId(456), pSnapshot->harvestingMosaicId());
+		EXPECT_EQ(0u, pSnapshot->size());
+	}
+
+	TEST(TEST_CLASS, SnapshotIsUnaffectedBySubsequentChanges) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		AddAccounts(cache, builder, { addresses[0], addresses[1] });
+		auto pSnapshot = builder.build(Height(7));
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->find(addresses[0]).get().Balances.credit(MosaicId(2222), Amount(123));
+			delta->queueRemove(addresses[1], Height(1));
+			delta->commitRemovals();
+			delta->addAccount(addresses[2], Height(1));
+			builder.update(*delta);
+			cache.commit();
+		}
+
+		auto pNewSnapshot = builder.build(Height(8));
+
+		// Assert:
+		EXPECT_EQ(Height(7), pSnapshot->height());
+		EXPECT_EQ(2u, pSnapshot->size());
+		EXPECT_EQ(Amount(), pSnapshot->find(addresses[0]).get().Balances.get(MosaicId(2222)));
+		EXPECT_TRUE(pSnapshot->contains(addresses[1]));
+		EXPECT_FALSE(pSnapshot->contains(addresses[2]));
+
+		EXPECT_EQ(Height(8), pNewSnapshot->height());
+		EXPECT_EQ(2u, pNewSnapshot->size());
+		EXPECT_EQ(Amount(123), pNewSnapshot->find(addresses[0]).get().Balances.get(MosaicId(2222)));
+		EXPECT_FALSE(pNewSnapshot->contains(addresses[1]));
+		EXPECT_TRUE(pNewSnapshot->contains(addresses[2]));
+	}
+
+	namespace {
+		void AssertSnapshotsShareUnmodifiedAccountStates(const std::vector<Address>& addresses) {
+			// Arrange:
+			AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+			AccountStateSnapshotBuilder builder(Default_Cache_Options);
+			AddAccounts(cache, builder, addresses);
+			auto pSnapshot = builder.build(Height(7));
+
+			// Act: modify second account
+			Credit(cache, builder, addresses[1], Amount(123));
+			auto pNewSnapshot = builder.build(Height(8));
+
+			// Assert: only the modified account state was copied
+			EXPECT_EQ(pSnapshot->find(addresses[0]).tryGet(), pNewSnapshot->find(addresses[0]).tryGet());
+			EXPECT_NE(pSnapshot->find(addresses[1]).tryGet(), pNewSnapshot->find(addresses[1]).tryGet());
+
+			EXPECT_EQ(Amount(), GetBalance(*pSnapshot, addresses[1]));
+			EXPECT_EQ(Amount(123), GetBalance(*pNewSnapshot, addresses[1]));
+		}
+	}
+
+	TEST(TEST_CLASS, SnapshotsShareUnmodifiedAccountStates_DifferentShardGroups) {
+		AssertSnapshotsShareUnmodifiedAccountStates({ GenerateAddressInShard(1, 5), GenerateAddressInShard(2, 5) });
+	}
+
+	TEST(TEST_CLASS, SnapshotsShareUnmodifiedAccountStates_DifferentShardsInSameShardGroup) {
+		AssertSnapshotsShareUnmodifiedAccountStates({ GenerateAddressInShard(1, 5), GenerateAddressInShard(1, 6) });
+	}
+
+	TEST(TEST_CLASS, SnapshotsShareUnmodifiedAccountStates_SameShard) {
+		AssertSnapshotsShareUnmodifiedAccountStates({ GenerateAddressInShard(1, 5), GenerateAddressInShard(1, 5) });
+	}
+
+	TEST(TEST_CLASS, SnapshotsAreUnaffectedByChangesAcrossMultipleBuilds) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto addresses = std::vector<Address>{ GenerateAddressInShard(1, 5), GenerateAddressInShard(1, 5), GenerateAddressInShard(1, 6) };
+		AddAccounts(cache, builder, addresses);
+
+		// Act: apply multiple updates between some builds
+		std::vector<std::shared_ptr<const AccountStateSnapshot>> snapshots;
+		snapshots.push_back(builder.build(Height(7)));
+
+		Credit(cache, builder, addresses[0], Amount(100));
+		Credit(cache, builder, addresses[2], Amount(300));
+		snapshots.push_back(builder.build(Height(8)));
+
+		Credit(cache, builder, addresses[0], Amount(10));
+		snapshots.push_back(builder.build(Height(9)));
+
+		Credit(cache, builder, addresses[1], Amount(200));
+		Credit(cache, builder, addresses[0], Amount(1));
+		snapshots.push_back(builder.build(Height(10)));
+
+		// Assert: each snapshot only includes changes applied before it was built
+		auto expectedBalances = std::vector<std::vector<Amount>>{
+			{ Amount(), Amount(), Amount() },
+			{ Amount(100), Amount(), Amount(300) },
+			{ Amount(110), Amount(), Amount(300) },
+			{ Amount(111), Amount(200), Amount(300) }
+		};
+
+		for (auto i = 0u; i < snapshots.size(); ++i) {
+			for (auto j = 0u; j < addresses.size(); ++j)
+				EXPECT_EQ(expectedBalances[i][j], GetBalance(*snapshots[i], addresses[j])) << "snapshot " << i << " account " << j;
+		}
+	}
+
+	// endregion
+
+	// region AccountStateSnapshot find
+
+	TEST(TEST_CLASS, FindByAddressReturnsEmptyIteratorForUnknownAddress) {
+		// Arrange:
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto pSnapshot = builder.build(Height(7));
+
+		// Act:
+		auto iter = pSnapshot->find(test::GenerateRandomAddress());
+
+		// Assert:
+		EXPECT_FALSE(!!iter.tryGet());
+		EXPECT_THROW(iter.get(), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, FindByKeyReturnsEmptyIteratorForUnknownPublicKeyButKnownAddress) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		auto address = model::PublicKeyToAddress(publicKey, Default_Cache_Options.NetworkIdentifier);
+		AddAccounts(cache, builder, { address });
+		auto pSnapshot = builder.build(Height(7));
+
+		// Act + Assert:
+		EXPECT_TRUE(pSnapshot->contains(address));
+		EXPECT_FALSE(pSnapshot->contains(publicKey));
+		EXPECT_FALSE(!!pSnapshot->find(publicKey).tryGet());
+	}
+
+	TEST(TEST_CLASS, FindByKeyReturnsAccountStateForKnownPublicKey) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		AccountStateSnapshotBuilder builder(Default_Cache_Options);
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		{
+			auto delta = cache.createDelta();
+			delta->addAccount(publicKey, Height(1));
+			builder.update(*delta);
+			cache.commit();
+		}
+
+		auto pSnapshot = builder.build(Height(7));
+
+		// Act:
+		auto iter = pSnapshot->find(publicKey);
+
+		// Assert:
+		EXPECT_TRUE(pSnapshot->contains(publicKey));
+		ASSERT_TRUE(!!iter.tryGet());
+		EXPECT_EQ(publicKey, iter.get().PublicKey);
+	}
+
+	// endregion
+}}
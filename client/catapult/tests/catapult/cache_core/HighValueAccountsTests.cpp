@@ -62,6 +62,14 @@ namespace catapult { namespace cache {
 			accountState.Balances.debit(Harvesting_Mosaic_Id, amount);
 		}
 
+		model::AddressSet Pick(const std::vector<Address>& addresses, std::initializer_list<size_t> indexes) {
+			model::AddressSet selectedAddresses;
+			for (auto index : indexes)
+				selectedAddresses.insert(addresses[index]);
+
+			return selectedAddresses;
+		}
+
 		AddressAccountHistoryMap CreateThreeAccountHistories() {
 			return test::GenerateAccountHistories({
 				{ { { 1 } }, { { Height(2), RelVoterAmount(1) }, { Height(4), RelVoterAmount(9) }, { Height(7), RelVoterAmount(-1) } } },
@@ -117,6 +125,84 @@ namespace catapult { namespace cache {
 		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
 	}
 
+	TEST(TEST_CLASS, Accounts_CreatesAccountHistoryJournalFromAccountHistories) {
+		// Act:
+		HighValueAccounts accounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+
+		// Assert:
+		auto expectedJournal = HeightAddressesMap{
+			{ Height(2), { Address{ { 1 } }, Address{ { 2 } } } },
+			{ Height(3), { Address{ { 3 } } } },
+			{ Height(4), { Address{ { 1 } }, Address{ { 3 } } } },
+			{ Height(6), { Address{ { 2 } } } },
+			{ Height(7), { Address{ { 1 } }, Address{ { 3 } } } }
+		};
+		EXPECT_EQ(expectedJournal, accounts.accountHistoryJournal());
+	}
+
+	// endregion
+
+	// region accounts - apply
+
+	TEST(TEST_CLASS, Accounts_CanApplyEmptyChanges) {
+		// Arrange:
+		auto addresses = GenerateRandomAddresses(4);
+		auto removedAddresses = GenerateRandomAddresses(3);
+		HighValueAccounts accounts(addresses, removedAddresses, CreateThreeAccountHistories());
+		auto expectedJournal = accounts.accountHistoryJournal();
+
+		// Act:
+		accounts.apply(HighValueAccountsChanges());
+
+		// Assert:
+		EXPECT_EQ(addresses, accounts.addresses());
+		EXPECT_EQ(removedAddresses, accounts.removedAddresses());
+		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
+		EXPECT_EQ(expectedJournal, accounts.accountHistoryJournal());
+	}
+
+	TEST(TEST_CLASS, Accounts_CanApplyChangesInPlace) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(6);
+		HighValueAccounts accounts(
+				model::AddressSet(addresses.cbegin(), addresses.cbegin() + 3),
+				model::AddressSet(addresses.cbegin() + 3, addresses.cend()),
+				CreateThreeAccountHistories());
+
+		HighValueAccountsChanges changes;
+		changes.AddedAddresses.insert(addresses[3]);
+		changes.ErasedAddresses.insert(addresses[1]);
+		changes.AddedRemovedAddresses.insert(addresses[1]);
+		changes.ErasedRemovedAddresses.insert(addresses[3]);
+		changes.ModifiedAccountHistories.emplace(Address{ { 3 } }, test::CreateAccountHistory({ { Height(5), RelVoterAmount(5) } }));
+		changes.ModifiedAccountHistories.emplace(Address{ { 4 } }, test::CreateAccountHistory({ { Height(5), RelVoterAmount(4) } }));
+		changes.ErasedAccountHistories.insert(Address{ { 2 } });
+		changes.AddedJournalEntries.emplace(Height(5), model::AddressSet{ Address{ { 3 } }, Address{ { 4 } } });
+		changes.MinJournalHeight = Height(3);
+		changes.MaxJournalHeight = Height(4);
+
+		// Act:
+		accounts.apply(std::move(changes));
+
+		// Assert:
+		EXPECT_EQ(Pick(addresses, { 0, 2, 3 }), accounts.addresses());
+		EXPECT_EQ(Pick(addresses, { 1, 4, 5 }), accounts.removedAddresses());
+
+		auto expectedAccountHistories = test::GenerateAccountHistories({
+			{ { { 1 } }, { { Height(2), RelVoterAmount(1) }, { Height(4), RelVoterAmount(9) }, { Height(7), RelVoterAmount(-1) } } },
+			{ { { 3 } }, { { Height(5), RelVoterAmount(5) } } },
+			{ { { 4 } }, { { Height(5), RelVoterAmount(4) } } }
+		});
+		test::AssertEqual(expectedAccountHistories, accounts.accountHistories());
+
+		auto expectedJournal = HeightAddressesMap{
+			{ Height(3), { Address{ { 3 } } } },
+			{ Height(4), { Address{ { 1 } }, Address{ { 3 } } } },
+			{ Height(5), { Address{ { 3 } }, Address{ { 4 } } } }
+		};
+		EXPECT_EQ(expectedJournal, accounts.accountHistoryJournal());
+	}
+
 	// endregion
 
 	// region updater - constructor
@@ -227,14 +313,6 @@ namespace catapult { namespace cache {
 			return addresses;
 		}
 
-		model::AddressSet Pick(const std::vector<Address>& addresses, std::initializer_list<size_t> indexes) {
-			model::AddressSet selectedAddresses;
-			for (auto index : indexes)
-				selectedAddresses.insert(addresses[index]);
-
-			return selectedAddresses;
-		}
-
 		auto& SelectAdded(test::DeltaElementsTestUtils::Wrapper<MemorySetType>& deltas) {
 			return deltas.Added;
 		}
@@ -567,6 +645,75 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region updater - address iteration
+
+	namespace {
+		std::vector<Address> CollectAddresses(const HighValueAccountsUpdater& updater) {
+			std::vector<Address> addresses;
+			updater.forEachAddress([&addresses](const auto& address) { addresses.push_back(address); });
+			return addresses;
+		}
+
+		std::vector<Address> CollectRemovedAddresses(const HighValueAccountsUpdater& updater) {
+			std::vector<Address> addresses;
+			updater.forEachRemovedAddress([&addresses](const auto& address) { addresses.push_back(address); });
+			return addresses;
+		}
+
+		void AssertAddressIteration(
+				const HighValueAccountsUpdater& updater,
+				const model::AddressSet& expectedAddresses,
+				const model::AddressSet& expectedRemovedAddresses) {
+			// Assert: each address is visited exactly once
+			auto addresses = CollectAddresses(updater);
+			EXPECT_EQ(expectedAddresses.size(), updater.numAddresses());
+			EXPECT_EQ(expectedAddresses.size(), addresses.size());
+			EXPECT_EQ(expectedAddresses, model::AddressSet(addresses.cbegin(), addresses.cend()));
+
+			auto removedAddresses = CollectRemovedAddresses(updater);
+			EXPECT_EQ(expectedRemovedAddresses.size(), updater.numRemovedAddresses());
+			EXPECT_EQ(expectedRemovedAddresses.size(), removedAddresses.size());
+			EXPECT_EQ(expectedRemovedAddresses, model::AddressSet(removedAddresses.cbegin(), removedAddresses.cend()));
+		}
+	}
+
+	TEST(TEST_CLASS, Updater_CanIterateOriginalAddresses) {
+		// Arrange:
+		auto addresses = GenerateRandomAddresses(4);
+		auto removedAddresses = GenerateRandomAddresses(3);
+		auto accounts = CreateAccounts(addresses, removedAddresses);
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act + Assert:
+		AssertAddressIteration(updater, addresses, removedAddresses);
+	}
+
+	TEST(TEST_CLASS, Updater_CanIterateAddressesWithPendingChanges) {
+		// Arrange: { 0, 1 } are treated as original accounts whereas { 2, 3 } are treated as added accounts
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, {
+			Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000)
+		});
+
+		// - add removed addresses at { 4, 5 }
+		addedAddresses.push_back(test::GenerateRandomByteArray<Address>());
+		addedAddresses.push_back(test::GenerateRandomByteArray<Address>());
+
+		auto accounts = CreateAccounts(
+				model::AddressSet(addedAddresses.cbegin(), addedAddresses.cbegin() + 2),
+				model::AddressSet(addedAddresses.cbegin() + 4, addedAddresses.cend()));
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act: { 1 } is erased from original addresses and { 2 } is added
+		updater.update(deltas.deltas());
+
+		// Assert: iteration is consistent with materialized addresses
+		AssertAddressIteration(updater, Pick(addedAddresses, { 0, 2 }), Pick(addedAddresses, { 4, 5, 1 }));
+		AssertAddressIteration(updater, updater.addresses(), updater.removedAddresses());
+	}
+
+	// endregion
+
 	// region updater - voter eligible accounts
 
 	namespace {
@@ -1264,9 +1411,102 @@ namespace catapult { namespace cache {
 
 	// endregion
 
-	// region updater - detachAccounts
+	// region updater - incremental changes
+
+	namespace {
+		model::AddressSet GetKeys(const AddressAccountHistoryMap& accountHistories) {
+			model::AddressSet addresses;
+			for (const auto& accountHistoryPair : accountHistories)
+				addresses.insert(accountHistoryPair.first);
+
+			return addresses;
+		}
+	}
+
+	TEST(TEST_CLASS, Updater_RollbackOnlyCopiesAccountHistoriesJournaledAtGreaterHeights) {
+		// Arrange:
+		auto accounts = HighValueAccounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.setHeight(Height(6));
+		updater.update(test::DeltaElementsTestUtils::Wrapper<MemorySetType>().deltas());
+
+		// Assert: only accounts with values at height 7 were copied and pruned
+		EXPECT_EQ(model::AddressSet({ Address{ { 1 } }, Address{ { 3 } } }), GetKeys(updater.changes().ModifiedAccountHistories));
+		EXPECT_TRUE(updater.changes().ErasedAccountHistories.empty());
+		EXPECT_EQ(Height(6), updater.changes().MaxJournalHeight);
+
+		auto expectedAccountHistories = test::GenerateAccountHistories({
+			{ { { 1 } }, { { Height(2), RelVoterAmount(1) }, { Height(4), RelVoterAmount(9) } } },
+			{ { { 2 } }, { { Height(2), RelVoterAmount(0) }, { Height(6), RelVoterAmount(-100) } } },
+			{ { { 3 } }, { { Height(3), RelVoterAmount(9) }, { Height(4), RelVoterAmount(-9) } } }
+		});
+		test::AssertEqual(expectedAccountHistories, updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_RollbackErasesAccountHistoriesWithoutAnyValues) {
+		// Arrange:
+		auto accounts = HighValueAccounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.setHeight(Height(1));
+		updater.update(test::DeltaElementsTestUtils::Wrapper<MemorySetType>().deltas());
+
+		// Assert:
+		EXPECT_TRUE(updater.changes().ModifiedAccountHistories.empty());
+		EXPECT_EQ(GetKeys(CreateThreeAccountHistories()), updater.changes().ErasedAccountHistories);
+		EXPECT_TRUE(updater.accountHistories().empty());
+
+		// Sanity: original accounts are unchanged
+		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_PruneDoesNotCopyAccountHistoriesWhenNoneHaveValuesLessThanPruneHeight) {
+		// Arrange:
+		auto accounts = HighValueAccounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.prune(Height(2));
+
+		// Assert:
+		EXPECT_TRUE(updater.changes().ModifiedAccountHistories.empty());
+		EXPECT_TRUE(updater.changes().ErasedAccountHistories.empty());
+		EXPECT_TRUE(updater.changes().AddedJournalEntries.empty());
+		test::AssertEqual(CreateThreeAccountHistories(), updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_PruneJournalsAllRetainedAccountHistoriesAtPruneHeight) {
+		// Arrange:
+		auto accounts = HighValueAccounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.prune(Height(3));
+
+		// Assert:
+		const auto& changes = updater.changes();
+		EXPECT_EQ(GetKeys(CreateThreeAccountHistories()), GetKeys(changes.ModifiedAccountHistories));
+		EXPECT_EQ(Height(3), changes.MinJournalHeight);
+		EXPECT_EQ(1u, changes.AddedJournalEntries.size());
+		EXPECT_EQ(GetKeys(CreateThreeAccountHistories()), changes.AddedJournalEntries.at(Height(3)));
+
+		// - account histories were pruned
+		auto expectedAccountHistories = test::GenerateAccountHistories({
+			{ { { 1 } }, { { Height(3), RelVoterAmount(1) }, { Height(4), RelVoterAmount(9) }, { Height(7), RelVoterAmount(-1) } } },
+			{ { { 2 } }, { { Height(3), RelVoterAmount(0) }, { Height(6), RelVoterAmount(-100) } } },
+			{ { { 3 } }, { { Height(3), RelVoterAmount(9) }, { Height(4), RelVoterAmount(-9) }, { Height(7), RelVoterAmount(8) } } }
+		});
+		test::AssertEqualBalanceHistoryOnly(expectedAccountHistories, updater.accountHistories());
+	}
+
+	// endregion
+
+	// region updater - detachChanges
 
-	TEST(TEST_CLASS, Updater_DetachAccountsReturnsExpectedHighValueAccounts) {
+	TEST(TEST_CLASS, Updater_DetachChangesReturnsExpectedHighValueAccountsChanges) {
 		// Arrange:
 		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
 		auto addedAddresses = AddAccountsWithBalances(deltas.Added, GetHarvesterEligibleTestBalances());
@@ -1280,22 +1520,63 @@ namespace catapult { namespace cache {
 		updater.update(deltas.deltas());
 
 		// Act:
-		auto accounts = updater.detachAccounts();
+		auto changes = updater.detachChanges();
 
-		// Assert:
-		EXPECT_EQ(Pick(addedAddresses, { 0, 2, 4, 5 }), accounts.addresses());
-		EXPECT_EQ(Pick(addedAddresses, { 1 }), accounts.removedAddresses());
+		// Assert: only changed accounts are present
+		EXPECT_EQ(Pick(addedAddresses, { 4, 5 }), changes.AddedAddresses);
+		EXPECT_EQ(Pick(addedAddresses, { 1 }), changes.ErasedAddresses);
+		EXPECT_EQ(Pick(addedAddresses, { 1 }), changes.AddedRemovedAddresses);
+		EXPECT_TRUE(changes.ErasedRemovedAddresses.empty());
 
 		// - notice that GetHarvesterEligibleTestBalances includes one account with min voter balance
-		auto expectedAccountHistories = CreateThreeAccountHistories();
-		expectedAccountHistories.emplace(addedAddresses[5], test::CreateAccountHistory({ { Height(9), Min_Voter_Balance } }));
-		test::AssertEqualBalanceHistoryOnly(expectedAccountHistories, accounts.accountHistories());
+		auto expectedAccountHistories = test::GenerateAccountHistories({ { addedAddresses[5], { { Height(9), Min_Voter_Balance } } } });
+		test::AssertEqualBalanceHistoryOnly(expectedAccountHistories, changes.ModifiedAccountHistories);
+		EXPECT_TRUE(changes.ErasedAccountHistories.empty());
 
-		// - updater is cleared
-		EXPECT_TRUE(updater.addresses().empty());
-		EXPECT_TRUE(updater.removedAddresses().empty());
+		EXPECT_EQ(1u, changes.AddedJournalEntries.size());
+		EXPECT_EQ(model::AddressSet({ addedAddresses[5] }), changes.AddedJournalEntries.at(Height(9)));
 
-		EXPECT_TRUE(updater.accountHistories().empty());
+		// - updater reflects original accounts
+		EXPECT_EQ(originalAccounts.addresses(), updater.addresses());
+		EXPECT_EQ(originalAccounts.removedAddresses(), updater.removedAddresses());
+		test::AssertEqual(originalAccounts.accountHistories(), updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_DetachedChangesCanBeAppliedToOriginalAccounts) {
+		// Arrange:
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, GetHarvesterEligibleTestBalances());
+
+		auto originalAccounts = HighValueAccounts(
+				model::AddressSet(addedAddresses.cbegin(), addedAddresses.cbegin() + 3),
+				model::AddressSet(),
+				CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), originalAccounts);
+		updater.setHeight(Height(9));
+		updater.update(deltas.deltas());
+
+		auto expectedAddresses = updater.addresses();
+		auto expectedRemovedAddresses = updater.removedAddresses();
+		auto expectedAccountHistories = updater.accountHistories();
+
+		// Act:
+		originalAccounts.apply(updater.detachChanges());
+
+		// Assert:
+		EXPECT_EQ(Pick(addedAddresses, { 0, 2, 4, 5 }), originalAccounts.addresses());
+		EXPECT_EQ(Pick(addedAddresses, { 1 }), originalAccounts.removedAddresses());
+		EXPECT_EQ(expectedAddresses, originalAccounts.addresses());
+		EXPECT_EQ(expectedRemovedAddresses, originalAccounts.removedAddresses());
+		test::AssertEqual(expectedAccountHistories, originalAccounts.accountHistories());
+
+		// - journal contains original and added entries
+		EXPECT_EQ(6u, originalAccounts.accountHistoryJournal().size());
+		EXPECT_EQ(model::AddressSet({ addedAddresses[5] }), originalAccounts.accountHistoryJournal().at(Height(9)));
+
+		// - updater reflects updated original accounts
+		EXPECT_EQ(originalAccounts.addresses(), updater.addresses());
+		EXPECT_EQ(originalAccounts.removedAddresses(), updater.removedAddresses());
+		test::AssertEqual(originalAccounts.accountHistories(), updater.accountHistories());
 	}
 
 	// endregion
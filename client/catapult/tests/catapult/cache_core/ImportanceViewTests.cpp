@@ -94,7 +94,7 @@ namespace catapult { namespace cache {
 			auto& accountState = accountStateIter.get();
 			accountState.ImportanceSnapshots.set(importance, importanceHeight);
 			accountState.Balances.credit(Harvesting_Mosaic_Id, balance);
-			cache.commit();
+			cache.commit(Height(100));
 		}
 
 		auto ConvertToImportanceHeight(Height height) {
@@ -105,7 +105,11 @@ namespace catapult { namespace cache {
 			auto options = Default_Cache_Options;
 			options.MinHarvesterBalance = minHarvesterBalance;
 			options.MaxHarvesterBalance = maxHarvesterBalance;
-			return std::make_unique<AccountStateCache>(CacheConfiguration(), options);
+
+			// enable snapshots so that all tests can be run against both views and snapshots
+			auto config = CacheConfiguration();
+			config.ShouldPublishSnapshots = true;
+			return std::make_unique<AccountStateCache>(config, options);
 		}
 
 		auto CreateAccountStateCache() {
@@ -147,7 +151,9 @@ namespace catapult { namespace cache {
 		auto pView = test::CreateImportanceView(*pCache);
 
 		// Act + Assert: mismatched key
-		AssertCannotFindImportance(*pView, test::GenerateRandomByteArray<Key>(), height);
+		auto otherKey = test::GenerateRandomByteArray<Key>();
+		AssertCannotFindImportance(*pView, otherKey, height);
+		AssertCannotFindImportance(ImportanceView(*pCache->snapshot()), otherKey, height);
 	}
 
 	KEY_TRAITS_BASED_TEST(CannotRetrieveImportanceForAccountAtMismatchedHeight) {
@@ -159,6 +165,7 @@ namespace catapult { namespace cache {
 
 		// Act + Assert: mismatched height
 		AssertCannotFindImportance(*pView, key, Height(3333));
+		AssertCannotFindImportance(ImportanceView(*pCache->snapshot()), key, Height(3333));
 	}
 
 	namespace {
@@ -180,6 +187,14 @@ namespace catapult { namespace cache {
 			EXPECT_TRUE(foundImportance);
 			EXPECT_EQ(accountImportance, importance);
 			EXPECT_EQ(accountImportance, importanceOrDefault);
+
+			// - snapshot view returns same importance
+			auto pSnapshot = pCache->snapshot();
+			ImportanceView snapshotView(*pSnapshot);
+			Importance snapshotImportance;
+			EXPECT_TRUE(snapshotView.tryGetAccountImportance(key, height, snapshotImportance));
+			EXPECT_EQ(accountImportance, snapshotImportance);
+			EXPECT_EQ(accountImportance, snapshotView.getAccountImportanceOrDefault(key, height));
 		}
 	}
 
@@ -203,10 +218,23 @@ namespace catapult { namespace cache {
 			}
 		};
 
+		struct CanHarvestViaSnapshotTraits {
+			static bool CanHarvest(const AccountStateCache& cache, const Key& publicKey, Height height) {
+				auto pSnapshot = cache.snapshot();
+				ImportanceView view(*pSnapshot);
+				return view.canHarvest(model::PublicKeyToAddress(publicKey, Default_Cache_Options.NetworkIdentifier), height);
+			}
+		};
+
 		struct AddressCanHarvestViaMemberTraits : public AddressTraits, public CanHarvestViaMemberTraits {};
 		struct PublicKeyCanHarvestViaMemberTraits : public PublicKeyTraits, public CanHarvestViaMemberTraits {};
 		struct MainAccountCanHarvestViaMemberTraits : public MainAccountTraits, public CanHarvestViaMemberTraits {};
 		struct RemoteAccountCanHarvestViaMemberTraits : public RemoteAccountTraits, public CanHarvestViaMemberTraits {};
+
+		struct AddressCanHarvestViaSnapshotTraits : public AddressTraits, public CanHarvestViaSnapshotTraits {};
+		struct PublicKeyCanHarvestViaSnapshotTraits : public PublicKeyTraits, public CanHarvestViaSnapshotTraits {};
+		struct MainAccountCanHarvestViaSnapshotTraits : public MainAccountTraits, public CanHarvestViaSnapshotTraits {};
+		struct RemoteAccountCanHarvestViaSnapshotTraits : public RemoteAccountTraits, public CanHarvestViaSnapshotTraits {};
 	}
 
 #define CAN_HARVEST_TRAITS_BASED_TEST(TEST_NAME) \
@@ -215,6 +243,14 @@ namespace catapult { namespace cache {
 	TEST(TEST_CLASS, TEST_NAME##_PublicKey) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PublicKeyCanHarvestViaMemberTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_MainAccount) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<MainAccountCanHarvestViaMemberTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_RemoteAccount) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<RemoteAccountCanHarvestViaMemberTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Address_Snapshot) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<AddressCanHarvestViaSnapshotTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_PublicKey_Snapshot) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PublicKeyCanHarvestViaSnapshotTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_MainAccount_Snapshot) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<MainAccountCanHarvestViaSnapshotTraits>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_RemoteAccount_Snapshot) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<RemoteAccountCanHarvestViaSnapshotTraits>(); \
+	} \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	CAN_HARVEST_TRAITS_BASED_TEST(CannotHarvestWhenAccountIsUnknown) {
@@ -316,13 +352,14 @@ namespace catapult { namespace cache {
 				auto delta = pCache->createDelta();
 				auto accountStateIter = RemoteAccountTraits::AddAccount(*delta, publicKey, Height(100));
 				mutator(accountStateIter.get());
-				pCache->commit();
+				pCache->commit(Height(100));
 			}
 
 			auto pView = test::CreateImportanceView(*pCache);
 
 			// Act + Assert:
 			EXPECT_THROW(TTraits::Act(*pView, publicKey), catapult_runtime_error);
+			EXPECT_THROW(TTraits::Act(ImportanceView(*pCache->snapshot()), publicKey), catapult_runtime_error);
 		}
 	}
 
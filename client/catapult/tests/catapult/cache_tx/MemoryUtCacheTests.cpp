@@ -522,6 +522,137 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (ordered)
+
+	namespace {
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithFeeMultipliers(
+				Timestamp::ValueType startDeadline,
+				const std::vector<uint32_t>& feeMultipliers) {
+			auto i = 0u;
+			auto transactionInfos = test::CreateTransactionInfos(feeMultipliers.size(), [startDeadline](auto index) {
+				return Timestamp(startDeadline + index);
+			});
+			for (auto& transactionInfo : transactionInfos) {
+				auto& transaction = const_cast<model::Transaction&>(*transactionInfo.pEntity);
+				transaction.MaxFee = Amount(transaction.Size * feeMultipliers[i++]);
+			}
+
+			return transactionInfos;
+		}
+
+		std::unique_ptr<MemoryUtCache> CreateCacheWithFeeMultipliers() {
+			// deadlines 1 - 8
+			auto pCache = std::make_unique<MemoryUtCache>(Default_Options);
+			test::AddAll(*pCache, CreateTransactionInfosWithFeeMultipliers(1, { 30, 10, 20, 10, 40, 20, 30, 10 }));
+			return pCache;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractDeadlines(
+				const MemoryUtCache& cache,
+				UtCacheIterationOrder order,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEach(order, [numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+			return rawDeadlines;
+		}
+	}
+
+	TEST(TEST_CLASS, OrderedForEachForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractDeadlines(cache, UtCacheIterationOrder::Arrival).empty());
+		EXPECT_TRUE(ExtractDeadlines(cache, UtCacheIterationOrder::Max_Fee_Multiplier_Ascending).empty());
+		EXPECT_TRUE(ExtractDeadlines(cache, UtCacheIterationOrder::Max_Fee_Multiplier_Descending).empty());
+	}
+
+	TEST(TEST_CLASS, OrderedForEachCanForwardTransactionsByArrival) {
+		// Arrange:
+		auto pCache = CreateCacheWithFeeMultipliers();
+
+		// Act:
+		auto deadlines = ExtractDeadlines(*pCache, UtCacheIterationOrder::Arrival);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4, 5, 6, 7, 8 }), deadlines);
+	}
+
+	TEST(TEST_CLASS, OrderedForEachCanForwardTransactionsByMaxFeeMultiplierAscending) {
+		// Arrange:
+		auto pCache = CreateCacheWithFeeMultipliers();
+
+		// Act:
+		auto deadlines = ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Ascending);
+
+		// Assert: older transactions are first when multipliers are equal
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 8, 3, 6, 1, 7, 5 }), deadlines);
+	}
+
+	TEST(TEST_CLASS, OrderedForEachCanForwardTransactionsByMaxFeeMultiplierDescending) {
+		// Arrange:
+		auto pCache = CreateCacheWithFeeMultipliers();
+
+		// Act:
+		auto deadlines = ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Descending);
+
+		// Assert: older transactions are first when multipliers are equal
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 5, 1, 7, 3, 6, 2, 4, 8 }), deadlines);
+	}
+
+	TEST(TEST_CLASS, OrderedForEachForwardsSubsetOfTransactionsWhenShortCircuited) {
+		// Arrange:
+		auto pCache = CreateCacheWithFeeMultipliers();
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3 }), ExtractDeadlines(*pCache, UtCacheIterationOrder::Arrival, 3));
+		EXPECT_EQ(
+				std::vector<Timestamp::ValueType>({ 2, 4, 8, 3 }),
+				ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Ascending, 4));
+		EXPECT_EQ(
+				std::vector<Timestamp::ValueType>({ 5, 1 }),
+				ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Descending, 2));
+	}
+
+	TEST(TEST_CLASS, OrderedForEachReflectsAddsAndRemoves) {
+		// Arrange: remove transactions with deadlines 1 and 6 and add transaction with deadline 9
+		auto pCache = CreateCacheWithFeeMultipliers();
+		{
+			auto transactionInfos = test::ExtractTransactionInfos(pCache->view(), 8);
+			auto hash1 = transactionInfos[0]->EntityHash;
+			auto hash6 = transactionInfos[5]->EntityHash;
+
+			auto modifier = pCache->modifier();
+			modifier.remove(hash1);
+			modifier.remove(hash6);
+		}
+
+		test::AddAll(*pCache, CreateTransactionInfosWithFeeMultipliers(9, { 30 }));
+
+		// Act + Assert:
+		EXPECT_EQ(
+				std::vector<Timestamp::ValueType>({ 2, 4, 8, 3, 7, 9, 5 }),
+				ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Ascending));
+		EXPECT_EQ(
+				std::vector<Timestamp::ValueType>({ 5, 7, 9, 3, 2, 4, 8 }),
+				ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Descending));
+	}
+
+	TEST(TEST_CLASS, OrderedForEachForwardsNoTransactionInfosAfterRemoveAll) {
+		// Arrange:
+		auto pCache = CreateCacheWithFeeMultipliers();
+		pCache->modifier().removeAll();
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Ascending).empty());
+		EXPECT_TRUE(ExtractDeadlines(*pCache, UtCacheIterationOrder::Max_Fee_Multiplier_Descending).empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsShortHashesForAllTransactions) {
@@ -21,6 +21,7 @@
 
 #include "catapult/cache_tx/MemoryUtCacheUtils.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -40,15 +41,6 @@ namespace catapult { namespace cache {
 			return static_cast<uint32_t>(1 + (base > deadline ? base - deadline : deadline - base).unwrap());
 		}
 
-		bool CompareNaturalOrder(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
-			// test::CreateSeededMemoryUtCache seeds with transactions sorted by deadline
-			return pLhs->pEntity->Deadline < pRhs->pEntity->Deadline;
-		}
-
-		bool CompareReverseOrder(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
-			return pLhs->pEntity->Deadline > pRhs->pEntity->Deadline;
-		}
-
 		bool SelectAllFilter(const model::TransactionInfo&) {
 			return true;
 		}
@@ -65,9 +57,9 @@ namespace catapult { namespace cache {
 			}
 		};
 
-		struct GetFirstSortedFilteredTraits {
+		struct GetFirstOrderedFilteredTraits {
 			static auto GetFirst(const MemoryUtCacheView& utCacheView, uint32_t count, const EmbeddedCountRetriever& countRetriever) {
-				return GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, CompareNaturalOrder, SelectAllFilter);
+				return GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, UtCacheIterationOrder::Arrival, SelectAllFilter);
 			}
 		};
 	}
@@ -76,7 +68,7 @@ namespace catapult { namespace cache {
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_Ordinal) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstOrdinalTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Filtered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstFilteredTraits>(); } \
-	TEST(TEST_CLASS, TEST_NAME##_SortedFiltered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstSortedFilteredTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_OrderedFiltered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstOrderedFilteredTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// endregion
@@ -154,81 +146,53 @@ namespace catapult { namespace cache {
 
 	// endregion
 
-	// region SortedFiltered
+	// region OrderedFiltered
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesSorting_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		auto utCacheView = pUtCache->view();
+	namespace {
+		void SetMaxFeeMultipliers(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				const std::vector<uint32_t>& feeMultipliers) {
+			auto i = 0u;
+			for (const auto& transactionInfo : transactionInfos) {
+				auto& transaction = const_cast<model::Transaction&>(*transactionInfo.pEntity);
+				transaction.MaxFee = Amount(transaction.Size * feeMultipliers[i++]);
+			}
+		}
 
-		// Act: apply a reverse sort
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, CompareReverseOrder, [](const auto&) {
-			return true;
-		});
+		void AssertOrderedFiltered(UtCacheIterationOrder order, const std::vector<Timestamp::ValueType>& expectedDeadlines) {
+			// Arrange: deadlines 1 - 8
+			auto transactionInfos = test::CreateTransactionInfos(8);
+			SetMaxFeeMultipliers(transactionInfos, { 30, 10, 20, 10, 40, 20, 30, 10 });
 
-		// Assert: (9, 8, 7) should be returned; if count was applied first, wrong (2, 1, 0) would be returned
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 10);
-		ASSERT_EQ(3u, transactionInfos.size());
-		for (auto i = 0u; i < transactionInfos.size(); ++i)
-			test::AssertEqual(*allTransactionInfos[10 - i - 1], *transactionInfos[i], "transaction at " + std::to_string(i));
-	}
+			MemoryUtCache utCache(MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1)));
+			test::AddAll(utCache, transactionInfos);
+			auto utCacheView = utCache.view();
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesStableSorting_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		test::AddAll(*pUtCache, test::CreateTransactionInfos(4, [](auto i) {
-			return 0 == i % 2 ? Timestamp(10) : Timestamp(9);
-		}));
-		auto utCacheView = pUtCache->view();
+			// Act: filter deadline 4 txes
+			auto transactionInfoPointers = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, order, [](
+					const auto& transactionInfo) {
+				return Timestamp(4) != transactionInfo.pEntity->Deadline;
+			});
 
-		// Act: apply a reverse sort
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 4, CountAsOne, CompareReverseOrder, [](const auto&) {
-			return true;
-		});
+			// Assert:
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			for (const auto* pTransactionInfo : transactionInfoPointers)
+				rawDeadlines.push_back(pTransactionInfo->pEntity->Deadline.unwrap());
 
-		// Assert:
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 14);
-		ASSERT_EQ(4u, transactionInfos.size());
-		test::AssertEqual(*allTransactionInfos[9], *transactionInfos[0], "transaction at 0");
-		test::AssertEqual(*allTransactionInfos[10], *transactionInfos[1], "transaction at 1");
-		test::AssertEqual(*allTransactionInfos[12], *transactionInfos[2], "transaction at 2");
-		test::AssertEqual(*allTransactionInfos[8], *transactionInfos[3], "transaction at 3");
+			EXPECT_EQ(expectedDeadlines, rawDeadlines);
+		}
 	}
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesFiltering_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		auto utCacheView = pUtCache->view();
-
-		// Act: filter odd deadline txes
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, CompareNaturalOrder, [](
-				const auto& transactionInfo) {
-			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
-		});
-
-		// Assert: (1, 3, 5) should be returned; if count was applied first, wrong (1) would be returned
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 10);
-		ASSERT_EQ(3u, transactionInfos.size());
-		for (auto i = 0u; i < transactionInfos.size(); ++i)
-			test::AssertEqual(*allTransactionInfos[1 + i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesArrivalOrderAndFiltering_OrderedFiltered) {
+		AssertOrderedFiltered(UtCacheIterationOrder::Arrival, { 1, 2, 3 });
 	}
 
-	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesSortingAndFiltering_SortedFiltered) {
-		// Arrange:
-		auto pUtCache = test::CreateSeededMemoryUtCache(10);
-		auto utCacheView = pUtCache->view();
-
-		// Act: apply a reverse sort AND filter odd deadline txes
-		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, CompareReverseOrder, [](
-				const auto& transactionInfo) {
-			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
-		});
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesMaxFeeMultiplierAscendingOrderAndFiltering_OrderedFiltered) {
+		AssertOrderedFiltered(UtCacheIterationOrder::Max_Fee_Multiplier_Ascending, { 2, 8, 3 });
+	}
 
-		// Assert: (9, 7, 5) should be returned; if count was applied first, wrong (1) would be returned
-		auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, 10);
-		ASSERT_EQ(3u, transactionInfos.size());
-		for (auto i = 0u; i < transactionInfos.size(); ++i)
-			test::AssertEqual(*allTransactionInfos[9 - i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesMaxFeeMultiplierDescendingOrderAndFiltering_OrderedFiltered) {
+		AssertOrderedFiltered(UtCacheIterationOrder::Max_Fee_Multiplier_Descending, { 5, 1, 7 });
 	}
 
 	// endregion
@@ -99,7 +99,7 @@ namespace catapult { namespace chain {
 
 		// region test utils
 
-		enum class ConsumerMode { Normal, Full };
+		enum class ConsumerMode { Normal, Full, Full_After_First_Range };
 
 		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
 			auto pVerifiableBlock = test::GenerateBlockWithTransactions(0, Default_Height);
@@ -112,7 +112,9 @@ namespace catapult { namespace chain {
 				++context.BlockRangeConsumerCalls;
 				context.BlockRangeSourceIdentities.push_back(range.SourceIdentity);
 				context.ProcessingComplete = processingComplete;
-				return ConsumerMode::Normal == mode ? context.BlockRangeConsumerCalls : 0;
+				auto isAccepted = ConsumerMode::Normal == mode
+						|| (ConsumerMode::Full_After_First_Range == mode && 1 == context.BlockRangeConsumerCalls);
+				return isAccepted ? context.BlockRangeConsumerCalls : 0;
 			};
 
 			return CreateChainSynchronizer(pLocal, context.Config, finalizedHeightSupplier, blockRangeConsumer);
@@ -639,6 +641,150 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region chain synchronization - streaming
+
+	namespace {
+		TestContext CreateStreamingTestContext(size_t numLocalHashes, size_t forkDepth = 0) {
+			// allow unprocessed elements to hold many ranges
+			auto context = CreateTestContextWithHashes(numLocalHashes, 10, forkDepth);
+			context.Config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8).bytes32();
+			context.Config.MaxBlockRangesPerSyncAttempt = 3;
+			return context;
+		}
+	}
+
+	TEST(TEST_CLASS, SuccessfulInteractionWhenMultipleRangesAreStreamed) {
+		// Arrange:
+		auto context = CreateStreamingTestContext(9);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: each range was forwarded to the consumer separately
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 3);
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2), Default_Height + Height(4) });
+	}
+
+	TEST(TEST_CLASS, SuccessfulInteractionWhenStreamingIsStoppedBecauseRemoteRunsOutOfBlocks) {
+		// Arrange:
+		auto context = CreateStreamingTestContext(9);
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 2, 0 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: successful because first range was forwarded to the consumer
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2) });
+	}
+
+	TEST(TEST_CLASS, StreamingStartsAfterForkHasBeenPulled) {
+		// Arrange:
+		// - common block has height 10 + 4 (fork depth 6)
+		// - pulls 2 blocks at time: 3 attempts needed to pull 6 blocks, which are forwarded as a single range
+		constexpr auto Common_Block_Height = Height(14);
+
+		auto context = CreateStreamingTestContext(4, 6);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 3);
+		AssertRequestHeights(context, {
+			Common_Block_Height + Height(1),
+			Common_Block_Height + Height(3),
+			Common_Block_Height + Height(5),
+			Common_Block_Height + Height(7),
+			Common_Block_Height + Height(9)
+		});
+	}
+
+	TEST(TEST_CLASS, StreamingIsStoppedWhenUnprocessedElementsAreFull) {
+		// Arrange: the container is full after the first range
+		auto context = CreateStreamingTestContext(9);
+		context.Config.MaxChainBytesPerSyncAttempt = sizeof(BlockHeader) / 3 - 1;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertRequestHeights(context, { Default_Height });
+	}
+
+	TEST(TEST_CLASS, StreamingIsStoppedWhenConsumerRejectsRange) {
+		// Arrange:
+		auto context = CreateStreamingTestContext(9);
+		auto synchronizer = CreateSynchronizer(context, ConsumerMode::Full);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		AssertSync(context, 1);
+		AssertRequestHeights(context, { Default_Height });
+	}
+
+	TEST(TEST_CLASS, StreamingIsStoppedWhenConsumerRejectsStreamedRange) {
+		// Arrange:
+		auto context = CreateStreamingTestContext(9);
+		auto synchronizer = CreateSynchronizer(context, ConsumerMode::Full_After_First_Range);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: successful because first range was accepted by the consumer
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 2);
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2) });
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenStreamedRangeRequestFails) {
+		// Arrange: only the first blocks from request succeeds
+		auto context = CreateStreamingTestContext(9);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From, 1);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: failure is reported but first range was still forwarded to the consumer
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		AssertSync(context, 1);
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2) });
+	}
+
+	TEST(TEST_CLASS, CanSyncAfterStreamedRangeRequestFails) {
+		// Arrange: only the first blocks from request succeeds
+		auto context = CreateStreamingTestContext(9);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From, 1);
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// - clear the exception and finish processing the first range
+		context.pChainApi->setError(MockChainApi::EntryPoint::None);
+		context.ProcessingComplete(1, CreateContinueResult());
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: the next sync attempt streams all ranges
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 4);
+	}
+
+	// endregion
+
 	// region recoverability
 
 	namespace {
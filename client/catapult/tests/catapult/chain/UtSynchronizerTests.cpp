@@ -27,6 +27,8 @@
 
 namespace catapult { namespace chain {
 
+#define TEST_CLASS UtSynchronizerTests
+
 	namespace {
 		using MockRemoteApi = mocks::MockTransactionApi;
 
@@ -100,4 +102,126 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_CONDITIONAL_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region reconciliation
+
+	namespace {
+		struct ReconciliationTestContext {
+		public:
+			explicit ReconciliationTestContext(uint32_t numTableCells)
+					: ShortHashes(UtSynchronizerTraits::CreateRequestRange(5))
+					, Transactions(test::CreateTransactionEntityRange(3))
+					, Api(Transactions)
+					, NumConsumerCalls(0)
+					, Synchronizer(CreateUtReconciliationSynchronizer(
+							numTableCells,
+							BlockFeeMultiplier(17),
+							[]() { return Timestamp(84); },
+							[&shortHashes = ShortHashes]() { return model::ShortHashRange::CopyRange(shortHashes); },
+							[this](auto&& range) {
+								++NumConsumerCalls;
+								ConsumedTransactions = std::move(range.Range);
+							},
+							[]() { return true; }))
+			{}
+
+		public:
+			model::ShortHashRange ShortHashes;
+			model::TransactionRange Transactions;
+			MockRemoteApi Api;
+
+			size_t NumConsumerCalls;
+			model::TransactionRange ConsumedTransactions;
+
+			RemoteNodeSynchronizer<api::RemoteTransactionApi> Synchronizer;
+		};
+
+		utils::ShortHashIblt CreateTable(uint32_t numTableCells, const model::ShortHashRange& shortHashes) {
+			utils::ShortHashIblt iblt(numTableCells);
+			for (const auto& shortHash : shortHashes)
+				iblt.insert(shortHash);
+
+			return iblt;
+		}
+	}
+
+	TEST(TEST_CLASS, ReconciliationSynchronizerSendsShortHashTableWhenRemoteCanDecode) {
+		// Arrange:
+		ReconciliationTestContext context(30);
+
+		// Act:
+		auto code = context.Synchronizer(context.Api).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		test::AssertEqualRange(context.Transactions, context.ConsumedTransactions, "consumed transactions");
+
+		// - only a reconcile request was sent
+		EXPECT_TRUE(context.Api.utRequests().empty());
+		ASSERT_EQ(1u, context.Api.reconcileRequests().size());
+
+		const auto& request = context.Api.reconcileRequests()[0];
+		EXPECT_EQ(Timestamp(84), request.Deadline);
+		EXPECT_EQ(BlockFeeMultiplier(17), request.FeeMultiplier);
+
+		auto expectedTable = CreateTable(30, context.ShortHashes);
+		ASSERT_EQ(expectedTable.size(), request.Cells.size());
+		EXPECT_EQ_MEMORY(expectedTable.data(), request.Cells.data(), expectedTable.size() * sizeof(utils::ShortHashIblt::Cell));
+	}
+
+	TEST(TEST_CLASS, ReconciliationSynchronizerPullsWithAllShortHashesWhenRemoteCannotDecode) {
+		// Arrange:
+		ReconciliationTestContext context(30);
+		context.Api.setReconcileDecoded(false);
+
+		// Act:
+		auto code = context.Synchronizer(context.Api).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		test::AssertEqualRange(context.Transactions, context.ConsumedTransactions, "consumed transactions");
+
+		// - reconcile request was followed by a pull request
+		EXPECT_EQ(1u, context.Api.reconcileRequests().size());
+		ASSERT_EQ(1u, context.Api.utRequests().size());
+
+		const auto& request = context.Api.utRequests()[0];
+		EXPECT_EQ(Timestamp(84), request.Deadline);
+		EXPECT_EQ(BlockFeeMultiplier(17), request.FeeMultiplier);
+		test::AssertEqualRange(context.ShortHashes, request.ShortHashes, "short hashes");
+	}
+
+	TEST(TEST_CLASS, ReconciliationSynchronizerFailsWhenReconcileRequestFails) {
+		// Arrange:
+		ReconciliationTestContext context(30);
+		context.Api.setError(MockRemoteApi::EntryPoint::Reconcile_Transactions);
+
+		// Act:
+		auto code = context.Synchronizer(context.Api).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+		EXPECT_EQ(1u, context.Api.reconcileRequests().size());
+		EXPECT_TRUE(context.Api.utRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ReconciliationSynchronizerPullsWithAllShortHashesWhenTableIsEmpty) {
+		// Arrange:
+		ReconciliationTestContext context(0);
+
+		// Act:
+		auto code = context.Synchronizer(context.Api).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		EXPECT_TRUE(context.Api.reconcileRequests().empty());
+		ASSERT_EQ(1u, context.Api.utRequests().size());
+		test::AssertEqualRange(context.ShortHashes, context.Api.utRequests()[0].ShortHashes, "short hashes");
+	}
+
+	// endregion
 }}
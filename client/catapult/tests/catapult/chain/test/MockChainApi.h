@@ -49,6 +49,8 @@ namespace catapult { namespace mocks {
 				: api::RemoteChainApi({ test::GenerateRandomByteArray<Key>(), "fake-host-from-mock-chain-api" })
 				, m_score(score)
 				, m_errorEntryPoint(EntryPoint::None)
+				, m_numSuccessfulErrorEntryPointCalls(0)
+				, m_numErrorEntryPointCalls(0)
 				, m_numBlocksPerBlocksFromRequest({ 2 }) {
 			m_blocks.emplace(Height(0), std::move(pLastBlock));
 		}
@@ -59,8 +61,11 @@ namespace catapult { namespace mocks {
 
 	public:
 		/// Sets the entry point where an exception should occur to \a entryPoint.
-		void setError(EntryPoint entryPoint) {
+		/// \note The first \a numSuccessfulCalls calls to the entry point succeed.
+		void setError(EntryPoint entryPoint, size_t numSuccessfulCalls = 0) {
 			m_errorEntryPoint = entryPoint;
+			m_numSuccessfulErrorEntryPointCalls = numSuccessfulCalls;
+			m_numErrorEntryPointCalls = 0;
 		}
 
 		/// Sets the \a delay that chain requests should wait before returning a response.
@@ -182,7 +187,10 @@ namespace catapult { namespace mocks {
 
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
-			return m_errorEntryPoint == entryPoint;
+			if (m_errorEntryPoint != entryPoint)
+				return false;
+
+			return m_numErrorEntryPointCalls++ >= m_numSuccessfulErrorEntryPointCalls;
 		}
 
 		Height chainHeight() const {
@@ -225,6 +233,8 @@ namespace catapult { namespace mocks {
 	private:
 		model::ChainScore m_score;
 		EntryPoint m_errorEntryPoint;
+		size_t m_numSuccessfulErrorEntryPointCalls;
+		mutable size_t m_numErrorEntryPointCalls;
 		std::map<Height, model::HashRange> m_hashes;
 		std::map<Height, std::shared_ptr<model::Block>> m_blocks;
 
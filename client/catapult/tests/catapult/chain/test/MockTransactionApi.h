@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include "tests/test/nodeps/Random.h"
 
 namespace catapult { namespace mocks {
@@ -31,7 +32,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Reconcile_Transactions
 		};
 
 		struct UtRequest {
@@ -40,12 +42,19 @@ namespace catapult { namespace mocks {
 			model::ShortHashRange ShortHashes;
 		};
 
+		struct ReconcileRequest {
+			Timestamp Deadline;
+			BlockFeeMultiplier FeeMultiplier;
+			std::vector<utils::ShortHashIblt::Cell> Cells;
+		};
+
 	public:
 		/// Creates a transaction api around a range of transactions (\a transactionRange).
 		explicit MockTransactionApi(const model::TransactionRange& transactionRange)
 				: api::RemoteTransactionApi({ test::GenerateRandomByteArray<Key>(), "fake-host-from-mock-transaction-api" })
 				, m_transactionRange(model::TransactionRange::CopyRange(transactionRange))
 				, m_errorEntryPoint(EntryPoint::None)
+				, m_isReconcileDecoded(true)
 		{}
 
 	public:
@@ -54,11 +63,21 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets whether or not reconcile transactions responses are decoded (\a isReconcileDecoded).
+		void setReconcileDecoded(bool isReconcileDecoded) {
+			m_isReconcileDecoded = isReconcileDecoded;
+		}
+
 		/// Gets a vector of parameters that were passed to the unconfirmed transactions requests.
 		const auto& utRequests() const {
 			return m_utRequests;
 		}
 
+		/// Gets a vector of parameters that were passed to the reconcile transactions requests.
+		const auto& reconcileRequests() const {
+			return m_reconcileRequests;
+		}
+
 	public:
 		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a minDeadline, \a minFeeMultiplier and \a knownShortHashes parameters are captured.
@@ -73,6 +92,26 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactionRange));
 		}
 
+		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Reconcile_Transactions.
+		/// \note The \a minDeadline, \a minFeeMultiplier and \a knownShortHashesTable parameters are captured.
+		/// \note No transactions are returned when reconcile responses are configured to be undecoded.
+		thread::future<api::ReconciledTransactions> reconcileTransactions(
+				Timestamp minDeadline,
+				BlockFeeMultiplier minFeeMultiplier,
+				const utils::ShortHashIblt& knownShortHashesTable) const override {
+			const auto* pCells = knownShortHashesTable.data();
+			m_reconcileRequests.push_back({ minDeadline, minFeeMultiplier, { pCells, pCells + knownShortHashesTable.size() } });
+			if (shouldRaiseException(EntryPoint::Reconcile_Transactions))
+				return CreateFutureException<api::ReconciledTransactions>("reconcile transactions error has been set");
+
+			api::ReconciledTransactions reconciledTransactions;
+			reconciledTransactions.IsDecoded = m_isReconcileDecoded;
+			if (m_isReconcileDecoded)
+				reconciledTransactions.Transactions = model::TransactionRange::CopyRange(m_transactionRange);
+
+			return thread::make_ready_future(std::move(reconciledTransactions));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -86,6 +125,8 @@ namespace catapult { namespace mocks {
 	private:
 		model::TransactionRange m_transactionRange;
 		EntryPoint m_errorEntryPoint;
+		bool m_isReconcileDecoded;
 		mutable std::vector<UtRequest> m_utRequests;
+		mutable std::vector<ReconcileRequest> m_reconcileRequests;
 	};
 }}
@@ -118,10 +118,18 @@ namespace catapult { namespace config {
 
 			EXPECT_FALSE(config.EnableAddressReuse);
 			EXPECT_FALSE(config.EnableSingleThreadPool);
+			EXPECT_FALSE(config.EnablePerWorkerIoContexts);
+			EXPECT_FALSE(config.EnableWorkerThreadPinning);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
+			EXPECT_FALSE(config.EnableCacheSnapshots);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_FALSE(config.EnableStorageCompression);
+			EXPECT_EQ(3u, config.StorageCompressionLevel);
+			EXPECT_FALSE(config.EnableSpoolSegmentFiles);
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(500), config.SpoolPollInterval);
+			EXPECT_EQ(100u, config.MaxSpoolBlockChangeBatchSize);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -129,6 +137,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(84u, config.MaxHashesPerSyncAttempt);
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.MaxBlockRangesPerSyncAttempt);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -140,6 +149,8 @@ namespace catapult { namespace config {
 			EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_FALSE(config.EnableUnconfirmedTransactionsReconciliation);
+			EXPECT_EQ(300u, config.UnconfirmedTransactionsReconciliationTableSize);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -41,10 +41,18 @@ namespace catapult { namespace config {
 
 							{ "enableAddressReuse", "true" },
 							{ "enableSingleThreadPool", "true" },
+							{ "enablePerWorkerIoContexts", "true" },
+							{ "enableWorkerThreadPinning", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
+							{ "enableCacheSnapshots", "true" },
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "enableStorageCompression", "true" },
+							{ "storageCompressionLevel", "19" },
+							{ "enableSpoolSegmentFiles", "true" },
+							{ "spoolPollInterval", "17ms" },
+							{ "maxSpoolBlockChangeBatchSize", "37" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -52,6 +60,7 @@ namespace catapult { namespace config {
 							{ "maxHashesPerSyncAttempt", "74" },
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxBlockRangesPerSyncAttempt", "3" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -63,6 +72,8 @@ namespace catapult { namespace config {
 							{ "transactionSelectionStrategy", "maximize-fee" },
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98MB" },
+							{ "enableUnconfirmedTransactionsReconciliation", "true" },
+							{ "unconfirmedTransactionsReconciliationTableSize", "456" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -165,10 +176,18 @@ namespace catapult { namespace config {
 
 				EXPECT_FALSE(config.EnableAddressReuse);
 				EXPECT_FALSE(config.EnableSingleThreadPool);
+				EXPECT_FALSE(config.EnablePerWorkerIoContexts);
+				EXPECT_FALSE(config.EnableWorkerThreadPinning);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
+				EXPECT_FALSE(config.EnableCacheSnapshots);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_FALSE(config.EnableStorageCompression);
+				EXPECT_EQ(0u, config.StorageCompressionLevel);
+				EXPECT_FALSE(config.EnableSpoolSegmentFiles);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(0), config.SpoolPollInterval);
+				EXPECT_EQ(0u, config.MaxSpoolBlockChangeBatchSize);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -176,6 +195,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxBlockRangesPerSyncAttempt);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -187,6 +207,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_FALSE(config.EnableUnconfirmedTransactionsReconciliation);
+				EXPECT_EQ(0u, config.UnconfirmedTransactionsReconciliationTableSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -262,10 +284,18 @@ namespace catapult { namespace config {
 
 				EXPECT_TRUE(config.EnableAddressReuse);
 				EXPECT_TRUE(config.EnableSingleThreadPool);
+				EXPECT_TRUE(config.EnablePerWorkerIoContexts);
+				EXPECT_TRUE(config.EnableWorkerThreadPinning);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
+				EXPECT_TRUE(config.EnableCacheSnapshots);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_TRUE(config.EnableStorageCompression);
+				EXPECT_EQ(19u, config.StorageCompressionLevel);
+				EXPECT_TRUE(config.EnableSpoolSegmentFiles);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(17), config.SpoolPollInterval);
+				EXPECT_EQ(37u, config.MaxSpoolBlockChangeBatchSize);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -273,6 +303,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(74u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(3u, config.MaxBlockRangesPerSyncAttempt);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -284,6 +315,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Maximize_Fee, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(98), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_TRUE(config.EnableUnconfirmedTransactionsReconciliation);
+				EXPECT_EQ(456u, config.UnconfirmedTransactionsReconciliationTableSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -423,7 +423,7 @@ namespace catapult { namespace consumers {
 					return std::make_unique<PruneAwareSubCacheView>(m_pruneIdentifiers);
 				}
 
-				void commit() override
+				void commit(Height) override
 				{}
 
 			private:
@@ -120,7 +120,7 @@ namespace catapult { namespace crypto {
 			// Arrange:
 			DataHolder dataHolder;
 			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			std::unordered_set<size_t> failedIndexes{ 1, 17, 58, 70, 98 };
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
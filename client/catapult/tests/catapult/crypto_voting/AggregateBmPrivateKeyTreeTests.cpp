@@ -314,6 +314,87 @@ namespace catapult { namespace crypto {
 		}
 	}
 
+	namespace {
+		class DelayedTreeFactory {
+		public:
+			explicit DelayedTreeFactory(const std::vector<BmOptions>& options)
+					: m_options(options)
+					, m_storages(options.size())
+					, m_numAvailableTrees(0)
+					, m_nextTreeIndex(0)
+			{}
+
+		public:
+			void makeAvailable(size_t numTrees) {
+				m_numAvailableTrees = numTrees;
+			}
+
+			std::unique_ptr<BmPrivateKeyTree> operator()() {
+				if (m_nextTreeIndex >= m_numAvailableTrees)
+					return nullptr;
+
+				auto tree = BmPrivateKeyTree::Create(GenerateKeyPair(), m_storages[m_nextTreeIndex], m_options[m_nextTreeIndex]);
+				++m_nextTreeIndex;
+				return std::make_unique<BmPrivateKeyTree>(std::move(tree));
+			}
+
+		private:
+			std::vector<BmOptions> m_options;
+			std::vector<mocks::MockSeekableMemoryStream> m_storages;
+			size_t m_numAvailableTrees;
+			size_t m_nextTreeIndex;
+		};
+	}
+
+	TEST(TEST_CLASS, CanSignWithTreeReturnedByFactoryAfterInitialLoadFailed) {
+		// Arrange:
+		DelayedTreeFactory factory({ Default_Options });
+		AggregateBmPrivateKeyTree tree([&factory]() { return factory(); });
+
+		// Sanity:
+		test::AssertCannotSign(tree, { 75 });
+
+		// Act: make the tree available after it could not be loaded
+		factory.makeAvailable(1);
+
+		// Assert:
+		test::AssertCanSign(tree, { 75 });
+	}
+
+	TEST(TEST_CLASS, CanSignWithTreeReturnedByFactoryAfterLoadOfNextTreeFailed) {
+		// Arrange:
+		DelayedTreeFactory factory({ { { 8 }, { 14 } }, { { 15 }, { 27 } } });
+		factory.makeAvailable(1);
+		AggregateBmPrivateKeyTree tree([&factory]() { return factory(); });
+
+		// Sanity:
+		test::AssertCanSign(tree, { 10 });
+		test::AssertCannotSign(tree, { 19 });
+
+		// Act: make the next tree available after it could not be loaded
+		factory.makeAvailable(2);
+
+		// Assert:
+		test::AssertCanSign(tree, { 19 });
+	}
+
+	TEST(TEST_CLASS, CannotSignWhenTreeReturnedByFactoryAfterLoadOfNextTreeFailedOverlaps) {
+		// Arrange:
+		DelayedTreeFactory factory({ { { 8 }, { 14 } }, { { 12 }, { 27 } } });
+		factory.makeAvailable(1);
+		AggregateBmPrivateKeyTree tree([&factory]() { return factory(); });
+
+		// Sanity:
+		test::AssertCanSign(tree, { 10 });
+		test::AssertCannotSign(tree, { 19 });
+
+		// Act: make the (overlapping) next tree available after it could not be loaded
+		factory.makeAvailable(2);
+
+		// Assert:
+		EXPECT_THROW(tree.canSign({ 19 }), catapult_runtime_error);
+	}
+
 	// endregion
 
 	// region wipe - saving
@@ -0,0 +1,204 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto_voting/BmPrivateKeyTreePrefetcher.h"
+#include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS BmPrivateKeyTreePrefetcherTests
+
+	namespace {
+		constexpr BmOptions Default_Options{ { 8 }, { 14 } };
+
+		// region test context
+
+		class TestContext {
+		public:
+			TestContext() : TestContext(std::vector<BmOptions>{ Default_Options })
+			{}
+
+			explicit TestContext(const std::vector<BmOptions>& options)
+					: m_numFactoryCalls(0)
+					, m_storages(options.size())
+					, m_prefetcher([this, options]() {
+						++m_numFactoryCalls;
+						if (m_publicKeys.size() >= options.size())
+							return std::unique_ptr<BmPrivateKeyTree>();
+
+						auto index = m_publicKeys.size();
+						auto keyPair = VotingKeyPair::FromPrivate(VotingPrivateKey::Generate(test::RandomByte));
+						m_publicKeys.push_back(keyPair.publicKey());
+						auto tree = BmPrivateKeyTree::Create(std::move(keyPair), m_storages[index], options[index]);
+						return std::make_unique<BmPrivateKeyTree>(std::move(tree));
+					})
+			{}
+
+		public:
+			size_t numFactoryCalls() const {
+				return m_numFactoryCalls;
+			}
+
+			const auto& publicKey(size_t index) const {
+				return m_publicKeys[index];
+			}
+
+			auto& prefetcher() {
+				return m_prefetcher;
+			}
+
+		private:
+			size_t m_numFactoryCalls;
+			std::vector<VotingKey> m_publicKeys;
+			std::vector<mocks::MockSeekableMemoryStream> m_storages;
+			BmPrivateKeyTreePrefetcher m_prefetcher;
+		};
+
+		// endregion
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreatePrefetcher) {
+		// Act:
+		TestContext context;
+
+		// Assert: nothing is loaded eagerly
+		EXPECT_EQ(0u, context.numFactoryCalls());
+		EXPECT_EQ(0u, context.prefetcher().numReadyKeys());
+	}
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchLoadsNextTree) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto result = context.prefetcher().prefetch();
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, context.numFactoryCalls());
+		EXPECT_EQ(7u, context.prefetcher().numReadyKeys());
+	}
+
+	TEST(TEST_CLASS, PrefetchDoesNotReloadPrefetchedTree) {
+		// Arrange:
+		TestContext context({ Default_Options, { { 15 }, { 27 } } });
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			context.prefetcher().prefetch();
+
+		// Assert:
+		EXPECT_EQ(1u, context.numFactoryCalls());
+		EXPECT_EQ(7u, context.prefetcher().numReadyKeys());
+	}
+
+	TEST(TEST_CLASS, PrefetchRetriesWhenNoTreeIsAvailable) {
+		// Arrange:
+		TestContext context{ std::vector<BmOptions>() };
+
+		// Act:
+		auto result1 = context.prefetcher().prefetch();
+		auto result2 = context.prefetcher().prefetch();
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_EQ(2u, context.numFactoryCalls());
+		EXPECT_EQ(0u, context.prefetcher().numReadyKeys());
+	}
+
+	// endregion
+
+	// region next
+
+	TEST(TEST_CLASS, NextLoadsTreeOnDemandWhenNotPrefetched) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto pTree = context.prefetcher().next();
+
+		// Assert:
+		ASSERT_TRUE(!!pTree);
+		EXPECT_EQ(context.publicKey(0), pTree->rootPublicKey());
+		EXPECT_EQ(1u, context.numFactoryCalls());
+		EXPECT_EQ(0u, context.prefetcher().numReadyKeys());
+	}
+
+	TEST(TEST_CLASS, NextReturnsPrefetchedTree) {
+		// Arrange:
+		TestContext context({ Default_Options, { { 15 }, { 27 } } });
+		context.prefetcher().prefetch();
+
+		// Act:
+		auto pTree = context.prefetcher().next();
+
+		// Assert:
+		ASSERT_TRUE(!!pTree);
+		EXPECT_EQ(context.publicKey(0), pTree->rootPublicKey());
+		EXPECT_EQ(1u, context.numFactoryCalls());
+		EXPECT_EQ(0u, context.prefetcher().numReadyKeys());
+	}
+
+	TEST(TEST_CLASS, NextReturnsNullptrWhenNoTreeIsAvailable) {
+		// Arrange:
+		TestContext context{ std::vector<BmOptions>() };
+
+		// Act:
+		auto pTree = context.prefetcher().next();
+
+		// Assert:
+		EXPECT_FALSE(!!pTree);
+		EXPECT_EQ(1u, context.numFactoryCalls());
+	}
+
+	TEST(TEST_CLASS, CanAlternatePrefetchAndNext) {
+		// Arrange:
+		TestContext context({ Default_Options, { { 15 }, { 27 } } });
+		auto pTree1 = context.prefetcher().next();
+
+		// Act:
+		context.prefetcher().prefetch();
+		auto numReadyKeys = context.prefetcher().numReadyKeys();
+		auto pTree2 = context.prefetcher().next();
+
+		// Assert:
+		EXPECT_EQ(13u, numReadyKeys);
+		EXPECT_EQ(2u, context.numFactoryCalls());
+
+		ASSERT_TRUE(!!pTree1);
+		EXPECT_EQ(context.publicKey(0), pTree1->rootPublicKey());
+
+		ASSERT_TRUE(!!pTree2);
+		EXPECT_EQ(context.publicKey(1), pTree2->rootPublicKey());
+		EXPECT_EQ(BmKeyIdentifier({ 15 }), pTree2->options().StartKeyIdentifier);
+	}
+
+	// endregion
+}}
@@ -418,4 +418,86 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region VerifyMulti
+
+	namespace {
+		struct SignedBuffer {
+			BmKeyIdentifier KeyIdentifier;
+			std::array<uint8_t, 10> Buffer;
+			BmTreeSignature Signature;
+		};
+
+		std::vector<SignedBuffer> SignAllKeys(BmPrivateKeyTree& tree) {
+			std::vector<SignedBuffer> signedBuffers;
+			for (auto keyId = Start_Key.KeyId; keyId <= End_Key.KeyId; ++keyId) {
+				auto buffer = test::GenerateRandomArray<10>();
+				signedBuffers.push_back({ { keyId }, buffer, tree.sign({ keyId }, buffer) });
+			}
+
+			return signedBuffers;
+		}
+
+		std::vector<bool> VerifyAll(const std::vector<SignedBuffer>& signedBuffers) {
+			std::vector<BmTreeSignatureInput> signatureInputs;
+			for (const auto& signedBuffer : signedBuffers)
+				signatureInputs.push_back({ signedBuffer.Signature, signedBuffer.KeyIdentifier, signedBuffer.Buffer });
+
+			auto randomFiller = [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+			return VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size());
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenNoSignaturesArePresent) {
+		// Act:
+		auto results = VerifyAll({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		TestContext context;
+		auto signedBuffers = SignAllKeys(context.tree());
+
+		// Act:
+		auto results = VerifyAll(signedBuffers);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(Num_Keys, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsOnlyInvalidSignatures) {
+		// Arrange:
+		TestContext context;
+		auto signedBuffers = SignAllKeys(context.tree());
+
+		// - corrupt root signature, bottom signature, key identifier and buffer of different entries
+		signedBuffers[1].Signature.Root.Signature[5] ^= 0xFF;
+		signedBuffers[4].Signature.Bottom.Signature[5] ^= 0xFF;
+		signedBuffers[6].KeyIdentifier = { signedBuffers[6].KeyIdentifier.KeyId + 1 };
+		signedBuffers[9].Buffer[3] ^= 0xFF;
+
+		// Act:
+		auto results = VerifyAll(signedBuffers);
+
+		// Assert:
+		auto expectedResults = std::vector<bool>(Num_Keys, true);
+		for (auto index : { 1u, 4u, 6u, 9u })
+			expectedResults[index] = false;
+
+		EXPECT_EQ(expectedResults, results);
+
+		// Sanity: results are consistent with single verification
+		for (auto i = 0u; i < signedBuffers.size(); ++i) {
+			const auto& signedBuffer = signedBuffers[i];
+			EXPECT_EQ(expectedResults[i], Verify(signedBuffer.Signature, signedBuffer.KeyIdentifier, signedBuffer.Buffer)) << i;
+		}
+	}
+
+	// endregion
 }}
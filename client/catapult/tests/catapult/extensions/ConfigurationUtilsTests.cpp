@@ -40,4 +40,16 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), options.MaxResponseSize);
 		EXPECT_EQ(utils::FileSize::FromBytes(234), options.MaxCacheSize);
 	}
+
+	TEST(TEST_CLASS, CanExtractSpoolStorageModeFromNodeConfiguration) {
+		// Arrange:
+		auto config = config::NodeConfiguration::Uninitialized();
+
+		// Act + Assert:
+		config.EnableSpoolSegmentFiles = false;
+		EXPECT_EQ(io::FileQueueStorageMode::Message_Files, GetSpoolStorageMode(config));
+
+		config.EnableSpoolSegmentFiles = true;
+		EXPECT_EQ(io::FileQueueStorageMode::Segment_Files, GetSpoolStorageMode(config));
+	}
 }}
@@ -20,6 +20,8 @@
 **/
 
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/api/TransactionPackets.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -167,4 +169,202 @@ namespace catapult { namespace handlers {
 			test::PullEntitiesHandlerAssertAdapter<PullTransactionsRequestResponseTraits>::AssertFunc)
 
 	// endregion
+
+	// region ReconcileTransactionsHandler
+
+	namespace {
+		constexpr auto Reconcile_Data_Header_Size = sizeof(Timestamp) + sizeof(BlockFeeMultiplier);
+
+		struct UtRetrieverParams {
+			Timestamp Deadline;
+			BlockFeeMultiplier FeeMultiplier;
+			utils::ShortHashesSet KnownShortHashes;
+		};
+
+		std::vector<utils::ShortHash> CreateShortHashes(uint32_t start, uint32_t count) {
+			std::vector<utils::ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(utils::ShortHash(start + i));
+
+			return shortHashes;
+		}
+
+		std::shared_ptr<ionet::Packet> CreateReconcilePacket(const std::vector<utils::ShortHash>& shortHashes, size_t numCells) {
+			utils::ShortHashIblt iblt(numCells);
+			for (const auto& shortHash : shortHashes)
+				iblt.insert(shortHash);
+
+			auto cellsSize = static_cast<uint32_t>(iblt.size() * sizeof(utils::ShortHashIblt::Cell));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(static_cast<uint32_t>(Reconcile_Data_Header_Size + cellsSize));
+			pPacket->Type = ionet::PacketType::Reconcile_Transactions;
+			reinterpret_cast<Timestamp&>(*pPacket->Data()) = Timestamp(84);
+			reinterpret_cast<BlockFeeMultiplier&>(*(pPacket->Data() + sizeof(Timestamp))) = BlockFeeMultiplier(17);
+			std::memcpy(pPacket->Data() + Reconcile_Data_Header_Size, iblt.data(), cellsSize);
+			return pPacket;
+		}
+
+		constexpr uint32_t Max_Num_Cells = 29;
+
+		void RegisterReconcileHandler(
+				ionet::ServerPacketHandlers& handlers,
+				const std::vector<utils::ShortHash>& localShortHashes,
+				const UnconfirmedTransactions& transactions,
+				std::vector<UtRetrieverParams>& capturedParams) {
+			RegisterReconcileTransactionsHandler(handlers, Max_Num_Cells, [localShortHashes]() {
+				return model::ShortHashRange::CopyFixed(
+						reinterpret_cast<const uint8_t*>(localShortHashes.data()),
+						localShortHashes.size());
+			}, [transactions, &capturedParams](auto minDeadline, auto minFeeMultiplier, const auto& knownShortHashes) {
+				capturedParams.push_back({ minDeadline, minFeeMultiplier, knownShortHashes });
+				return transactions;
+			});
+		}
+
+		void AssertReconcilePacketIsRejected(const ionet::Packet& packet) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			std::vector<UtRetrieverParams> capturedParams;
+			RegisterReconcileHandler(handlers, CreateShortHashes(1, 10), {}, capturedParams);
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(packet, handlerContext));
+
+			// Assert:
+			test::AssertNoResponse(handlerContext);
+			EXPECT_TRUE(capturedParams.empty());
+		}
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_TooSmallPacketIsRejected) {
+		// Arrange:
+		auto pPacket = CreateReconcilePacket({}, 3);
+		pPacket->Size = static_cast<uint32_t>(sizeof(ionet::Packet) + Reconcile_Data_Header_Size - 1);
+
+		// Act + Assert:
+		AssertReconcilePacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_PacketWithoutCellsIsRejected) {
+		// Arrange:
+		auto pPacket = CreateReconcilePacket({}, 3);
+		pPacket->Size = static_cast<uint32_t>(sizeof(ionet::Packet) + Reconcile_Data_Header_Size);
+
+		// Act + Assert:
+		AssertReconcilePacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_PacketWithPartialCellIsRejected) {
+		// Arrange:
+		auto pPacket = CreateReconcilePacket({}, 3);
+		--pPacket->Size;
+
+		// Act + Assert:
+		AssertReconcilePacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_PacketWithInvalidNumberOfCellsIsRejected) {
+		// Arrange:
+		auto pPacket = CreateReconcilePacket({}, 3);
+		pPacket->Size -= SizeOf32<utils::ShortHashIblt::Cell>();
+
+		// Act + Assert:
+		AssertReconcilePacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_PacketWithTooManyCellsIsRejected) {
+		// Arrange: max number of cells is rounded up to 30
+		auto pPacket = CreateReconcilePacket(CreateShortHashes(1, 10), 33);
+
+		// Act + Assert:
+		AssertReconcilePacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_PacketWithRoundedUpMaxCellsIsAccepted) {
+		// Arrange:
+		auto pPacket = CreateReconcilePacket(CreateShortHashes(1, 10), 30);
+
+		ionet::ServerPacketHandlers handlers;
+		std::vector<UtRetrieverParams> capturedParams;
+		RegisterReconcileHandler(handlers, CreateShortHashes(1, 10), {}, capturedParams);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert:
+		EXPECT_EQ(1u, capturedParams.size());
+		test::AssertPacketHeader(
+				handlerContext,
+				sizeof(ionet::PacketHeader) + sizeof(api::ReconcileTransactionsStatus),
+				ionet::PacketType::Reconcile_Transactions);
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_RespondsWithUnknownTransactionsWhenSetDifferenceIsDecoded) {
+		// Arrange: local node has short hashes [1, 20], remote node has short hashes [1, 15] and [100, 102]
+		auto remoteShortHashes = CreateShortHashes(1, 15);
+		auto remoteOnlyShortHashes = CreateShortHashes(100, 3);
+		remoteShortHashes.insert(remoteShortHashes.end(), remoteOnlyShortHashes.cbegin(), remoteOnlyShortHashes.cend());
+		auto pPacket = CreateReconcilePacket(remoteShortHashes, 30);
+
+		UnconfirmedTransactions transactions;
+		for (uint16_t i = 0u; i < 3; ++i)
+			transactions.push_back(mocks::CreateMockTransaction(static_cast<uint16_t>(i + 1)));
+
+		ionet::ServerPacketHandlers handlers;
+		std::vector<UtRetrieverParams> capturedParams;
+		RegisterReconcileHandler(handlers, CreateShortHashes(1, 20), transactions, capturedParams);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert: only short hashes known by both nodes were passed to the retriever
+		ASSERT_EQ(1u, capturedParams.size());
+		EXPECT_EQ(Timestamp(84), capturedParams[0].Deadline);
+		EXPECT_EQ(BlockFeeMultiplier(17), capturedParams[0].FeeMultiplier);
+
+		auto expectedShortHashes = CreateShortHashes(1, 15);
+		EXPECT_EQ(utils::ShortHashesSet(expectedShortHashes.cbegin(), expectedShortHashes.cend()), capturedParams[0].KnownShortHashes);
+
+		// - response is composed of success status followed by transactions
+		auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(api::ReconcileTransactionsStatus) + test::TotalSize(transactions);
+		test::AssertPacketHeader(handlerContext, expectedSize, ionet::PacketType::Reconcile_Transactions);
+
+		const auto& buffers = handlerContext.response().buffers();
+		ASSERT_EQ(4u, buffers.size());
+		EXPECT_EQ(
+				api::ReconcileTransactionsStatus::Success,
+				reinterpret_cast<const api::ReconcileTransactionsStatus&>(*buffers[0].pData));
+		for (auto i = 0u; i < transactions.size(); ++i)
+			EXPECT_EQ(*transactions[i], reinterpret_cast<const mocks::MockTransaction&>(*buffers[i + 1].pData)) << "transaction " << i;
+	}
+
+	TEST(TEST_CLASS, ReconcileTransactions_RespondsWithDecodeFailureWhenSetDifferenceIsTooLarge) {
+		// Arrange: local node has short hashes [1, 20], remote node has short hashes [1000, 1100)
+		auto pPacket = CreateReconcilePacket(CreateShortHashes(1000, 100), 30);
+
+		ionet::ServerPacketHandlers handlers;
+		std::vector<UtRetrieverParams> capturedParams;
+		RegisterReconcileHandler(handlers, CreateShortHashes(1, 20), {}, capturedParams);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert: retriever was not called
+		EXPECT_TRUE(capturedParams.empty());
+
+		// - response is composed of failure status
+		auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(api::ReconcileTransactionsStatus);
+		test::AssertPacketHeader(handlerContext, expectedSize, ionet::PacketType::Reconcile_Transactions);
+
+		const auto& buffers = handlerContext.response().buffers();
+		ASSERT_EQ(1u, buffers.size());
+		EXPECT_EQ(
+				api::ReconcileTransactionsStatus::Decode_Failure,
+				reinterpret_cast<const api::ReconcileTransactionsStatus&>(*buffers[0].pData));
+	}
+
+	// endregion
 }}
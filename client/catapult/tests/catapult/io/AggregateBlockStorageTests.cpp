@@ -44,6 +44,10 @@ namespace catapult { namespace io {
 			void notifyDropBlocksAfter(Height) override {
 				CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 			}
+
+			void flush() override {
+				CATAPULT_THROW_RUNTIME_ERROR("flush - not supported in mock");
+			}
 		};
 
 		// endregion
@@ -171,6 +175,37 @@ namespace catapult { namespace io {
 		EXPECT_EQ(pBlockElement.get(), context.subscriber().blockElements()[0]);
 	}
 
+	TEST(TEST_CLASS, SaveBlocksDelegatesToStorageAndPublisher) {
+		// Arrange:
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			std::vector<const std::vector<model::BlockElement>*> ElementsVectors;
+
+		public:
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				ElementsVectors.push_back(&blockElements);
+			}
+		};
+
+		TestContext<MockBlockStorage, mocks::MockBlockChangeSubscriber> context;
+
+		auto pBlock1 = test::GenerateEmptyRandomBlock();
+		auto pBlock2 = test::GenerateEmptyRandomBlock();
+		std::vector<model::BlockElement> blockElements{ model::BlockElement(*pBlock1), model::BlockElement(*pBlock2) };
+
+		// Act:
+		context.aggregate().saveBlocks(blockElements);
+
+		// Assert: storage is called once with all elements
+		ASSERT_EQ(1u, context.storage().ElementsVectors.size());
+		EXPECT_EQ(&blockElements, context.storage().ElementsVectors[0]);
+
+		// - subscriber is notified about each element
+		ASSERT_EQ(2u, context.subscriber().blockElements().size());
+		EXPECT_EQ(&blockElements[0], context.subscriber().blockElements()[0]);
+		EXPECT_EQ(&blockElements[1], context.subscriber().blockElements()[1]);
+	}
+
 	TEST(TEST_CLASS, DropBlocksAfterDelegatesToStorageAndPublisher) {
 		// Arrange:
 		class MockBlockStorage : public UnsupportedBlockStorage {
@@ -64,6 +64,13 @@ namespace catapult { namespace io {
 				return m_cache.view().loadBlock(height);
 			}
 
+			std::vector<std::shared_ptr<const model::Block>> loadBlockRange(
+					Height height,
+					size_t maxBlocks,
+					size_t maxBytes) const override {
+				return m_cache.view().loadBlockRange(height, maxBlocks, maxBytes);
+			}
+
 			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
 				return m_cache.view().loadBlockElement(height);
 			}
@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/ZstdPayloadCodec.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS CompressedFileBlockStorageTests
+
+	namespace {
+		std::shared_ptr<const PayloadCodec> CreatePayloadCodec() {
+			return CreateZstdPayloadCodec(3);
+		}
+
+		struct CompressedFileTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = FileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination, uint32_t fileDatabaseBatchSize = 1) {
+				auto pPayloadCodec = CreatePayloadCodec();
+				return std::make_unique<StorageType>(destination, fileDatabaseBatchSize, FileBlockStorageMode::Hash_Index, pPayloadCodec);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				// notice that the prepared nemesis block is not compressed
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination, test::File_Database_Batch_Size);
+			}
+		};
+
+		uint64_t GetDirectorySize(const std::string& directory) {
+			uint64_t size = 0;
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+				if (entry.is_regular_file() && ".dat" == entry.path().extension() && "hashes.dat" != entry.path().filename())
+					size += entry.file_size();
+			}
+
+			return size;
+		}
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(CompressedFileTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(CompressedFileTraits)
+
+	// region compression
+
+	TEST(TEST_CLASS, CompressedStorageUsesLessDiskSpaceForRepetitiveBlocks) {
+		// Arrange: blocks with identical transactions are highly compressible
+		test::TempDirectoryGuard tempDir1("dir1");
+		test::TempDirectoryGuard tempDir2("dir2");
+		FileBlockStorage storage(tempDir1.name(), test::File_Database_Batch_Size, FileBlockStorageMode::None);
+		auto pPayloadCodec = CreatePayloadCodec();
+		FileBlockStorage compressedStorage(tempDir2.name(), test::File_Database_Batch_Size, FileBlockStorageMode::None, pPayloadCodec);
+
+		std::shared_ptr<const model::Transaction> pTransaction = test::GenerateRandomTransaction();
+		for (auto height = Height(1); height <= Height(10); height = height + Height(1)) {
+			auto transactions = test::ConstTransactions{ pTransaction, pTransaction, pTransaction, pTransaction };
+			auto pBlock = test::GenerateBlockWithTransactions(transactions);
+			pBlock->Height = height;
+			auto blockElement = test::BlockToBlockElement(*pBlock);
+
+			// Act:
+			storage.saveBlock(blockElement);
+			compressedStorage.saveBlock(blockElement);
+		}
+
+		// Assert:
+		EXPECT_GT(GetDirectorySize(tempDir1.name()), 2 * GetDirectorySize(tempDir2.name()));
+	}
+
+	TEST(TEST_CLASS, CanReadBlocksSavedWithoutCompression) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(1));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>());
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>());
+
+		{
+			FileBlockStorage storage(tempDir.name(), test::File_Database_Batch_Size, FileBlockStorageMode::None);
+			storage.saveBlock(element1);
+		}
+
+		// Act: save second block with compression
+		FileBlockStorage storage(tempDir.name(), test::File_Database_Batch_Size, FileBlockStorageMode::None, CreatePayloadCodec());
+		storage.saveBlock(element2);
+
+		auto pBlockElement1 = storage.loadBlockElement(Height(1));
+		auto pBlockElement2 = storage.loadBlockElement(Height(2));
+
+		// Assert:
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, CanReadBlocksSavedByGroupCommit) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(3));
+		std::vector<model::BlockElement> elements{
+			test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>()),
+			test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>())
+		};
+
+		// Act:
+		auto pStorage = CompressedFileTraits::PrepareStorage(tempDir.name());
+		pStorage->saveBlocks(elements);
+
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(3));
+
+		// Assert:
+		test::AssertEqual(elements[0], *pBlockElement1);
+		test::AssertEqual(elements[1], *pBlockElement2);
+	}
+
+	// endregion
+}}
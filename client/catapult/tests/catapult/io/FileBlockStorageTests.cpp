@@ -20,6 +20,8 @@
 **/
 
 #include "catapult/io/FileBlockStorage.h"
+#include "tests/test/core/BlockStatementTestUtils.h"
+#include "tests/test/core/BlockStorageTestUtils.h"
 #include "tests/test/core/BlockStorageTests.h"
 #include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -99,6 +101,189 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region saveBlocks
+
+	namespace {
+		struct BlockElementsHolder {
+			std::vector<std::unique_ptr<model::Block>> Blocks;
+			std::vector<model::BlockElement> Elements;
+		};
+
+		// generates blocks at heights [startHeight, startHeight + count) and attaches statements to blocks with odd heights
+		BlockElementsHolder GenerateBlockElements(Height startHeight, size_t count) {
+			BlockElementsHolder holder;
+			for (auto i = 0u; i < count; ++i)
+				holder.Blocks.push_back(test::GenerateBlockWithTransactions(5, startHeight + Height(i)));
+
+			for (const auto& pBlock : holder.Blocks) {
+				holder.Elements.push_back(test::CreateBlockElementForSaveTests(*pBlock));
+				if (1 == pBlock->Height.unwrap() % 2)
+					holder.Elements.back().OptionalStatement = test::GenerateRandomStatements({ 1, 2, 3 });
+			}
+
+			return holder;
+		}
+
+		void AssertStoredBlockElements(const FileBlockStorage& storage, const std::vector<model::BlockElement>& expectedElements) {
+			for (const auto& expectedElement : expectedElements) {
+				auto pBlockElement = test::LoadBlockElementWithStatements(storage, expectedElement.Block.Height);
+				test::AssertEqual(expectedElement, *pBlockElement);
+
+				ASSERT_EQ(!!expectedElement.OptionalStatement, !!pBlockElement->OptionalStatement);
+				if (expectedElement.OptionalStatement)
+					test::AssertEqual(*expectedElement.OptionalStatement, *pBlockElement->OptionalStatement);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlocksWithZeroBlocksIsNoOp) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+
+		// Act:
+		pStorage->saveBlocks({});
+
+		// Assert:
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+	}
+
+	TEST(TEST_CLASS, CanSaveMultipleBlocks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileTraits::PrepareStorage(tempDir.name());
+		FileBlockStorage storage(tempDir.name(), test::File_Database_Batch_Size, FileBlockStorageMode::Hash_Index);
+		auto holder = GenerateBlockElements(Height(2), 25);
+
+		// Act:
+		storage.saveBlocks(holder.Elements);
+
+		// Assert:
+		EXPECT_EQ(Height(26), storage.chainHeight());
+		AssertStoredBlockElements(storage, holder.Elements);
+
+		auto hashes = storage.loadHashesFrom(Height(2), 100);
+		ASSERT_EQ(25u, hashes.size());
+
+		auto i = 0u;
+		for (const auto& hash : hashes)
+			EXPECT_EQ(holder.Elements[i++].EntityHash, hash) << "hash at " << i;
+	}
+
+	TEST(TEST_CLASS, CanSaveMultipleBlocksWithHashIndexDisabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), test::File_Database_Batch_Size, FileBlockStorageMode::None);
+		auto holder = GenerateBlockElements(Height(1), 12);
+
+		// Act:
+		storage.saveBlocks(holder.Elements);
+
+		// Assert:
+		EXPECT_EQ(Height(12), storage.chainHeight());
+		AssertStoredBlockElements(storage, holder.Elements);
+		EXPECT_THROW(storage.loadHashesFrom(Height(1), 100), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanSaveBlocksAfterSaveBlock) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto holder = GenerateBlockElements(Height(2), 10);
+
+		// Act:
+		pStorage->saveBlock(holder.Elements[0]);
+		pStorage->saveBlocks(std::vector<model::BlockElement>(holder.Elements.cbegin() + 1, holder.Elements.cend()));
+
+		// Assert:
+		EXPECT_EQ(Height(11), pStorage->chainHeight());
+		AssertStoredBlockElements(*pStorage, holder.Elements);
+	}
+
+	TEST(TEST_CLASS, CanSaveBlocksOverDroppedBlocks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto originalHolder = GenerateBlockElements(Height(2), 10);
+		pStorage->saveBlocks(originalHolder.Elements);
+		pStorage->dropBlocksAfter(Height(4));
+
+		auto holder = GenerateBlockElements(Height(5), 3);
+
+		// Act:
+		pStorage->saveBlocks(holder.Elements);
+
+		// Assert:
+		EXPECT_EQ(Height(7), pStorage->chainHeight());
+		const auto& originalElements = originalHolder.Elements;
+		AssertStoredBlockElements(*pStorage, std::vector<model::BlockElement>(originalElements.cbegin(), originalElements.cbegin() + 3));
+		AssertStoredBlockElements(*pStorage, holder.Elements);
+	}
+
+	TEST(TEST_CLASS, CannotSaveBlocksWithGapBeforeFirstBlock) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto holder = GenerateBlockElements(Height(3), 5);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->saveBlocks(holder.Elements), catapult_invalid_argument);
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+	}
+
+	TEST(TEST_CLASS, CannotSaveBlocksWithNonConsecutiveHeights) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto holder = GenerateBlockElements(Height(2), 5);
+		std::vector<model::BlockElement> blockElements{ holder.Elements[0], holder.Elements[1], holder.Elements[3], holder.Elements[4] };
+
+		// Act + Assert: no blocks should be saved
+		EXPECT_THROW(pStorage->saveBlocks(blockElements), catapult_invalid_argument);
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+	}
+
+	TEST(TEST_CLASS, SaveBlocksProducesSameFilesAsSaveBlock) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir1("dir1");
+		test::TempDirectoryGuard tempDir2("dir2");
+		auto pStorage1 = FileTraits::PrepareStorage(tempDir1.name());
+		auto pStorage2 = FileTraits::PrepareStorage(tempDir2.name());
+		auto holder = GenerateBlockElements(Height(2), 40);
+
+		// Act:
+		for (const auto& blockElement : holder.Elements)
+			pStorage1->saveBlock(blockElement);
+
+		pStorage2->saveBlocks(holder.Elements);
+
+		// Assert: all files have identical contents
+		auto numFiles = 0u;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(tempDir1.name())) {
+			if (!entry.is_regular_file())
+				continue;
+
+			auto relativePath = std::filesystem::relative(entry.path(), tempDir1.name());
+			auto otherPath = std::filesystem::path(tempDir2.name()) / relativePath;
+			ASSERT_TRUE(std::filesystem::exists(otherPath)) << relativePath;
+
+			RawFile file1(entry.path().generic_string(), OpenMode::Read_Only);
+			RawFile file2(otherPath.generic_string(), OpenMode::Read_Only);
+			ASSERT_EQ(file1.size(), file2.size()) << relativePath;
+
+			std::vector<uint8_t> buffer1(file1.size());
+			std::vector<uint8_t> buffer2(file2.size());
+			file1.read(buffer1);
+			file2.read(buffer2);
+			EXPECT_EQ(buffer1, buffer2) << relativePath;
+			++numFiles;
+		}
+
+		EXPECT_LT(0u, numFiles);
+	}
+
+	// endregion
+
 	// region folder management
 
 	TEST(TEST_CLASS, PurgeDoesNotDeleteDataDirectory) {
@@ -35,8 +35,8 @@ namespace catapult { namespace io {
 
 		class TestContext {
 		public:
-			explicit TestContext(size_t batchSize = Batch_Size)
-					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" })
+			explicit TestContext(size_t batchSize = Batch_Size, const std::shared_ptr<const PayloadCodec>& pPayloadCodec = nullptr)
+					: m_database(createDatabase(batchSize, pPayloadCodec))
 			{}
 
 		public:
@@ -44,6 +44,10 @@ namespace catapult { namespace io {
 				return m_database;
 			}
 
+			FileDatabase createDatabase(size_t batchSize, const std::shared_ptr<const PayloadCodec>& pPayloadCodec) const {
+				return FileDatabase(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin", pPayloadCodec });
+			}
+
 			size_t countDatabaseFiles() const {
 				return test::CountFilesAndDirectories(m_tempDir.name());
 			}
@@ -88,6 +92,7 @@ namespace catapult { namespace io {
 			for (auto i = 0u; i < payloads.size(); ++i) {
 				auto pOutputStream = database.outputStream(startId + i * increment);
 				pOutputStream->write(payloads[i]);
+				pOutputStream->flush();
 			}
 		}
 
@@ -679,4 +684,420 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region writeRange
+
+	namespace {
+		void WriteRange(FileDatabase& database, size_t startId, const std::vector<std::vector<uint8_t>>& payloads) {
+			database.writeRange(startId, payloads.size(), [startId, &payloads](auto id, auto& output) {
+				output.write(payloads[id - startId]);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, WriteRangeWithZeroPayloadsDoesNotCreateFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		WriteRange(context.database(), 10, {});
+
+		// Assert:
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	TEST(TEST_CLASS, CanWriteRangeToSingleFile) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteRange(context.database(), 11, payloads);
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+
+		auto contents = context.readAll(10);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 40, 90, 100, 0 }), payloads[0], payloads[1], payloads[2] }), contents);
+	}
+
+	TEST(TEST_CLASS, CanWriteRangeAcrossMultipleFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteRange(context.database(), 13, payloads);
+
+		// Assert: files are identical to files written one payload at a time
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		auto contents4 = context.readAll(20);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 70, 80, 100, 190 }), payloads[2], payloads[3], payloads[4], payloads[5], payloads[6] }),
+				contents3);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), payloads[7] }), contents4);
+	}
+
+	TEST(TEST_CLASS, CanWriteRangeOverExistingPayloads) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 50, 20 });
+		WriteRange(context.database(), 17, newPayloads);
+
+		// Assert: as an optimization, files after the rewritten payloads are unmodified
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		auto contents4 = context.readAll(20);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 70, 80, 130, 0 }), payloads[2], payloads[3], newPayloads[0], newPayloads[1] }), contents3);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), payloads[7] }), contents4); // effectively orphaned
+	}
+
+	TEST(TEST_CLASS, CanReadPayloadsWrittenByWriteRange) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteRange(context.database(), 13, payloads);
+
+		// Act + Assert:
+		for (auto i = 0u; i < payloads.size(); ++i) {
+			size_t size;
+			auto pInputStream = context.database().inputStream(13 + i, &size);
+
+			std::vector<uint8_t> readBuffer(size);
+			pInputStream->read(readBuffer);
+
+			EXPECT_EQ(payloads[i], readBuffer) << "payload " << i;
+			EXPECT_TRUE(pInputStream->eof()) << "payload " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanWriteRangeInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		EXPECT_EQ(payloads[0], context.readAll(10));
+		EXPECT_EQ(payloads[1], context.readAll(11));
+		EXPECT_EQ(payloads[2], context.readAll(12));
+	}
+
+	// endregion
+
+	// region readRange
+
+	namespace {
+		std::vector<std::vector<uint8_t>> ToVectors(const std::vector<FileDatabase::SharedPayload>& payloads) {
+			std::vector<std::vector<uint8_t>> vectors;
+			for (const auto& payload : payloads)
+				vectors.emplace_back(payload.Data.pData, payload.Data.pData + payload.Data.Size);
+
+			return vectors;
+		}
+
+		std::vector<std::vector<uint8_t>> Slice(const std::vector<std::vector<uint8_t>>& payloads, size_t startIndex, size_t count) {
+			auto startIter = payloads.cbegin() + static_cast<std::ptrdiff_t>(startIndex);
+			return std::vector<std::vector<uint8_t>>(startIter, startIter + static_cast<std::ptrdiff_t>(count));
+		}
+
+		void AssertReadRange(size_t startId, size_t maxCount, size_t maxSize, size_t expectedStartIndex, size_t expectedCount) {
+			// Arrange: ids 13 - 14 are in file 10, ids 15 - 19 are in file 15, id 20 is in file 20
+			TestContext context;
+
+			auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+			WriteRange(context.database(), 13, payloads);
+
+			// Act:
+			auto readPayloads = context.database().readRange(startId, maxCount, maxSize);
+
+			// Assert:
+			EXPECT_EQ(Slice(payloads, expectedStartIndex, expectedCount), ToVectors(readPayloads));
+		}
+	}
+
+	TEST(TEST_CLASS, ReadRangeWithZeroMaxCountReadsNoPayloads) {
+		AssertReadRange(15, 0, 1000, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReadRangeCanReadAllPayloadsInFile) {
+		AssertReadRange(13, 10, 1000, 0, 2);
+		AssertReadRange(15, 10, 1000, 2, 5);
+		AssertReadRange(20, 10, 1000, 7, 1);
+	}
+
+	TEST(TEST_CLASS, ReadRangeCanReadTrailingPayloadsInFile) {
+		AssertReadRange(14, 10, 1000, 1, 1);
+		AssertReadRange(17, 10, 1000, 4, 3);
+	}
+
+	TEST(TEST_CLASS, ReadRangeReadsAtMostMaxCountPayloads) {
+		AssertReadRange(15, 1, 1000, 2, 1);
+		AssertReadRange(15, 3, 1000, 2, 3);
+	}
+
+	TEST(TEST_CLASS, ReadRangeReadsPayloadsWithTotalSizeOfAtMostMaxSize) {
+		// Assert: payload sizes starting at 15 are { 30, 10, 20, 90, 40 }
+		AssertReadRange(15, 10, 60, 2, 3);
+		AssertReadRange(15, 10, 59, 2, 2);
+	}
+
+	TEST(TEST_CLASS, ReadRangeAlwaysReadsFirstPayload) {
+		AssertReadRange(15, 10, 0, 2, 1);
+		AssertReadRange(18, 10, 89, 5, 1);
+	}
+
+	TEST(TEST_CLASS, ReadRangeReadsAllPayloadsIntoSharedBuffer) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Act:
+		auto readPayloads = context.database().readRange(10, 10, 1000);
+
+		// Assert: all payloads are laid out contiguously in a single buffer
+		ASSERT_EQ(3u, readPayloads.size());
+		EXPECT_EQ(90u, readPayloads[0].pBuffer->size());
+		for (auto i = 0u; i < readPayloads.size(); ++i)
+			EXPECT_EQ(readPayloads[0].pBuffer, readPayloads[i].pBuffer) << "payload " << i;
+
+		EXPECT_EQ(readPayloads[0].pBuffer->data(), readPayloads[0].Data.pData);
+		EXPECT_EQ(readPayloads[0].pBuffer->data() + 50, readPayloads[1].Data.pData);
+		EXPECT_EQ(readPayloads[0].pBuffer->data() + 60, readPayloads[2].Data.pData);
+		EXPECT_EQ(payloads, ToVectors(readPayloads));
+	}
+
+	TEST(TEST_CLASS, ReadRangeStopsAtUnwrittenPayload) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Act:
+		auto readPayloads = context.database().readRange(10, 10, 1000);
+
+		// Assert:
+		EXPECT_EQ(payloads, ToVectors(readPayloads));
+	}
+
+	TEST(TEST_CLASS, CannotReadRangeStartingAtUnwrittenPayload) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().readRange(12, 10, 1000), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, ReadRangeReadsSinglePayloadInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Act:
+		auto readPayloads = context.database().readRange(11, 10, 1000);
+
+		// Assert:
+		EXPECT_EQ(Slice(payloads, 1, 1), ToVectors(readPayloads));
+	}
+
+	// endregion
+
+	// region payload codec
+
+	namespace {
+		// encodes payloads by prefixing them with a marker and reversing their bytes
+		class MockPayloadCodec : public PayloadCodec {
+		public:
+			static constexpr uint8_t Marker = 0xEC;
+
+		public:
+			bool isEncoded(const RawBuffer& buffer) const override {
+				return 0 != buffer.Size && Marker == buffer.pData[0];
+			}
+
+			std::vector<uint8_t> encode(const RawBuffer& buffer) const override {
+				std::vector<uint8_t> encoded{ Marker };
+				encoded.insert(
+						encoded.end(),
+						std::make_reverse_iterator(buffer.pData + buffer.Size),
+						std::make_reverse_iterator(buffer.pData));
+				return encoded;
+			}
+
+			std::vector<uint8_t> decode(const RawBuffer& buffer) const override {
+				auto begin = std::make_reverse_iterator(buffer.pData + buffer.Size);
+				return std::vector<uint8_t>(begin, std::make_reverse_iterator(buffer.pData + 1));
+			}
+		};
+
+		std::vector<uint8_t> Encode(const std::vector<uint8_t>& payload) {
+			return MockPayloadCodec().encode(payload);
+		}
+
+		std::vector<std::vector<uint8_t>> CreateUnencodedPayloads(std::initializer_list<size_t> sizes) {
+			auto payloads = CreatePayloads(sizes);
+			for (auto& payload : payloads)
+				payload[0] = static_cast<uint8_t>(MockPayloadCodec::Marker + 1);
+
+			return payloads;
+		}
+
+		void AssertCanReadPayloads(const FileDatabase& database, size_t startId, const std::vector<std::vector<uint8_t>>& payloads) {
+			for (auto i = 0u; i < payloads.size(); ++i) {
+				size_t size;
+				auto pInputStream = database.inputStream(startId + i, &size);
+
+				std::vector<uint8_t> readBuffer(size);
+				pInputStream->read(readBuffer);
+
+				EXPECT_EQ(payloads[i], readBuffer) << "payload " << i;
+				EXPECT_TRUE(pInputStream->eof()) << "payload " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, OutputStreamDoesNotWritePayloadWithoutFlushWhenCodecIsConfigured) {
+		// Arrange:
+		TestContext context(Batch_Size, std::make_shared<MockPayloadCodec>());
+		auto payload = test::GenerateRandomVector(50);
+
+		// Act:
+		{
+			auto pOutputStream = context.database().outputStream(10);
+			pOutputStream->write(payload);
+		}
+
+		// Assert: only the header has been written
+		EXPECT_EQ(MakeHeader({ 40, 0, 0, 0, 0 }), context.readAll(10));
+	}
+
+	TEST(TEST_CLASS, OutputStreamWritesEncodedPayloadsWhenCodecIsConfigured) {
+		// Arrange:
+		TestContext context(Batch_Size, std::make_shared<MockPayloadCodec>());
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Assert: each encoded payload is one byte larger than the original payload
+		auto contents = context.readAll(10);
+		auto expectedContents = Concatenate({
+			MakeHeader({ 40, 91, 102, 0, 0 }), Encode(payloads[0]), Encode(payloads[1]), Encode(payloads[2])
+		});
+		EXPECT_EQ(expectedContents, contents);
+	}
+
+	TEST(TEST_CLASS, WriteRangeWritesEncodedPayloadsWhenCodecIsConfigured) {
+		// Arrange:
+		TestContext context(Batch_Size, std::make_shared<MockPayloadCodec>());
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Assert: each encoded payload is one byte larger than the original payload
+		auto contents = context.readAll(10);
+		auto expectedContents = Concatenate({
+			MakeHeader({ 40, 91, 102, 0, 0 }), Encode(payloads[0]), Encode(payloads[1]), Encode(payloads[2])
+		});
+		EXPECT_EQ(expectedContents, contents);
+	}
+
+	TEST(TEST_CLASS, CanReadPayloadsWrittenByOutputStreamWhenCodecIsConfigured) {
+		// Arrange:
+		TestContext context(Batch_Size, std::make_shared<MockPayloadCodec>());
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act + Assert:
+		AssertCanReadPayloads(context.database(), 13, payloads);
+	}
+
+	TEST(TEST_CLASS, CanReadPayloadsWrittenByWriteRangeWhenCodecIsConfigured) {
+		// Arrange:
+		TestContext context(Batch_Size, std::make_shared<MockPayloadCodec>());
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteRange(context.database(), 13, payloads);
+
+		// Act + Assert:
+		AssertCanReadPayloads(context.database(), 13, payloads);
+	}
+
+	TEST(TEST_CLASS, CanReadUnencodedPayloadsWhenCodecIsConfigured) {
+		// Arrange: write unencoded payloads without a codec followed by encoded payloads with a codec
+		TestContext context;
+
+		auto payloads = CreateUnencodedPayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, std::vector<std::vector<uint8_t>>(payloads.cbegin(), payloads.cbegin() + 4));
+
+		auto database = context.createDatabase(Batch_Size, std::make_shared<MockPayloadCodec>());
+		WriteAll(database, 17, std::vector<std::vector<uint8_t>>(payloads.cbegin() + 4, payloads.cend()));
+
+		// Act + Assert:
+		AssertCanReadPayloads(database, 13, payloads);
+	}
+
+	TEST(TEST_CLASS, CanReadPayloadsInHeaderlessModeWhenCodecIsConfigured) {
+		// Arrange:
+		TestContext context(1, std::make_shared<MockPayloadCodec>());
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteRange(context.database(), 10, payloads);
+
+		// Sanity:
+		EXPECT_EQ(Encode(payloads[0]), context.readAll(10));
+
+		// Act + Assert:
+		AssertCanReadPayloads(context.database(), 10, payloads);
+	}
+
+	TEST(TEST_CLASS, ReadRangeDecodesPayloadsWhenCodecIsConfigured) {
+		// Arrange: write unencoded payloads without a codec followed by encoded payloads with a codec
+		TestContext context;
+
+		auto payloads = CreateUnencodedPayloads({ 30, 10, 20, 90, 40 });
+		WriteAll(context.database(), 15, std::vector<std::vector<uint8_t>>(payloads.cbegin(), payloads.cbegin() + 2));
+
+		auto database = context.createDatabase(Batch_Size, std::make_shared<MockPayloadCodec>());
+		WriteAll(database, 17, std::vector<std::vector<uint8_t>>(payloads.cbegin() + 2, payloads.cend()));
+
+		// Act:
+		auto readPayloads = database.readRange(15, 10, 1000);
+
+		// Assert:
+		EXPECT_EQ(payloads, ToVectors(readPayloads));
+	}
+
+	// endregion
 }}
@@ -624,6 +624,10 @@ namespace catapult { namespace io {
 			return m_writeBuffer1;
 		}
 
+		const auto& writeBuffer2() const {
+			return m_writeBuffer2;
+		}
+
 	private:
 		void setup() {
 			// Arrange:
@@ -770,6 +774,77 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region FileQueueReader - peek
+
+	DIRECTORY_TRAITS_BASED_TEST(CanPeekNextMessage) {
+		// Arrange:
+		TwoFileReaderTestContext<TTraits> context;
+
+		// Act:
+		auto numCalls = 0u;
+		std::vector<uint8_t> readBuffer;
+		auto result = context.reader().tryPeekMessage(0, [&numCalls, &readBuffer](const auto& buffer) {
+			++numCalls;
+			readBuffer = buffer;
+		});
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(context.writeBuffer1(), readBuffer);
+
+		// - peeked data file should NOT have been deleted
+		context.assertZeroFilesConsumed();
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanPeekMessageAfterNextMessage) {
+		// Arrange:
+		TwoFileReaderTestContext<TTraits> context;
+
+		// Act:
+		auto numCalls = 0u;
+		std::vector<uint8_t> readBuffer;
+		auto result = context.reader().tryPeekMessage(1, [&numCalls, &readBuffer](const auto& buffer) {
+			++numCalls;
+			readBuffer = buffer;
+		});
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(context.writeBuffer2(), readBuffer);
+
+		// - peeked data file should NOT have been deleted
+		context.assertZeroFilesConsumed();
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekMessageAtOrPastWriterIndex) {
+		// Arrange:
+		TwoFileReaderTestContext<TTraits> context;
+
+		// Act:
+		auto numCalls = 0u;
+		auto result = context.reader().tryPeekMessage(2, [&numCalls](const auto&) {
+			++numCalls;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, numCalls);
+		context.assertZeroFilesConsumed();
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenMessageDoesNotExist) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+
+		// Act + Assert:
+		EXPECT_THROW(context.reader().tryPeekMessage(1, [](const auto&) {}), catapult_runtime_error);
+	}
+
+	// endregion
+
 	// region FileQueueReader - skip
 
 	namespace {
@@ -823,5 +898,328 @@ namespace catapult { namespace io {
 		AssertCanSkip<TTraits>(120, 118, 6, 120);
 	}
 
+	DIRECTORY_TRAITS_BASED_TEST(SkipDoesNotReadSkippedMessages) {
+		// Arrange: only write some of the skipped message files
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 110);
+
+		for (auto id = 110u; id < 120; id += 2) {
+			std::ostringstream out;
+			out << utils::HexFormat(static_cast<uint64_t>(id)) << ".dat";
+			context.write(out.str(), test::GenerateRandomVector(15 + id % 10));
+		}
+
+		// Act:
+		context.reader().skip(6);
+
+		// Assert: skipped messages were consumed even though some of them could not be read
+		EXPECT_EQ(2u + 2, context.countFiles());
+		AssertIndexFiles(context, 120, 116);
+	}
+
+	// endregion
+
+	// region segment files
+
+	namespace {
+		constexpr auto Segment_Header_Size = File_Queue_Messages_Per_Segment * sizeof(uint64_t);
+
+		class SegmentTestContext : public BasicQueueTestContext<DefaultTraits> {
+		public:
+			SegmentTestContext() : BasicQueueTestContext<DefaultTraits>("q")
+			{}
+
+		public:
+			FileQueueWriter createWriter(FileQueueStorageMode storageMode = FileQueueStorageMode::Segment_Files) {
+				return FileQueueWriter(directory().generic_string(), DefaultTraits::Index_Writer_Filename, storageMode);
+			}
+
+			FileQueueReader createReader() {
+				return FileQueueReader(directory().generic_string());
+			}
+
+			uint64_t fileSize(const std::string& name) {
+				return std::filesystem::file_size(directory() / name);
+			}
+
+		public:
+			std::vector<std::vector<uint8_t>> writeMessages(FileQueueWriter& writer, size_t count) {
+				std::vector<std::vector<uint8_t>> buffers;
+				for (auto i = 0u; i < count; ++i) {
+					buffers.push_back(test::GenerateRandomVector(10 + i % 20));
+					writer.write(buffers.back());
+					writer.flush();
+				}
+
+				return buffers;
+			}
+
+			std::vector<std::vector<uint8_t>> readMessages(FileQueueReader& reader) {
+				std::vector<std::vector<uint8_t>> buffers;
+				while (reader.tryReadNextMessage([&buffers](const auto& buffer) { buffers.push_back(buffer); }))
+				{}
+
+				return buffers;
+			}
+		};
+
+		uint64_t SumSizes(const std::vector<std::vector<uint8_t>>& buffers) {
+			uint64_t size = 0;
+			for (const auto& buffer : buffers)
+				size += buffer.size();
+
+			return size;
+		}
+	}
+
+	TEST(TEST_CLASS, CanWriteMultipleMessagesToSingleSegmentFile) {
+		// Arrange:
+		SegmentTestContext context;
+		auto writer = context.createWriter();
+
+		// Act: write a single message with multiple payloads followed by two single payload messages
+		auto buffer1 = test::GenerateRandomVector(21);
+		auto buffer2 = test::GenerateRandomVector(80);
+		writer.write(buffer1);
+		writer.write(buffer2);
+		writer.flush();
+		auto buffers = context.writeMessages(writer, 2);
+
+		// Assert:
+		EXPECT_EQ(2u, context.countFiles());
+		EXPECT_TRUE(context.exists(DefaultTraits::Index_Writer_Filename));
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(Segment_Header_Size + buffer1.size() + buffer2.size() + SumSizes(buffers), context.fileSize("0000000000000000.seg"));
+	}
+
+	TEST(TEST_CLASS, SegmentWriterBuffersMessageInMemoryUntilFlush) {
+		// Arrange:
+		SegmentTestContext context;
+		auto writer = context.createWriter();
+
+		// Act:
+		writer.write(test::GenerateRandomVector(21));
+
+		// Assert: no segment file is created before the first flush
+		EXPECT_EQ(1u, context.countFiles());
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, CanReadMessagesFromSegmentFile) {
+		// Arrange:
+		SegmentTestContext context;
+		auto writer = context.createWriter();
+		auto buffers = context.writeMessages(writer, 5);
+
+		auto reader = context.createReader();
+
+		// Act:
+		auto readBuffers = context.readMessages(reader);
+
+		// Assert: segment file is retained because its last message has not been consumed
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+	}
+
+	TEST(TEST_CLASS, CanPeekMessagesInSegmentFile) {
+		// Arrange:
+		SegmentTestContext context;
+		auto writer = context.createWriter();
+		auto buffers = context.writeMessages(writer, 5);
+
+		auto reader = context.createReader();
+
+		// Act:
+		std::vector<uint8_t> peekedBuffer;
+		auto result = reader.tryPeekMessage(3, [&peekedBuffer](const auto& buffer) { peekedBuffer = buffer; });
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(buffers[3], peekedBuffer);
+		EXPECT_EQ(0u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, SegmentFileIsRemovedAfterLastMessageIsConsumed) {
+		// Arrange:
+		SegmentTestContext context;
+		auto writer = context.createWriter();
+		auto buffers = context.writeMessages(writer, File_Queue_Messages_Per_Segment + 2);
+
+		auto reader = context.createReader();
+
+		// Sanity:
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("0000000000000400.seg"));
+
+		// Act:
+		reader.skip(static_cast<uint32_t>(File_Queue_Messages_Per_Segment - 1));
+		auto isFirstSegmentRetained = context.exists("0000000000000000.seg");
+		reader.skip(1);
+		auto readBuffers = context.readMessages(reader);
+
+		// Assert:
+		EXPECT_TRUE(isFirstSegmentRetained);
+		EXPECT_FALSE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("0000000000000400.seg"));
+
+		ASSERT_EQ(2u, readBuffers.size());
+		EXPECT_EQ(buffers[File_Queue_Messages_Per_Segment], readBuffers[0]);
+		EXPECT_EQ(buffers[File_Queue_Messages_Per_Segment + 1], readBuffers[1]);
+	}
+
+	TEST(TEST_CLASS, SegmentWriterOverwritesMessagesFollowingWriterIndex) {
+		// Arrange: write three messages and roll back the writer index to the second one
+		SegmentTestContext context;
+		std::vector<std::vector<uint8_t>> buffers;
+		{
+			auto writer = context.createWriter();
+			buffers = context.writeMessages(writer, 3);
+		}
+
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(1);
+
+		// Act:
+		auto writer = context.createWriter();
+		auto newBuffer = test::GenerateRandomVector(50);
+		writer.write(newBuffer);
+		writer.flush();
+
+		auto reader = context.createReader();
+		auto readBuffers = context.readMessages(reader);
+
+		// Assert: rolled back messages were discarded
+		EXPECT_EQ(2u, context.readIndexWriterFile());
+		EXPECT_EQ(Segment_Header_Size + buffers[0].size() + newBuffer.size(), context.fileSize("0000000000000000.seg"));
+
+		ASSERT_EQ(2u, readBuffers.size());
+		EXPECT_EQ(buffers[0], readBuffers[0]);
+		EXPECT_EQ(newBuffer, readBuffers[1]);
+	}
+
+	TEST(TEST_CLASS, SegmentWriterPreservesCommittedMessagesPrecedingMessageFile) {
+		// Arrange: write two messages to a segment file followed by one message to its own file
+		SegmentTestContext context;
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto storageMode : { FileQueueStorageMode::Segment_Files, FileQueueStorageMode::Message_Files }) {
+			auto writer = context.createWriter(storageMode);
+			auto modeBuffers = context.writeMessages(writer, FileQueueStorageMode::Segment_Files == storageMode ? 2 : 1);
+			buffers.insert(buffers.end(), modeBuffers.cbegin(), modeBuffers.cend());
+		}
+
+		// Act: reopen the segment file and append two more messages to it
+		{
+			auto writer = context.createWriter();
+			auto modeBuffers = context.writeMessages(writer, 2);
+			buffers.insert(buffers.end(), modeBuffers.cbegin(), modeBuffers.cend());
+		}
+
+		auto reader = context.createReader();
+		auto readBuffers = context.readMessages(reader);
+
+		// Assert: unconsumed messages stored in the segment file before the message file were not truncated
+		auto expectedSegmentSize = Segment_Header_Size + buffers[0].size() + buffers[1].size() + buffers[3].size() + buffers[4].size();
+		EXPECT_EQ(expectedSegmentSize, context.fileSize("0000000000000000.seg"));
+		EXPECT_EQ(buffers, readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentWriterClearsHeaderEntriesOfDiscardedMessages) {
+		// Arrange: write three messages and roll back the writer index to the second one
+		SegmentTestContext context;
+		std::vector<std::vector<uint8_t>> buffers;
+		{
+			auto writer = context.createWriter();
+			buffers = context.writeMessages(writer, 3);
+		}
+
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(1);
+		buffers.resize(1);
+
+		// Act: rewrite the second message (shorter) to the segment file, the third one to its own file
+		//      and the fourth one to the segment file
+		auto storageModes = {
+			FileQueueStorageMode::Segment_Files, FileQueueStorageMode::Message_Files, FileQueueStorageMode::Segment_Files
+		};
+		for (auto storageMode : storageModes) {
+			auto writer = context.createWriter(storageMode);
+			buffers.push_back(test::GenerateRandomVector(2 == buffers.size() ? 20 : 5));
+			writer.write(buffers.back());
+			writer.flush();
+		}
+
+		auto reader = context.createReader();
+		auto readBuffers = context.readMessages(reader);
+
+		// Assert: the stale end offset of the discarded third message was not used as the start of the fourth message
+		EXPECT_EQ(4u, context.readIndexWriterFile());
+		auto expectedSegmentSize = Segment_Header_Size + buffers[0].size() + buffers[1].size() + buffers[3].size();
+		EXPECT_EQ(expectedSegmentSize, context.fileSize("0000000000000000.seg"));
+		EXPECT_EQ(buffers, readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentFileIsRemovedAfterLastMessageInItsRangeIsConsumedFromMessageFile) {
+		// Arrange: store all but the last message of the first segment in a segment file and the last one in its own file
+		SegmentTestContext context;
+		for (auto storageMode : { FileQueueStorageMode::Segment_Files, FileQueueStorageMode::Message_Files }) {
+			auto writer = context.createWriter(storageMode);
+			context.writeMessages(writer, FileQueueStorageMode::Segment_Files == storageMode ? File_Queue_Messages_Per_Segment - 1 : 1);
+		}
+
+		auto reader = context.createReader();
+
+		// Sanity:
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("00000000000003FF.dat"));
+
+		// Act:
+		reader.skip(static_cast<uint32_t>(File_Queue_Messages_Per_Segment));
+
+		// Assert: the segment file was not leaked
+		EXPECT_EQ(File_Queue_Messages_Per_Segment, context.readIndexReaderFile());
+		EXPECT_FALSE(context.exists("0000000000000000.seg"));
+		EXPECT_FALSE(context.exists("00000000000003FF.dat"));
+	}
+
+	TEST(TEST_CLASS, CanReadMessagesWrittenWithDifferentStorageModes) {
+		// Arrange:
+		SegmentTestContext context;
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto storageMode : { FileQueueStorageMode::Message_Files, FileQueueStorageMode::Segment_Files }) {
+			auto writer = context.createWriter(storageMode);
+			auto modeBuffers = context.writeMessages(writer, 2);
+			buffers.insert(buffers.end(), modeBuffers.cbegin(), modeBuffers.cend());
+		}
+
+		auto reader = context.createReader();
+
+		// Act:
+		auto readBuffers = context.readMessages(reader);
+
+		// Assert:
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_FALSE(context.exists("0000000000000000.dat"));
+		EXPECT_FALSE(context.exists("0000000000000001.dat"));
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+	}
+
+	TEST(TEST_CLASS, CannotReadUncommittedMessageFromSegmentFile) {
+		// Arrange: advance the writer index past the last message in the segment file
+		SegmentTestContext context;
+		{
+			auto writer = context.createWriter();
+			context.writeMessages(writer, 2);
+		}
+
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(3);
+		auto reader = context.createReader();
+		reader.skip(2);
+
+		// Act + Assert:
+		EXPECT_THROW(reader.tryReadNextMessage([](const auto&) {}), catapult_runtime_error);
+		EXPECT_EQ(2u, context.readIndexReaderFile());
+	}
+
 	// endregion
 }}
@@ -261,4 +261,102 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region saveRange
+
+	namespace {
+		std::vector<ValueType> ToValues(uint64_t startSeed, size_t count) {
+			std::vector<ValueType> values;
+			for (auto i = 0u; i < count; ++i)
+				values.push_back(ToValue(startSeed + i));
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeOfAscendingKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveRange(Height(2), ToValues(12, 3));
+
+		auto values = context.hashFile().loadRangeFrom(Height(2), 3);
+
+		// Assert:
+		ASSERT_EQ(5 * ValueType::Size, fs::file_size(context.filename("00000")));
+		AssertValues(values, { 12, 13, 14 });
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveEmptyRange) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveRange(Height(2), {});
+
+		// Assert:
+		ASSERT_EQ(2 * ValueType::Size, fs::file_size(context.filename("00000")));
+	}
+
+	TEST(TEST_CLASS, StorageCannotSaveRangeSkippingSomeKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act + Assert:
+		EXPECT_THROW(context.hashFile().saveRange(Height(4), ToValues(14, 3)), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeOverwritingExistingKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(5);
+
+		// Act:
+		context.hashFile().saveRange(Height(3), ToValues(13, 4));
+
+		auto values = context.hashFile().loadRangeFrom(Height(1), 6);
+
+		// Assert: values at heights 1 and 2 come from seed, values at heights 3+ were overwritten or appended
+		ASSERT_EQ(7 * ValueType::Size, fs::file_size(context.filename("00000")));
+		AssertValues(values, { 1, 2, 13, 14, 15, 16 });
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeSpanningMultipleFiles) {
+		// Arrange:
+		TestContext context;
+		context.seed(Files_Per_Storage_Directory - 5);
+
+		// Act:
+		context.hashFile().saveRange(Height(Files_Per_Storage_Directory - 5), ToValues(Files_Per_Storage_Directory - 5, 15));
+
+		auto values = context.hashFile().loadRangeFrom(Height(Files_Per_Storage_Directory - 10), 20);
+
+		// Assert:
+		EXPECT_TRUE(context.storageExists("00001"));
+		ASSERT_EQ(10 * ValueType::Size, fs::file_size(context.filename("00001")));
+		AssertValues(values, Files_Per_Storage_Directory - 10, 20);
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveAfterSaveRange) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+		context.hashFile().save(Height(2), ToValue(2));
+
+		// Act: save after saveRange must not use stale cached file state
+		context.hashFile().saveRange(Height(3), ToValues(3, 3));
+		context.hashFile().save(Height(6), ToValue(6));
+
+		auto values = context.hashFile().loadRangeFrom(Height(0), 7);
+
+		// Assert:
+		ASSERT_EQ(7 * ValueType::Size, fs::file_size(context.filename("00000")));
+		AssertValues(values, 0, 7);
+	}
+
+	// endregion
 }}
@@ -141,6 +141,33 @@ namespace catapult { namespace io {
 		EXPECT_EQ(87u, indexFile.get());
 	}
 
+	TEST(TEST_CLASS, CanSetValueDurably) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		IndexFile indexFile(tempFile.name());
+
+		// Act:
+		indexFile.setDurable(1234);
+
+		// Assert:
+		AssertExists(tempFile, indexFile);
+		EXPECT_EQ(1234u, indexFile.get());
+	}
+
+	TEST(TEST_CLASS, CanResetValueDurably) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		IndexFile indexFile(tempFile.name());
+
+		// Act:
+		indexFile.set(1234);
+		indexFile.setDurable(87);
+
+		// Assert:
+		AssertExists(tempFile, indexFile);
+		EXPECT_EQ(87u, indexFile.get());
+	}
+
 	// endregion
 
 	// region increment
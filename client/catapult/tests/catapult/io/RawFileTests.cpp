@@ -500,6 +500,28 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region sync
+
+	WRITING_TRAITS_BASED_TEST(CanSyncFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.sync();
+
+		// Assert: sync does not change file size or position
+		EXPECT_EQ(Default_Bytes_Written, rawFile.size());
+		EXPECT_EQ(Default_Bytes_Written, rawFile.position());
+
+		// - data is visible on disk
+		EXPECT_EQ(Default_Bytes_Written, std::filesystem::file_size(guard.name()));
+	}
+
+	// endregion
+
 	// region multiple raw files around same physical file
 
 	TEST(TEST_CLASS, PositionInDifferentInstancesIsIndependent) {
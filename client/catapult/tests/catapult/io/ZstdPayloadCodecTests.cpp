@@ -0,0 +1,186 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/ZstdPayloadCodec.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS ZstdPayloadCodecTests
+
+	namespace {
+		constexpr auto Compression_Level = 3;
+
+		// generates a payload with many repeated fragments, similar to serialized blocks containing repeated addresses
+		std::vector<uint8_t> GenerateRepetitivePayload(size_t size) {
+			auto fragment = test::GenerateRandomVector(24);
+
+			std::vector<uint8_t> payload;
+			while (payload.size() < size) {
+				payload.insert(payload.end(), fragment.cbegin(), fragment.cend());
+				payload.push_back(test::RandomByte());
+			}
+
+			payload.resize(size);
+			return payload;
+		}
+
+		std::vector<std::vector<uint8_t>> GenerateSamples(size_t count) {
+			auto fragment = test::GenerateRandomVector(64);
+
+			std::vector<std::vector<uint8_t>> samples;
+			for (auto i = 0u; i < count; ++i) {
+				auto sample = test::GenerateRandomVector(32);
+				sample.insert(sample.end(), fragment.cbegin(), fragment.cend());
+				samples.push_back(std::move(sample));
+			}
+
+			return samples;
+		}
+	}
+
+	// region isEncoded
+
+	TEST(TEST_CLASS, IsEncodedReturnsFalseForRawPayloads) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+		std::vector<uint8_t> rawPayload{ 0x28, 0xB5, 0x2F, 0xFE, 0x00 }; // magic with last byte changed
+
+		// Act + Assert:
+		EXPECT_FALSE(pCodec->isEncoded(std::vector<uint8_t>()));
+		EXPECT_FALSE(pCodec->isEncoded(std::vector<uint8_t>{ 0x28, 0xB5, 0x2F }));
+		EXPECT_FALSE(pCodec->isEncoded(rawPayload));
+	}
+
+	TEST(TEST_CLASS, IsEncodedReturnsTrueForEncodedPayloads) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+		auto encoded = pCodec->encode(test::GenerateRandomVector(100));
+
+		// Act + Assert:
+		EXPECT_TRUE(pCodec->isEncoded(encoded));
+	}
+
+	// endregion
+
+	// region encode / decode
+
+	TEST(TEST_CLASS, CanRoundtripEmptyPayload) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+
+		// Act:
+		auto decoded = pCodec->decode(pCodec->encode(std::vector<uint8_t>()));
+
+		// Assert:
+		EXPECT_TRUE(decoded.empty());
+	}
+
+	TEST(TEST_CLASS, CanRoundtripRandomPayload) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+		auto payload = test::GenerateRandomVector(1000);
+
+		// Act:
+		auto decoded = pCodec->decode(pCodec->encode(payload));
+
+		// Assert:
+		EXPECT_EQ(payload, decoded);
+	}
+
+	TEST(TEST_CLASS, EncodeCompressesRepetitivePayload) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+		auto payload = GenerateRepetitivePayload(10'000);
+
+		// Act:
+		auto encoded = pCodec->encode(payload);
+		auto decoded = pCodec->decode(encoded);
+
+		// Assert:
+		EXPECT_GT(payload.size() / 2, encoded.size());
+		EXPECT_EQ(payload, decoded);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeCorruptPayload) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+		auto encoded = pCodec->encode(test::GenerateRandomVector(1000));
+
+		// - truncate the frame
+		encoded.resize(encoded.size() / 2);
+
+		// Act + Assert:
+		EXPECT_THROW(pCodec->decode(encoded), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeUnencodedPayload) {
+		// Arrange:
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level);
+
+		// Act + Assert:
+		EXPECT_THROW(pCodec->decode(test::GenerateRandomVector(1000)), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region dictionary
+
+	TEST(TEST_CLASS, CanTrainDictionary) {
+		// Act:
+		auto dictionary = TrainZstdDictionary(GenerateSamples(1000), 4 * 1024);
+
+		// Assert:
+		EXPECT_FALSE(dictionary.empty());
+		EXPECT_GE(4u * 1024, dictionary.size());
+	}
+
+	TEST(TEST_CLASS, CannotCreateCodecWithInvalidDictionary) {
+		// Arrange: zstd treats buffers without the dictionary magic as raw content dictionaries,
+		//          so create a buffer with the dictionary magic but without valid entropy tables
+		auto dictionary = test::GenerateRandomVector(100);
+		dictionary[0] = 0x37;
+		dictionary[1] = 0xA4;
+		dictionary[2] = 0x30;
+		dictionary[3] = 0xEC;
+
+		// Act + Assert:
+		EXPECT_THROW(CreateZstdPayloadCodec(Compression_Level, dictionary), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripPayloadWithDictionary) {
+		// Arrange:
+		auto samples = GenerateSamples(1000);
+		auto pCodec = CreateZstdPayloadCodec(Compression_Level, TrainZstdDictionary(samples, 4 * 1024));
+		auto pCodecWithoutDictionary = CreateZstdPayloadCodec(Compression_Level);
+
+		// Act:
+		auto encoded = pCodec->encode(samples[0]);
+		auto encodedWithoutDictionary = pCodecWithoutDictionary->encode(samples[0]);
+		auto decoded = pCodec->decode(encoded);
+
+		// Assert: dictionary improves compression of small payloads similar to the samples
+		EXPECT_GT(encodedWithoutDictionary.size(), encoded.size());
+		EXPECT_EQ(samples[0], decoded);
+	}
+
+	// endregion
+}}
@@ -20,7 +20,11 @@
 **/
 
 #include "catapult/ionet/BufferedPacketIo.h"
+#include "catapult/ionet/BatchPacketWriter.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
+#include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/net/SocketTestUtils.h"
 
 namespace catapult { namespace ionet {
@@ -48,4 +52,186 @@ namespace catapult { namespace ionet {
 	TEST(TEST_CLASS, ReadCanReadMultipleSimultaneousPayloadsWithoutInterleaving) {
 		test::AssertReadCanReadMultipleSimultaneousPayloadsWithoutInterleaving(Transform);
 	}
+
+	// region coalescing
+
+	namespace {
+		class MockBatchPacketWriter : public BatchPacketWriter {
+		public:
+			MockBatchPacketWriter(boost::asio::io_context& ioContext, SocketOperationCode code, uint32_t maxPacketSize)
+					: m_ioContext(ioContext)
+					, m_code(code)
+					, m_maxPacketSize(maxPacketSize)
+			{}
+
+		public:
+			const std::vector<std::vector<PacketPayload>>& batches() const {
+				return m_batches;
+			}
+
+		public:
+			bool isWritable(const PacketPayload& payload) const override {
+				return payload.header().Size <= m_maxPacketSize;
+			}
+
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const PacketIo::WriteCallback& callback) override {
+				// complete asynchronously like a real socket write, failing the entire batch if any payload is malformed
+				m_batches.push_back(payloads);
+				auto isBatchWritable = std::all_of(payloads.cbegin(), payloads.cend(), [this](const auto& payload) {
+					return this->isWritable(payload);
+				});
+
+				auto code = isBatchWritable ? m_code : SocketOperationCode::Malformed_Data;
+				boost::asio::post(m_ioContext, [callback, code]() {
+					callback(code);
+				});
+			}
+
+		private:
+			boost::asio::io_context& m_ioContext;
+			SocketOperationCode m_code;
+			uint32_t m_maxPacketSize;
+			std::vector<std::vector<PacketPayload>> m_batches;
+		};
+
+		struct CoalescingResult {
+			std::vector<std::vector<PacketPayload>> Batches;
+			std::vector<SocketOperationCode> Codes;
+			size_t NumUnderlyingWrites;
+		};
+
+		CoalescingResult WriteCoalesced(
+				const std::vector<PacketPayload>& payloads,
+				size_t maxCoalescedWriteSize,
+				SocketOperationCode code = SocketOperationCode::Success,
+				uint32_t maxPacketSize = std::numeric_limits<uint32_t>::max()) {
+			// Arrange:
+			boost::asio::io_context ioContext;
+			boost::asio::io_context::strand strand(ioContext);
+			auto pIo = std::make_shared<mocks::MockPacketIo>();
+			auto pWriter = std::make_shared<MockBatchPacketWriter>(ioContext, code, maxPacketSize);
+			auto pBufferedIo = CreateBufferedPacketIo(pIo, pWriter, strand, maxCoalescedWriteSize);
+
+			// Act: queue all writes before running the io context
+			CoalescingResult result;
+			for (const auto& payload : payloads)
+				pBufferedIo->write(payload, [&codes = result.Codes](auto writeCode) { codes.push_back(writeCode); });
+
+			ioContext.run();
+
+			result.Batches = pWriter->batches();
+			result.NumUnderlyingWrites = pIo->numWrites();
+			return result;
+		}
+
+		std::vector<PacketPayload> GeneratePayloads(const std::vector<uint32_t>& packetSizes) {
+			std::vector<PacketPayload> payloads;
+			for (auto packetSize : packetSizes)
+				payloads.push_back(test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(packetSize)));
+
+			return payloads;
+		}
+
+		void AssertBatches(
+				const std::vector<PacketPayload>& payloads,
+				const std::vector<size_t>& expectedBatchSizes,
+				const std::vector<std::vector<PacketPayload>>& batches) {
+			ASSERT_EQ(expectedBatchSizes.size(), batches.size());
+
+			auto payloadIndex = 0u;
+			for (auto i = 0u; i < batches.size(); ++i) {
+				ASSERT_EQ(expectedBatchSizes[i], batches[i].size()) << "batch " << i;
+
+				for (const auto& payload : batches[i])
+					test::AssertEqualPayload(payloads[payloadIndex++], payload);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CoalescingWriteCoalescesQueuedWrites) {
+		// Arrange:
+		auto payloads = GeneratePayloads({ 100, 120, 80, 150, 50 });
+
+		// Act:
+		auto result = WriteCoalesced(payloads, 1000);
+
+		// Assert: the first write starts immediately and all remaining writes are coalesced while it is in progress
+		AssertBatches(payloads, { 1, 4 }, result.Batches);
+		EXPECT_EQ(std::vector<SocketOperationCode>(5, SocketOperationCode::Success), result.Codes);
+		EXPECT_EQ(0u, result.NumUnderlyingWrites);
+	}
+
+	TEST(TEST_CLASS, CoalescingWriteRespectsMaxCoalescedWriteSize) {
+		// Arrange:
+		auto payloads = GeneratePayloads({ 100, 120, 80, 150, 50, 60 });
+
+		// Act: 120 + 80 | 150 + 50 | 60
+		auto result = WriteCoalesced(payloads, 200);
+
+		// Assert:
+		AssertBatches(payloads, { 1, 2, 2, 1 }, result.Batches);
+		EXPECT_EQ(std::vector<SocketOperationCode>(6, SocketOperationCode::Success), result.Codes);
+	}
+
+	TEST(TEST_CLASS, CoalescingWriteWritesPayloadsLargerThanMaxCoalescedWriteSizeAlone) {
+		// Arrange:
+		auto payloads = GeneratePayloads({ 100, 120, 500, 80, 50 });
+
+		// Act:
+		auto result = WriteCoalesced(payloads, 200);
+
+		// Assert:
+		AssertBatches(payloads, { 1, 1, 1, 2 }, result.Batches);
+		EXPECT_EQ(std::vector<SocketOperationCode>(5, SocketOperationCode::Success), result.Codes);
+	}
+
+	TEST(TEST_CLASS, CoalescingWriteForwardsBatchResultToAllCallbacks) {
+		// Arrange:
+		auto payloads = GeneratePayloads({ 100, 120, 80 });
+
+		// Act:
+		auto result = WriteCoalesced(payloads, 1000, SocketOperationCode::Write_Error);
+
+		// Assert:
+		AssertBatches(payloads, { 1, 2 }, result.Batches);
+		EXPECT_EQ(std::vector<SocketOperationCode>(3, SocketOperationCode::Write_Error), result.Codes);
+	}
+
+	TEST(TEST_CLASS, CoalescingWriteFailsOnlyMalformedRequest) {
+		// Arrange: third payload is malformed
+		auto payloads = GeneratePayloads({ 100, 120, 500, 80, 50 });
+
+		// Act: 100 | 120 | 500 (malformed) | 80 + 50
+		auto result = WriteCoalesced(payloads, 1000, SocketOperationCode::Success, 200);
+
+		// Assert: malformed payload is written alone and its failure does not affect neighboring requests
+		AssertBatches(payloads, { 1, 1, 1, 2 }, result.Batches);
+		EXPECT_EQ(std::vector<SocketOperationCode>({
+			SocketOperationCode::Success,
+			SocketOperationCode::Success,
+			SocketOperationCode::Malformed_Data,
+			SocketOperationCode::Success,
+			SocketOperationCode::Success
+		}), result.Codes);
+	}
+
+	TEST(TEST_CLASS, CoalescingWriteFailsOnlyMalformedRequestsWhenMalformedRequestsAreAdjacent) {
+		// Arrange: second and third payloads are malformed
+		auto payloads = GeneratePayloads({ 100, 500, 600, 80, 50 });
+
+		// Act: 100 | 500 (malformed) | 600 (malformed) | 80 + 50
+		auto result = WriteCoalesced(payloads, 1000, SocketOperationCode::Success, 200);
+
+		// Assert:
+		AssertBatches(payloads, { 1, 1, 1, 2 }, result.Batches);
+		EXPECT_EQ(std::vector<SocketOperationCode>({
+			SocketOperationCode::Success,
+			SocketOperationCode::Malformed_Data,
+			SocketOperationCode::Malformed_Data,
+			SocketOperationCode::Success,
+			SocketOperationCode::Success
+		}), result.Codes);
+	}
+
+	// endregion
 }}
@@ -63,6 +63,19 @@ namespace catapult { namespace local {
 
 	// region basic tests
 
+	namespace {
+		uint64_t GetCounterValue(const std::vector<utils::DiagnosticCounter>& counters, const std::string& name) {
+			auto iter = std::find_if(counters.cbegin(), counters.cend(), [&name](const auto& counter) {
+				return name == counter.id().name();
+			});
+
+			if (counters.cend() == iter)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("could not find counter with name", name);
+
+			return iter->value();
+		}
+	}
+
 	TEST(TEST_CLASS, CanBootBroker) {
 		// Arrange:
 		BrokerTestContext context;
@@ -71,6 +84,23 @@ namespace catapult { namespace local {
 		context.boot();
 	}
 
+	TEST(TEST_CLASS, CanRetrieveQueueCountersAfterBoot) {
+		// Arrange:
+		BrokerTestContext context;
+		context.boot();
+
+		// Act:
+		const auto& counters = context.broker().counters();
+
+		// Assert: each queue has lag and consumed message counters
+		for (const auto* prefix : { "BLK CHG", "UT CHG", "PT CHG", "FIN", "STATE", "TX STAT" }) {
+			for (const auto* suffix : { " LAG", " MSGS" }) {
+				auto name = std::string(prefix) + suffix;
+				EXPECT_EQ(0u, GetCounterValue(counters, name)) << name;
+			}
+		}
+	}
+
 	TEST(TEST_CLASS, CanShutdownBroker) {
 		// Arrange:
 		BrokerTestContext context;
@@ -87,6 +117,7 @@ namespace catapult { namespace local {
 	namespace {
 		struct BlockChangeTraits {
 			static constexpr auto Queue_Directory_Name = "block_change";
+			static constexpr auto Counter_Name_Prefix = "BLK CHG";
 
 			static void WriteMessage(io::OutputStream& outputStream) {
 				io::Write8(outputStream, utils::to_underlying_type(subscribers::BlockChangeOperationType::Drop_Blocks_After));
@@ -96,24 +127,28 @@ namespace catapult { namespace local {
 
 		struct UtChangeTraits {
 			static constexpr auto Queue_Directory_Name = "unconfirmed_transactions_change";
+			static constexpr auto Counter_Name_Prefix = "UT CHG";
 
 			static constexpr auto WriteMessage = test::WriteRandomUtChange;
 		};
 
 		struct PtChangeTraits {
 			static constexpr auto Queue_Directory_Name = "partial_transactions_change";
+			static constexpr auto Counter_Name_Prefix = "PT CHG";
 
 			static constexpr auto WriteMessage = test::WriteRandomPtChange;
 		};
 
 		struct FinalizationTraits {
 			static constexpr auto Queue_Directory_Name = "finalization";
+			static constexpr auto Counter_Name_Prefix = "FIN";
 
 			static constexpr auto WriteMessage = test::WriteRandomFinalization;
 		};
 
 		struct StateChangeTraits {
 			static constexpr auto Queue_Directory_Name = "state_change";
+			static constexpr auto Counter_Name_Prefix = "STATE";
 
 			static void WriteMessage(io::OutputStream& outputStream) {
 				io::Write8(outputStream, utils::to_underlying_type(subscribers::StateChangeOperationType::Score_Change));
@@ -124,6 +159,7 @@ namespace catapult { namespace local {
 
 		struct TransactionStatusTraits {
 			static constexpr auto Queue_Directory_Name = "transaction_status";
+			static constexpr auto Counter_Name_Prefix = "TX STAT";
 
 			static constexpr auto WriteMessage = test::WriteRandomTransactionStatus;
 		};
@@ -164,6 +200,20 @@ namespace catapult { namespace local {
 		test::ProduceAndConsumeMessages<TTraits>(context, 5, 7);
 	}
 
+	SUBSCRIBER_TRAITS_BASED_TEST(IngestionUpdatesQueueCounters) {
+		// Arrange:
+		BrokerTestContext context;
+		auto lagCounterName = std::string(TTraits::Counter_Name_Prefix) + " LAG";
+		auto messagesCounterName = std::string(TTraits::Counter_Name_Prefix) + " MSGS";
+
+		// Act:
+		test::ProduceAndConsumeMessages<TTraits>(context, 7);
+
+		// Assert:
+		WAIT_FOR_VALUE_EXPR(7u, GetCounterValue(context.broker().counters(), messagesCounterName));
+		WAIT_FOR_ZERO_EXPR(GetCounterValue(context.broker().counters(), lagCounterName));
+	}
+
 	SUBSCRIBER_TRAITS_BASED_TEST(CanIngestMessagesProducedWhileRunning) {
 		// Arrange: produce and consume some messages
 		BrokerTestContext context;
@@ -44,22 +44,34 @@ namespace catapult { namespace local {
 
 		// region subscriber mocks
 
+		// buffers blocks similar to mongo block change subscriber and only exposes heights of flushed blocks
 		class MockBlockChangeSubscriber : public io::BlockChangeSubscriber {
+		public:
+			static constexpr size_t Max_Batch_Size = 4;
+
 		public:
 			explicit MockBlockChangeSubscriber(std::vector<Height>& heights) : m_heights(heights)
 			{}
 
 		public:
 			void notifyBlock(const model::BlockElement& blockElement) override {
-				m_heights.push_back(blockElement.Block.Height);
+				m_pendingHeights.push_back(blockElement.Block.Height);
+				if (Max_Batch_Size == m_pendingHeights.size())
+					flush();
 			}
 
 			void notifyDropBlocksAfter(Height) override {
 				CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 			}
 
+			void flush() override {
+				m_heights.insert(m_heights.end(), m_pendingHeights.cbegin(), m_pendingHeights.cend());
+				m_pendingHeights.clear();
+			}
+
 		private:
 			std::vector<Height>& m_heights;
+			std::vector<Height> m_pendingHeights;
 		};
 
 		class MockStateChangeSubscriber : public subscribers::StateChangeSubscriber {
@@ -352,6 +364,18 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(context.finalizationHeights().empty());
 	}
 
+	TEST(TEST_CLASS, CanImportChainWithBlockChangeSubscriberWhenBlockCountIsNotMultipleOfBatchSize) {
+		// Arrange: nemesis and 9 blocks (10 total) do not fill an integral number of batches
+		TestContext context;
+		context.seedBlocks(2 * MockBlockChangeSubscriber::Max_Batch_Size + 1);
+
+		// Act:
+		context.boot(SubscriberMode::Block_Change);
+
+		// Assert: all blocks, including those in the partial batch, are flushed
+		EXPECT_EQ(GetHeightRange(Height(1), Height(10)), context.blockChangeHeights());
+	}
+
 	TEST(TEST_CLASS, CanImportChainWithStateChangeSubscriber) {
 		// Arrange:
 		TestContext context;
@@ -473,5 +473,50 @@ namespace catapult { namespace model {
 		EXPECT_EQ(mosaicResolutionStatementHash1, GetResolutionStatementHash<MosaicResolutionTraits>(*pStatement, unresolvedMosaicId1));
 	}
 
+	TEST(TEST_CLASS, CanAddStatementsAfterPoppingSource) {
+		// Arrange:
+		RandomPayloadReceipt<3> receipt1;
+		RandomPayloadReceipt<4> receipt2;
+		RandomPayloadReceipt<2> receipt3;
+
+		auto unresolvedAddress = AddressResolutionTraits::GenerateUnresolved();
+		auto resolvedAddress1 = AddressResolutionTraits::GenerateResolved();
+		auto resolvedAddress2 = AddressResolutionTraits::GenerateResolved();
+		auto resolvedAddress3 = AddressResolutionTraits::GenerateResolved();
+
+		BlockStatementBuilder builder;
+		builder.setSource({ 12, 11 });
+		builder.addReceipt(receipt1);
+		builder.addResolution(unresolvedAddress, resolvedAddress1);
+		builder.setSource({ 14, 0 });
+		builder.addReceipt(receipt2);
+		builder.addResolution(unresolvedAddress, resolvedAddress2);
+		builder.popSource(); // pop source with primary id 14
+
+		// Act:
+		builder.setSource({ 14, 0 });
+		builder.addReceipt(receipt3);
+		builder.addResolution(unresolvedAddress, resolvedAddress3);
+		auto pStatement = builder.build();
+
+		// Assert:
+		auto transactionStatementHash1 = CalculateTransactionStatementHash({ 12, 11 }, { &receipt1 });
+		auto transactionStatementHash2 = CalculateTransactionStatementHash({ 14, 0 }, { &receipt3 });
+
+		auto addressResolutionStatementHash = CalculateResolutionStatementHash<AddressResolutionTraits>(unresolvedAddress, {
+			{ { 12, 11 }, resolvedAddress1 },
+			{ { 14, 0 }, resolvedAddress3 }
+		});
+
+		ASSERT_EQ(2u, pStatement->TransactionStatements.size());
+		EXPECT_EQ(transactionStatementHash1, GetTransactionStatementHash(*pStatement, { 12, 11 }));
+		EXPECT_EQ(transactionStatementHash2, GetTransactionStatementHash(*pStatement, { 14, 0 }));
+
+		ASSERT_EQ(1u, pStatement->AddressResolutionStatements.size());
+		EXPECT_EQ(addressResolutionStatementHash, GetResolutionStatementHash<AddressResolutionTraits>(*pStatement, unresolvedAddress));
+
+		EXPECT_EQ(0u, pStatement->MosaicResolutionStatements.size());
+	}
+
 	// endregion
 }}
@@ -331,6 +331,19 @@ namespace catapult { namespace model {
 		AssertEntities(GetExpectedMultiEntityBufferValues(), entities);
 	}
 
+	TEST(TEST_CLASS, ExtractedEntitiesFromMultipleEntityBufferRangeShareOwnership) {
+		// Act:
+		auto range = EntityRange<uint32_t>::CopyVariable(Multi_Entity_Buffer.data(), Multi_Entity_Buffer.size(), { 0, 4, 8 });
+		auto entities = EntityRange<uint32_t>::ExtractEntitiesFromRange(std::move(range));
+
+		// Assert: all entities share a single owner (backing buffer)
+		ASSERT_EQ(3u, entities.size());
+		for (const auto& pEntity : entities) {
+			EXPECT_EQ(3, pEntity.use_count());
+			EXPECT_FALSE(pEntity.owner_before(entities[0]) || entities[0].owner_before(pEntity));
+		}
+	}
+
 	// endregion
 
 	// region overlay (variable) buffer
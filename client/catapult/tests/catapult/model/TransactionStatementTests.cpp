@@ -295,5 +295,47 @@ namespace catapult { namespace model {
 		EXPECT_EQ(expectedHash, hash);
 	}
 
+	// endregion
+	// region receipts
+
+	TEST(TEST_CLASS, ReceiptsBufferIsEmptyWhenNoReceiptsAreAttached) {
+		// Act:
+		auto transactionStatement = TransactionStatement({ 0x222, 0x333 });
+
+		// Assert:
+		EXPECT_EQ(0u, transactionStatement.receipts().Size);
+	}
+
+	TEST(TEST_CLASS, ReceiptsBufferContainsAllAttachedReceiptsInSortedOrder) {
+		// Arrange:
+		CustomReceipt<3> receipt1(std::array<uint8_t, 3>{ { 0x39, 0x62, 0x19 } });
+		CustomReceipt<5> receipt2(std::array<uint8_t, 5>{ { 0x23, 0x03, 0x82, 0x94, 0x70 } });
+		CustomReceipt<4> receipt3(std::array<uint8_t, 4>{ { 0xAB, 0xFA, 0xCE, 0x55 } });
+		CustomReceipt<3> receipt4(std::array<uint8_t, 3>{ { 0x00, 0xDD, 0xDD } });
+
+		auto transactionStatement = TransactionStatement({ 0x222, 0x333 });
+		transactionStatement.addReceipt(receipt1);
+		transactionStatement.addReceipt(receipt2);
+		transactionStatement.addReceipt(receipt3);
+		transactionStatement.addReceipt(receipt4);
+
+		// Act:
+		auto receipts = transactionStatement.receipts();
+
+		// Assert: receipts are laid out contiguously (sorted by type followed by add order)
+		std::vector<uint8_t> expectedReceipts{
+			0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x39, 0x62, 0x19,
+			0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0xDD, 0xDD,
+			0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0xAB, 0xFA, 0xCE, 0x55,
+			0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x23, 0x03, 0x82, 0x94, 0x70
+		};
+		ASSERT_EQ(expectedReceipts.size(), receipts.Size);
+		EXPECT_EQ_MEMORY(expectedReceipts.data(), receipts.pData, receipts.Size);
+
+		// - receiptAt points into the buffer
+		EXPECT_EQ(receipts.pData, reinterpret_cast<const uint8_t*>(&transactionStatement.receiptAt(0)));
+		EXPECT_EQ(receipts.pData + 22, reinterpret_cast<const uint8_t*>(&transactionStatement.receiptAt(2)));
+	}
+
 	// endregion
 }}
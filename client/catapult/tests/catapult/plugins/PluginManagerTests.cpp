@@ -23,6 +23,7 @@
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "catapult/cache/CatapultCache.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
@@ -44,6 +45,7 @@ namespace catapult { namespace plugins {
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize::FromKilobytes(0), config.CacheDatabaseConfig.MaxWriteBatchSize);
+		EXPECT_FALSE(config.EnableCacheSnapshots);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -80,12 +82,16 @@ namespace catapult { namespace plugins {
 		storageConfig.PreferCacheDatabase = true;
 		storageConfig.CacheDatabaseDirectory = "abc";
 		storageConfig.CacheDatabaseConfig.MaxWriteBatchSize = utils::FileSize::FromKilobytes(23);
+		storageConfig.EnableCacheSnapshots = true;
 
 		auto assertCacheConfiguration = [](const auto& cacheConfig, const auto& expectedDirectory) {
 			EXPECT_TRUE(cacheConfig.ShouldUseCacheDatabase);
 			EXPECT_EQ(expectedDirectory, cacheConfig.CacheDatabaseDirectory);
 			EXPECT_EQ(utils::FileSize::FromKilobytes(23), cacheConfig.CacheDatabaseConfig.MaxWriteBatchSize);
 			EXPECT_FALSE(cacheConfig.ShouldStorePatriciaTrees);
+
+			// snapshots are not supported by cache database
+			EXPECT_FALSE(cacheConfig.ShouldPublishSnapshots);
 		};
 
 		// Act:
@@ -100,6 +106,62 @@ namespace catapult { namespace plugins {
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
 	}
 
+	namespace {
+		void AssertCanCreateCacheConfigurationWithoutCacheDatabase(bool enableCacheSnapshots) {
+			// Arrange:
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = false;
+			storageConfig.CacheDatabaseDirectory = "abc";
+			storageConfig.EnableCacheSnapshots = enableCacheSnapshots;
+
+			// Act:
+			PluginManager manager(
+					model::BlockchainConfiguration::Uninitialized(),
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+			auto cacheConfig = manager.cacheConfig("foo");
+
+			// Assert:
+			EXPECT_FALSE(cacheConfig.ShouldUseCacheDatabase);
+			EXPECT_TRUE(cacheConfig.CacheDatabaseDirectory.empty());
+			EXPECT_FALSE(cacheConfig.ShouldStorePatriciaTrees);
+			EXPECT_EQ(enableCacheSnapshots, cacheConfig.ShouldPublishSnapshots);
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithoutCacheDatabase) {
+		AssertCanCreateCacheConfigurationWithoutCacheDatabase(false);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithoutCacheDatabaseWithSnapshots) {
+		AssertCanCreateCacheConfigurationWithoutCacheDatabase(true);
+	}
+
+	// endregion
+
+	// region thread pool
+
+	TEST(TEST_CLASS, ThreadPoolIsInitiallyUnset) {
+		// Act:
+		auto manager = test::CreatePluginManager();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.threadPool());
+	}
+
+	TEST(TEST_CLASS, CanSetThreadPool) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act:
+		manager.setThreadPool(pPool.get());
+
+		// Assert:
+		EXPECT_EQ(pPool.get(), manager.threadPool());
+	}
+
 	// endregion
 
 	// region tx plugins
@@ -737,6 +737,41 @@ namespace catapult { namespace state {
 		EXPECT_EQ(&keys.voting(), &const_cast<const AccountPublicKeys&>(keys).voting());
 	}
 
+	TEST(TEST_CLASS, MoveTransfersKeyStorage) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		AccountPublicKeys keys;
+		keys.linked().set(key);
+		keys.voting().add({ { { 0x44 } }, FinalizationEpoch(100), FinalizationEpoch(149) });
+		const auto* pVotingKey = &keys.voting().get(0);
+
+		// Act:
+		AccountPublicKeys keysMoved(std::move(keys));
+
+		// Assert: key storage is owned by the destination and was not copied
+		EXPECT_FALSE(!!keys.linked());
+		EXPECT_EQ(0u, keys.voting().size());
+
+		EXPECT_EQ(key, keysMoved.linked().get());
+		ASSERT_EQ(1u, keysMoved.voting().size());
+		EXPECT_EQ(pVotingKey, &keysMoved.voting().get(0));
+	}
+
+	TEST(TEST_CLASS, CopyAllocatesDistinctKeyStorage) {
+		// Arrange:
+		AccountPublicKeys keys;
+		keys.voting().add({ { { 0x44 } }, FinalizationEpoch(100), FinalizationEpoch(149) });
+
+		// Act:
+		AccountPublicKeys keysCopy(keys);
+
+		// Assert: key storage is not shared between copies
+		ASSERT_EQ(1u, keys.voting().size());
+		ASSERT_EQ(1u, keysCopy.voting().size());
+		EXPECT_EQ(keys.voting().get(0), keysCopy.voting().get(0));
+		EXPECT_NE(&keys.voting().get(0), &keysCopy.voting().get(0));
+	}
+
 	TEST(TEST_CLASS, CanDeepCopy) {
 		// Arrange: sanity check that copied keys are unlinked
 		auto key1 = test::GenerateRandomByteArray<Key>();
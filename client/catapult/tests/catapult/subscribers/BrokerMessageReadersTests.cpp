@@ -220,14 +220,14 @@ namespace catapult { namespace subscribers {
 
 		struct ReadAllFileQueueTraits {
 			template<typename TSubscriber, typename TMessageReader>
-			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			static size_t ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
 				return subscribers::ReadAll(context.reader(), subscriber, readNextMessage);
 			}
 		};
 
 		struct ReadAllMessageQueueDescriptorTraits {
 			template<typename TSubscriber, typename TMessageReader>
-			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			static size_t ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
 				return subscribers::ReadAll({ context.queuePath(), "index_r.dat", "index.dat" }, subscriber, readNextMessage);
 			}
 		};
@@ -248,9 +248,10 @@ namespace catapult { namespace subscribers {
 		MockBufferSubscriber subscriber;
 
 		// Act:
-		TTraits::ReadAll(context, subscriber, ReadNextBuffer);
+		auto numMessages = TTraits::ReadAll(context, subscriber, ReadNextBuffer);
 
 		// Assert:
+		EXPECT_EQ(0u, numMessages);
 		EXPECT_EQ(std::vector<Breadcrumb>(), subscriber.breadcrumbs());
 
 		const auto& notifications = subscriber.notifications();
@@ -324,9 +325,10 @@ namespace catapult { namespace subscribers {
 		MockBufferSubscriber subscriber;
 
 		// Act:
-		TTraits::ReadAll(context, subscriber, ReadNextBuffer);
+		auto numMessages = TTraits::ReadAll(context, subscriber, ReadNextBuffer);
 
 		// Assert:
+		EXPECT_EQ(3u, numMessages);
 		std::vector<Breadcrumb> expectedBreadcrumbs{
 			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
 			Breadcrumb::Notify, Breadcrumb::Flush,
@@ -345,4 +347,109 @@ namespace catapult { namespace subscribers {
 	}
 
 	// endregion
+
+	// region ReadAllBatched (FileQueue / MessageQueueDescriptor)
+
+	namespace {
+		constexpr uint32_t Max_Batch_Size = 2;
+
+		struct ReadAllBatchedFileQueueTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static size_t ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				return subscribers::ReadAllBatched(context.reader(), Max_Batch_Size, subscriber, readNextMessage);
+			}
+		};
+
+		struct ReadAllBatchedMessageQueueDescriptorTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static size_t ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				MessageQueueDescriptor descriptor{ context.queuePath(), "index_reader.dat", "index.dat" };
+				return subscribers::ReadAllBatched(descriptor, Max_Batch_Size, subscriber, readNextMessage);
+			}
+		};
+	}
+
+#define READ_ALL_BATCHED_FILE_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_FileQueue) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedFileQueueTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_MessageQueueDescriptor) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedMessageQueueDescriptorTraits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_CanReadZero) {
+		// Arrange:
+		QueueTestContext context;
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		auto numMessages = TTraits::ReadAll(context, subscriber, ReadNextBuffer);
+
+		// Assert:
+		EXPECT_EQ(0u, numMessages);
+		EXPECT_EQ(std::vector<Breadcrumb>(), subscriber.breadcrumbs());
+		EXPECT_TRUE(subscriber.notifications().empty());
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_CanReadMultipleWithMultipleNotificationsPerFile) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> notificationBuffers;
+		for (auto i = 0u; i < 6; ++i)
+			notificationBuffers.push_back(test::GenerateRandomVector(129 + i));
+
+		QueueTestContext context;
+		context.write({ notificationBuffers[0], notificationBuffers[1] });
+		context.write(notificationBuffers[2]);
+		context.write(notificationBuffers[3]);
+		context.write({ notificationBuffers[4], notificationBuffers[5] });
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		auto numMessages = TTraits::ReadAll(context, subscriber, ReadNextBuffer);
+
+		// Assert: subscriber is flushed once per batch of (at most) two files
+		EXPECT_EQ(4u, numMessages);
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(notificationBuffers, subscriber.notifications());
+
+		// - all messages were consumed
+		EXPECT_EQ(0u, context.reader().pending());
+	}
+
+	TEST(TEST_CLASS, ReadAllBatched_DoesNotConsumeMessagesInBatchThatFailedProcessing) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> notificationBuffers;
+		QueueTestContext context;
+		for (auto i = 0u; i < 5; ++i) {
+			notificationBuffers.push_back(test::GenerateRandomVector(129 + i));
+			context.write(notificationBuffers.back());
+		}
+
+		MockBufferSubscriber subscriber;
+
+		// Act: fail processing of fourth message (in second batch)
+		auto numReads = 0u;
+		EXPECT_THROW(ReadAllBatched(context.reader(), Max_Batch_Size, subscriber, [&numReads](auto& inputStream, auto& subscriberRef) {
+			if (4 == ++numReads)
+				CATAPULT_THROW_RUNTIME_ERROR("fourth message failed");
+
+			ReadNextBuffer(inputStream, subscriberRef);
+		}), catapult_runtime_error);
+
+		// Assert: only first batch was flushed and consumed
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(3u, context.reader().pending());
+	}
+
+	// endregion
 }}
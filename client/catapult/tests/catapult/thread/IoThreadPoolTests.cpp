@@ -25,6 +25,7 @@
 #include "tests/test/core/WaitFunctions.h"
 #include "tests/TestHarness.h"
 #include <memory>
+#include <set>
 #include <thread>
 
 namespace catapult { namespace thread {
@@ -305,4 +306,134 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
 		EXPECT_EQ(2 * Num_Default_Threads, work.numHandlerCalls());
 	}
+
+	// region io context modes
+
+	namespace {
+		auto CreatePerWorkerIoThreadPool(bool pinWorkerThreads = false) {
+			IoThreadPoolOptions options;
+			options.Mode = IoThreadPoolMode::Per_Worker;
+			options.PinWorkerThreads = pinWorkerThreads;
+			return CreateIoThreadPool(Num_Default_Threads, "per worker", options);
+		}
+	}
+
+	TEST(TEST_CLASS, SharedPoolNextIoContextAlwaysReturnsIoContext) {
+		// Arrange:
+		auto pPool = CreateDefaultIoThreadPool();
+
+		// Act + Assert:
+		for (auto i = 0u; i < 2 * Num_Default_Threads; ++i)
+			EXPECT_EQ(&pPool->ioContext(), &pPool->nextIoContext()) << "call " << i;
+	}
+
+	TEST(TEST_CLASS, SharedPoolIoContextAlwaysReturnsSameIoContext) {
+		// Arrange:
+		auto pPool = CreateDefaultIoThreadPool();
+		auto* pIoContext = &pPool->ioContext();
+
+		// Act + Assert:
+		for (auto i = 0u; i < 2 * Num_Default_Threads; ++i)
+			EXPECT_EQ(pIoContext, &pPool->ioContext()) << "call " << i;
+	}
+
+	namespace {
+		template<typename TAccessor>
+		void AssertPerWorkerPoolReturnsWorkerIoContextsRoundRobin(TAccessor accessor) {
+			// Arrange:
+			auto pPool = CreatePerWorkerIoThreadPool();
+
+			// Act:
+			std::vector<boost::asio::io_context*> ioContexts;
+			for (auto i = 0u; i < 2 * Num_Default_Threads; ++i)
+				ioContexts.push_back(&accessor(*pPool));
+
+			// Assert: one io context per worker
+			std::set<boost::asio::io_context*> uniqueIoContexts(ioContexts.cbegin(), ioContexts.cend());
+			EXPECT_EQ(Num_Default_Threads, uniqueIoContexts.size());
+
+			for (auto i = 0u; i < Num_Default_Threads; ++i)
+				EXPECT_EQ(ioContexts[i], ioContexts[Num_Default_Threads + i]) << "call " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, PerWorkerPoolIoContextReturnsWorkerIoContextsRoundRobin) {
+		AssertPerWorkerPoolReturnsWorkerIoContextsRoundRobin([](auto& pool) -> boost::asio::io_context& { return pool.ioContext(); });
+	}
+
+	TEST(TEST_CLASS, PerWorkerPoolNextIoContextReturnsWorkerIoContextsRoundRobin) {
+		AssertPerWorkerPoolReturnsWorkerIoContextsRoundRobin([](auto& pool) -> boost::asio::io_context& { return pool.nextIoContext(); });
+	}
+
+	TEST(TEST_CLASS, PerWorkerPoolIoContextAndNextIoContextShareRoundRobinPosition) {
+		// Arrange:
+		auto pPool = CreatePerWorkerIoThreadPool();
+
+		// Act: alternate between accessors
+		std::vector<boost::asio::io_context*> ioContexts;
+		for (auto i = 0u; i < Num_Default_Threads; ++i)
+			ioContexts.push_back(0 == i % 2 ? &pPool->ioContext() : &pPool->nextIoContext());
+
+		// Assert: all workers were selected
+		EXPECT_EQ(Num_Default_Threads, std::set<boost::asio::io_context*>(ioContexts.cbegin(), ioContexts.cend()).size());
+	}
+
+	namespace {
+		void AssertPerWorkerPoolRunsEachIoContextOnSingleThread(bool pinWorkerThreads) {
+			// Arrange:
+			auto pPool = CreatePerWorkerIoThreadPool(pinWorkerThreads);
+			pPool->start();
+
+			// Act: post 10 work items on each io context
+			std::vector<std::vector<std::thread::id>> threadIds(Num_Default_Threads);
+			for (auto& contextThreadIds : threadIds) {
+				auto& ioContext = pPool->nextIoContext();
+				for (auto i = 0u; i < 10; ++i)
+					boost::asio::post(ioContext, [&contextThreadIds]() { contextThreadIds.push_back(std::this_thread::get_id()); });
+			}
+
+			pPool->join();
+
+			// Assert: all work items posted to the same io context were executed by the same thread
+			std::set<std::thread::id> uniqueThreadIds;
+			for (const auto& contextThreadIds : threadIds) {
+				ASSERT_EQ(10u, contextThreadIds.size());
+				EXPECT_EQ(1u, std::set<std::thread::id>(contextThreadIds.cbegin(), contextThreadIds.cend()).size());
+				uniqueThreadIds.insert(contextThreadIds[0]);
+			}
+
+			// - each io context was executed by a different thread
+			EXPECT_EQ(Num_Default_Threads, uniqueThreadIds.size());
+		}
+	}
+
+	TEST(TEST_CLASS, PerWorkerPoolRunsEachIoContextOnSingleThread) {
+		AssertPerWorkerPoolRunsEachIoContextOnSingleThread(false);
+	}
+
+	TEST(TEST_CLASS, PerWorkerPoolRunsEachIoContextOnSingleThread_Pinned) {
+		AssertPerWorkerPoolRunsEachIoContextOnSingleThread(true);
+	}
+
+	TEST(TEST_CLASS, PerWorkerPoolCanBeRestarted) {
+		// Arrange: set up a pool
+		auto pPool = CreatePerWorkerIoThreadPool();
+		pPool->start();
+
+		// Act: restart the pool
+		pPool->join();
+		pPool->start();
+
+		// - post work on all io contexts
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < Num_Default_Threads; ++i)
+			boost::asio::post(pPool->nextIoContext(), [&]() { ++numHandlerCalls; });
+
+		pPool->join();
+
+		// Assert: all work items were processed
+		EXPECT_EQ(Num_Default_Threads, numHandlerCalls);
+	}
+
+	// endregion
 }}
@@ -117,6 +117,21 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(0u, pool.numServices());
 	}
 
+	TEST(TEST_CLASS, CanCreatePoolWithCustomOptions) {
+		// Arrange:
+		IoThreadPoolOptions options;
+		options.Mode = IoThreadPoolMode::Per_Worker;
+
+		// Act:
+		MultiServicePool pool("foo", 3, options, MultiServicePool::IsolatedPoolMode::Disabled);
+		auto* pPool = pool.pushIsolatedPool("pool", 2);
+
+		// Assert: isolated pool mode is disabled, so the primary pool is returned, which has one io context per worker
+		EXPECT_EQ(3u, pool.numWorkerThreads());
+		EXPECT_EQ(3u, pPool->numWorkerThreads());
+		EXPECT_NE(&pPool->nextIoContext(), &pPool->nextIoContext());
+	}
+
 	TEST(TEST_CLASS, CanCreatePoolWithDefaultNumberOfThreads) {
 		// Act:
 		MultiServicePool pool("foo", MultiServicePool::DefaultPoolConcurrency());
@@ -229,6 +244,22 @@ namespace catapult { namespace thread {
 		});
 	}
 
+	TEST(TEST_CLASS, CanAddSingleIsolatedPoolWithCustomOptions) {
+		// Arrange:
+		MultiServicePool pool("foo", 3);
+
+		IoThreadPoolOptions options;
+		options.Mode = IoThreadPoolMode::Per_Worker;
+
+		// Act:
+		auto* pIsolatedPool = pool.pushIsolatedPool("pool", 2, options);
+
+		// Assert: the isolated pool has one io context per worker
+		EXPECT_EQ(5u, pool.numWorkerThreads());
+		EXPECT_EQ(2u, pIsolatedPool->numWorkerThreads());
+		EXPECT_NE(&pIsolatedPool->nextIoContext(), &pIsolatedPool->nextIoContext());
+	}
+
 	namespace {
 		template<typename TCreatePool>
 		void AssertCanAddSingleMergedPool(TCreatePool createIsolatedPool) {
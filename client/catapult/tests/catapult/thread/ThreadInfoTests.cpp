@@ -22,6 +22,10 @@
 #include "catapult/thread/ThreadInfo.h"
 #include "tests/TestHarness.h"
 #include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace catapult { namespace thread {
 
@@ -52,4 +56,39 @@ namespace catapult { namespace thread {
 		// Assert: the long thread name is truncated
 		EXPECT_EQ(std::string(GetMaxThreadNameLength(), 'a'), threadName);
 	}
+
+#ifdef __linux__
+
+	TEST(TEST_CLASS, CanSetThreadAffinity) {
+		// Arrange:
+		auto isPinned = false;
+		auto numCpus = 0;
+		std::thread([&isPinned, &numCpus] {
+			// Act:
+			isPinned = SetThreadAffinity(0);
+
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+			numCpus = CPU_COUNT(&cpuSet);
+		}).join();
+
+		// Assert:
+		EXPECT_TRUE(isPinned);
+		EXPECT_EQ(1, numCpus);
+	}
+
+#endif
+
+	TEST(TEST_CLASS, CannotSetThreadAffinityToUnknownCpu) {
+		// Arrange:
+		auto isPinned = true;
+		std::thread([&isPinned] {
+			// Act:
+			isPinned = SetThreadAffinity(std::numeric_limits<size_t>::max());
+		}).join();
+
+		// Assert:
+		EXPECT_FALSE(isPinned);
+	}
 }}
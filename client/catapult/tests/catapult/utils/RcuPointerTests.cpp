@@ -0,0 +1,133 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/RcuPointer.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS RcuPointerTests
+
+	TEST(TEST_CLASS, CanCreateEmptyPointer) {
+		// Act:
+		RcuPointer<int> pointer;
+
+		// Assert:
+		EXPECT_FALSE(!!pointer.pin());
+	}
+
+	TEST(TEST_CLASS, CanCreatePointerAroundInitialVersion) {
+		// Act:
+		RcuPointer<int> pointer(std::make_shared<const int>(17));
+
+		// Assert:
+		auto pValue = pointer.pin();
+		ASSERT_TRUE(!!pValue);
+		EXPECT_EQ(17, *pValue);
+	}
+
+	TEST(TEST_CLASS, PublishReplacesCurrentVersion) {
+		// Arrange:
+		RcuPointer<int> pointer(std::make_shared<const int>(17));
+
+		// Act:
+		pointer.publish(std::make_shared<const int>(25));
+
+		// Assert:
+		auto pValue = pointer.pin();
+		ASSERT_TRUE(!!pValue);
+		EXPECT_EQ(25, *pValue);
+	}
+
+	TEST(TEST_CLASS, PinnedVersionIsUnaffectedByPublish) {
+		// Arrange:
+		RcuPointer<int> pointer(std::make_shared<const int>(17));
+		auto pPinnedValue = pointer.pin();
+
+		// Act:
+		pointer.publish(std::make_shared<const int>(25));
+
+		// Assert:
+		EXPECT_EQ(17, *pPinnedValue);
+		EXPECT_EQ(25, *pointer.pin());
+	}
+
+	TEST(TEST_CLASS, ReplacedVersionIsReclaimedWhenLastReaderUnpins) {
+		// Arrange:
+		RcuPointer<int> pointer(std::make_shared<const int>(17));
+		auto pPinnedValue = pointer.pin();
+		auto pWeakValue = std::weak_ptr<const int>(pPinnedValue);
+
+		// Act:
+		pointer.publish(std::make_shared<const int>(25));
+
+		// Sanity:
+		EXPECT_FALSE(pWeakValue.expired());
+
+		// Act:
+		pPinnedValue.reset();
+
+		// Assert:
+		EXPECT_TRUE(pWeakValue.expired());
+	}
+
+	TEST(TEST_CLASS, ReadersAlwaysPinConsistentVersionsWhileWriterPublishes) {
+		// Arrange: each version is a pair of values that are always equal
+		using VersionType = std::pair<uint32_t, uint32_t>;
+		constexpr uint32_t Num_Versions = 1000;
+		RcuPointer<VersionType> pointer(std::make_shared<const VersionType>(0u, 0u));
+
+		std::atomic<uint32_t> numInconsistentVersions(0);
+		std::atomic<uint32_t> numOutOfOrderVersions(0);
+		thread::ThreadGroup threads;
+
+		// Act:
+		for (auto i = 0u; i < test::GetNumDefaultPoolThreads(); ++i) {
+			threads.spawn([&pointer, &numInconsistentVersions, &numOutOfOrderVersions]() {
+				uint32_t lastVersion = 0;
+				while (lastVersion < Num_Versions) {
+					auto pVersion = pointer.pin();
+					if (pVersion->first != pVersion->second)
+						++numInconsistentVersions;
+
+					if (pVersion->first < lastVersion)
+						++numOutOfOrderVersions;
+
+					lastVersion = pVersion->first;
+				}
+			});
+		}
+
+		threads.spawn([&pointer]() {
+			for (auto i = 1u; i <= Num_Versions; ++i)
+				pointer.publish(std::make_shared<const VersionType>(i, i));
+		});
+
+		threads.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numInconsistentVersions);
+		EXPECT_EQ(0u, numOutOfOrderVersions);
+		EXPECT_EQ(VersionType(Num_Versions, Num_Versions), *pointer.pin());
+	}
+}}
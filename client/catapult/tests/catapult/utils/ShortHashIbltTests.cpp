@@ -0,0 +1,305 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ShortHashIblt.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ShortHashIbltTests
+
+	namespace {
+		std::vector<ShortHash> CreateShortHashes(uint32_t start, uint32_t count) {
+			std::vector<ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(ShortHash((start + i) * 0x9E3779B1u));
+
+			return shortHashes;
+		}
+
+		ShortHashIblt CreateTable(size_t numCells, const std::vector<ShortHash>& shortHashes) {
+			ShortHashIblt iblt(numCells);
+			for (const auto& shortHash : shortHashes)
+				iblt.insert(shortHash);
+
+			return iblt;
+		}
+
+		ShortHashesSet ToSet(const std::vector<ShortHash>& shortHashes) {
+			return ShortHashesSet(shortHashes.cbegin(), shortHashes.cend());
+		}
+
+		void AssertEmpty(const ShortHashIblt& iblt) {
+			for (auto i = 0u; i < iblt.size(); ++i) {
+				const auto& cell = iblt.data()[i];
+				EXPECT_EQ(0, cell.Count) << "cell at " << i;
+				EXPECT_EQ(ShortHash(), cell.KeySum) << "cell at " << i;
+				EXPECT_EQ(0u, cell.CheckSum) << "cell at " << i;
+			}
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CellHasExpectedSize) {
+		EXPECT_EQ(12u, sizeof(ShortHashIblt::Cell));
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyTable) {
+		// Act:
+		ShortHashIblt iblt(30);
+
+		// Assert:
+		EXPECT_EQ(30u, iblt.size());
+		AssertEmpty(iblt);
+	}
+
+	TEST(TEST_CLASS, NumberOfCellsIsRoundedUpToMultipleOfNumberOfHashes) {
+		EXPECT_EQ(3u, ShortHashIblt(0).size());
+		EXPECT_EQ(3u, ShortHashIblt(1).size());
+		EXPECT_EQ(30u, ShortHashIblt(28).size());
+		EXPECT_EQ(30u, ShortHashIblt(29).size());
+		EXPECT_EQ(33u, ShortHashIblt(31).size());
+	}
+
+	TEST(TEST_CLASS, CanCreateTableAroundCells) {
+		// Arrange:
+		auto source = CreateTable(30, CreateShortHashes(1, 5));
+
+		// Act:
+		ShortHashIblt iblt(source.data(), source.size());
+
+		// Assert:
+		ASSERT_EQ(30u, iblt.size());
+		EXPECT_EQ_MEMORY(source.data(), iblt.data(), 30 * sizeof(ShortHashIblt::Cell));
+	}
+
+	TEST(TEST_CLASS, CannotCreateTableAroundInvalidNumberOfCells) {
+		// Arrange:
+		auto source = CreateTable(30, CreateShortHashes(1, 5));
+
+		// Act + Assert:
+		EXPECT_THROW(ShortHashIblt(source.data(), 0), catapult_invalid_argument);
+		EXPECT_THROW(ShortHashIblt(source.data(), 29), catapult_invalid_argument);
+		EXPECT_THROW(ShortHashIblt(source.data(), 28), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region insert
+
+	TEST(TEST_CLASS, InsertUpdatesNumberOfHashesCells) {
+		// Act:
+		auto iblt = CreateTable(30, CreateShortHashes(1, 1));
+
+		// Assert:
+		auto numNonEmptyCells = 0u;
+		for (auto i = 0u; i < iblt.size(); ++i) {
+			const auto& cell = iblt.data()[i];
+			if (0 == cell.Count)
+				continue;
+
+			++numNonEmptyCells;
+			EXPECT_EQ(1, cell.Count);
+			EXPECT_EQ(CreateShortHashes(1, 1)[0], cell.KeySum);
+		}
+
+		EXPECT_EQ(ShortHashIblt::Num_Hashes, numNonEmptyCells);
+	}
+
+	// endregion
+
+	// region subtract
+
+	TEST(TEST_CLASS, SubtractingEqualTablesProducesEmptyTable) {
+		// Arrange:
+		auto shortHashes = CreateShortHashes(1, 100);
+		auto iblt = CreateTable(30, shortHashes);
+
+		// Act:
+		iblt.subtract(CreateTable(30, shortHashes));
+
+		// Assert:
+		AssertEmpty(iblt);
+	}
+
+	TEST(TEST_CLASS, CannotSubtractTablesWithDifferentSizes) {
+		// Arrange:
+		ShortHashIblt iblt(30);
+
+		// Act + Assert:
+		EXPECT_THROW(iblt.subtract(ShortHashIblt(33)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region decode
+
+	TEST(TEST_CLASS, CanDecodeEmptyTable) {
+		// Act:
+		auto result = ShortHashIblt(30).decode();
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_TRUE(result.Positive.empty());
+		EXPECT_TRUE(result.Negative.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeTableWithFewShortHashes) {
+		// Arrange:
+		auto shortHashes = CreateShortHashes(1, 10);
+		auto iblt = CreateTable(30, shortHashes);
+
+		// Act:
+		auto result = iblt.decode();
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_EQ(ToSet(shortHashes), result.Positive);
+		EXPECT_TRUE(result.Negative.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeSetDifferenceOfLargeSets) {
+		// Arrange: sets share 10000 short hashes and each has 10 unique short hashes
+		auto commonShortHashes = CreateShortHashes(1, 10000);
+		auto localShortHashes = commonShortHashes;
+		auto remoteShortHashes = commonShortHashes;
+		auto localOnlyShortHashes = CreateShortHashes(20000, 10);
+		auto remoteOnlyShortHashes = CreateShortHashes(30000, 10);
+		localShortHashes.insert(localShortHashes.end(), localOnlyShortHashes.cbegin(), localOnlyShortHashes.cend());
+		remoteShortHashes.insert(remoteShortHashes.end(), remoteOnlyShortHashes.cbegin(), remoteOnlyShortHashes.cend());
+
+		auto iblt = CreateTable(60, localShortHashes);
+
+		// Act:
+		iblt.subtract(CreateTable(60, remoteShortHashes));
+		auto result = iblt.decode();
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_EQ(ToSet(localOnlyShortHashes), result.Positive);
+		EXPECT_EQ(ToSet(remoteOnlyShortHashes), result.Negative);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeTableWhenSetDifferenceIsTooLarge) {
+		// Arrange:
+		auto iblt = CreateTable(30, CreateShortHashes(1, 1000));
+
+		// Act:
+		auto result = iblt.decode();
+
+		// Assert:
+		EXPECT_FALSE(result.IsDecoded);
+	}
+
+	namespace {
+		std::vector<ShortHashIblt::Cell> CopyCells(const ShortHashIblt& iblt) {
+			return std::vector<ShortHashIblt::Cell>(iblt.data(), iblt.data() + iblt.size());
+		}
+
+		std::vector<size_t> FindMappedCellIndexes(size_t numCells, ShortHash shortHash) {
+			auto iblt = CreateTable(numCells, { shortHash });
+
+			std::vector<size_t> indexes;
+			for (auto i = 0u; i < iblt.size(); ++i) {
+				if (0 != iblt.data()[i].Count)
+					indexes.push_back(i);
+			}
+
+			return indexes;
+		}
+
+		ShortHashIblt::Cell CreatePureCell(int32_t count, ShortHash shortHash) {
+			// every cell of a table with a single partition cell per hash is mapped to the short hash
+			auto cell = CreateTable(ShortHashIblt::Num_Hashes, { shortHash }).data()[0];
+			cell.Count = count;
+			return cell;
+		}
+
+		void AssertCannotDecode(const std::vector<ShortHashIblt::Cell>& cells) {
+			// Act:
+			auto result = ShortHashIblt(cells.data(), cells.size()).decode();
+
+			// Assert:
+			EXPECT_FALSE(result.IsDecoded);
+			EXPECT_TRUE(result.Positive.empty());
+			EXPECT_TRUE(result.Negative.empty());
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDecodeTableWithPureCellThatIsRepeatedlyPeeled) {
+		// Arrange: negative pure cell at first mapped index and no other mapped cells
+		//          peeling it produces two positive pure cells, and peeling either of them makes the first cell pure again
+		auto shortHash = CreateShortHashes(1, 1)[0];
+		auto indexes = FindMappedCellIndexes(30, shortHash);
+		auto cells = CopyCells(ShortHashIblt(30));
+		cells[indexes[0]] = CreatePureCell(-1, shortHash);
+
+		// Act + Assert:
+		AssertCannotDecode(cells);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeTableWithPureCellThatIsNotMappedToItsShortHash) {
+		// Arrange: insert a short hash and add a pure cell for it at an index that it is not mapped to
+		auto shortHash = CreateShortHashes(1, 1)[0];
+		auto indexes = FindMappedCellIndexes(30, shortHash);
+		auto cells = CopyCells(CreateTable(30, { shortHash }));
+
+		auto unmappedIndex = 0u;
+		while (indexes.cend() != std::find(indexes.cbegin(), indexes.cend(), unmappedIndex))
+			++unmappedIndex;
+
+		cells[unmappedIndex] = CreatePureCell(1, shortHash);
+
+		// Act + Assert:
+		AssertCannotDecode(cells);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeTableWithRandomPureCells) {
+		for (auto i = 0u; i < 100; ++i) {
+			// Arrange: every cell is pure but contains a random short hash
+			std::vector<ShortHashIblt::Cell> cells;
+			for (auto j = 0u; j < 30; ++j)
+				cells.push_back(CreatePureCell(0 == test::RandomByte() % 2 ? 1 : -1, test::GenerateRandomValue<ShortHash>()));
+
+			// Act:
+			auto result = ShortHashIblt(cells.data(), cells.size()).decode();
+
+			// Assert: decoding terminates without reporting more short hashes than cells
+			EXPECT_FALSE(result.IsDecoded) << "table at " << i;
+			EXPECT_GE(cells.size(), result.Positive.size() + result.Negative.size()) << "table at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, DecodeDoesNotModifyTable) {
+		// Arrange:
+		auto iblt = CreateTable(30, CreateShortHashes(1, 10));
+		auto originalCells = std::vector<ShortHashIblt::Cell>(iblt.data(), iblt.data() + iblt.size());
+
+		// Act:
+		iblt.decode();
+
+		// Assert:
+		EXPECT_EQ_MEMORY(originalCells.data(), iblt.data(), iblt.size() * sizeof(ShortHashIblt::Cell));
+	}
+
+	// endregion
+}}
@@ -45,7 +45,7 @@ namespace catapult { namespace io {
 			return Height(GetNumIterations() + 1);
 		}
 
-		void RunMultithreadedReadWriteTest(size_t numReaders) {
+		void RunMultithreadedReadWriteTest(size_t numReaders, size_t numBlocksPerSave = 1) {
 			// Arrange:
 			// - prepare and create the storage
 			test::TempDirectoryGuard tempDir;
@@ -82,12 +82,24 @@ namespace catapult { namespace io {
 			threads.spawn([&] {
 				test::StressThreadLogger logger("writer thread");
 
-				for (auto i = 0u; i < GetNumIterations(); ++i) {
+				for (auto i = 0u; i < GetNumIterations(); i += static_cast<uint32_t>(numBlocksPerSave)) {
 					logger.notifyIteration(i, GetNumIterations());
-					auto pNextBlock = test::GenerateBlockWithTransactions(0, Height(2 + i));
+
+					auto numBlocks = std::min<size_t>(numBlocksPerSave, GetNumIterations() - i);
+					std::vector<std::unique_ptr<model::Block>> blocks;
+					std::vector<model::BlockElement> blockElements;
+					for (auto j = 0u; j < numBlocks; ++j)
+						blocks.push_back(test::GenerateBlockWithTransactions(0, Height(2 + i + j)));
+
+					for (const auto& pBlock : blocks)
+						blockElements.push_back(test::BlockToBlockElement(*pBlock));
 
 					auto modifier = storage.modifier();
-					modifier.saveBlock(test::BlockToBlockElement(*pNextBlock));
+					if (1 == numBlocksPerSave)
+						modifier.saveBlock(blockElements[0]);
+					else
+						modifier.saveBlocks(blockElements);
+
 					modifier.commit();
 				}
 			});
@@ -110,4 +122,12 @@ namespace catapult { namespace io {
 	NO_STRESS_TEST(TEST_CLASS, StorageIsThreadSafeWithMultipleReadersSingleWriter) {
 		RunMultithreadedReadWriteTest(test::GetNumDefaultPoolThreads());
 	}
+
+	NO_STRESS_TEST(TEST_CLASS, StorageIsThreadSafeWithSingleReaderSingleGroupCommitWriter) {
+		RunMultithreadedReadWriteTest(1, 7);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StorageIsThreadSafeWithMultipleReadersSingleGroupCommitWriter) {
+		RunMultithreadedReadWriteTest(test::GetNumDefaultPoolThreads(), 7);
+	}
 }}
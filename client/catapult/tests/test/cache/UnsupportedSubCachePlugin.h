@@ -118,7 +118,7 @@ namespace catapult { namespace test {
 		}
 
 		[[noreturn]]
-		void commit() override {
+		void commit(Height) override {
 			CATAPULT_THROW_RUNTIME_ERROR("commit is not supported");
 		}
 
@@ -29,6 +29,7 @@
 #include "catapult/model/BlockUtils.h"
 #include "catapult/constants.h"
 #include "tests/test/nodeps/Nemesis.h"
+#include "tests/test/nodeps/TestConstants.h"
 #include "tests/TestHarness.h"
 #include <numeric>
 
@@ -337,6 +338,126 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region loadBlockRange
+
+	private:
+		static void AssertBlocks(
+				const io::BlockStorage& storage,
+				Height startHeight,
+				size_t expectedNumBlocks,
+				const std::vector<std::shared_ptr<const model::Block>>& blocks) {
+			ASSERT_EQ(expectedNumBlocks, blocks.size());
+
+			for (auto i = 0u; i < blocks.size(); ++i) {
+				auto pExpectedBlock = storage.loadBlock(startHeight + Height(i));
+				EXPECT_EQ(*pExpectedBlock, *blocks[i]) << "block at " << i;
+			}
+		}
+
+		static size_t SumBlockSizes(const io::BlockStorage& storage, Height startHeight, size_t numBlocks) {
+			size_t totalSize = 0;
+			for (auto i = 0u; i < numBlocks; ++i)
+				totalSize += storage.loadBlock(startHeight + Height(i))->Size;
+
+			return totalSize;
+		}
+
+	public:
+		static void AssertLoadBlockRange_CanLoadSingleBlock() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlockRange(Height(5), 1, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			AssertBlocks(*pStorage, Height(5), 1, blocks);
+		}
+
+		static void AssertLoadBlockRange_LoadsAtMostMaxBlocks() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlockRange(Height(2), 6, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			AssertBlocks(*pStorage, Height(2), 6, blocks);
+		}
+
+		static void AssertLoadBlockRange_LoadsAreBoundedByLastBlock() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlockRange(Height(5), 10, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			AssertBlocks(*pStorage, Height(5), 6, blocks);
+		}
+
+		static void AssertLoadBlockRange_LoadsAreBoundedByMaxBytes() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto maxBytes = SumBlockSizes(*pStorage, Height(3), 4);
+
+			// Act:
+			auto blocks1 = pStorage->loadBlockRange(Height(3), 10, maxBytes);
+			auto blocks2 = pStorage->loadBlockRange(Height(3), 10, maxBytes - 1);
+
+			// Assert:
+			AssertBlocks(*pStorage, Height(3), 4, blocks1);
+			AssertBlocks(*pStorage, Height(3), 3, blocks2);
+		}
+
+		static void AssertLoadBlockRange_AlwaysLoadsFirstBlock() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlockRange(Height(3), 10, 0);
+
+			// Assert:
+			AssertBlocks(*pStorage, Height(3), 1, blocks);
+		}
+
+		static void AssertLoadBlockRange_LoadsNoBlocksWhenMaxBlocksIsZero() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blocks = pStorage->loadBlockRange(Height(3), 0, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			EXPECT_TRUE(blocks.empty());
+		}
+
+		static void AssertLoadBlockRange_CannotLoadAtHeightGreaterThanChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act + Assert:
+			EXPECT_THROW(pStorage->loadBlockRange(Height(11), 1, std::numeric_limits<size_t>::max()), catapult_invalid_argument);
+		}
+
+		static void AssertLoadBlockRange_LoadsCanCrossFileBoundary() {
+			// Arrange:
+			constexpr auto Start_Height = File_Database_Batch_Size - 5;
+
+			StorageContext context;
+			context.pTempDirectoryGuard = std::make_unique<typename TTraits::Guard>();
+			context.pStorage = TTraits::PrepareStorage(context.pTempDirectoryGuard->name(), Height(Start_Height));
+			SeedBlocks(*context.pStorage, Height(Start_Height), Height(Start_Height + 10));
+
+			// Act:
+			auto blocks = context.pStorage->loadBlockRange(Height(Start_Height + 1), 8, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			AssertBlocks(*context.pStorage, Height(Start_Height + 1), 8, blocks);
+		}
+
+		// endregion
+
 		// region saveBlock - statements
 
 	private:
@@ -655,6 +776,15 @@ namespace catapult { namespace test {
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadHashesFrom_LoadsAreBoundedByLastBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadHashesFrom_LoadsCanCrossIndexFileBoundary) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_CanLoadSingleBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_LoadsAtMostMaxBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_LoadsAreBoundedByLastBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_LoadsAreBoundedByMaxBytes) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_AlwaysLoadsFirstBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_LoadsNoBlocksWhenMaxBlocksIsZero) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_CannotLoadAtHeightGreaterThanChainHeight) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockRange_LoadsCanCrossFileBoundary) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithoutStatements) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithOnlyTransactionStatements) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithOnlyAddressResolutions) \
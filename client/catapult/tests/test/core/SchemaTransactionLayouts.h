@@ -0,0 +1,86 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+// Code generated by catbuffer cpp layout generator; DO NOT EDIT.
+
+#pragma once
+#include "catapult/model/EntityType.h"
+
+namespace catapult { namespace test {
+
+	/// Fixed size layout of a transaction described by the catbuffer schemas.
+	struct SchemaTransactionLayout {
+		/// Transaction type.
+		model::EntityType Type;
+
+		/// Transaction version.
+		uint8_t Version;
+
+		/// Size of the fixed portion of the top-level transaction.
+		uint32_t Size;
+
+		/// Size of the fixed portion of the embedded transaction (zero when transaction cannot be embedded).
+		uint32_t EmbeddedSize;
+	};
+
+	/// Transaction layouts described by the catbuffer schemas.
+	constexpr SchemaTransactionLayout Schema_Transaction_Layouts[] = {
+		{ static_cast<model::EntityType>(0x4141), 1, 168, 0 }, // AggregateCompleteTransactionV1
+		{ static_cast<model::EntityType>(0x4141), 2, 168, 0 }, // AggregateCompleteTransactionV2
+		{ static_cast<model::EntityType>(0x4143), 1, 169, 89 }, // VotingKeyLinkTransactionV1
+		{ static_cast<model::EntityType>(0x4144), 1, 164, 84 }, // AccountMetadataTransactionV1
+		{ static_cast<model::EntityType>(0x4148), 1, 184, 104 }, // HashLockTransactionV1
+		{ static_cast<model::EntityType>(0x414C), 1, 161, 81 }, // AccountKeyLinkTransactionV1
+		{ static_cast<model::EntityType>(0x414D), 1, 150, 70 }, // MosaicDefinitionTransactionV1
+		{ static_cast<model::EntityType>(0x414E), 1, 146, 66 }, // NamespaceRegistrationTransactionV1
+		{ static_cast<model::EntityType>(0x4150), 1, 136, 56 }, // AccountAddressRestrictionTransactionV1
+		{ static_cast<model::EntityType>(0x4151), 1, 170, 90 }, // MosaicGlobalRestrictionTransactionV1
+		{ static_cast<model::EntityType>(0x4152), 1, 209, 129 }, // SecretLockTransactionV1
+		{ static_cast<model::EntityType>(0x4154), 1, 160, 80 }, // TransferTransactionV1
+		{ static_cast<model::EntityType>(0x4155), 1, 136, 56 }, // MultisigAccountModificationTransactionV1
+		{ static_cast<model::EntityType>(0x4241), 1, 168, 0 }, // AggregateBondedTransactionV1
+		{ static_cast<model::EntityType>(0x4241), 2, 168, 0 }, // AggregateBondedTransactionV2
+		{ static_cast<model::EntityType>(0x4243), 1, 161, 81 }, // VrfKeyLinkTransactionV1
+		{ static_cast<model::EntityType>(0x4244), 1, 172, 92 }, // MosaicMetadataTransactionV1
+		{ static_cast<model::EntityType>(0x424C), 1, 161, 81 }, // NodeKeyLinkTransactionV1
+		{ static_cast<model::EntityType>(0x424D), 1, 145, 65 }, // MosaicSupplyChangeTransactionV1
+		{ static_cast<model::EntityType>(0x424E), 1, 161, 81 }, // AddressAliasTransactionV1
+		{ static_cast<model::EntityType>(0x4250), 1, 136, 56 }, // AccountMosaicRestrictionTransactionV1
+		{ static_cast<model::EntityType>(0x4251), 1, 184, 104 }, // MosaicAddressRestrictionTransactionV1
+		{ static_cast<model::EntityType>(0x4252), 1, 187, 107 }, // SecretProofTransactionV1
+		{ static_cast<model::EntityType>(0x4344), 1, 172, 92 }, // NamespaceMetadataTransactionV1
+		{ static_cast<model::EntityType>(0x434D), 1, 168, 88 }, // MosaicSupplyRevocationTransactionV1
+		{ static_cast<model::EntityType>(0x434E), 1, 145, 65 }, // MosaicAliasTransactionV1
+		{ static_cast<model::EntityType>(0x4350), 1, 136, 56 }, // AccountOperationRestrictionTransactionV1
+	};
+
+	/// Gets the size of the fixed portion of the transaction with \a type and \a version as described by the catbuffer schemas
+	/// or zero if no such transaction is described.
+	/// \note The embedded transaction size is returned when \a isEmbedded is \c true.
+	constexpr uint32_t GetSchemaTransactionSize(model::EntityType type, uint8_t version, bool isEmbedded) {
+		for (const auto& layout : Schema_Transaction_Layouts) {
+			if (type == layout.Type && version == layout.Version)
+				return isEmbedded ? layout.EmbeddedSize : layout.Size;
+		}
+
+		return 0;
+	}
+}}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "AddressTestUtils.h"
+#include "SchemaTransactionLayouts.h"
 #include "catapult/model/Cosignature.h"
 #include "catapult/model/RangeTypes.h"
 #include "tests/TestHarness.h"
@@ -86,6 +87,14 @@ namespace catapult { namespace test {
 			const std::vector<model::Cosignature>& actualCosignatures,
 			const std::string& message = "");
 
+	/// Asserts that the size of \a TTransaction matches the size of its fixed portion as described by the catbuffer schemas.
+	template<typename TTransaction>
+	void AssertTransactionHasSchemaSize() {
+		constexpr auto Is_Embedded = std::is_base_of_v<model::EmbeddedTransaction, TTransaction>;
+		constexpr auto Schema_Size = GetSchemaTransactionSize(TTransaction::Entity_Type, TTransaction::Current_Version, Is_Embedded);
+		static_assert(sizeof(TTransaction) == Schema_Size, "transaction layout does not match catbuffer schema");
+	}
+
 /// Adds basic transaction property tests for \a NAME transaction with custom arguments.
 #define ADD_BASIC_TRANSACTION_PROPERTY_TESTS_WITH_ARGS(NAME, ...) \
 	TEST(NAME##TransactionTests, TransactionHasExpectedProperties) { \
@@ -127,4 +136,13 @@ namespace catapult { namespace test {
 	TEST(NAME##TransactionTests, EmbeddedTransactionHasExpectedSize) { \
 		AssertTransactionHasExpectedSize<Embedded##NAME##Transaction>(sizeof(EmbeddedTransaction)); \
 	}
+
+/// Adds tests asserting that the sizes of \a NAME transactions match the catbuffer schemas.
+#define ADD_SCHEMA_TRANSACTION_SIZE_TESTS(NAME) \
+	TEST(NAME##TransactionTests, TransactionHasSchemaSize) { \
+		test::AssertTransactionHasSchemaSize<NAME##Transaction>(); \
+	} \
+	TEST(NAME##TransactionTests, EmbeddedTransactionHasSchemaSize) { \
+		test::AssertTransactionHasSchemaSize<Embedded##NAME##Transaction>(); \
+	}
 }}
@@ -28,6 +28,11 @@ namespace catapult { namespace mocks {
 
 	/// Mock block change subscriber implementation.
 	class MockBlockChangeSubscriber : public io::BlockChangeSubscriber {
+	public:
+		/// Creates a subscriber.
+		MockBlockChangeSubscriber() : m_numFlushes(0)
+		{}
+
 	public:
 		/// Gets the captured block element pointers.
 		const auto& blockElements() const {
@@ -44,6 +49,11 @@ namespace catapult { namespace mocks {
 			return m_dropBlocksAfterHeights;
 		}
 
+		/// Gets the number of flush calls.
+		size_t numFlushes() const {
+			return m_numFlushes;
+		}
+
 	public:
 		void notifyBlock(const model::BlockElement& blockElement) override {
 			m_blockElements.push_back(&blockElement);
@@ -54,6 +64,10 @@ namespace catapult { namespace mocks {
 			m_dropBlocksAfterHeights.push_back(height);
 		}
 
+		void flush() override {
+			++m_numFlushes;
+		}
+
 	private:
 		std::unique_ptr<model::BlockElement> copy(const model::BlockElement& blockElement) {
 			// notice that this only copies block parts of blockElement (it does not copy Transactions)
@@ -71,5 +85,6 @@ namespace catapult { namespace mocks {
 		std::vector<std::unique_ptr<model::Block>> m_copiedBlocks;
 		std::vector<std::unique_ptr<model::BlockElement>> m_copiedBlockElements;
 		std::vector<Height> m_dropBlocksAfterHeights;
+		size_t m_numFlushes;
 	};
 }}
@@ -29,6 +29,7 @@
 #include "catapult/io/BufferInputStreamAdapter.h"
 #include "catapult/io/FileBlockStorage.h"
 #include "catapult/io/FileProofStorage.h"
+#include "catapult/io/ZstdPayloadCodec.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/EntityHasher.h"
 #include "catapult/thread/IoThreadPool.h"
@@ -347,7 +348,15 @@ namespace catapult { namespace tools { namespace verify {
 				pluginLoader.loadAll();
 
 				auto dataDirectory = (std::filesystem::path(resourcesPath) / config.User.DataDirectory).generic_string();
-				io::FileBlockStorage blockStorage(dataDirectory, config.Node.FileDatabaseBatchSize);
+				std::shared_ptr<const io::PayloadCodec> pPayloadCodec;
+				if (config.Node.EnableStorageCompression)
+					pPayloadCodec = io::CreateZstdPayloadCodec(static_cast<int>(config.Node.StorageCompressionLevel));
+
+				io::FileBlockStorage blockStorage(
+						dataDirectory,
+						config.Node.FileDatabaseBatchSize,
+						io::FileBlockStorageMode::Hash_Index,
+						pPayloadCodec);
 				io::FileProofStorage proofStorage(dataDirectory, config.Node.FileDatabaseBatchSize);
 
 				CATAPULT_LOG(important)
@@ -3,7 +3,7 @@ import sys
 from pathlib import Path
 
 from configuration import load_compiler_configuration, load_versions_map
-from dependency_flags import get_dependency_flags
+from dependency_flags import get_dependency_cmake_source_directory, get_dependency_flags
 
 SINGLE_COMMAND_SEPARATOR = ' \\\n    && '
 LAYER_TO_IMAGE_TAG_MAP = {'os': 'preimage1', 'boost': 'preimage2', 'deps': 'preimage3', 'test': '', 'conan': 'conan'}
@@ -207,6 +207,11 @@ class OptionsManager:
 
 		return self._cmake(descriptor)
 
+	def zstd(self):
+		descriptor = self.OptionsDescriptor()
+		descriptor.options += get_dependency_flags('facebook_zstd')
+		return self._cmake(descriptor)
+
 	def googletest(self):
 		descriptor = self.OptionsDescriptor()
 		descriptor.options += get_dependency_flags('google_googletest')
@@ -456,13 +461,19 @@ class LinuxSystemGenerator:
 			'cd {PROJECT}',
 			'mkdir _build',
 			'cd _build',
-			'cmake {OPTIONS} ..',
+			'cmake {OPTIONS} {SOURCE_DIRECTORY}',
 			'make -j 8',
 			'make install',
 			'cd ..',
 			'rm -rf {PROJECT}',
 			'echo \"force rebuild revision {REVISION}\"'
-		], ORGANIZATION=organization, PROJECT=project, VERSION=version, OPTIONS=' '.join(options), REVISION=revision)
+		],
+			ORGANIZATION=organization,
+			PROJECT=project,
+			VERSION=version,
+			OPTIONS=' '.join(options),
+			SOURCE_DIRECTORY=get_dependency_cmake_source_directory(f'{organization}_{project}'),
+			REVISION=revision)
 
 	@staticmethod
 	def add_openssl(options, configure):
@@ -495,6 +506,7 @@ class LinuxSystemGenerator:
 		self.add_git_dependency('zeromq', 'libzmq', self.options.libzmq())
 		self.add_git_dependency('zeromq', 'cppzmq', self.options.cppzmq())
 
+		self.add_git_dependency('facebook', 'zstd', self.options.zstd())
 		self.add_git_dependency('facebook', 'rocksdb', self.options.rocks())
 
 	def generate_phase_test(self):
@@ -573,7 +585,7 @@ class WindowsSystemGenerator:
 			'cd {PROJECT}',
 			'mkdir _build',
 			'cd _build',
-			'cmake {OPTIONS} -S .. -G "{GENERATOR}" -A x64 -DCMAKE_INSTALL_PREFIX={PREFIX_PATH} -DCMAKE_PREFIX_PATH={PREFIX_PATH}',
+			'cmake {OPTIONS} -S {SOURCE_DIRECTORY} -G "{GENERATOR}" -A x64 -DCMAKE_INSTALL_PREFIX={PREFIX_PATH} -DCMAKE_PREFIX_PATH={PREFIX_PATH}',
 			'cmake --build . -j 8 --config RelWithDebInfo --target install',
 			'cd ../..',
 			'rmdir /q /s {PROJECT}',
@@ -583,6 +595,7 @@ class WindowsSystemGenerator:
 			PROJECT=project,
 			VERSION=version,
 			OPTIONS=' '.join(package_options),
+			SOURCE_DIRECTORY=get_dependency_cmake_source_directory(f'{organization}_{project}'),
 			REVISION=revision,
 			PREFIX_PATH=prefix_path,
 			GENERATOR=generator)
@@ -620,6 +633,7 @@ class WindowsSystemGenerator:
 		self.add_git_dependency('zeromq', 'libzmq', self.options.libzmq())
 		self.add_git_dependency('zeromq', 'cppzmq', self.options.cppzmq())
 
+		self.add_git_dependency('facebook', 'zstd', self.options.zstd())
 		self.add_git_dependency('facebook', 'rocksdb', self.options.rocks())
 
 	def generate_phase_test(self):
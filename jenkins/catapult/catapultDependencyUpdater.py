@@ -19,6 +19,7 @@ DEPENDENCY_NAMES_MAP = {
 	'zeromq': ('zeromq_libzmq', None),
 	'cppzmq': ('zeromq_cppzmq', 'cppzmq'),
 	'rocksdb': ('facebook_rocksdb', 'RocksDB'),
+	'zstd': ('facebook_zstd', 'zstd'),
 	'openssl': ('openssl_openssl', 'OpenSSL')
 }
 DEPENDENCIES_NAME = DEPENDENCY_NAMES_MAP.keys()
@@ -93,6 +94,7 @@ class CatapultDependencyUpdater:
 			'cppzmq': ['extensions/zeromq/CMakeLists.txt'],
 			'openssl': ['CMakeLists.txt'],
 			'rocksdb': ['CMakeLists.txt'],
+			'zstd': ['CMakeLists.txt'],
 		}
 
 		for dependency_name, current_version, latest_version in dependencies_to_update:
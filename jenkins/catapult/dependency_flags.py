@@ -10,6 +10,8 @@ DEPENDENCY_FLAGS = {
 		'-DWITH_GFLAGS=OFF'
 	],
 
+	'facebook_zstd': ['-DZSTD_BUILD_PROGRAMS=OFF', '-DZSTD_BUILD_TESTS=OFF', '-DZSTD_BUILD_STATIC=OFF'],
+
 	'google_googletest': ['-DCMAKE_POSITION_INDEPENDENT_CODE=ON', '-DBUILD_GMOCK=OFF'],
 	'google_benchmark': ['-DBENCHMARK_ENABLE_GTEST_TESTS=OFF'],
 
@@ -44,6 +46,11 @@ WINDOWS_DEPENDENCY_FLAGS = {
 	'mongodb_mongo-cxx-driver': ['-DENABLE_TESTS=OFF']
 }
 
+# cmake source directories (relative to the _build directory) of dependencies without a CMakeLists.txt in their root directory
+DEPENDENCY_CMAKE_SOURCE_DIRECTORIES = {
+	'facebook_zstd': '../build/cmake'
+}
+
 
 def get_dependency_flags(dependency_name):
 	flags = DEPENDENCY_FLAGS.get(dependency_name, [])
@@ -51,3 +58,7 @@ def get_dependency_flags(dependency_name):
 		flags += WINDOWS_DEPENDENCY_FLAGS.get(dependency_name, [])
 
 	return flags
+
+
+def get_dependency_cmake_source_directory(dependency_name):
+	return DEPENDENCY_CMAKE_SOURCE_DIRECTORIES.get(dependency_name, '..')
@@ -2,7 +2,7 @@ import argparse
 from pathlib import Path
 
 from configuration import load_versions_map
-from dependency_flags import get_dependency_flags
+from dependency_flags import get_dependency_cmake_source_directory, get_dependency_flags
 from environment import EnvironmentManager
 from process import ProcessManager
 
@@ -103,7 +103,8 @@ class Builder:
 		if additional_cmake_options:
 			cmake_options += additional_cmake_options
 
-		self.process_manager.dispatch_subprocess(cmake_options + ['..'])
+		cmake_source_directory = get_dependency_cmake_source_directory(f'{organization}_{project}')
+		self.process_manager.dispatch_subprocess(cmake_options + [cmake_source_directory])
 		if EnvironmentManager.is_windows_platform():
 			self.process_manager.dispatch_subprocess(['cmake', '--build', '.', '-j', str(NUM_BUILD_CORES), '--target', 'install'])
 		else:
@@ -165,6 +166,7 @@ def main():
 		('mongodb', 'mongo-cxx-driver'),
 		('zeromq', 'libzmq'),
 		('zeromq', 'cppzmq'),
+		('facebook', 'zstd'),
 		('facebook', 'rocksdb')
 	]
 